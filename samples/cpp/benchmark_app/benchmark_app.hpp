@@ -37,6 +37,29 @@ static const char model_message[] =
     "Required. Path to an .xml/.onnx file with a trained model or to a .blob files with "
     "a trained compiled model.";
 
+/// @brief message for multi-model list argument
+static const char multi_model_message[] =
+    "Optional. Comma-separated list of model files to benchmark concurrently on one device, "
+    "e.g. how several workloads behave when they share a host. Overrides -m. Every model is "
+    "compiled separately and runs in parallel with the others; results are reported per model "
+    "and aggregated. Per-model configuration is set with -mm_nstreams and -mm_nireq.";
+
+/// @brief message for multi-model streams argument
+static const char multi_model_nstreams_message[] =
+    "Optional. Comma-separated list of stream numbers aligned with the -mm model list. "
+    "An empty entry compiles the model with the THROUGHPUT performance hint instead.";
+
+/// @brief message for multi-model requests argument
+static const char multi_model_nireq_message[] =
+    "Optional. Comma-separated list of infer request numbers aligned with the -mm model list. "
+    "An empty entry uses the optimal number reported by the compiled model.";
+
+/// @brief message for multi-model solo time argument
+static const char multi_model_solo_time_message[] =
+    "Optional. Time in seconds to additionally benchmark every model alone before the concurrent "
+    "run, so that the report includes the throughput retained under concurrency. Default value "
+    "is 0 (solo phase is disabled).";
+
 /// @brief message for performance hint
 static const char hint_message[] =
     "Optional. Performance hint allows the OpenVINO device to select the right model-specific settings.\n"
@@ -225,6 +248,12 @@ static const char pc_sort_message[] =
 // @brief message for performance counters for sequence option
 static const char pcseq_message[] = "Optional. Report latencies for each shape in -data_shape sequence.";
 
+// @brief message for latency breakdown option
+static const char latency_breakdown_message[] =
+    "Optional. Split the reported latency into the device time (sum of per-layer real time from performance "
+    "counters) and the host overhead (queueing, transfers and callback delay). Implicitly turns on performance "
+    "counters collection, which adds some overhead to every inference.";
+
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] =
     "Optional. Path to a file where to store executable graph information serialized.";
@@ -266,6 +295,18 @@ DEFINE_string(i, "", input_message);
 /// It is a required parameter
 DEFINE_string(m, "", model_message);
 
+/// @brief Define parameter for the concurrent multi-model mode <br>
+DEFINE_string(mm, "", multi_model_message);
+
+/// @brief Define parameter for per-model stream numbers in the multi-model mode <br>
+DEFINE_string(mm_nstreams, "", multi_model_nstreams_message);
+
+/// @brief Define parameter for per-model infer request numbers in the multi-model mode <br>
+DEFINE_string(mm_nireq, "", multi_model_nireq_message);
+
+/// @brief Define parameter for the solo baseline phase duration in the multi-model mode <br>
+DEFINE_uint64(mm_solo_time, 0, multi_model_solo_time_message);
+
 /// @brief Define execution mode
 DEFINE_string(hint, "", hint_message);
 
@@ -373,6 +414,9 @@ DEFINE_string(pcsort, "", pc_sort_message);
 /// @brief Define flag for showing performance sequence counters <br>
 DEFINE_bool(pcseq, false, pcseq_message);
 
+/// @brief Define flag for reporting the device time vs host overhead latency breakdown <br>
+DEFINE_bool(latency_breakdown, false, latency_breakdown_message);
+
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
@@ -398,6 +442,12 @@ static void show_usage() {
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
     std::cout << std::endl;
+    std::cout << "Multi-model mode" << std::endl;
+    std::cout << "    -mm  <path,path,...>          " << multi_model_message << std::endl;
+    std::cout << "    -mm_nstreams  <int,int,...>   " << multi_model_nstreams_message << std::endl;
+    std::cout << "    -mm_nireq  <int,int,...>      " << multi_model_nireq_message << std::endl;
+    std::cout << "    -mm_solo_time  <integer>      " << multi_model_solo_time_message << std::endl;
+    std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
     std::cout << "    -shape                        " << shape_message << std::endl;
@@ -438,6 +488,7 @@ static void show_usage() {
     std::cout << "    -pc                     " << pc_message << std::endl;
     std::cout << "    -pcsort                 " << pc_sort_message << std::endl;
     std::cout << "    -pcseq                  " << pcseq_message << std::endl;
+    std::cout << "    -latency_breakdown      " << latency_breakdown_message << std::endl;
     std::cout << "    -exec_graph_path        " << exec_graph_path_message << std::endl;
     std::cout << "    -dump_config            " << dump_config_message << std::endl;
     std::cout << "    -load_config            " << load_config_message << std::endl;
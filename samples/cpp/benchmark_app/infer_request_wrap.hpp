@@ -106,8 +106,13 @@ private:
 
 class InferRequestsQueue final {
 public:
-    InferRequestsQueue(ov::CompiledModel& model, size_t nireq, size_t lat_group_n, bool enable_lat_groups)
-        : enable_lat_groups(enable_lat_groups) {
+    InferRequestsQueue(ov::CompiledModel& model,
+                       size_t nireq,
+                       size_t lat_group_n,
+                       bool enable_lat_groups,
+                       bool collect_device_time = false)
+        : enable_lat_groups(enable_lat_groups),
+          collect_device_time(collect_device_time) {
         for (size_t id = 0; id < nireq; id++) {
             requests.push_back(std::make_shared<InferReqWrap>(model,
                                                               id,
@@ -137,6 +142,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _device_latencies.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -158,6 +164,15 @@ public:
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
             }
+            if (collect_device_time) {
+                // requires ov::enable_profiling; sums per-layer real time into the device part of the
+                // iteration so that the host-side overhead can be derived as `latency - device time`
+                std::chrono::microseconds device_time = std::chrono::microseconds::zero();
+                for (const auto& info : requests.at(id)->get_performance_counts()) {
+                    device_time += info.real_time;
+                }
+                _device_latencies.push_back(device_time.count() / 1000.0);
+            }
             _idleIds.push(id);
             _endTime = std::max(Time::now(), _endTime);
         }
@@ -196,6 +211,10 @@ public:
         return _latency_groups;
     }
 
+    std::vector<double> get_device_latencies() {
+        return _device_latencies;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -205,7 +224,9 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _device_latencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
+    bool collect_device_time;
     std::exception_ptr inferenceException = nullptr;
 };
@@ -31,6 +31,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "multi_model_benchmark.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -48,7 +49,7 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_mm.empty()) {
         show_usage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
@@ -254,6 +255,10 @@ int main(int argc, char* argv[]) {
             return 0;
         }
 
+        if (!FLAGS_mm.empty()) {
+            return run_multi_model_benchmark();
+        }
+
         bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
         if (isNetworkCompiled) {
             slog::info << "Model is compiled" << slog::endl;
@@ -402,6 +407,10 @@ int main(int argc, char* argv[]) {
                 slog::warn << "Turn on sorted performance counters for " << device << " device since pcsort value is "
                            << FLAGS_pcsort << "." << slog::endl;
                 device_config[ov::enable_profiling.name()] = true;
+            } else if (FLAGS_latency_breakdown) {
+                slog::warn << "Turn on performance counters for " << device
+                           << " device since latency breakdown is requested." << slog::endl;
+                device_config[ov::enable_profiling.name()] = true;
             } else {
                 // set to default value
                 device_config[ov::enable_profiling.name()] = FLAGS_pc;
@@ -927,7 +936,11 @@ int main(int argc, char* argv[]) {
         // ----------------------------------------
         next_step();
 
-        InferRequestsQueue inferRequestsQueue(compiledModel, nireq, app_inputs_info.size(), FLAGS_pcseq);
+        InferRequestsQueue inferRequestsQueue(compiledModel,
+                                              nireq,
+                                              app_inputs_info.size(),
+                                              FLAGS_pcseq,
+                                              FLAGS_latency_breakdown);
 
         bool inputHasName = false;
         if (inputFiles.size() > 0) {
@@ -1145,6 +1158,17 @@ int main(int argc, char* argv[]) {
         inferRequestsQueue.wait_all();
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+        LatencyMetrics deviceLatency, overheadLatency;
+        if (FLAGS_latency_breakdown) {
+            const auto& wall_latencies = inferRequestsQueue.get_latencies();
+            const auto& device_latencies = inferRequestsQueue.get_device_latencies();
+            std::vector<double> overhead_latencies(device_latencies.size());
+            for (size_t i = 0; i < device_latencies.size(); ++i) {
+                overhead_latencies[i] = std::max(0.0, wall_latencies[i] - device_latencies[i]);
+            }
+            deviceLatency = LatencyMetrics(device_latencies, "", FLAGS_latency_percentile);
+            overheadLatency = LatencyMetrics(overhead_latencies, "", FLAGS_latency_percentile);
+        }
         std::vector<LatencyMetrics> groupLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
@@ -1182,7 +1206,26 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Percentile boundary", "percentile_boundary", FLAGS_latency_percentile),
                      StatisticsVariant("Average latency (ms)", "latency_avg", generalLatency.avg),
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
-                     StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
+                     StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max),
+                     StatisticsVariant("latency (90 percentile) (ms)", "latency_p90", generalLatency.p90),
+                     StatisticsVariant("latency (95 percentile) (ms)", "latency_p95", generalLatency.p95),
+                     StatisticsVariant("latency (99 percentile) (ms)", "latency_p99", generalLatency.p99),
+                     StatisticsVariant("latency (99.9 percentile) (ms)", "latency_p99.9", generalLatency.p999)});
+
+                if (FLAGS_latency_breakdown) {
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {StatisticsVariant("Average device latency (ms)", "latency_device_avg", deviceLatency.avg),
+                         StatisticsVariant("Device latency (99 percentile) (ms)",
+                                           "latency_device_p99",
+                                           deviceLatency.p99),
+                         StatisticsVariant("Average host overhead (ms)",
+                                           "latency_host_overhead_avg",
+                                           overheadLatency.avg),
+                         StatisticsVariant("Host overhead (99 percentile) (ms)",
+                                           "latency_host_overhead_p99",
+                                           overheadLatency.p99)});
+                }
 
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
@@ -1252,6 +1295,13 @@ int main(int argc, char* argv[]) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
 
+            if (FLAGS_latency_breakdown) {
+                slog::info << "Device latency:" << slog::endl;
+                deviceLatency.write_to_slog();
+                slog::info << "Host overhead:" << slog::endl;
+                overheadLatency.write_to_slog();
+            }
+
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
                 for (size_t i = 0; i < app_inputs_info.size(); ++i) {
@@ -0,0 +1,230 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// clang-format off
+#include "gflags/gflags.h"
+#include "openvino/openvino.hpp"
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "multi_model_benchmark.hpp"
+#include "utils.hpp"
+// clang-format on
+
+// The flags are defined in benchmark_app.hpp which must stay included by a single translation unit
+DECLARE_string(mm);
+DECLARE_string(mm_nstreams);
+DECLARE_string(mm_nireq);
+DECLARE_uint64(mm_solo_time);
+DECLARE_string(d);
+DECLARE_string(cache_dir);
+DECLARE_uint64(t);
+DECLARE_uint64(nthreads);
+DECLARE_uint64(latency_percentile);
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Per-model benchmarking state: a compiled model with its own pool of infer requests and
+/// pre-generated input tensors, independent from the other models sharing the device.
+struct ModelEntry {
+    std::string path;
+    std::string name;
+    ov::CompiledModel compiled_model;
+    std::vector<ov::InferRequest> requests;
+    size_t nireq = 0;
+
+    // results of the last run_for() call
+    size_t iterations = 0;
+    double duration_sec = 0.0;
+    std::vector<double> latencies_ms;
+    double solo_fps = 0.0;
+
+    double fps() const {
+        return duration_sec > 0.0 ? static_cast<double>(iterations) / duration_sec : 0.0;
+    }
+};
+
+void fill_random_inputs(ModelEntry& entry) {
+    std::mt19937 gen(0);
+    for (auto& request : entry.requests) {
+        for (const auto& input : entry.compiled_model.inputs()) {
+            auto tensor = ov::Tensor(input.get_element_type(), input.get_shape());
+            if (tensor.get_element_type() == ov::element::f32) {
+                std::uniform_real_distribution<float> dist(0.f, 1.f);
+                auto* data = tensor.data<float>();
+                for (size_t i = 0; i < tensor.get_size(); i++)
+                    data[i] = dist(gen);
+            } else {
+                // raw byte noise is representative enough for the integer precisions
+                std::uniform_int_distribution<int> dist(0, 255);
+                auto* data = static_cast<uint8_t*>(tensor.data());
+                for (size_t i = 0; i < tensor.get_byte_size(); i++)
+                    data[i] = static_cast<uint8_t>(dist(gen));
+            }
+            request.set_tensor(input, tensor);
+        }
+    }
+}
+
+/// Runs inference on all requests of the model in parallel until the deadline and collects
+/// the iteration count and per-inference latencies.
+void run_for(ModelEntry& entry, const std::chrono::seconds duration) {
+    entry.iterations = 0;
+    entry.latencies_ms.clear();
+
+    std::atomic<size_t> iterations{0};
+    std::mutex latencies_mutex;
+    std::vector<double> latencies_ms;
+
+    const auto start = Clock::now();
+    const auto deadline = start + duration;
+
+    std::vector<std::thread> workers;
+    for (auto& request : entry.requests) {
+        workers.emplace_back([&, request]() mutable {
+            std::vector<double> local_latencies;
+            while (Clock::now() < deadline) {
+                const auto infer_start = Clock::now();
+                request.infer();
+                const auto infer_end = Clock::now();
+                local_latencies.push_back(std::chrono::duration<double, std::milli>(infer_end - infer_start).count());
+                iterations++;
+            }
+            std::lock_guard<std::mutex> lock(latencies_mutex);
+            latencies_ms.insert(latencies_ms.end(), local_latencies.begin(), local_latencies.end());
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    entry.duration_sec = std::chrono::duration<double>(Clock::now() - start).count();
+    entry.iterations = iterations;
+    entry.latencies_ms = std::move(latencies_ms);
+}
+
+double percentile(std::vector<double> values, const size_t p) {
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, values.size() * p / 100)];
+}
+
+std::string pick_entry(const std::vector<std::string>& values, size_t idx) {
+    return idx < values.size() ? values[idx] : std::string{};
+}
+
+}  // namespace
+
+int run_multi_model_benchmark() {
+    const auto model_paths = split(FLAGS_mm, ',');
+    const auto nstreams_list = split(FLAGS_mm_nstreams, ',');
+    const auto nireq_list = split(FLAGS_mm_nireq, ',');
+    if (nstreams_list.size() > model_paths.size())
+        throw std::logic_error("-mm_nstreams contains more entries than models given in -mm");
+    if (nireq_list.size() > model_paths.size())
+        throw std::logic_error("-mm_nireq contains more entries than models given in -mm");
+
+    const std::chrono::seconds duration(FLAGS_t != 0 ? FLAGS_t : 10);
+    const std::chrono::seconds solo_duration(FLAGS_mm_solo_time);
+
+    ov::Core core;
+    if (!FLAGS_cache_dir.empty())
+        core.set_property(ov::cache_dir(FLAGS_cache_dir));
+
+    std::vector<ModelEntry> entries(model_paths.size());
+    for (size_t i = 0; i < model_paths.size(); i++) {
+        auto& entry = entries[i];
+        entry.path = model_paths[i];
+
+        slog::info << "Reading and compiling model: " << entry.path << slog::endl;
+        auto model = core.read_model(entry.path);
+        entry.name = model->get_friendly_name();
+        for (const auto& input : model->inputs()) {
+            if (input.get_partial_shape().is_dynamic())
+                throw std::logic_error("Model '" + entry.path +
+                                       "' has a dynamic input. The multi-model mode supports static shapes only, "
+                                       "reshape the model in advance or benchmark it with the single-model mode.");
+        }
+
+        ov::AnyMap device_config;
+        const auto nstreams = pick_entry(nstreams_list, i);
+        if (!nstreams.empty()) {
+            device_config[ov::num_streams.name()] = nstreams;
+        } else {
+            device_config[ov::hint::performance_mode.name()] = ov::hint::PerformanceMode::THROUGHPUT;
+        }
+        if (FLAGS_nthreads != 0)
+            device_config[ov::inference_num_threads.name()] = static_cast<int>(FLAGS_nthreads);
+        entry.compiled_model = core.compile_model(model, FLAGS_d, device_config);
+
+        const auto nireq = pick_entry(nireq_list, i);
+        entry.nireq = nireq.empty() ? entry.compiled_model.get_property(ov::optimal_number_of_infer_requests)
+                                    : static_cast<size_t>(std::stoul(nireq));
+        if (entry.nireq == 0)
+            throw std::logic_error("Number of infer requests must be positive for model '" + entry.path + "'");
+        for (size_t r = 0; r < entry.nireq; r++)
+            entry.requests.push_back(entry.compiled_model.create_infer_request());
+
+        fill_random_inputs(entry);
+
+        // warm-up so that the first-inference overheads stay out of the measurements
+        for (auto& request : entry.requests)
+            request.infer();
+    }
+
+    if (solo_duration.count() > 0) {
+        slog::info << "Measuring solo baselines (" << solo_duration.count() << " s per model)" << slog::endl;
+        for (auto& entry : entries) {
+            run_for(entry, solo_duration);
+            entry.solo_fps = entry.fps();
+        }
+    }
+
+    slog::info << "Benchmarking " << entries.size() << " models concurrently on " << FLAGS_d << " for "
+               << duration.count() << " s" << slog::endl;
+    {
+        std::vector<std::thread> model_threads;
+        for (auto& entry : entries)
+            model_threads.emplace_back([&entry, duration]() {
+                run_for(entry, duration);
+            });
+        for (auto& thread : model_threads)
+            thread.join();
+    }
+
+    double total_fps = 0.0;
+    for (auto& entry : entries) {
+        const auto latency_sum = std::accumulate(entry.latencies_ms.begin(), entry.latencies_ms.end(), 0.0);
+        const auto avg_latency = entry.latencies_ms.empty() ? 0.0 : latency_sum / entry.latencies_ms.size();
+        total_fps += entry.fps();
+
+        slog::info << slog::endl << "Model: " << entry.name << " (" << entry.path << ")" << slog::endl;
+        slog::info << "   Infer requests:  " << entry.nireq << slog::endl;
+        slog::info << "   Count:           " << entry.iterations << " iterations" << slog::endl;
+        slog::info << "   Throughput:      " << double_to_string(entry.fps()) << " FPS" << slog::endl;
+        slog::info << "   Average latency: " << double_to_string(avg_latency) << " ms" << slog::endl;
+        slog::info << "   Latency " << FLAGS_latency_percentile << "%:     "
+                   << double_to_string(percentile(entry.latencies_ms, FLAGS_latency_percentile)) << " ms" << slog::endl;
+        if (entry.solo_fps > 0.0) {
+            const auto retained = entry.fps() / entry.solo_fps * 100.0;
+            slog::info << "   Solo throughput: " << double_to_string(entry.solo_fps) << " FPS ("
+                       << double_to_string(retained) << "% retained under concurrency)" << slog::endl;
+        }
+    }
+    slog::info << slog::endl << "Aggregate throughput: " << double_to_string(total_fps) << " FPS" << slog::endl;
+    return 0;
+}
@@ -0,0 +1,9 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+/// Runs the concurrent multi-model benchmarking mode selected with the -mm option.
+/// Returns the process exit code.
+int run_multi_model_benchmark();
@@ -60,7 +60,7 @@ void StatisticsReport::dump() {
     if (_parameters.count(Category::EXECUTION_RESULTS_GROUPPED)) {
         dumper << "Group Latencies";
         dumper.endLine();
-        dumper << "Data shape;Median;Average;Min;Max";
+        dumper << "Data shape;Median;Average;Min;Max;90%;95%;99%;99.9%";
         dumper.endLine();
 
         dump_parameters(_parameters.at(Category::EXECUTION_RESULTS_GROUPPED));
@@ -340,6 +340,10 @@ static nlohmann::json to_json(const LatencyMetrics& latenct_metrics) {
     stat["latency_average"] = latenct_metrics.avg;
     stat["latency_min"] = latenct_metrics.min;
     stat["latency_max"] = latenct_metrics.max;
+    stat["latency_p90"] = latenct_metrics.p90;
+    stat["latency_p95"] = latenct_metrics.p95;
+    stat["latency_p99"] = latenct_metrics.p99;
+    stat["latency_p99.9"] = latenct_metrics.p999;
     return stat;
 }
 
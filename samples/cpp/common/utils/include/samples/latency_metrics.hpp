@@ -34,6 +34,10 @@ public:
     double avg = 0;
     double min = 0;
     double max = 0;
+    double p90 = 0;
+    double p95 = 0;
+    double p99 = 0;
+    double p999 = 0;
     std::string data_shape;
 
 private:
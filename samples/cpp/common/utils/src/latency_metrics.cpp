@@ -15,7 +15,7 @@
 void LatencyMetrics::write_to_stream(std::ostream& stream) const {
     std::ios::fmtflags fmt(std::cout.flags());
     stream << data_shape << ";" << std::fixed << std::setprecision(2) << median_or_percentile << ";" << avg << ";"
-           << min << ";" << max;
+           << min << ";" << max << ";" << p90 << ";" << p95 << ";" << p99 << ";" << p999;
     std::cout.flags(fmt);
 }
 
@@ -28,6 +28,10 @@ void LatencyMetrics::write_to_slog() const {
     slog::info << "   Average:          " << double_to_string(avg) << " ms" << slog::endl;
     slog::info << "   Min:              " << double_to_string(min) << " ms" << slog::endl;
     slog::info << "   Max:              " << double_to_string(max) << " ms" << slog::endl;
+    slog::info << "   90 percentile:    " << double_to_string(p90) << " ms" << slog::endl;
+    slog::info << "   95 percentile:    " << double_to_string(p95) << " ms" << slog::endl;
+    slog::info << "   99 percentile:    " << double_to_string(p99) << " ms" << slog::endl;
+    slog::info << "   99.9 percentile:  " << double_to_string(p999) << " ms" << slog::endl;
 }
 
 void LatencyMetrics::fill_data(std::vector<double> latencies, size_t percentile_boundary) {
@@ -35,8 +39,15 @@ void LatencyMetrics::fill_data(std::vector<double> latencies, size_t percentile_
         throw std::logic_error("Latency metrics class expects non-empty vector of latencies at consturction.");
     }
     std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double boundary) {
+        return latencies[std::min(latencies.size() - 1, size_t(latencies.size() / 100.0 * boundary))];
+    };
     min = latencies[0];
     avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
-    median_or_percentile = latencies[size_t(latencies.size() / 100.0 * percentile_boundary)];
+    median_or_percentile = percentile(static_cast<double>(percentile_boundary));
+    p90 = percentile(90.0);
+    p95 = percentile(95.0);
+    p99 = percentile(99.0);
+    p999 = percentile(99.9);
     max = latencies.back();
 };
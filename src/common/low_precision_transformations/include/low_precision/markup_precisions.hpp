@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "low_precision/lpt_visibility.hpp"
@@ -71,8 +72,22 @@ public:
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
 
 private:
-    static bool isPrecisionPreserved(const std::shared_ptr<Node>& node);
-    static bool isSupported(const std::shared_ptr<Node>& node);
+    static bool isPrecisionPreserved(const std::shared_ptr<Node>& node, const bool preservedByType);
+    static bool isPrecisionPreservedByType(const ov::DiscreteTypeInfo& typeInfo);
+    static bool isSupported(const ov::DiscreteTypeInfo& typeInfo);
+
+    // Markup decisions which depend on the operation type only. Models assembled from repeated
+    // blocks contain many clones of each operation, so these decisions are resolved once per type
+    // and reused for the clones. The restriction pointer stays valid as restrictionsByOperation
+    // is not modified after construction.
+    struct TypeMarkup {
+        bool supported = false;
+        bool precisionPreservedByType = false;
+        bool restricted = false;
+        const Restriction::RestrictionByVersion* restriction = nullptr;
+    };
+
+    std::unordered_map<ov::DiscreteTypeInfo, TypeMarkup> markupByType;
     std::unordered_map<std::string, Restriction> restrictionsByOperation;
     std::vector<ov::element::Type> defaultPrecisions;
 };
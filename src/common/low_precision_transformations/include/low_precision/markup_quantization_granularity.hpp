@@ -50,5 +50,10 @@ public:
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
 
 private:
+    // Restricted ports resolved per operation type: the lookup result is the same for all clones
+    // of the type, so it is computed once and reused on models with repeated block structures.
+    // The pointers stay valid as restrictionsByOperation is not modified after construction.
+    std::unordered_map<ov::DiscreteTypeInfo, const std::vector<PortQuantizationGranularityRestriction>*>
+        restrictionsByType;
     std::unordered_map<std::string, PerTensorQuantization> restrictionsByOperation;
 };
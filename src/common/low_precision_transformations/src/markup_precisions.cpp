@@ -89,17 +89,42 @@ bool ov::pass::low_precision::MarkupPrecisions::run_on_model(const std::shared_p
             continue;
         }
 
-        // TODO: don't need to set restrictions for not supported operations
-        // if don't set restrictions for not supported operations then accuracy drop appears, issue #59197
-        const bool supported = ov::is_type<opset1::Result>(node) || isSupported(node);
-        if (!supported && restrictionsByOperation.find(node->get_type_info().name) != restrictionsByOperation.end())
+        const auto& typeInfo = node->get_type_info();
+        auto markupIt = markupByType.find(typeInfo);
+        if (markupIt == markupByType.end()) {
+            // TODO: don't need to set restrictions for not supported operations
+            // if don't set restrictions for not supported operations then accuracy drop appears, issue #59197
+            TypeMarkup typeMarkup;
+            typeMarkup.supported =
+                typeInfo.is_castable(opset1::Result::get_type_info_static()) || isSupported(typeInfo);
+            typeMarkup.precisionPreservedByType = isPrecisionPreservedByType(typeInfo);
+
+            const auto it = restrictionsByOperation.find(typeInfo.name);
+            if (it != restrictionsByOperation.end()) {
+                typeMarkup.restricted = true;
+                const Restriction& r = it->second;
+                if (r.versionIsRequired) {
+                    const auto it2 = r.precisionsByVersion.find(typeInfo.version_id);
+                    if (it2 != r.precisionsByVersion.end()) {
+                        typeMarkup.restriction = &it2->second;
+                    }
+                } else {
+                    assert(r.precisionsByVersion.size() == 1ul);
+                    typeMarkup.restriction = &r.precisionsByVersion.begin()->second;
+                }
+            }
+            markupIt = markupByType.emplace(typeInfo, typeMarkup).first;
+        }
+
+        const TypeMarkup& typeMarkup = markupIt->second;
+        if (!typeMarkup.supported && typeMarkup.restricted)
             THROW_IE_LPT_EXCEPTION(*node) << "Restriction is set for unsupported operation";
-        if (!supported || !LayerTransformation::canBeTransformedStatic(node, defaultPrecisions)) {
+        if (!typeMarkup.supported || !LayerTransformation::canBeTransformedStatic(node, defaultPrecisions)) {
             setRestriction(node, pass::low_precision::PrecisionsRestriction::PrecisionsByPorts{{{0ul}, {}}});
             continue;
         }
 
-        const bool precisionPreserved = isPrecisionPreserved(node);
+        const bool precisionPreserved = isPrecisionPreserved(node, typeMarkup.precisionPreservedByType);
         if (precisionPreserved) {
             auto& rt = node->get_rt_info();
             rt.emplace(
@@ -107,24 +132,8 @@ bool ov::pass::low_precision::MarkupPrecisions::run_on_model(const std::shared_p
                 PrecisionPreservedAttribute(precisionPreserved));
         }
 
-        const auto& typeInfo = node->get_type_info();
-        auto it = restrictionsByOperation.find(typeInfo.name);
-        if (it != restrictionsByOperation.end()) {
-            const Restriction& r = it->second;
-            if (r.versionIsRequired) {
-                const auto it2 = r.precisionsByVersion.find(typeInfo.version_id);
-                if (it2 == r.precisionsByVersion.end()) {
-                    continue;
-                }
-
-                const auto& precisionsByPorts = it2->second;
-                setRestriction(node, precisionsByPorts.get(node));
-            } else {
-                assert(r.precisionsByVersion.size() == 1ul);
-
-                const auto& precisionsByPorts = r.precisionsByVersion.begin()->second;
-                setRestriction(node, precisionsByPorts.get(node));
-            }
+        if (typeMarkup.restriction != nullptr) {
+            setRestriction(node, typeMarkup.restriction->get(node));
         }
     }
     return true;
@@ -135,11 +144,7 @@ std::string name() {
     return Operation::get_type_info_static().name;
 }
 
-bool ov::pass::low_precision::MarkupPrecisions::isPrecisionPreserved(const std::shared_ptr<Node>& node) {
-    if (isDisabled(node)) {
-        return false;
-    }
-
+bool ov::pass::low_precision::MarkupPrecisions::isPrecisionPreservedByType(const ov::DiscreteTypeInfo& typeInfo) {
     // TODO: think how to handle conditions <= not mandatory for PoC
     // TODO: operation set version is not affected <= not mandatory for PoC
     static std::unordered_set<std::string> precisionPreservedOps = {
@@ -165,9 +170,17 @@ bool ov::pass::low_precision::MarkupPrecisions::isPrecisionPreserved(const std::
         { name<opset1::VariadicSplit>() }
     };
 
-    const bool precisionPreserved = precisionPreservedOps.find(node->get_type_name()) != precisionPreservedOps.end();
-    if (precisionPreserved) {
-        return precisionPreserved;
+    return precisionPreservedOps.find(typeInfo.name) != precisionPreservedOps.end();
+}
+
+bool ov::pass::low_precision::MarkupPrecisions::isPrecisionPreserved(const std::shared_ptr<Node>& node,
+    const bool preservedByType) {
+    if (isDisabled(node)) {
+        return false;
+    }
+
+    if (preservedByType) {
+        return true;
     }
 
     if (ov::is_type<opset1::Interpolate>(node)) {
@@ -187,7 +200,7 @@ bool ov::pass::low_precision::MarkupPrecisions::isPrecisionPreserved(const std::
     return false;
 }
 
-bool ov::pass::low_precision::MarkupPrecisions::isSupported(const std::shared_ptr<Node>& node) {
+bool ov::pass::low_precision::MarkupPrecisions::isSupported(const ov::DiscreteTypeInfo& typeInfo) {
     static std::unordered_set<std::string> supportedOps = {
         { name<opset1::Add>() },
         { name<opset1::AvgPool>() },
@@ -233,5 +246,5 @@ bool ov::pass::low_precision::MarkupPrecisions::isSupported(const std::shared_pt
         { name<opset6::GRUSequence>() },
     };
 
-    return supportedOps.find(node->get_type_name()) != supportedOps.end();
+    return supportedOps.find(typeInfo.name) != supportedOps.end();
 }
@@ -61,28 +61,30 @@ bool ov::pass::low_precision::MarkupQuantizationGranularity::run_on_model(const
             continue;
         }
 
-        const auto typeIt = restrictionsByOperation.find(node->get_type_info().name);
-        if (typeIt == restrictionsByOperation.end()) {
-            continue;
-        }
-
-        const auto& restriction = typeIt->second;
-        if (restriction.portsByVersion.empty()) {
-            continue;
-        }
-
-        if (restriction.versionIsRequired) {
-            const auto it2 = restriction.portsByVersion.find(node->get_type_info().version_id);
-            if (it2 == restriction.portsByVersion.end()) {
-                continue;
+        const auto& typeInfo = node->get_type_info();
+        auto restrictionIt = restrictionsByType.find(typeInfo);
+        if (restrictionIt == restrictionsByType.end()) {
+            const std::vector<PortQuantizationGranularityRestriction>* restrictedPorts = nullptr;
+            const auto typeIt = restrictionsByOperation.find(typeInfo.name);
+            if (typeIt != restrictionsByOperation.end()) {
+                const auto& restriction = typeIt->second;
+                if (!restriction.portsByVersion.empty()) {
+                    if (restriction.versionIsRequired) {
+                        const auto it2 = restriction.portsByVersion.find(typeInfo.version_id);
+                        if (it2 != restriction.portsByVersion.end()) {
+                            restrictedPorts = &it2->second;
+                        }
+                    } else {
+                        assert(restriction.portsByVersion.size() == 1ul);
+                        restrictedPorts = &restriction.portsByVersion.begin()->second;
+                    }
+                }
             }
+            restrictionIt = restrictionsByType.emplace(typeInfo, restrictedPorts).first;
+        }
 
-            const std::vector<PortQuantizationGranularityRestriction>& restrictedPorts = it2->second;
-            setRestriction(node, restrictedPorts);
-        } else {
-            assert(restriction.portsByVersion.size() == 1ul);
-            const std::vector<PortQuantizationGranularityRestriction>& restrictedPorts = restriction.portsByVersion.begin()->second;
-            setRestriction(node, restrictedPorts);
+        if (restrictionIt->second != nullptr) {
+            setRestriction(node, *restrictionIt->second);
         }
     }
     return true;
@@ -46,7 +46,9 @@ private:
     size_t& m_buffer_scratchpad_size;
     AllocateBuffers::BufferClusters& m_clusters;
 
-    constexpr static size_t m_alignment = 32; // 32 bytes for data alignment in allocated memory
+    // Alignment of the packed clusters in the scratchpad: one cache line (and one zmm vector),
+    // so solver-packed buffers never straddle cache lines and full-width accesses stay unsplit
+    constexpr static size_t m_alignment = 64;
 };
 
 } // namespace pass
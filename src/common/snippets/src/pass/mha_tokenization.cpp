@@ -23,7 +23,8 @@ bool is_supported_intermediate_op(const std::shared_ptr<ov::Node>& node) {
         return ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node) ||
                ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node) ||
                ov::is_type<ov::op::v0::FakeQuantize>(node) ||
-               ov::is_type<ov::op::v1::Select>(node);
+               ov::is_type<ov::op::v1::Select>(node) ||
+               ov::is_type<ov::op::v0::Convert>(node);
     };
     return is_intermediate_op(node) && ov::snippets::pass::TokenizeSnippets::AppropriateForSubgraph(node);
 }
@@ -121,12 +122,20 @@ size_t get_potential_body_params(const std::shared_ptr<ov::Node>& op) {
 }
 
 bool update_intermediate_supported_ops(std::shared_ptr<ov::Node>& interm_op, ov::NodeVector& ordered_ops,
-                                       size_t& hidden_virtual_ports_count, size_t& potential_body_params_count) {
+                                       size_t& hidden_virtual_ports_count, size_t& potential_body_params_count,
+                                       size_t& buffer_count) {
     while (is_supported_intermediate_op(interm_op)) {
         // All supported intermediate ops have only one output port
         if (interm_op->get_output_target_inputs(0).size() != 1)
             return false;
 
+        // Convert that changes the element size breaks in-place reuse of the fused Loop Buffers
+        // (the same way as mixed-precision MatMul inputs do), so one more Buffer should be reserved
+        if (const auto convert = ov::as_type_ptr<ov::op::v0::Convert>(interm_op)) {
+            if (convert->get_input_element_type(0).size() != convert->get_destination_type().size())
+                buffer_count++;
+        }
+
         // Check for supported ops on branches: Broadcast/Elementwise (for example, dequantize ops)
         if (interm_op->get_input_size() > 1) {
             tokenize_broadcast(interm_op, ordered_ops);
@@ -274,7 +283,8 @@ ov::snippets::pass::TokenizeMHASnippets::TokenizeMHASnippets(const SnippetsToken
 
         auto interm_op = matmul0->get_output_target_inputs(0).begin()->get_node()->shared_from_this();
         // Add supported operations which are between MatMul0 and Softmax to ordered_ops
-        if (!update_intermediate_supported_ops(interm_op, ordered_ops, hidden_virtual_ports_count, potential_body_params_count))
+        if (!update_intermediate_supported_ops(interm_op, ordered_ops, hidden_virtual_ports_count, potential_body_params_count,
+                                               buffer_count))
             return false;
 
         std::shared_ptr<ov::opset1::Reshape> reshape0 = nullptr;
@@ -305,7 +315,8 @@ ov::snippets::pass::TokenizeMHASnippets::TokenizeMHASnippets(const SnippetsToken
             return false;
 
         // Add supported operations which are between Softmax and MatMul1 to ordered_ops
-        if (!update_intermediate_supported_ops(interm_op, ordered_ops, hidden_virtual_ports_count, potential_body_params_count))
+        if (!update_intermediate_supported_ops(interm_op, ordered_ops, hidden_virtual_ports_count, potential_body_params_count,
+                                               buffer_count))
             return false;
 
         const auto matmul1 = ov::as_type_ptr<ov::opset1::MatMul>(interm_op);
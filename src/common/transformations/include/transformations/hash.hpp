@@ -27,11 +27,15 @@ public:
      *
      * @param output_hash_value Reference to output value. By applying hash pass on function, resulting hash value
      * will be set to this variable
+     * @param skip_weights When true, constant payloads are excluded from the hash; only the serialized topology
+     * (including constant offsets and sizes) contributes. The caller is expected to hash the weights separately,
+     * which allows doing it per-Constant and in parallel
      */
-    Hash(uint64_t& output_hash_value);
+    Hash(uint64_t& output_hash_value, bool skip_weights = false);
 
 private:
     uint64_t& m_hash;
+    bool m_skip_weights = false;
 };
 
 }  // namespace pass
@@ -1006,6 +1006,11 @@ ov::pass::PrepareShapeOpsForEliminationAroundBE::PrepareShapeOpsForEliminationAr
 }
 
 ov::pass::NopElimination::NopElimination(bool use_shape_for_elimination) {
+    // Pure cleanup: eliminations never enable matches outside the neighborhood of a
+    // change, so repeated runs within one pipeline may be driven by a worklist of
+    // nodes dirtied since the previous run instead of a full model sweep.
+    set_worklist_enabled(true);
+
     // shape-agnostic transformations
     ADD_MATCHER_FOR_THIS(EliminatePad)
     ADD_MATCHER_FOR_THIS(EliminateConvert)
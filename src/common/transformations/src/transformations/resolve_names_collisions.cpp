@@ -69,7 +69,7 @@ bool ov::pass::ResolveNameCollisions::run_on_model(const std::shared_ptr<ov::Mod
             for (const auto& op : same_named_ops) {
                 // check if op has OV autogenerated friendly name.
                 // unique and friendly names have to be equal for the autogenerated name.
-                bool is_autogenerated = op->m_friendly_name.empty();
+                bool is_autogenerated = !op->m_friendly_name || op->m_friendly_name->empty();
                 if (!is_autogenerated) {
                     continue;
                 }
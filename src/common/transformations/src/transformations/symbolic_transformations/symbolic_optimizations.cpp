@@ -8,6 +8,7 @@
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/reshape.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/symbolic_info.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/or.hpp"
@@ -86,11 +87,49 @@ void special_case_range_symbol_propagation(const std::shared_ptr<ov::Node>& node
         output_shape[0].set_symbol(add_in0_symbol);
     node->set_output_type(0, node->get_output_element_type(0), output_shape);
 }
+
+bool shape_symbols_are_set_up(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto multi_subgraph_op = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op))
+            for (const auto& sub_graph : multi_subgraph_op->get_functions())
+                if (sub_graph && !shape_symbols_are_set_up(sub_graph))
+                    return false;
+        for (const auto& output : op->outputs()) {
+            const auto& shape = output.get_partial_shape();
+            if (shape.rank().is_dynamic())
+                return false;
+            for (const auto& d : shape)
+                if (d.is_dynamic() && !d.has_symbol())
+                    return false;
+        }
+    }
+    return true;
+}
+
+void restore_skip_invalidation(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto multi_subgraph_op = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op))
+            for (const auto& sub_graph : multi_subgraph_op->get_functions())
+                if (sub_graph)
+                    restore_skip_invalidation(sub_graph);
+        for (auto& output : op->outputs())
+            ov::skip_invalidation(output);
+    }
+}
 }  // namespace
 
 bool ov::pass::SymbolicPropagation::run_on_model(const std::shared_ptr<ov::Model>& m) {
     RUN_ON_MODEL_SCOPE(SymbolicPropagation);
 
+    // Symbols assigned by a previous run survive on the shapes (only the SkipInvalidation markers are
+    // removed by SymbolicOptimizations). When every dynamic dimension of the model still carries a
+    // symbol there is nothing to rediscover -- re-installing the invalidation guards is enough for the
+    // symbolic passes, value symbols are populated lazily during bound evaluation.
+    if (shape_symbols_are_set_up(m)) {
+        restore_skip_invalidation(m);
+        return false;
+    }
+
     for (const auto& op : m->get_ordered_ops()) {
         // since we disable invalidation with the following two lines, we have to invalidate manually here
         op->invalidate_values();
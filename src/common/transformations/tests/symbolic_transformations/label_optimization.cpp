@@ -47,6 +47,29 @@ TEST(TransformationTests, ApplySymbolEquivalence_Concat) {
     EXPECT_FALSE(symbol::are_equal(pshape_1[3].get_symbol(), pshape_3[3].get_symbol()));
 }
 
+TEST(TransformationTests, SymbolicPropagation_KeepsSymbolsOnRepeatedRun) {
+    auto input_1 = make_shared<v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto input_2 = make_shared<v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto concat = make_shared<v0::Concat>(OutputVector{input_1, input_2}, -1);
+    auto model = make_shared<Model>(NodeVector{concat}, ParameterVector{input_2, input_1});
+
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<pass::SymbolicPropagation>();
+    manager.run_passes(model);
+
+    std::vector<std::shared_ptr<Symbol>> symbols;
+    for (const auto& d : concat->get_output_partial_shape(0))
+        symbols.push_back(d.get_symbol());
+
+    // re-running propagation on an already symboled model must not re-discover symbols
+    manager.run_passes(model);
+
+    const auto& pshape = concat->get_output_partial_shape(0);
+    for (size_t i = 0; i < symbols.size(); ++i)
+        EXPECT_EQ(pshape[i].get_symbol(), symbols[i]);
+}
+
 TEST_F(TransformationTestsF, ApplySymbolEquivalence_Concat_Values) {
     {
         auto input_1 = make_shared<v0::Parameter>(element::f32, PartialShape::dynamic(4));
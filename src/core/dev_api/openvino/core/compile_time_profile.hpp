@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <string>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Returns true when a CompileTimeProfileScope is active on the current thread.
+ *
+ * Collection is off by default so steady-state inference never pays for it; the runtime
+ * activates a scope for the duration of Core::compile_model.
+ */
+OPENVINO_API bool compile_time_profile_enabled();
+
+/**
+ * @brief Adds `duration` to the accumulator of `stage` on the current thread.
+ *
+ * No-op when no scope is active. Repeated additions for the same stage name are summed,
+ * so stages that run several times (e.g. a transformation pass re-applied by nested
+ * pass managers) report their aggregate duration.
+ */
+OPENVINO_API void compile_time_profile_add(const std::string& stage, std::chrono::nanoseconds duration);
+
+/**
+ * @brief Activates compile-time telemetry collection on the current thread for its lifetime.
+ *
+ * The outermost scope owns the accumulated data; nested scopes on the same thread are
+ * no-ops and their take() returns an empty map, so a compilation triggered from within
+ * another compilation (e.g. HETERO falling back to a device plugin) contributes to the
+ * profile of the outer one. Stages recorded by other threads are not captured.
+ */
+class OPENVINO_API CompileTimeProfileScope {
+public:
+    CompileTimeProfileScope();
+    ~CompileTimeProfileScope();
+
+    CompileTimeProfileScope(const CompileTimeProfileScope&) = delete;
+    CompileTimeProfileScope& operator=(const CompileTimeProfileScope&) = delete;
+
+    /// \brief Returns the per-stage durations in milliseconds accumulated since construction
+    /// and resets the accumulator.
+    std::map<std::string, double> take();
+
+private:
+    std::map<std::string, double> m_durations_ms;
+    bool m_owner = false;
+};
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Monotonic memory arena which batches the many small allocations made while a model graph
+ * is being constructed.
+ *
+ * Memory is carved from large blocks with a bump pointer, so concurrent model loads do not contend
+ * on the global heap for every node or tensor descriptor. Individual deallocations only decrement
+ * a live-object counter; all blocks are returned to the system at once when the last reference to
+ * the arena is dropped. Every object carved from the arena keeps the arena alive through its
+ * allocator, therefore teardown naturally happens in bulk when the owning ov::Model releases its
+ * nodes.
+ */
+class OPENVINO_API MemoryArena : public std::enable_shared_from_this<MemoryArena> {
+public:
+    /// \brief Default size of a single arena block in bytes
+    static constexpr size_t default_block_size = 1u << 20;
+
+    explicit MemoryArena(size_t block_size = default_block_size);
+    ~MemoryArena();
+
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    /**
+     * @brief Allocates `size` bytes with the requested alignment from the arena
+     *
+     * @param size       Number of bytes to allocate
+     * @param alignment  Required alignment, must be a power of two
+     * @return Pointer to the allocated storage, never nullptr (throws std::bad_alloc on failure)
+     */
+    void* allocate(size_t size, size_t alignment);
+
+    /**
+     * @brief Registers the release of a previously allocated object
+     *
+     * The memory itself is not reused; blocks are freed in bulk by the destructor.
+     */
+    void deallocate(void* ptr, size_t size) noexcept;
+
+    /// \brief Returns the number of objects currently carved from the arena
+    size_t get_live_allocations() const;
+
+    /// \brief Returns the total number of bytes reserved by the arena blocks
+    size_t get_capacity() const;
+
+    /// \brief Returns the arena activated for the calling thread via ArenaScope, or nullptr
+    static const std::shared_ptr<MemoryArena>& current();
+
+private:
+    friend class ArenaScope;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    size_t m_block_size;
+    size_t m_block_capacity = 0;
+    size_t m_offset = 0;
+    size_t m_capacity = 0;
+    size_t m_live = 0;
+};
+
+/**
+ * @brief Activates a MemoryArena for the calling thread for the lifetime of the scope object.
+ *
+ * Model loaders wrap graph construction into an ArenaScope so that node factories and descriptor
+ * creation pick the arena up through MemoryArena::current(). Scopes may nest; the previous arena
+ * is restored on destruction.
+ */
+class OPENVINO_API ArenaScope {
+public:
+    explicit ArenaScope(std::shared_ptr<MemoryArena> arena);
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    std::shared_ptr<MemoryArena> m_previous;
+};
+
+/**
+ * @brief Standard allocator adapter which carves objects from a MemoryArena.
+ *
+ * Keeps a strong reference to the arena, so storage outlives every object allocated through it.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(std::shared_ptr<MemoryArena> arena) : m_arena{std::move(arena)} {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : m_arena{other.get_arena()} {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        m_arena->deallocate(p, n * sizeof(T));
+    }
+
+    const std::shared_ptr<MemoryArena>& get_arena() const {
+        return m_arena;
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const {
+        return m_arena == other.get_arena();
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const {
+        return !(*this == other);
+    }
+
+private:
+    std::shared_ptr<MemoryArena> m_arena;
+};
+
+/**
+ * @brief Creates a shared_ptr from the arena active on the calling thread, falling back to
+ * std::make_shared when no arena is installed.
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> make_arena_shared(Args&&... args) {
+    const auto& arena = MemoryArena::current();
+    if (arena) {
+        return std::allocate_shared<T>(ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Packs a tensor of std::string elements into the contiguous byte representation.
+ *
+ * The packed format is the one already used for string tensor serialization:
+ * <num_strings>, <0>, <1st string end offset>, ..., <nth string end offset>, <all strings raw bytes>,
+ * where the counters and offsets are int32 values. Unlike the per-element std::string storage the packed
+ * form is a single allocation, so it is the preferred way to carry string data between the pipeline
+ * stages which do not need to mutate individual elements.
+ *
+ * @param strings  Tensor of element::string type, must be contiguous.
+ * @return One-dimensional element::u8 tensor with the packed representation.
+ */
+OPENVINO_API Tensor pack_string_tensor(const Tensor& strings);
+
+/**
+ * @brief Unpacks the contiguous byte representation into a tensor of std::string elements.
+ *
+ * The inverse of pack_string_tensor; the multi-dimensional shape is not stored in the packed form,
+ * so the result is a one-dimensional tensor with one element per packed string.
+ *
+ * @param packed  One-dimensional element::u8 tensor with the packed representation.
+ * @return Tensor of element::string type with the unpacked elements.
+ */
+OPENVINO_API Tensor unpack_string_tensor(const Tensor& packed);
+
+}  // namespace util
+}  // namespace ov
@@ -145,6 +145,15 @@ public:
     void reshape(const std::map<std::string, ov::PartialShape>& partial_shapes);
     void reshape(const std::map<ov::Output<ov::Node>, ov::PartialShape>& partial_shapes);
 
+    /// \brief Reshapes the model to every candidate set of input shapes in turn, memoizing the
+    /// inferred per-node shapes for each candidate. Later reshapes to any of the candidates replay
+    /// the memoized result instead of re-running shape propagation, which makes switching between
+    /// a fixed set of input shapes (e.g. bucketed batch sizes at serving time) cheap.
+    /// The model is left reshaped to the last candidate.
+    /// \param shape_candidates Candidate input shape sets; each entry follows the same contract as
+    /// reshape(const std::map<ov::Output<ov::Node>, ov::PartialShape>&).
+    void reshape(const std::vector<std::map<ov::Output<ov::Node>, ov::PartialShape>>& shape_candidates);
+
     /// Return the element type of output i
     const ov::element::Type& get_output_element_type(size_t i) const;
 
@@ -561,6 +570,25 @@ private:
     mutable std::unordered_map<std::string, Output<Node>> m_cached_output_names;
     mutable std::unordered_map<std::string, std::weak_ptr<Node>> m_cached_op_names;
 
+    // Memoized results of shape propagation keyed by the signature of all parameter shapes.
+    // An entry is replayed only when the graph still matches the topological order it was
+    // recorded against; stale entries are dropped on the next lookup.
+    struct ReshapeCacheEntry {
+        std::vector<std::weak_ptr<Node>> nodes;
+        std::vector<std::vector<PartialShape>> shapes;
+        std::vector<std::vector<element::Type>> types;
+        // Value bounds and symbols computed for this shape signature; restored on replay
+        // so unchanged shape subgraphs skip bound re-evaluation as well.
+        std::vector<std::vector<ov::Tensor>> lower_bounds;
+        std::vector<std::vector<ov::Tensor>> upper_bounds;
+        std::vector<std::vector<TensorSymbol>> symbols;
+    };
+    mutable std::map<std::string, ReshapeCacheEntry> m_reshape_cache;
+
+    bool try_replay_reshape(const std::string& signature,
+                            const std::unordered_map<ov::op::v0::Parameter*, ov::PartialShape>& param_shapes);
+    void record_reshape(const std::string& signature);
+
     // Private runtime info which is shared across nodes and used only
     // for internal purposes.
     std::shared_ptr<SharedRTInfo> m_shared_rt_info;
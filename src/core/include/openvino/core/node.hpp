@@ -432,7 +432,9 @@ private:
     std::vector<Node*> m_control_dependents;
     std::vector<std::shared_ptr<Node>> m_control_dependencies;
     size_t m_instance_id{m_next_instance_id.fetch_add(1)};
-    std::string m_friendly_name;
+    // Interned (globally deduplicated) storage: equal friendly names of nodes from
+    // different models share one allocation
+    std::shared_ptr<const std::string> m_friendly_name;
     mutable std::string m_unique_name;
     mutable std::atomic_bool m_name_changing{false};
     static std::atomic<size_t> m_next_instance_id;
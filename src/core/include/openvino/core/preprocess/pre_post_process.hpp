@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "openvino/core/core_visibility.hpp"
 #include "openvino/core/preprocess/input_info.hpp"
 #include "openvino/core/preprocess/output_info.hpp"
@@ -92,6 +94,20 @@ public:
     /// \return Function with added pre/post-processing operations
     std::shared_ptr<Model> build();
 
+    /// \brief Builds pre-processing as a standalone model instead of inlining it into the main graph
+    ///
+    /// The first model of the returned pair contains only the pre-processing operations: its inputs are the
+    /// user's tensors and its outputs correspond, in order, to the inputs of the second model. The second model
+    /// is the function passed in constructor with post-processing operations added and inputs left untouched.
+    /// Compiling the two models separately allows an application to schedule pre-processing as its own pipeline
+    /// stage, e.g. overlap pre-processing of the next frame with the model compute of the current one using
+    /// asynchronous infer requests
+    ///
+    /// Shall not be mixed with `build` within one PrePostProcessor instance
+    ///
+    /// \return Pair of the pre-processing model and the model with post-processing operations
+    std::pair<std::shared_ptr<Model>, std::shared_ptr<Model>> build_separate();
+
 private:
     friend OPENVINO_API std::ostream& operator<<(std::ostream& str, const PrePostProcessor& prePostProcessor);
     void dump(std::ostream&) const;
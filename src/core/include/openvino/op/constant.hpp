@@ -174,8 +174,32 @@ public:
     /// \param data A void* to constant data.
     Constant(const element::Type& type, const Shape& shape, const void* data);
 
+    /// \brief Constructs a tensor constant directly over a pre-allocated buffer
+    ///
+    /// The data is adopted, not copied; the buffer (e.g. an ov::SharedBuffer over a
+    /// memory-mapped weights file) is kept alive for the constant lifetime. Consumers
+    /// can query get_alignment() to decide whether the memory can be used in place.
+    ///
+    /// \param type The element type of the tensor constant.
+    /// \param shape The shape of the tensor constant.
+    /// \param data Pre-allocated buffer with constant data.
     Constant(const element::Type& type, const Shape& shape, const std::shared_ptr<ov::AlignedBuffer>& data);
 
+    /// \brief Wraps a narrower-precision constant into a lazily decompressed constant of \p type.
+    ///
+    /// The returned constant reports \p type and the shape of \p compressed, but keeps referencing
+    /// the compressed payload until the data is accessed for the first time, at which point the
+    /// payload is converted to \p type once. Transformations which fold decompression Converts and
+    /// then only inspect metadata therefore never allocate the expanded data, which keeps the
+    /// compile-time peak RSS of f16/int8 IRs close to the compressed weights size.
+    ///
+    /// \param type The element type the constant reports (the decompressed type).
+    /// \param compressed Constant whose payload is adopted; its buffer is kept alive, not copied.
+    /// \return The lazily decompressed constant, or nullptr when the payload of \p compressed is
+    ///         itself still pending expansion.
+    static std::shared_ptr<Constant> create_lazily_decompressed(const element::Type& type,
+                                                                const std::shared_ptr<Constant>& compressed);
+
     Constant(const Constant& other);
     Constant(const Constant& other, const Shape& new_shape);
     Constant& operator=(const Constant&) = delete;
@@ -227,6 +251,14 @@ public:
     /// \brief Return data size in bytes
     size_t get_byte_size() const;
 
+    /// \brief Returns the byte alignment the underlying data pointer is guaranteed to have
+    ///
+    /// Internally allocated constants report at least host_alignment() (64 bytes); for
+    /// adopted external memory the actual pointer alignment (capped at 4096) is reported,
+    /// so plugins can decide whether mapped weights may be consumed in place without a
+    /// reorder copy.
+    size_t get_alignment() const;
+
     /// \brief Wrapper around constructing a shared_ptr of a Constant
     ///
     /// \param type The element type of the tensor constant.
@@ -727,9 +759,16 @@ private:
         lp_iter_ptr iter;
     };
 
+    void expand_compressed_data() const;
+
     element::Type m_element_type{};
     Shape m_shape{};
-    std::shared_ptr<ov::AlignedBuffer> m_data{};
+    mutable std::shared_ptr<ov::AlignedBuffer> m_data{};
+    // payload still stored in the compressed element type; expanded into m_data on the first data
+    // access, see create_lazily_decompressed()
+    mutable std::shared_ptr<ov::AlignedBuffer> m_compressed_data{};
+    element::Type m_compressed_type{};
+    mutable std::atomic_bool m_compressed{false};
     mutable std::atomic_bool m_all_elements_bitwise_identical{false};
     mutable std::atomic_bool m_all_elements_bitwise_identical_checked{false};
     bool m_alloc_buffer_on_visit_attributes{true};
@@ -45,6 +45,7 @@ public:
     bool evaluate_lower(TensorVector& outputs) const override;
     bool evaluate_upper(TensorVector& outputs) const override;
     bool evaluate_symbol(TensorSymbolVector& output_symbols) const override;
+    bool constant_fold(OutputVector& output_values, const OutputVector& input_values) override;
 
 protected:
     ov::element::Type m_destination_type;
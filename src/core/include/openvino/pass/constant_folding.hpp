@@ -19,6 +19,21 @@ namespace pass {
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+
+    ConstantFolding() = default;
+
+    /// \brief Constructs the pass with a materialization budget.
+    ///
+    /// Nodes whose folded result would exceed the given number of bytes are left
+    /// intact instead of being materialized into new Constants, which bounds the
+    /// peak memory taken by intermediate fold results; such subgraphs stay foldable
+    /// and can be materialized later by a pass instance with a larger budget.
+    ///
+    /// \param max_folded_constant_size  Byte budget for a single folded node result;
+    ///                                  0 means no limit.
+    explicit ConstantFolding(size_t max_folded_constant_size)
+        : m_max_folded_constant_size{max_folded_constant_size} {}
+
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +41,13 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Checks that materializing the node's outputs fits the size budget.
+    bool within_size_budget(const Node& node) const;
+    /// \brief Evaluates independent fold candidates (nodes whose inputs are all
+    /// Constants) concurrently in waves; replacements are applied serially.
+    bool fold_independent_nodes_in_parallel(const std::shared_ptr<ov::Model>& model);
+
+    size_t m_max_folded_constant_size = 0;
 };
 
 /**
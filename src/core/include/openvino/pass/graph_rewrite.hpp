@@ -138,6 +138,11 @@ public:
         return m_matcher;
     }
 
+    /// \brief Returns the op types the pattern root can match: the type of a concrete root
+    /// node or the set wrapped by pattern::op::WrapType. An empty vector means the root
+    /// type cannot be determined statically and the pass has to be tried on every node.
+    std::vector<DiscreteTypeInfo> get_root_type_infos() const;
+
 protected:
     void register_matcher(const std::shared_ptr<pattern::Matcher>& m,
                           const matcher_pass_callback& callback,
@@ -258,14 +263,60 @@ public:
 
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
 
+    /// \brief Runs the registered matcher passes over the neighborhood of the given seed
+    /// nodes only (producers, the seeds themselves and their users) instead of sweeping the
+    /// whole model. Nodes registered by successful callbacks are re-enqueued as usual, so
+    /// the rewrite still runs to a fixpoint over the worklist.
+    /// Expired seeds are skipped; their replacements are expected to be part of the list.
+    bool run_on_nodes(const std::shared_ptr<ov::Model>& model, const std::vector<std::weak_ptr<Node>>& seeds);
+
+    /// \brief Marks this rewrite as an idempotent cleanup that may be re-executed over a
+    /// worklist of changed nodes (see run_on_nodes) instead of a full model sweep.
+    /// pass::Manager uses the flag to feed repeated runs of the same cleanup with the
+    /// nodes recorded dirty since its previous invocation.
+    void set_worklist_enabled(bool enabled) {
+        m_worklist_enabled = enabled;
+    }
+
+    bool is_worklist_enabled() const {
+        return m_worklist_enabled;
+    }
+
+    /// \brief Nodes recorded via MatcherPass::register_new_node during the last run.
+    const std::vector<std::weak_ptr<Node>>& get_dirty_nodes() const {
+        return m_dirty_nodes;
+    }
+
+    /// \brief Whether the dirty set covers every modification made during the last run.
+    bool dirty_nodes_complete() const {
+        return m_dirty_nodes_complete;
+    }
+
     void set_pass_config(const std::shared_ptr<PassConfig>& pass_config) override;
 
+    /// \brief Re-validates only the downstream cone of nodes recorded via
+    /// MatcherPass::register_new_node during the last run instead of the whole model.
+    /// \return false when the dirty set is incomplete (some successful rewrite did not
+    /// record its nodes) and the caller has to fall back to whole-model validation.
+    bool validate_dirty_subgraph(const std::shared_ptr<ov::Model>& model);
+
+    /// \brief Drops dirty-node bookkeeping accumulated by the previous run.
+    void clear_dirty_nodes();
+
 protected:
     bool apply_matcher_passes(std::shared_ptr<Model> f, std::deque<std::weak_ptr<Node>> nodes_to_run);
 
     bool m_enable_shape_inference = false;
 
     std::vector<std::shared_ptr<ov::pass::MatcherPass>> m_matchers;
+
+    // Nodes created by successful matcher callbacks; seeds for scoped validation.
+    // The flag turns false when a successful rewrite did not register its nodes and
+    // the dirty set therefore does not cover all modifications.
+    std::vector<std::weak_ptr<Node>> m_dirty_nodes;
+    bool m_dirty_nodes_complete = true;
+
+    bool m_worklist_enabled = false;
 };
 
 class OPENVINO_API BackwardGraphRewrite : public GraphRewrite {
@@ -4,8 +4,10 @@
 
 #pragma once
 
+#include <functional>
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -85,6 +87,20 @@ public:
         return m_pass_config;
     }
 
+    /// \brief Returns a stable fingerprint of the enabled pass pipeline combining every
+    /// registered pass type name with its version. Together with a model hash it keys the
+    /// persistent transformed-model cache; callers maintaining their own caches may reuse it.
+    std::string get_pipeline_fingerprint() const;
+
+    /// \brief Loader used by the persistent transformed-model cache to deserialize a
+    /// previously stored model. Deserialization is implemented above core (IR frontend),
+    /// so the runtime registers a loader here during its initialization. The cache stays
+    /// inactive until both a loader is registered and the OV_TRANSFORMATIONS_CACHE_DIR
+    /// environment variable points to a writable directory.
+    using cached_model_loader_t =
+        std::function<std::shared_ptr<Model>(const std::string& xml_path, const std::string& bin_path)>;
+    static void set_cached_model_loader(const cached_model_loader_t& loader);
+
 protected:
     template <typename T, class... Args>
     std::shared_ptr<T> push_pass(Args&&... args) {
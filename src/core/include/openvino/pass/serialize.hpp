@@ -18,6 +18,8 @@ namespace pass {
  * @brief Serialize transformation converts ov::Model into IR files
  * @attention
  * - dynamic shapes are not supported
+ * - a path with the ".bir" extension instead of ".xml" produces the compact binary
+ *   encoding of the IR document, which the IR frontend reads back noticeably faster
  * \ingroup ov_pass_cpp_api
  */
 class OPENVINO_API Serialize : public ov::pass::ModelPass {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <future>
 
 #include "openvino/core/coordinate_diff.hpp"
@@ -82,36 +83,85 @@ void convolve_2D_channels(const ConvolutionParams& p,
     const int f_y_block = filter_size_y * f_y_increment;
     const int f_x_block = filter_size_x * f_x_increment;
 
+    // the general per-point path which handles the filter windows clipped by the padding
+    auto convolve_point = [&](const int i_y_m, const int i_x) {
+        const int f_y_up_lim = f_y_block + i_y_m;
+        const int f_x_up_lim = f_x_block + i_x;
+        auto input_channel = batch;
+        auto filter_channel = filter;
+        T sum = 0;
+        size_t filter_channels_count = f_channels;
+
+        while (filter_channels_count--) {
+            for (int f_y_i = i_y_m; f_y_i < f_y_up_lim; f_y_i += f_y_increment) {
+                if (f_y_i < 0 || f_y_i >= input_size_yx) {
+                    filter_channel += filter_size_x;
+                    continue;
+                }
+                const int x_up_bound = input_size_x + f_y_i;
+                for (int f_x_i = f_y_i + i_x; f_x_i < f_x_up_lim + f_y_i;
+                     f_x_i += f_x_increment, filter_channel++) {
+                    if (f_x_i < f_y_i || f_x_i >= x_up_bound) {
+                        continue;
+                    }
+
+                    sum += input_channel[f_x_i] * filter_channel[0];
+                }
+            }
+            input_channel += input_size_yx;
+        }
+        return sum;
+    };
+
+    // output columns whose filter window lies fully inside the input row: for them the boundary
+    // checks are resolved once per row and the innermost loop runs branch-free over the output
+    // positions, so the compiler is able to vectorize it
+    const int k0 = pad_begin_x > 0 ? (pad_begin_x + stride_x - 1) / stride_x : 0;
+    const int i_x_first = -pad_begin_x + k0 * stride_x;
+    const int i_x_last = std::min(input_size_x - dilated_filter_size_x, i_x_lim);
+    const int interior_count = i_x_last >= i_x_first ? (i_x_last - i_x_first) / stride_x + 1 : 0;
+
     for (int i_y = -pad_begin_y; i_y <= i_y_lim; i_y += stride_y) {
         const int i_y_m = i_y * input_size_x;
-        const int f_y_up_lim = f_y_block + i_y_m;
+        const bool y_inside = i_y >= 0 && i_y + dilated_filter_size_y <= input_size_y;
 
-        for (int i_x = -pad_begin_x; i_x <= i_x_lim; i_x += stride_x) {
-            const int f_x_up_lim = f_x_block + i_x;
-            auto input_channel = batch;
-            auto filter_channel = filter;
-            T sum = 0;
-            size_t filter_channels_count = f_channels;
+        if (!y_inside || interior_count == 0) {
+            for (int i_x = -pad_begin_x; i_x <= i_x_lim; i_x += stride_x) {
+                *out = convolve_point(i_y_m, i_x);
+                ++out;
+            }
+            continue;
+        }
 
-            while (filter_channels_count--) {
-                for (int f_y_i = i_y_m; f_y_i < f_y_up_lim; f_y_i += f_y_increment) {
-                    if (f_y_i < 0 || f_y_i >= input_size_yx) {
-                        filter_channel += filter_size_x;
-                        continue;
-                    }
-                    const int x_up_bound = input_size_x + f_y_i;
-                    for (int f_x_i = f_y_i + i_x; f_x_i < f_x_up_lim + f_y_i;
-                         f_x_i += f_x_increment, filter_channel++) {
-                        if (f_x_i < f_y_i || f_x_i >= x_up_bound) {
-                            continue;
-                        }
+        int i_x = -pad_begin_x;
+        for (; i_x < i_x_first; i_x += stride_x) {
+            *out = convolve_point(i_y_m, i_x);
+            ++out;
+        }
 
-                        sum += input_channel[f_x_i] * filter_channel[0];
+        for (int i = 0; i < interior_count; i++)
+            out[i] = 0;
+
+        auto input_channel = batch;
+        auto filter_channel = filter;
+        size_t filter_channels_count = f_channels;
+        while (filter_channels_count--) {
+            for (int f_y = 0; f_y < filter_size_y; f_y++) {
+                const T* in_row = input_channel + i_y_m + f_y * f_y_increment + i_x_first;
+                for (int f_x = 0; f_x < filter_size_x; f_x++, filter_channel++) {
+                    const T weight = filter_channel[0];
+                    const T* in_pos = in_row + f_x * f_x_increment;
+                    for (int i = 0; i < interior_count; i++) {
+                        out[i] += in_pos[i * stride_x] * weight;
                     }
                 }
-                input_channel += input_size_yx;
             }
-            *out = sum;
+            input_channel += input_size_yx;
+        }
+        out += interior_count;
+
+        for (i_x = i_x_first + interior_count * stride_x; i_x <= i_x_lim; i_x += stride_x) {
+            *out = convolve_point(i_y_m, i_x);
             ++out;
         }
     }
@@ -165,46 +215,99 @@ void convolve_3D_channels(const ConvolutionParams& p,
     const int f_y_block = filter_size_y * f_y_increment;
     const int f_x_block = filter_size_x * f_x_increment;
 
+    // the general per-point path which handles the filter windows clipped by the padding
+    auto convolve_point = [&](const int s_z_shift, const int i_y_m, const int i_x) {
+        const int f_z_up_bound = f_z_block + s_z_shift;
+        auto input_channel = batch;
+        auto filter_channel = filter;
+        T sum = 0;
+        size_t filter_channels_count = f_channels;
+
+        while (filter_channels_count--) {
+            for (int f_z_i = s_z_shift; f_z_i < f_z_up_bound; f_z_i += f_z_increment) {
+                if (f_z_i < 0 || f_z_i >= input_size_zyx) {
+                    filter_channel += filter_size_yx;
+                    continue;
+                }
+                const int y_up_bound = f_z_i + input_size_yx;
+                const int y_shift = f_z_i + i_y_m;
+                for (int f_y_i = y_shift; f_y_i < f_y_block + y_shift; f_y_i += f_y_increment) {
+                    if (f_y_i < f_z_i || f_y_i >= y_up_bound) {
+                        filter_channel += filter_size_x;
+                        continue;
+                    }
+                    const int x_up_bound = input_size_x + f_y_i;
+                    for (int f_x_i = f_y_i + i_x; f_x_i < f_x_block + f_y_i + i_x;
+                         f_x_i += f_x_increment, filter_channel++) {
+                        if (f_x_i < f_y_i || f_x_i >= x_up_bound) {
+                            continue;
+                        }
+
+                        sum += input_channel[f_x_i] * filter_channel[0];
+                    }
+                }
+            }
+            input_channel += input_size_zyx;
+        }
+        return sum;
+    };
+
+    // output columns whose filter window lies fully inside the input row: for them the boundary
+    // checks are resolved once per row and the innermost loop runs branch-free over the output
+    // positions, so the compiler is able to vectorize it
+    const int k0 = pad_begin_x > 0 ? (pad_begin_x + stride_x - 1) / stride_x : 0;
+    const int i_x_first = -pad_begin_x + k0 * stride_x;
+    const int i_x_last = std::min(input_size_x - dilated_filter_size_x, i_x_lim);
+    const int interior_count = i_x_last >= i_x_first ? (i_x_last - i_x_first) / stride_x + 1 : 0;
+
     for (int i_z = -pad_begin_z; i_z <= i_z_lim; i_z += stride_z) {
         const int s_z_shift = i_z * input_size_yx;
-        const int f_z_up_bound = f_z_block + s_z_shift;
+        const bool z_inside = i_z >= 0 && i_z + dilated_filter_size_z <= input_size_z;
 
         for (int i_y = -pad_begin_y; i_y <= i_y_lim; i_y += stride_y) {
             const int i_y_m = i_y * input_size_x;
+            const bool y_inside = i_y >= 0 && i_y + dilated_filter_size_y <= input_size_y;
 
-            for (int i_x = -pad_begin_x; i_x <= i_x_lim; i_x += stride_x) {
-                auto input_channel = batch;
-                auto filter_channel = filter;
-                T sum = 0;
-                size_t filter_channels_count = f_channels;
-
-                while (filter_channels_count--) {
-                    for (int f_z_i = s_z_shift; f_z_i < f_z_up_bound; f_z_i += f_z_increment) {
-                        if (f_z_i < 0 || f_z_i >= input_size_zyx) {
-                            filter_channel += filter_size_yx;
-                            continue;
-                        }
-                        const int y_up_bound = f_z_i + input_size_yx;
-                        const int y_shift = f_z_i + i_y_m;
-                        for (int f_y_i = y_shift; f_y_i < f_y_block + y_shift; f_y_i += f_y_increment) {
-                            if (f_y_i < f_z_i || f_y_i >= y_up_bound) {
-                                filter_channel += filter_size_x;
-                                continue;
-                            }
-                            const int x_up_bound = input_size_x + f_y_i;
-                            for (int f_x_i = f_y_i + i_x; f_x_i < f_x_block + f_y_i + i_x;
-                                 f_x_i += f_x_increment, filter_channel++) {
-                                if (f_x_i < f_y_i || f_x_i >= x_up_bound) {
-                                    continue;
-                                }
-
-                                sum += input_channel[f_x_i] * filter_channel[0];
+            if (!z_inside || !y_inside || interior_count == 0) {
+                for (int i_x = -pad_begin_x; i_x <= i_x_lim; i_x += stride_x) {
+                    *out = convolve_point(s_z_shift, i_y_m, i_x);
+                    ++out;
+                }
+                continue;
+            }
+
+            int i_x = -pad_begin_x;
+            for (; i_x < i_x_first; i_x += stride_x) {
+                *out = convolve_point(s_z_shift, i_y_m, i_x);
+                ++out;
+            }
+
+            for (int i = 0; i < interior_count; i++)
+                out[i] = 0;
+
+            auto input_channel = batch;
+            auto filter_channel = filter;
+            size_t filter_channels_count = f_channels;
+            while (filter_channels_count--) {
+                for (int f_z = 0; f_z < filter_size_z; f_z++) {
+                    const int zy_shift = s_z_shift + f_z * f_z_increment + i_y_m;
+                    for (int f_y = 0; f_y < filter_size_y; f_y++) {
+                        const T* in_row = input_channel + zy_shift + f_y * f_y_increment + i_x_first;
+                        for (int f_x = 0; f_x < filter_size_x; f_x++, filter_channel++) {
+                            const T weight = filter_channel[0];
+                            const T* in_pos = in_row + f_x * f_x_increment;
+                            for (int i = 0; i < interior_count; i++) {
+                                out[i] += in_pos[i * stride_x] * weight;
                             }
                         }
                     }
-                    input_channel += input_size_zyx;
                 }
-                *out = sum;
+                input_channel += input_size_zyx;
+            }
+            out += interior_count;
+
+            for (i_x = i_x_first + interior_count * stride_x; i_x <= i_x_lim; i_x += stride_x) {
+                *out = convolve_point(s_z_shift, i_y_m, i_x);
                 ++out;
             }
         }
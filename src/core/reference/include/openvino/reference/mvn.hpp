@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cmath>
 #include <cstddef>
 
 #include "openvino/core/shape.hpp"
@@ -15,9 +16,73 @@
 #include "openvino/reference/reduce_sum.hpp"
 #include "openvino/reference/sqrt.hpp"
 #include "openvino/reference/subtract.hpp"
+#include "openvino/reference/utils/parallel_rows.hpp"
 
 namespace ov {
 namespace reference {
+
+// When the reduction covers exactly the trailing axes (the layer/instance norm style of MVN) the
+// data falls apart into independent contiguous rows; reports the row count and size in that case.
+inline bool mvn_reduces_to_rows(const Shape& in_shape,
+                                const AxisSet& reduction_axes,
+                                size_t& rows_count,
+                                size_t& row_size) {
+    const auto rank = in_shape.size();
+    bool trailing_axes = !reduction_axes.empty() && reduction_axes.size() <= rank;
+    for (const auto axis : reduction_axes) {
+        trailing_axes = trailing_axes && (axis + reduction_axes.size() >= rank) && (axis < rank);
+    }
+    if (!trailing_axes) {
+        return false;
+    }
+    rows_count = 1;
+    row_size = 1;
+    for (size_t i = 0; i < rank; i++) {
+        (i + reduction_axes.size() < rank ? rows_count : row_size) *= in_shape[i];
+    }
+    return row_size != 0;
+}
+
+// Normalizes independent contiguous rows directly, avoiding the temporary buffers and the
+// broadcasting arithmetic of the composed implementation.
+template <typename T>
+void mvn_rows(const T* arg,
+              T* out,
+              const size_t rows_count,
+              const size_t row_size,
+              const bool normalize_variance,
+              const double eps,
+              const bool eps_inside_sqrt) {
+    parallel_rows(rows_count, row_size, [=](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const T* in_row = arg + i * row_size;
+            T* out_row = out + i * row_size;
+            T sum = 0;
+            for (size_t j = 0; j < row_size; j++) {
+                sum += in_row[j];
+            }
+            const T mean = sum / static_cast<T>(row_size);
+            for (size_t j = 0; j < row_size; j++) {
+                out_row[j] = in_row[j] - mean;
+            }
+            if (!normalize_variance) {
+                continue;
+            }
+            T sqr_sum = 0;
+            for (size_t j = 0; j < row_size; j++) {
+                sqr_sum += out_row[j] * out_row[j];
+            }
+            const T variance = sqr_sum / static_cast<T>(row_size);
+            const T denominator = eps_inside_sqrt
+                                      ? static_cast<T>(std::sqrt(variance + static_cast<T>(eps)))
+                                      : static_cast<T>(std::sqrt(variance)) + static_cast<T>(eps);
+            for (size_t j = 0; j < row_size; j++) {
+                out_row[j] /= denominator;
+            }
+        }
+    });
+}
+
 template <typename T>
 void mvn(const T* arg,
          T* out,
@@ -25,6 +90,12 @@ void mvn(const T* arg,
          const bool normalize_variance,
          const AxisSet& reduction_axes,
          const double eps) {
+    size_t rows_count, row_size;
+    if (mvn_reduces_to_rows(in_shape, reduction_axes, rows_count, row_size)) {
+        mvn_rows(arg, out, rows_count, row_size, normalize_variance, eps, true);
+        return;
+    }
+
     auto reduced_shape = util::reduce_keep_dims(in_shape, reduction_axes);
     std::vector<T> tmp_buffer(shape_size(in_shape));
     reduce_mean(arg, tmp_buffer.data(), in_shape, reduction_axes);
@@ -55,6 +126,12 @@ void mvn_6(const T* arg,
            bool normalize_variance,
            double eps,
            op::MVNEpsMode eps_mode) {
+    size_t rows_count, row_size;
+    if (mvn_reduces_to_rows(in_shape, reduction_axes, rows_count, row_size)) {
+        mvn_rows(arg, out, rows_count, row_size, normalize_variance, eps, eps_mode == op::MVNEpsMode::INSIDE_SQRT);
+        return;
+    }
+
     auto reduced_shape = util::reduce_keep_dims(in_shape, reduction_axes);
     std::vector<T> tmp_buffer(shape_size(in_shape));
     reduce_mean(arg, tmp_buffer.data(), in_shape, reduction_axes);
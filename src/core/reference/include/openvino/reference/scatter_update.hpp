@@ -4,30 +4,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <numeric>
 
 #include "openvino/core/shape.hpp"
-#include "openvino/reference/utils/coordinate_transform.hpp"
-#include "openvino/util/common_util.hpp"
+#include "openvino/reference/utils/coordinate_index.hpp"
 
 namespace ov {
 namespace reference {
-static const CoordinateTransformBasic get_target_shape(const Shape& data_shape,
-                                                       const Coordinate& start_corner,
-                                                       const Coordinate& end_corner) {
-    const auto m_n_axes = data_shape.size();
-    Shape target_shape;
-    target_shape.reserve(m_n_axes);
-    AxisVector axis_order(m_n_axes);
-    std::iota(axis_order.begin(), axis_order.end(), 0);
-    const Strides strides(m_n_axes, 1);
-    for (size_t axis = 0; axis < m_n_axes; axis++) {
-        target_shape.push_back(
-            util::ceil_div(end_corner[axis_order[axis]] - start_corner[axis_order[axis]], strides[axis_order[axis]]));
-    }
-    return target_shape;
-}
-
 static void scatter_update(const char* input_data,
                            const int64_t* indices,
                            const char* updates,
@@ -45,17 +30,6 @@ static void scatter_update(const char* input_data,
     // where first ... in the data corresponds to first axis dimensions,
     // last ... in the data corresponds to the rank(data) - (axis + 1) dimensions.
 
-    //
-    // for i_coord in indices[m, n, ..., p]:
-    //     # get linear index
-    //     i_idx = index(i_coord)
-    //     # simultaneously iterate over two slices of data with same elements count
-    //     for d_coord in slice data[..., i_idx, ...],
-    //         u_coord in slice updates[..., i_coord, ...]
-    //          data[index(d_coord)] = updates[index(u_coord)]
-    CoordinateTransformBasic indices_transform{indices_shape};
-    const auto indices_in_strides = row_major_strides(indices_shape);
-
     size_t indices_ndim = indices_shape.size();
     size_t updates_ndim = updates_shape.size();
     size_t data_ndim = data_shape.size();
@@ -79,64 +53,40 @@ static void scatter_update(const char* input_data,
     if (updates_axis_dim >= updates_ndim)
         updates_axis_dim = updates_ndim - 1;
 
-    Coordinate updates_indices_start_corner(updates_ndim, 0);
-    Coordinate updates_indices_end_corner(updates_ndim, 1);
-
+    // The copied slices have the same shape on every iteration: a single element along the axis
+    // dimension of data and along the indices dimensions of updates, the full extent elsewhere.
+    // Their flat indices are walked incrementally instead of recomputing a coordinate dot
+    // product per element.
+    const auto data_strides = row_major_strides(data_shape);
+    const auto updates_strides = row_major_strides(updates_shape);
+
+    Shape data_slice_shape{data_shape};
+    data_slice_shape[axis] = 1;
+    Shape updates_slice_shape{updates_shape};
+    size_t updates_indices_size = 1;
     for (size_t i = 0; i < indices_ndim; ++i) {
-        updates_indices_end_corner[axis + i] = updates_shape[axis + i];
+        updates_indices_size *= updates_shape[axis + i];
+        updates_slice_shape[axis + i] = 1;
     }
 
-    const auto updates_indices_transform =
-        get_target_shape(updates_shape, updates_indices_start_corner, updates_indices_end_corner);
-    auto updates_indices_coord_iter = updates_indices_transform.begin();
-
-    int iteration{0};
-    for (const Coordinate& indices_cord : indices_transform) {
-        const size_t indices_idx =
-            std::inner_product(indices_cord.begin(), indices_cord.end(), indices_in_strides.begin(), uint64_t(0));
-        int64_t slice_index = indices[indices_idx];
-
-        Coordinate out_start_corner(data_shape.size(), 0);
-        Coordinate out_end_corner(data_shape);
-        out_start_corner[axis] = static_cast<size_t>(slice_index);
-        out_end_corner[axis] = out_start_corner[axis] + 1;
-
-        const auto out_transform = get_target_shape(data_shape, out_start_corner, out_end_corner);
-        const auto out_transform_in_strides = row_major_strides(data_shape);
-
-        if (updates_indices_coord_iter == updates_indices_transform.end())
-            break;
-        Coordinate updates_update_start_corner = *updates_indices_coord_iter;
-        Coordinate updates_update_end_corner(updates_shape);
-        for (size_t i = 0; i < indices_ndim; ++i) {
-            updates_update_end_corner[axis + i] = updates_update_start_corner[axis + i] + 1;
-        }
-
-        const auto updates_update_transform =
-            get_target_shape(updates_shape, updates_update_start_corner, updates_update_end_corner);
-        const auto updates_update_in_strides = row_major_strides(updates_shape);
-        auto updates_update_coord_iter = updates_update_transform.begin();
-
-        for (const Coordinate& out_cord : out_transform) {
-            if (updates_update_coord_iter == updates_update_transform.end())
-                break;
-            Coordinate update_cord = *updates_update_coord_iter;
-            Coordinate out_coord = out_cord;
-            out_coord.at(axis) = slice_index;
-            update_cord.at(updates_axis_dim) += iteration;
-            const auto data_idx =
-                std::inner_product(out_coord.begin(), out_coord.end(), out_transform_in_strides.begin(), uint64_t(0));
-            const auto updates_idx = std::inner_product(update_cord.begin(),
-                                                        update_cord.end(),
-                                                        updates_update_in_strides.begin(),
-                                                        uint64_t(0)) *
-                                     elem_size;
-
-            std::copy(updates + updates_idx, updates + (updates_idx + elem_size), out_buf + data_idx * elem_size);
-            updates_update_coord_iter++;
-        }
-        updates_indices_coord_iter++;
-        iteration++;
+    if (shape_size(data_slice_shape) == 0 || shape_size(updates_slice_shape) == 0)
+        return;
+
+    const auto num_of_updates = std::min(shape_size(indices_shape), updates_indices_size);
+    for (size_t iteration = 0; iteration < num_of_updates; ++iteration) {
+        const int64_t slice_index = indices[iteration];
+
+        CoordinateIndexIterator out_iter(data_slice_shape,
+                                         data_strides,
+                                         static_cast<size_t>(slice_index) * data_strides[axis]);
+        CoordinateIndexIterator updates_iter(updates_slice_shape,
+                                             updates_strides,
+                                             iteration * updates_strides.at(updates_axis_dim));
+        do {
+            std::memcpy(out_buf + out_iter.index() * elem_size,
+                        updates + updates_iter.index() * elem_size,
+                        elem_size);
+        } while (out_iter.increment() && updates_iter.increment());
     }
 }
 }  // namespace reference
@@ -4,18 +4,60 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/reduce_max.hpp"
 #include "openvino/reference/reduce_sum.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_rows.hpp"
 
 namespace ov {
 namespace reference {
 template <typename T>
 void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes) {
+    const auto rank = shape.size();
+
+    // the usual case of the reduced axes being the trailing ones, e.g. the classic last-axis
+    // softmax: the data falls apart into independent contiguous rows which are normalized with
+    // plain vectorizable loops instead of the per-element coordinate arithmetic below
+    bool trailing_axes = !axes.empty() && axes.size() <= rank;
+    for (const auto axis : axes) {
+        trailing_axes = trailing_axes && (axis + axes.size() >= rank) && (axis < rank);
+    }
+    if (trailing_axes) {
+        size_t rows_count = 1;
+        size_t row_size = 1;
+        for (size_t i = 0; i < rank; i++) {
+            (i + axes.size() < rank ? rows_count : row_size) *= shape[i];
+        }
+        if (row_size == 0) {
+            return;
+        }
+        parallel_rows(rows_count, row_size, [=](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                const T* in_row = arg + i * row_size;
+                T* out_row = out + i * row_size;
+                T max = std::numeric_limits<T>::lowest();
+                for (size_t j = 0; j < row_size; j++) {
+                    max = std::max(max, in_row[j]);
+                }
+                T sum = 0;
+                for (size_t j = 0; j < row_size; j++) {
+                    out_row[j] = static_cast<T>(std::exp(in_row[j] - max));
+                    sum += out_row[j];
+                }
+                for (size_t j = 0; j < row_size; j++) {
+                    out_row[j] /= sum;
+                }
+            }
+        });
+        return;
+    }
+
     const auto temp_shape = util::reduce_keep_dims(shape, axes);
     const auto temp_elements = shape_size(temp_shape);
     auto temp_storage = std::vector<T>(temp_elements);
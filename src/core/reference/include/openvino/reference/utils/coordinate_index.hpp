@@ -22,4 +22,35 @@ std::size_t coordinate_index(const Coordinate& c, const Shape& s);
  */
 size_t coordinate_offset(const std::vector<size_t>& coordinate, const std::vector<size_t>& strides);
 
+/// \brief Walks the flat indices of an iteration shape embedded into a tensor with the given
+///        per-dimension strides, visiting the elements in row-major order.
+///
+/// The running index is kept up to date with an incremental carry, so advancing costs O(1)
+/// amortized instead of the O(rank) coordinate dot product per element. Strides are applied
+/// with modular arithmetic, so negative effective steps may be passed as their two's
+/// complement size_t representation.
+class CoordinateIndexIterator {
+public:
+    /// \brief Constructs the iterator positioned on the first element.
+    /// \param iteration_shape Extents of the iterated dimensions, one per stride.
+    /// \param strides         Flat index distance between neighbours along each dimension.
+    /// \param start_index     Flat index of the first iterated element.
+    CoordinateIndexIterator(const Shape& iteration_shape, const std::vector<size_t>& strides, size_t start_index = 0);
+
+    /// \brief Flat index of the current element in the underlying tensor.
+    size_t index() const noexcept {
+        return m_index;
+    }
+
+    /// \brief Advances to the next element in row-major order.
+    /// \return false when the iteration wrapped past the last element.
+    bool increment() noexcept;
+
+private:
+    Shape m_iteration_shape;
+    std::vector<size_t> m_strides;
+    Coordinate m_coordinate;
+    size_t m_index;
+};
+
 }  // namespace ov
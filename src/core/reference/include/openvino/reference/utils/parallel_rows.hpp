@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace ov {
+namespace reference {
+
+/**
+ * @brief Runs a callable over a range of independent rows, splitting the range between
+ * std::async tasks when the amount of work justifies the threading overhead.
+ *
+ * std::async keeps the reference kernels dependency-free: the threading backend macros of
+ * openvino/core/parallel.hpp are not necessarily defined for every consumer of these headers.
+ *
+ * @param rows     Number of independent rows to process.
+ * @param row_size Number of elements in one row, used to estimate the amount of work.
+ * @param fn       Callable invoked as fn(row_begin, row_end) covering the range exactly once.
+ */
+template <typename F>
+void parallel_rows(const size_t rows, const size_t row_size, F&& fn) {
+    // below this amount of work the task setup costs more than the processing itself
+    constexpr size_t min_elements_per_task = 32768;
+
+    size_t tasks = std::thread::hardware_concurrency() / 2;
+    if (tasks == 0) {
+        tasks = 1;
+    }
+    tasks = std::min(tasks, rows);
+    tasks = std::min(tasks, rows * row_size / min_elements_per_task);
+
+    if (tasks <= 1) {
+        fn(size_t(0), rows);
+        return;
+    }
+
+    const size_t rows_per_task = (rows + tasks - 1) / tasks;
+    std::vector<std::future<void>> futures;
+    futures.reserve(tasks - 1);
+    for (size_t t = 1; t < tasks; t++) {
+        const size_t begin = t * rows_per_task;
+        const size_t end = std::min(begin + rows_per_task, rows);
+        if (begin >= end) {
+            break;
+        }
+        futures.push_back(std::async(std::launch::async, [begin, end, &fn] {
+            fn(begin, end);
+        }));
+    }
+    fn(size_t(0), rows_per_task);
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+}  // namespace reference
+}  // namespace ov
@@ -7,6 +7,7 @@
 #include <cstring>
 
 #include "openvino/core/except.hpp"
+#include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_range.hpp"
 #include "openvino/util/common_util.hpp"
 
@@ -41,16 +42,20 @@ void slice(const char* data,
     }
 
     // Slice elements
+    // The input index is walked incrementally along the output coordinates instead of being
+    // reconstructed with a div/mod chain per element; negative steps are applied through the
+    // modular size_t arithmetic of the iterator.
     const auto in_data_strides = row_major_strides(data_shape);
-    const auto out_data_strides = row_major_strides(out_shape);
-    std::vector<int64_t> in_data_coord(aligned_starts);
-    for (size_t out_idx = 0; out_idx < shape_size(out_shape); ++out_idx) {
-        for (size_t i = 0; i < in_data_coord.size(); ++i) {
-            in_data_coord[i] = aligned_starts[i] + (out_idx / out_data_strides[i] % out_shape[i]) * aligned_steps[i];
-        }
-        const auto in_idx =
-            std::inner_product(in_data_coord.begin(), in_data_coord.end(), in_data_strides.begin(), uint64_t(0));
-        const auto in_mem = data + in_idx * elem_size;
+    std::vector<size_t> in_data_steps(data_rank);
+    for (size_t i = 0; i < data_rank; ++i) {
+        in_data_steps[i] = static_cast<size_t>(aligned_steps[i]) * in_data_strides[i];
+    }
+    const auto in_start_idx =
+        std::inner_product(aligned_starts.begin(), aligned_starts.end(), in_data_strides.begin(), uint64_t(0));
+    CoordinateIndexIterator in_idx_iter(out_shape, in_data_steps, static_cast<size_t>(in_start_idx));
+    const auto out_size = shape_size(out_shape);
+    for (size_t out_idx = 0; out_idx < out_size; ++out_idx, in_idx_iter.increment()) {
+        const auto in_mem = data + in_idx_iter.index() * elem_size;
         std::memcpy(out, in_mem, elem_size);
         out += elem_size;
     }
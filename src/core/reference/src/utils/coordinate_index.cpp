@@ -29,4 +29,28 @@ std::size_t coordinate_index(const Coordinate& c, const Shape& s) {
 size_t coordinate_offset(const std::vector<size_t>& coordinate, const std::vector<size_t>& strides) {
     return std::inner_product(coordinate.cbegin(), coordinate.cend(), strides.cbegin(), static_cast<size_t>(0));
 }
+
+CoordinateIndexIterator::CoordinateIndexIterator(const Shape& iteration_shape,
+                                                 const std::vector<size_t>& strides,
+                                                 size_t start_index)
+    : m_iteration_shape(iteration_shape),
+      m_strides(strides),
+      m_coordinate(iteration_shape.size(), 0),
+      m_index(start_index) {
+    if (m_iteration_shape.size() != m_strides.size()) {
+        throw std::domain_error("Iteration shape rank differs from the strides rank.");
+    }
+}
+
+bool CoordinateIndexIterator::increment() noexcept {
+    for (size_t dim = m_iteration_shape.size(); dim-- > 0;) {
+        m_index += m_strides[dim];
+        if (++m_coordinate[dim] < m_iteration_shape[dim]) {
+            return true;
+        }
+        m_index -= m_coordinate[dim] * m_strides[dim];
+        m_coordinate[dim] = 0;
+    }
+    return false;
+}
 }  // namespace ov
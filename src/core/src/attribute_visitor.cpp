@@ -21,13 +21,27 @@ string ov::AttributeVisitor::finish_structure() {
 }
 
 string ov::AttributeVisitor::get_name_with_context() {
-    ostringstream result;
-    string sep = "";
+    // This runs once per visited attribute; the common flat-attribute case must not pay
+    // for stream machinery or joining
+    if (m_context.empty()) {
+        return {};
+    }
+    if (m_context.size() == 1) {
+        return m_context.front();
+    }
+    size_t length = m_context.size() - 1;
     for (const auto& c : m_context) {
-        result << sep << c;
-        sep = ".";
+        length += c.size();
     }
-    return result.str();
+    string result;
+    result.reserve(length);
+    for (size_t i = 0; i < m_context.size(); ++i) {
+        if (i != 0) {
+            result += '.';
+        }
+        result += m_context[i];
+    }
+    return result;
 }
 
 void ov::AttributeVisitor::on_adapter(const std::string& name, VisitorAdapter& adapter) {
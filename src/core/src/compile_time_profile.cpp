@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/compile_time_profile.hpp"
+
+namespace {
+
+// Accumulator of the innermost owning scope of the current thread; stages recorded while
+// it is null are dropped.
+thread_local std::map<std::string, double>* active_durations_ms = nullptr;
+
+}  // namespace
+
+bool ov::util::compile_time_profile_enabled() {
+    return active_durations_ms != nullptr;
+}
+
+void ov::util::compile_time_profile_add(const std::string& stage, std::chrono::nanoseconds duration) {
+    if (active_durations_ms) {
+        (*active_durations_ms)[stage] += duration.count() / 1e6;
+    }
+}
+
+ov::util::CompileTimeProfileScope::CompileTimeProfileScope() {
+    if (active_durations_ms == nullptr) {
+        active_durations_ms = &m_durations_ms;
+        m_owner = true;
+    }
+}
+
+ov::util::CompileTimeProfileScope::~CompileTimeProfileScope() {
+    if (m_owner) {
+        active_durations_ms = nullptr;
+    }
+}
+
+std::map<std::string, double> ov::util::CompileTimeProfileScope::take() {
+    std::map<std::string, double> result;
+    result.swap(m_durations_ms);
+    return result;
+}
@@ -31,6 +31,7 @@ ov::descriptor::Input::~Input() {
 }
 
 void ov::descriptor::Input::replace_output(Output& new_output) {
+    const auto old_src_node = m_src_node;
     if (m_output != nullptr) {
         m_output->remove_input(this);
     }
@@ -38,12 +39,18 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
     m_output = &new_output;
     m_src_node = std::shared_ptr<ov::Node>(new_output.get_node());
 
-    // Output replacement may change the topological order of nodes,
-    // so we have to reset cache by setting a flag into shared node info.
+    // Output replacement may change the topological order of nodes. Register both
+    // the new producer (its position has to be derived) and the old one (it may
+    // have become detached) as pending local updates, so Model::get_ordered_ops
+    // can patch the cached order in place; the cache is dropped only when the
+    // pending budget is exhausted (SharedRTInfo::add_pending_topological_update
+    // handles both).
     for_each(m_node->m_shared_rt_info.cbegin(),
              m_node->m_shared_rt_info.cend(),
-             [](const std::shared_ptr<SharedRTInfo>& info) {
-                 info->set_use_topological_cache(false);
+             [this, &old_src_node](const std::shared_ptr<SharedRTInfo>& info) {
+                 if (old_src_node)
+                     info->add_pending_topological_update(old_src_node);
+                 info->add_pending_topological_update(m_src_node);
              });
 }
 
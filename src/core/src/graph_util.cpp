@@ -30,31 +30,44 @@ void clone_ov_nodes(const std::vector<std::shared_ptr<ov::Node>>& nodes,
     // for each node in topological order
     for (const auto& node : nodes) {
         if (!node_map.count(node.get())) {
-            // get (already) cloned arguments and clone the node
-            ov::OutputVector cloned_args;
-            for (const auto& input : node->inputs()) {
-                ov::Output<ov::Node> output = input.get_source_output();
-                cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
-            }
-            std::vector<std::shared_ptr<ov::Node>> cloned_dependencies;
-            for (const auto& dependency : node->get_control_dependencies()) {
-                std::shared_ptr<ov::Node>& dependent = node_map.at(dependency.get());
-                if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
-                    cloned_dependencies.end()) {
-                    cloned_dependencies.push_back(dependent);
+            std::shared_ptr<ov::Node> cloned_node;
+            const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+            if (constant && node->get_control_dependencies().empty()) {
+                // Copy-on-write path for weights: the copy constructor shares the
+                // refcounted data buffer, so only the lightweight node shell is
+                // duplicated and no weight memory is copied
+                cloned_node = std::make_shared<ov::op::v0::Constant>(*constant);
+            } else {
+                // get (already) cloned arguments and clone the node
+                ov::OutputVector cloned_args;
+                for (const auto& input : node->inputs()) {
+                    ov::Output<ov::Node> output = input.get_source_output();
+                    cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
+                }
+                std::vector<std::shared_ptr<ov::Node>> cloned_dependencies;
+                for (const auto& dependency : node->get_control_dependencies()) {
+                    std::shared_ptr<ov::Node>& dependent = node_map.at(dependency.get());
+                    if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
+                        cloned_dependencies.end()) {
+                        cloned_dependencies.push_back(dependent);
+                    }
                 }
+                cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
             }
-            auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
             // There is a friendly name for this node so copy it
             cloned_node->set_friendly_name(node->get_friendly_name());
-            cloned_node->get_rt_info() = node->get_rt_info();
+            // Node and port metadata is copied only when present; the contained
+            // ov::Any values share their payload with the source model anyway
+            if (!node->get_rt_info().empty())
+                cloned_node->get_rt_info() = node->get_rt_info();
 
             for (const auto& output : node->outputs()) {
                 cloned_node->output(output.get_index()).get_tensor().clone_from(output.get_tensor());
             }
 
             for (const auto& input : node->inputs()) {
-                cloned_node->input(input.get_index()).get_rt_info() = input.get_rt_info();
+                if (!input.get_rt_info().empty())
+                    cloned_node->input(input.get_index()).get_rt_info() = input.get_rt_info();
             }
 
             node_map[node.get()] = cloned_node;
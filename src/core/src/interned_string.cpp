@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "interned_string.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace ov {
+namespace util {
+
+namespace {
+std::mutex intern_mutex;
+
+// Deliberately leaked so interned handles released during static destruction
+// never touch a destroyed table
+std::unordered_map<std::string, std::weak_ptr<const std::string>>& intern_table() {
+    static auto* table = new std::unordered_map<std::string, std::weak_ptr<const std::string>>();
+    return *table;
+}
+}  // namespace
+
+std::shared_ptr<const std::string> intern_string(const std::string& str) {
+    std::lock_guard<std::mutex> lock(intern_mutex);
+    auto& table = intern_table();
+    const auto it = table.find(str);
+    if (it != table.end()) {
+        if (auto existing = it->second.lock()) {
+            return existing;
+        }
+    }
+    std::shared_ptr<const std::string> handle(new std::string(str), [](const std::string* stored) {
+        {
+            std::lock_guard<std::mutex> lock(intern_mutex);
+            auto& table = intern_table();
+            const auto entry = table.find(*stored);
+            // The entry may have been re-interned concurrently; erase only if expired
+            if (entry != table.end() && entry->second.expired()) {
+                table.erase(entry);
+            }
+        }
+        delete stored;
+    });
+    table[str] = handle;
+    return handle;
+}
+
+}  // namespace util
+}  // namespace ov
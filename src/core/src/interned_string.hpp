@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace util {
+
+/// \brief Returns a refcounted handle to a globally deduplicated copy of the string.
+///
+/// Equal strings share one allocation (hash-consing), which collapses the duplicate
+/// node names created when the same model is loaded several times. Entries are
+/// dropped from the table once the last handle dies, so unloading models releases
+/// the memory again.
+std::shared_ptr<const std::string> intern_string(const std::string& str);
+
+}  // namespace util
+}  // namespace ov
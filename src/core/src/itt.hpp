@@ -49,24 +49,3 @@ OV_CC_DOMAINS(ov_opset);
 #    define REGISTER_OP(opset_name, op_name)
 #    define INSERT_OP(opset_name, op_name, op_namespace) opset.insert<op_namespace::op_name>()
 #endif
-
-#define OPENVINO_TYPE_CASE(region, a, ...)                      \
-    case ov::element::Type_t::a: {                              \
-        OV_SCOPE(ov_op, OV_PP_CAT3(region, _, a)) {             \
-            rc = evaluate<ov::element::Type_t::a>(__VA_ARGS__); \
-        }                                                       \
-    } break
-
-#define OPENVINO_2_TYPES_CASE(region, a, b, ...)                                \
-    case element::Type_t::a: {                                                  \
-        OV_SCOPE(ov_op, OV_PP_CAT4(region, _, a, b)) {                          \
-            rc = evaluate<element::Type_t::a, element::Type_t::b>(__VA_ARGS__); \
-        }                                                                       \
-    } break
-
-#define OPENVINO_COPY_TENSOR(region, a, ...)                       \
-    case ov::element::Type_t::a: {                                 \
-        OV_SCOPE(ov_op, OV_PP_CAT3(region, _, a)) {                \
-            rc = copy_tensor<ov::element::Type_t::a>(__VA_ARGS__); \
-        }                                                          \
-    } break
@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/memory_arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace ov {
+namespace util {
+
+namespace {
+thread_local std::shared_ptr<MemoryArena> current_arena;
+}  // namespace
+
+MemoryArena::MemoryArena(size_t block_size) : m_block_size{block_size} {}
+
+MemoryArena::~MemoryArena() = default;
+
+void* MemoryArena::allocate(size_t size, size_t alignment) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+    if (m_blocks.empty() || offset + size > m_block_capacity) {
+        const size_t block_size = std::max(m_block_size, size + alignment);
+        m_blocks.emplace_back(new char[block_size]);
+        m_block_capacity = block_size;
+        m_capacity += block_size;
+        offset = (reinterpret_cast<uintptr_t>(m_blocks.back().get()) % alignment == 0)
+                     ? 0
+                     : alignment - reinterpret_cast<uintptr_t>(m_blocks.back().get()) % alignment;
+    }
+    m_offset = offset + size;
+    ++m_live;
+    return m_blocks.back().get() + offset;
+}
+
+void MemoryArena::deallocate(void*, size_t) noexcept {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_live;
+}
+
+size_t MemoryArena::get_live_allocations() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_live;
+}
+
+size_t MemoryArena::get_capacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+const std::shared_ptr<MemoryArena>& MemoryArena::current() {
+    return current_arena;
+}
+
+ArenaScope::ArenaScope(std::shared_ptr<MemoryArena> arena) : m_previous{std::move(current_arena)} {
+    current_arena = std::move(arena);
+}
+
+ArenaScope::~ArenaScope() {
+    current_arena = std::move(m_previous);
+}
+
+}  // namespace util
+}  // namespace ov
@@ -3,18 +3,22 @@
 //
 
 #include <algorithm>
+#include <limits>
 #include <list>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "evaluator.hpp"
 #include "itt.hpp"
 #include "layout_utils.hpp"
 #include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/graph_util.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/util/op_types.hpp"
@@ -88,6 +92,243 @@ const std::shared_ptr<ov::Node>& verify_node(const std::shared_ptr<ov::Node>& no
     return node;
 }
 
+// Runs Node::revalidate_and_infer_types() concurrently for nodes which belong to the
+// same dependency level of the ordered op list: such nodes only read results produced
+// by earlier levels and write their own output descriptors, so they are independent.
+// Returns false when the graph is too small (or the build is sequential) and the
+// caller has to revalidate serially.
+bool parallel_revalidate_nodes(const std::vector<std::shared_ptr<ov::Node>>& ordered_ops) {
+#if OV_THREAD == OV_THREAD_SEQ
+    (void)ordered_ops;
+    return false;
+#else
+    // Level partitioning and thread dispatch only pay off on large graphs
+    constexpr size_t min_graph_size = 512;
+    constexpr size_t min_level_size = 4;
+    if (ordered_ops.size() < min_graph_size)
+        return false;
+
+    std::unordered_map<ov::Node*, size_t> levels;
+    levels.reserve(ordered_ops.size());
+    size_t num_levels = 0;
+    for (const auto& node : ordered_ops) {
+        size_t level = 0;
+        for (size_t i = 0; i < node->get_input_size(); ++i) {
+            const auto it = levels.find(node->get_input_node_ptr(i));
+            if (it != levels.end())
+                level = std::max(level, it->second + 1);
+        }
+        for (const auto& dependency : node->get_control_dependencies()) {
+            const auto it = levels.find(dependency.get());
+            if (it != levels.end())
+                level = std::max(level, it->second + 1);
+        }
+        levels[node.get()] = level;
+        num_levels = std::max(num_levels, level + 1);
+    }
+
+    std::vector<std::vector<ov::Node*>> buckets(num_levels);
+    for (const auto& node : ordered_ops)
+        buckets[levels[node.get()]].push_back(node.get());
+
+    for (const auto& bucket : buckets) {
+        if (bucket.size() < min_level_size) {
+            for (auto* node : bucket)
+                node->revalidate_and_infer_types();
+        } else {
+            std::exception_ptr first_error;
+            std::mutex error_mutex;
+            ov::parallel_for(bucket.size(), [&](size_t i) {
+                try {
+                    bucket[i]->revalidate_and_infer_types();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!first_error)
+                        first_error = std::current_exception();
+                }
+            });
+            if (first_error)
+                std::rethrow_exception(first_error);
+        }
+    }
+    return true;
+#endif
+}
+
+// Splices nodes introduced by local graph rewrites into an already sorted op list,
+// so repeated get_ordered_ops() calls after matcher rewrites cost O(changed region)
+// instead of a full topological re-sort. Each pending node which is not yet cached
+// is expanded to the subgraph of its new ancestors; the subgraph is inserted right
+// before its earliest cached user once it is proven that all of its cached producers
+// come earlier. Returns false when a safe placement cannot be derived and the
+// caller has to fall back to a full re-sort.
+bool patch_topological_order(std::vector<std::shared_ptr<ov::Node>>& order,
+                             const std::vector<std::shared_ptr<ov::Node>>& pending,
+                             const std::unordered_set<ov::Node*>& cached_ops,
+                             std::vector<std::shared_ptr<ov::Node>>& new_nodes,
+                             std::unordered_set<ov::Node*>& removed_nodes) {
+    // A rewrite touching more nodes than this is cheaper to handle with a full sort
+    constexpr size_t max_patch_size = 256;
+
+    std::unordered_map<ov::Node*, size_t> position;
+    position.reserve(order.size());
+    for (size_t i = 0; i < order.size(); ++i)
+        position[order[i].get()] = i;
+
+    struct Chunk {
+        size_t anchor;
+        std::vector<std::shared_ptr<ov::Node>> nodes;
+    };
+    std::vector<Chunk> chunks;
+    std::unordered_set<ov::Node*> in_chunks;
+
+    std::vector<std::shared_ptr<ov::Node>> cached_pending;
+    for (const auto& root : pending) {
+        if (cached_ops.count(root.get())) {
+            cached_pending.push_back(root);
+            continue;
+        }
+        if (in_chunks.count(root.get()))
+            continue;
+
+        // Collect the subgraph of new (not yet cached) ancestors in topological order
+        std::vector<std::shared_ptr<ov::Node>> chunk_nodes;
+        std::unordered_set<ov::Node*> visiting;
+        std::vector<std::pair<ov::Node*, bool>> stack{{root.get(), false}};
+        while (!stack.empty()) {
+            const auto entry = stack.back();
+            stack.pop_back();
+            if (entry.second) {
+                chunk_nodes.push_back(entry.first->shared_from_this());
+                in_chunks.insert(entry.first);
+                continue;
+            }
+            if (in_chunks.count(entry.first) || !visiting.insert(entry.first).second)
+                continue;
+            stack.emplace_back(entry.first, true);
+            for (size_t i = 0; i < entry.first->get_input_size(); ++i) {
+                auto* producer = entry.first->get_input_node_ptr(i);
+                if (!cached_ops.count(producer) && !in_chunks.count(producer))
+                    stack.emplace_back(producer, false);
+            }
+            for (const auto& dependency : entry.first->get_control_dependencies()) {
+                if (!cached_ops.count(dependency.get()) && !in_chunks.count(dependency.get()))
+                    stack.emplace_back(dependency.get(), false);
+            }
+            if (visiting.size() > max_patch_size)
+                return false;
+        }
+
+        // The chunk goes right before its earliest cached user and must not precede
+        // any of its cached producers
+        size_t anchor = std::numeric_limits<size_t>::max();
+        size_t last_producer = 0;
+        for (const auto& chunk_node : chunk_nodes) {
+            for (size_t i = 0; i < chunk_node->get_output_size(); ++i) {
+                for (const auto& target_input : chunk_node->get_output_target_inputs(i)) {
+                    const auto user_it = position.find(target_input.get_node());
+                    if (user_it != position.end())
+                        anchor = std::min(anchor, user_it->second);
+                }
+            }
+            for (size_t i = 0; i < chunk_node->get_input_size(); ++i) {
+                auto* producer = chunk_node->get_input_node_ptr(i);
+                if (in_chunks.count(producer))
+                    continue;
+                const auto producer_it = position.find(producer);
+                if (producer_it == position.end())
+                    return false;
+                last_producer = std::max(last_producer, producer_it->second + 1);
+            }
+        }
+        if (anchor == std::numeric_limits<size_t>::max() || last_producer > anchor)
+            return false;
+        chunks.push_back({anchor, std::move(chunk_nodes)});
+    }
+
+    // Old producers which lost their last user are detached from the model now and
+    // have to leave the cached order; detachment cascades into producers used only
+    // by the detached region. Liveness of a user outside this model cannot be
+    // proven here, so such cases fall back to a full re-sort.
+    const auto is_pinned = [](ov::Node* node) {
+        return ov::op::util::is_parameter(node) || ov::op::util::is_output(node) || ov::op::util::is_sink(node);
+    };
+    std::vector<ov::Node*> removal_candidates;
+    for (const auto& node : cached_pending)
+        removal_candidates.push_back(node.get());
+    while (!removal_candidates.empty()) {
+        auto* candidate = removal_candidates.back();
+        removal_candidates.pop_back();
+        if (removed_nodes.count(candidate) || is_pinned(candidate) || !position.count(candidate))
+            continue;
+        bool live = false;
+        bool unknown_user = false;
+        for (size_t i = 0; i < candidate->get_output_size() && !live; ++i) {
+            for (const auto& target_input : candidate->get_output_target_inputs(i)) {
+                auto* user = target_input.get_node();
+                if (removed_nodes.count(user))
+                    continue;
+                if (position.count(user) || in_chunks.count(user)) {
+                    live = true;
+                    break;
+                }
+                unknown_user = true;
+            }
+        }
+        if (live)
+            continue;
+        if (unknown_user)
+            return false;
+        removed_nodes.insert(candidate);
+        for (size_t i = 0; i < candidate->get_input_size(); ++i)
+            removal_candidates.push_back(candidate->get_input_node_ptr(i));
+        for (const auto& dependency : candidate->get_control_dependencies())
+            removal_candidates.push_back(dependency.get());
+    }
+
+    // Consumers rewired onto an already placed node keep the order valid only if
+    // all remaining users of that node come after it
+    for (const auto& root : cached_pending) {
+        if (removed_nodes.count(root.get()))
+            continue;
+        const auto pos_it = position.find(root.get());
+        if (pos_it == position.end())
+            return false;
+        for (size_t i = 0; i < root->get_output_size(); ++i) {
+            for (const auto& target_input : root->get_output_target_inputs(i)) {
+                const auto user_it = position.find(target_input.get_node());
+                if (user_it != position.end() && !removed_nodes.count(target_input.get_node()) &&
+                    user_it->second <= pos_it->second)
+                    return false;
+            }
+        }
+    }
+
+    if (chunks.empty() && removed_nodes.empty())
+        return true;
+
+    std::stable_sort(chunks.begin(), chunks.end(), [](const Chunk& lhs, const Chunk& rhs) {
+        return lhs.anchor < rhs.anchor;
+    });
+
+    std::vector<std::shared_ptr<ov::Node>> patched;
+    patched.reserve(order.size() + in_chunks.size());
+    size_t chunk_idx = 0;
+    for (size_t i = 0; i < order.size(); ++i) {
+        while (chunk_idx < chunks.size() && chunks[chunk_idx].anchor == i) {
+            for (auto& chunk_node : chunks[chunk_idx].nodes) {
+                new_nodes.push_back(chunk_node);
+                patched.push_back(std::move(chunk_node));
+            }
+            ++chunk_idx;
+        }
+        if (!removed_nodes.count(order[i].get()))
+            patched.push_back(order[i]);
+    }
+    order.swap(patched);
+    return true;
+}
+
 }  // namespace
 
 ov::Model::Model(const ResultVector& results, const ov::ParameterVector& parameters, const std::string& name)
@@ -224,8 +465,13 @@ void ov::Model::validate_nodes_and_infer_types() const {
     std::stringstream unregistered_variables;
     std::unordered_set<const ov::descriptor::Tensor*> tensors;
 
-    for (auto& node : get_ordered_ops()) {
-        node->revalidate_and_infer_types();
+    const auto ordered_ops = get_ordered_ops();
+    // Independent levels of large graphs are revalidated concurrently; the loop
+    // below then only performs the serial bookkeeping
+    const bool revalidated = parallel_revalidate_nodes(ordered_ops);
+    for (auto& node : ordered_ops) {
+        if (!revalidated)
+            node->revalidate_and_infer_types();
         for (const auto& output : node->outputs()) {
             const auto& tensor = output.get_tensor();
             // Skip results outputs tensors because result_input_tensor == result_output_tensor
@@ -273,7 +519,33 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
                 nodes.emplace_back(locked_node);
             }
         }
-        return nodes;
+        if (!m_shared_rt_info->has_pending_topological_updates()) {
+            return nodes;
+        }
+        // Local rewrites happened since the cache was built; try to patch the cached
+        // order in place instead of re-sorting the whole graph
+        const auto pending = m_shared_rt_info->take_pending_topological_updates();
+        for (auto* destroyed_node : m_shared_rt_info->take_pending_cleanups()) {
+            m_cached_ops.erase(destroyed_node);
+        }
+        NodeVector new_nodes;
+        std::unordered_set<Node*> removed_nodes;
+        if (patch_topological_order(nodes, pending, m_cached_ops, new_nodes, removed_nodes)) {
+            m_cached_ordered_ops.assign(nodes.begin(), nodes.end());
+            for (const auto& node : new_nodes) {
+                m_cached_ops.insert(node.get());
+                node->insert_info(m_shared_rt_info);
+            }
+            for (auto* node : removed_nodes) {
+                m_cached_ops.erase(node);
+            }
+            // Rewires may have changed which node a cached name resolves to
+            m_cached_output_names.clear();
+            m_cached_op_names.clear();
+            return nodes;
+        }
+        m_shared_rt_info->set_use_topological_cache(false);
+        nodes.clear();
     }
 
     for (const auto& r : get_results()) {
@@ -291,6 +563,7 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     // Update nodes cache and update all nodes to have shared rt info
     // which belongs to the current Model.
     m_cached_ordered_ops.clear();
+    m_cached_ops.clear();
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
         m_cached_ordered_ops.push_back(node);
         m_cached_ops.insert(node.get());
@@ -818,6 +1091,20 @@ void ov::Model::reshape(const std::map<ov::Output<ov::Node>, ov::PartialShape>&
     if (!need_reshape)
         return;
 
+    // Signature of the requested state of all parameters; used to memoize the result
+    // of shape propagation so reshaping back to an already seen set of input shapes
+    // replays the cached per-node shapes instead of re-running inference.
+    std::string signature;
+    for (const auto& param : params) {
+        const auto new_shape = new_param_shapes.find(param.get());
+        signature +=
+            (new_shape != new_param_shapes.end() ? new_shape->second : param->get_output_partial_shape(0)).to_string();
+        signature += ';';
+    }
+
+    if (try_replay_reshape(signature, new_param_shapes))
+        return;
+
     // save original parameters shape
     std::unordered_map<ov::op::v0::Parameter*, ov::PartialShape> original_input_shapes;
     for (const auto& param : params) {
@@ -838,6 +1125,7 @@ void ov::Model::reshape(const std::map<ov::Output<ov::Node>, ov::PartialShape>&
         ssr_manager.run_passes(shared_from_this());
 
         reshape_only(new_param_shapes);
+        record_reshape(signature);
     } catch (...) {
         // restore shapes to original ones
         reshape_only(original_input_shapes);
@@ -845,6 +1133,81 @@ void ov::Model::reshape(const std::map<ov::Output<ov::Node>, ov::PartialShape>&
     }
 }
 
+void ov::Model::reshape(const std::vector<std::map<ov::Output<ov::Node>, ov::PartialShape>>& shape_candidates) {
+    for (const auto& candidate : shape_candidates) {
+        reshape(candidate);
+    }
+}
+
+bool ov::Model::try_replay_reshape(const std::string& signature,
+                                   const std::unordered_map<ov::op::v0::Parameter*, ov::PartialShape>& param_shapes) {
+    const auto it = m_reshape_cache.find(signature);
+    if (it == m_reshape_cache.end())
+        return false;
+
+    const auto& entry = it->second;
+    // Replay is valid only while the graph matches the topological order the entry was
+    // recorded against; any structural change invalidates the memoized shapes.
+    const auto ordered_ops = get_ordered_ops();
+    bool entry_valid = ordered_ops.size() == entry.nodes.size();
+    for (size_t i = 0; entry_valid && i < ordered_ops.size(); ++i) {
+        entry_valid = entry.nodes[i].lock() == ordered_ops[i];
+    }
+    if (!entry_valid) {
+        m_reshape_cache.erase(it);
+        return false;
+    }
+
+    for (const auto& param_shape : param_shapes) {
+        param_shape.first->set_partial_shape(param_shape.second);
+    }
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        const auto& node = ordered_ops[i];
+        for (size_t j = 0; j < node->get_output_size(); ++j) {
+            auto& tensor = node->get_output_descriptor(j).get_tensor();
+            if (tensor.get_partial_shape() != entry.shapes[i][j] || tensor.get_element_type() != entry.types[i][j]) {
+                descriptor::set_tensor_type(tensor, entry.types[i][j], entry.shapes[i][j]);
+            }
+            // Restore the value bounds computed for this shape signature; bounds left from
+            // the previously active shapes would be stale for shape subgraphs.
+            tensor.invalidate_values();
+            if (entry.lower_bounds[i][j])
+                tensor.set_lower_value(entry.lower_bounds[i][j]);
+            if (entry.upper_bounds[i][j])
+                tensor.set_upper_value(entry.upper_bounds[i][j]);
+            if (!entry.symbols[i][j].empty())
+                tensor.set_value_symbol(entry.symbols[i][j]);
+        }
+    }
+    return true;
+}
+
+void ov::Model::record_reshape(const std::string& signature) {
+    const size_t max_reshape_cache_entries = 8;
+    if (m_reshape_cache.size() >= max_reshape_cache_entries && m_reshape_cache.count(signature) == 0) {
+        m_reshape_cache.erase(m_reshape_cache.begin());
+    }
+
+    ReshapeCacheEntry entry;
+    for (const auto& node : get_ordered_ops()) {
+        entry.nodes.emplace_back(node);
+        entry.shapes.emplace_back();
+        entry.types.emplace_back();
+        entry.lower_bounds.emplace_back();
+        entry.upper_bounds.emplace_back();
+        entry.symbols.emplace_back();
+        for (size_t i = 0; i < node->get_output_size(); ++i) {
+            const auto& tensor = node->get_output_descriptor(i).get_tensor();
+            entry.shapes.back().emplace_back(tensor.get_partial_shape());
+            entry.types.back().emplace_back(tensor.get_element_type());
+            entry.lower_bounds.back().emplace_back(tensor.get_lower_value());
+            entry.upper_bounds.back().emplace_back(tensor.get_upper_value());
+            entry.symbols.back().emplace_back(tensor.get_value_symbol());
+        }
+    }
+    m_reshape_cache[signature] = std::move(entry);
+}
+
 ov::Output<ov::Node> ov::Model::add_output(const std::string& tensor_name) {
     auto cache_valid = [&]() {
         return m_cached_output_names.count(tensor_name) &&
@@ -11,9 +11,11 @@
 
 #include "atomic_guard.hpp"
 #include "bound_evaluate.hpp"
+#include "interned_string.hpp"
 #include "itt.hpp"
 #include "openvino/core/descriptor/input.hpp"
 #include "openvino/core/descriptor_tensor.hpp"
+#include "openvino/core/memory_arena.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/shape_util.hpp"
 #include "openvino/op/util/op_types.hpp"
@@ -105,9 +107,11 @@ ov::Node::Node(const OutputVector& arguments, size_t output_size) : Node() {
 
 ov::Node::~Node() {
     try {
-        // raise a flag to reset nodes cache
-        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
-            info->set_use_topological_cache(false);
+        // register the node for a deferred cache sweep: the weak reference kept in the
+        // ordered ops cache expires by itself, while the raw pointer in the ops cache
+        // is removed during the next Model::get_ordered_ops patching
+        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [this](const std::shared_ptr<SharedRTInfo>& info) {
+            info->add_pending_cleanup(this);
         });
 
         for (descriptor::Input& input : m_inputs) {
@@ -223,7 +227,8 @@ ov::descriptor::Input& ov::Node::get_input_descriptor(size_t position) {
 ov::descriptor::Output& ov::Node::get_output_descriptor(size_t position) {
     while (m_outputs.size() <= position) {
         size_t i = m_outputs.size();
-        auto tensor_descriptor = make_shared<descriptor::Tensor>(element::dynamic, PartialShape::dynamic(), this, i);
+        auto tensor_descriptor =
+            util::make_arena_shared<descriptor::Tensor>(element::dynamic, PartialShape::dynamic(), this, i);
         m_outputs.emplace_back(this, i, tensor_descriptor);
     }
     return m_outputs[position];
@@ -282,10 +287,10 @@ std::string ov::Node::description() const {
 }
 
 const std::string& ov::Node::get_friendly_name() const {
-    if (m_friendly_name.empty()) {
+    if (!m_friendly_name || m_friendly_name->empty()) {
         return get_name();
     }
-    return m_friendly_name;
+    return *m_friendly_name;
 }
 
 const std::string& ov::Node::get_name() const {
@@ -296,7 +301,7 @@ const std::string& ov::Node::get_name() const {
 }
 
 void ov::Node::set_friendly_name(const string& name) {
-    m_friendly_name = name;
+    m_friendly_name = ov::util::intern_string(name);
 }
 
 ov::Node* ov::Node::get_input_node_ptr(size_t index) const {
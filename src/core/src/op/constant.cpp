@@ -7,6 +7,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cstring>
+#include <mutex>
 #include <sstream>
 
 #include "compare.hpp"
@@ -15,6 +16,7 @@
 #include "openvino/core/type/element_iterator.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/core/type/nf4.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/reference/utils/type_util.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
@@ -210,6 +212,9 @@ Constant::Constant(const Constant& other)
     : m_element_type{other.m_element_type},
       m_shape{other.m_shape},
       m_data{other.m_data},
+      m_compressed_data{other.m_compressed_data},
+      m_compressed_type{other.m_compressed_type},
+      m_compressed{other.m_compressed.load()},
       m_all_elements_bitwise_identical{other.m_all_elements_bitwise_identical.load()},
       m_all_elements_bitwise_identical_checked{other.m_all_elements_bitwise_identical_checked.load()} {
     constructor_validate_and_infer_types();
@@ -219,6 +224,9 @@ Constant::Constant(const Constant& other, const Shape& new_shape)
     : m_element_type{other.m_element_type},
       m_shape{new_shape},
       m_data{other.m_data},
+      m_compressed_data{other.m_compressed_data},
+      m_compressed_type{other.m_compressed_type},
+      m_compressed{other.m_compressed.load()},
       m_all_elements_bitwise_identical{other.m_all_elements_bitwise_identical.load()},
       m_all_elements_bitwise_identical_checked{other.m_all_elements_bitwise_identical_checked.load()} {
     const auto new_size = shape_size(new_shape);
@@ -282,17 +290,81 @@ std::string Constant::convert_value_to_string(size_t index) const {
                     string>::apply<ValueToString>(get_element_type(), get_data_ptr(), index);
 }
 
+std::shared_ptr<Constant> Constant::create_lazily_decompressed(const element::Type& type,
+                                                               const std::shared_ptr<Constant>& compressed) {
+    OPENVINO_ASSERT(compressed);
+    const auto& compressed_type = compressed->get_element_type();
+    OPENVINO_ASSERT(type.is_static() && type != element::string && compressed_type.is_static() &&
+                        compressed_type != element::string,
+                    "Lazy decompression from ",
+                    compressed_type,
+                    " to ",
+                    type,
+                    " is not supported");
+    if (compressed->m_compressed.load(std::memory_order_acquire) || !compressed->m_data)
+        return nullptr;
+    auto constant = std::make_shared<Constant>();
+    constant->m_element_type = type;
+    constant->m_shape = compressed->m_shape;
+    constant->m_compressed_data = compressed->m_data;
+    constant->m_compressed_type = compressed_type;
+    constant->m_compressed.store(true, std::memory_order_release);
+    constant->constructor_validate_and_infer_types();
+    return constant;
+}
+
+void Constant::expand_compressed_data() const {
+    // one mutex for all constants: the expansion happens at most once per constant, so the only
+    // possible contention is between threads racing for the first data access to the same payload
+    static std::mutex expand_mutex;
+    std::lock_guard<std::mutex> lock(expand_mutex);
+    if (!m_compressed.load(std::memory_order_relaxed))
+        return;
+    const auto num_elements = shape_size(m_shape);
+    auto expanded =
+        std::make_shared<AlignedBuffer>(element::get_byte_size(m_element_type, num_elements), host_alignment());
+    TensorVector expanded_tensor{Tensor(m_element_type, m_shape, expanded->get_ptr())};
+    const TensorVector compressed_tensor{Tensor(m_compressed_type, m_shape, m_compressed_data->get_ptr())};
+    OPENVINO_ASSERT(Convert().evaluate(expanded_tensor, compressed_tensor),
+                    "Cannot expand the compressed ",
+                    m_compressed_type,
+                    " payload of a ",
+                    m_element_type,
+                    " constant");
+    m_data = std::move(expanded);
+    m_compressed_data.reset();
+    m_compressed.store(false, std::memory_order_release);
+}
+
 size_t Constant::get_byte_size() const {
     // Returns 0 when shape is "empty" (equals 0).
     // TODO: refactor shape_size(m_shape) calculations and store it as a member.
+    // the expanded size is reported even while the payload is still compressed
+    if (m_compressed.load(std::memory_order_acquire))
+        return element::get_byte_size(m_element_type, shape_size(m_shape));
     return shape_size(m_shape) ? m_data->size() : 0;
 }
 
+size_t Constant::get_alignment() const {
+    const auto address = reinterpret_cast<uintptr_t>(get_data_ptr());
+    if (address == 0) {
+        return host_alignment();
+    }
+    // The largest power of two dividing the address, capped to keep the value stable
+    // for allocators aligning beyond any practically relevant boundary
+    constexpr uintptr_t alignment_cap = 4096;
+    return static_cast<size_t>(std::min<uintptr_t>(address & (~address + 1), alignment_cap));
+}
+
 const void* Constant::get_data_ptr() const {
+    if (m_compressed.load(std::memory_order_acquire))
+        expand_compressed_data();
     return (m_data ? m_data->get_ptr() : nullptr);
 }
 
 void* Constant::get_data_ptr_nc() {
+    if (m_compressed.load(std::memory_order_acquire))
+        expand_compressed_data();
     return (m_data ? m_data->get_ptr() : nullptr);
 }
 
@@ -451,6 +523,9 @@ bool Constant::visit_attributes(AttributeVisitor& visitor) {
             m_data = string_aligned_buffer;
         }
     } else {
+        // serialization has to see the expanded payload; on deserialization there is nothing to expand
+        if (m_compressed.load(std::memory_order_acquire))
+            expand_compressed_data();
         visitor.on_attribute("value", m_data);
     }
     update_identical_flags(false, false);
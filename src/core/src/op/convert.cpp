@@ -6,7 +6,9 @@
 
 #include "element_visitor.hpp"
 #include "itt.hpp"
+#include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/equal.hpp"
 #include "openvino/op/select.hpp"
 #include "openvino/reference/convert.hpp"
@@ -174,6 +176,28 @@ bool Convert::evaluate_upper(TensorVector& output_values) const {
     return convert::evaluate_bound(this, output_values, get_input_tensor(0).get_upper_value());
 }
 
+bool Convert::constant_fold(OutputVector& output_values, const OutputVector& input_values) {
+    OV_OP_SCOPE(v0_Convert_constant_fold);
+    if (!is_const_fold_disabled()) {
+        // widening decompression converts dominate the compile-time peak RSS; fold them into a
+        // constant which keeps the compressed payload and expands it on the first data access
+        if (const auto constant = ov::as_type_ptr<Constant>(input_values[0].get_node_shared_ptr())) {
+            const auto& src_type = constant->get_element_type();
+            const auto is_decompression = m_destination_type == element::f32 &&
+                                          (src_type == element::f16 || src_type == element::bf16 ||
+                                           src_type == element::i8 || src_type == element::u8);
+            if (is_decompression) {
+                if (auto folded = Constant::create_lazily_decompressed(m_destination_type, constant)) {
+                    ov::copy_runtime_info(constant, folded);
+                    output_values[0] = std::move(folded);
+                    return true;
+                }
+            }
+        }
+    }
+    return Node::constant_fold(output_values, input_values);
+}
+
 bool Convert::evaluate_symbol(TensorSymbolVector& output_symbols) const {
     const auto input_symbols = get_input_tensor(0).get_value_symbol();
     if (input_symbols.empty()) {
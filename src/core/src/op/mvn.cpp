@@ -5,6 +5,7 @@
 #include "openvino/op/mvn.hpp"
 
 #include "compare.hpp"
+#include "element_visitor.hpp"
 #include "itt.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/reference/mvn.hpp"
@@ -128,45 +129,51 @@ bool ov::op::v6::MVN::visit_attributes(AttributeVisitor& visitor) {
 
 namespace mvn {
 namespace {
-template <ov::element::Type_t ET>
-bool evaluate(ov::TensorVector& outputs,
-              const ov::TensorVector& inputs,
-              bool normalize_variance,
-              float eps,
-              ov::op::MVNEpsMode eps_mode) {
-    using T = typename ov::element_type_traits<ET>::value_type;
-    ov::AxisSet reduction_axes;
-    auto rank = inputs[0].get_shape().size();
-    if (inputs[1].get_element_type() == ov::element::i64) {
-        reduction_axes = ov::reference::mvn_6_reduction_axes<int64_t>(inputs[1], rank);
-    } else if (inputs[1].get_element_type() == ov::element::i32) {
-        reduction_axes = ov::reference::mvn_6_reduction_axes<int32_t>(inputs[1], rank);
-    } else {
-        OPENVINO_THROW("Unexpected indices type");
+struct Evaluate : ov::element::NoAction<bool> {
+    using ov::element::NoAction<bool>::visit;
+
+    template <ov::element::Type_t ET>
+    static result_type visit(ov::TensorVector& outputs,
+                             const ov::TensorVector& inputs,
+                             bool normalize_variance,
+                             float eps,
+                             ov::op::MVNEpsMode eps_mode) {
+        using T = typename ov::element_type_traits<ET>::value_type;
+        ov::AxisSet reduction_axes;
+        auto rank = inputs[0].get_shape().size();
+        if (inputs[1].get_element_type() == ov::element::i64) {
+            reduction_axes = ov::reference::mvn_6_reduction_axes<int64_t>(inputs[1], rank);
+        } else if (inputs[1].get_element_type() == ov::element::i32) {
+            reduction_axes = ov::reference::mvn_6_reduction_axes<int32_t>(inputs[1], rank);
+        } else {
+            OPENVINO_THROW("Unexpected indices type");
+        }
+        ov::reference::mvn_6<T>(inputs[0].data<T>(),
+                                outputs[0].data<T>(),
+                                inputs[0].get_shape(),
+                                reduction_axes,
+                                normalize_variance,
+                                eps,
+                                eps_mode);
+        return true;
     }
-    ov::reference::mvn_6<T>(inputs[0].data<T>(),
-                            outputs[0].data<T>(),
-                            inputs[0].get_shape(),
-                            reduction_axes,
-                            normalize_variance,
-                            eps,
-                            eps_mode);
-    return true;
-}
+};
 
 bool evaluate_mvn(ov::TensorVector& outputs,
                   const ov::TensorVector& inputs,
                   bool normalize_variance,
                   float eps,
                   ov::op::MVNEpsMode eps_mode) {
-    bool rc = true;
-    switch (inputs[0].get_element_type()) {
-        OPENVINO_TYPE_CASE(evaluate_mvn, f32, outputs, inputs, normalize_variance, eps, eps_mode);
-    default:
-        rc = false;
-        break;
-    }
-    return rc;
+    using namespace ov::element;
+    return IF_TYPE_OF(evaluate_mvn,
+                      OV_PP_ET_LIST(f32),
+                      Evaluate,
+                      inputs[0].get_element_type(),
+                      outputs,
+                      inputs,
+                      normalize_variance,
+                      eps,
+                      eps_mode);
 }
 }  // namespace
 }  // namespace mvn
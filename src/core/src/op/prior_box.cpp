@@ -7,6 +7,7 @@
 #include <array>
 
 #include "bound_evaluate.hpp"
+#include "element_visitor.hpp"
 #include "itt.hpp"
 #include "openvino/op/prior_box.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -17,46 +18,47 @@ namespace op {
 // ------------------------------ V0 ------------------------------
 namespace v0 {
 namespace {
-template <element::Type_t ET>
-bool evaluate(const Tensor& arg0, const Tensor& arg1, Tensor& out, const op::v0::PriorBox::Attributes& attrs) {
-    op::v8::PriorBox::Attributes attrs_v8;
-    attrs_v8.min_size = attrs.min_size;
-    attrs_v8.max_size = attrs.max_size;
-    attrs_v8.aspect_ratio = attrs.aspect_ratio;
-    attrs_v8.density = attrs.density;
-    attrs_v8.fixed_ratio = attrs.fixed_ratio;
-    attrs_v8.fixed_size = attrs.fixed_size;
-    attrs_v8.clip = attrs.clip;
-    attrs_v8.flip = attrs.flip;
-    attrs_v8.step = attrs.step;
-    attrs_v8.offset = attrs.offset;
-    attrs_v8.variance = attrs.variance;
-    attrs_v8.scale_all_sizes = attrs.scale_all_sizes;
-
-    using T = typename element_type_traits<ET>::value_type;
-    ov::reference::prior_box(arg0.data<T>(), arg1.data<T>(), out.data<float>(), out.get_shape(), attrs_v8);
-    return true;
-}
+struct Evaluate : element::NoAction<bool> {
+    using element::NoAction<bool>::visit;
+
+    template <element::Type_t ET>
+    static result_type visit(const Tensor& arg0,
+                             const Tensor& arg1,
+                             Tensor& out,
+                             const op::v0::PriorBox::Attributes& attrs) {
+        op::v8::PriorBox::Attributes attrs_v8;
+        attrs_v8.min_size = attrs.min_size;
+        attrs_v8.max_size = attrs.max_size;
+        attrs_v8.aspect_ratio = attrs.aspect_ratio;
+        attrs_v8.density = attrs.density;
+        attrs_v8.fixed_ratio = attrs.fixed_ratio;
+        attrs_v8.fixed_size = attrs.fixed_size;
+        attrs_v8.clip = attrs.clip;
+        attrs_v8.flip = attrs.flip;
+        attrs_v8.step = attrs.step;
+        attrs_v8.offset = attrs.offset;
+        attrs_v8.variance = attrs.variance;
+        attrs_v8.scale_all_sizes = attrs.scale_all_sizes;
+
+        using T = typename element_type_traits<ET>::value_type;
+        ov::reference::prior_box(arg0.data<T>(), arg1.data<T>(), out.data<float>(), out.get_shape(), attrs_v8);
+        return true;
+    }
+};
 
 bool evaluate_prior_box(const Tensor& arg0,
                         const Tensor& arg1,
                         Tensor& out,
                         const op::v0::PriorBox::Attributes& attrs) {
-    bool rc = true;
-    switch (arg0.get_element_type()) {
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i8, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i16, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i32, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i64, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u8, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u16, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u32, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u64, arg0, arg1, out, attrs);
-    default:
-        rc = false;
-        break;
-    }
-    return rc;
+    using namespace ov::element;
+    return IF_TYPE_OF(v0_PriorBox_evaluate,
+                      OV_PP_ET_LIST(i8, i16, i32, i64, u8, u16, u32, u64),
+                      Evaluate,
+                      arg0.get_element_type(),
+                      arg0,
+                      arg1,
+                      out,
+                      attrs);
 }
 }  // namespace
 
@@ -173,32 +175,33 @@ namespace ov {
 namespace op {
 namespace v8 {
 namespace {
-template <element::Type_t ET>
-bool evaluate(const Tensor& arg0, const Tensor& arg1, Tensor& out, const op::v8::PriorBox::Attributes& attrs) {
-    using T = typename element_type_traits<ET>::value_type;
-    ov::reference::prior_box(arg0.data<T>(), arg1.data<T>(), out.data<float>(), out.get_shape(), attrs);
-    return true;
-}
+struct Evaluate : element::NoAction<bool> {
+    using element::NoAction<bool>::visit;
+
+    template <element::Type_t ET>
+    static result_type visit(const Tensor& arg0,
+                             const Tensor& arg1,
+                             Tensor& out,
+                             const op::v8::PriorBox::Attributes& attrs) {
+        using T = typename element_type_traits<ET>::value_type;
+        ov::reference::prior_box(arg0.data<T>(), arg1.data<T>(), out.data<float>(), out.get_shape(), attrs);
+        return true;
+    }
+};
 
 bool evaluate_prior_box(const Tensor& arg0,
                         const Tensor& arg1,
                         Tensor& out,
                         const op::v8::PriorBox::Attributes& attrs) {
-    bool rc = true;
-    switch (arg0.get_element_type()) {
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i8, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i16, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i32, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i64, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u8, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u16, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u32, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u64, arg0, arg1, out, attrs);
-    default:
-        rc = false;
-        break;
-    }
-    return rc;
+    using namespace ov::element;
+    return IF_TYPE_OF(v8_PriorBox_evaluate,
+                      OV_PP_ET_LIST(i8, i16, i32, i64, u8, u16, u32, u64),
+                      Evaluate,
+                      arg0.get_element_type(),
+                      arg0,
+                      arg1,
+                      out,
+                      attrs);
 }
 }  // namespace
 
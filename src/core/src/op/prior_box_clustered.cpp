@@ -4,6 +4,7 @@
 
 #include "openvino/reference/prior_box_clustered.hpp"
 
+#include "element_visitor.hpp"
 #include "itt.hpp"
 #include "openvino/op/prior_box_clustered.hpp"
 #include "prior_box_clustered_shape_inference.hpp"
@@ -59,32 +60,33 @@ bool op::v0::PriorBoxClustered::visit_attributes(AttributeVisitor& visitor) {
 
 namespace prior_box_clustered {
 namespace {
-template <element::Type_t ET>
-bool evaluate(const Tensor& arg0, const Tensor& arg1, Tensor& out, op::v0::PriorBoxClustered::Attributes attrs) {
-    using T = fundamental_type_for<ET>;
-    ov::reference::prior_box_clustered(arg0.data<T>(), arg1.data<T>(), out.data<float>(), out.get_shape(), attrs);
-    return true;
-}
+struct Evaluate : element::NoAction<bool> {
+    using element::NoAction<bool>::visit;
+
+    template <element::Type_t ET>
+    static result_type visit(const Tensor& arg0,
+                             const Tensor& arg1,
+                             Tensor& out,
+                             const op::v0::PriorBoxClustered::Attributes& attrs) {
+        using T = fundamental_type_for<ET>;
+        ov::reference::prior_box_clustered(arg0.data<T>(), arg1.data<T>(), out.data<float>(), out.get_shape(), attrs);
+        return true;
+    }
+};
 
 bool evaluate_prior_box(const Tensor& arg0,
                         const Tensor& arg1,
                         Tensor& out,
                         const op::v0::PriorBoxClustered::Attributes& attrs) {
-    bool rc = true;
-    switch (arg0.get_element_type()) {
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i8, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i16, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i32, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, i64, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u8, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u16, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u32, arg0, arg1, out, attrs);
-        OPENVINO_TYPE_CASE(evaluate_prior_box, u64, arg0, arg1, out, attrs);
-    default:
-        rc = false;
-        break;
-    }
-    return rc;
+    using namespace ov::element;
+    return IF_TYPE_OF(v0_PriorBoxClustered_evaluate,
+                      OV_PP_ET_LIST(i8, i16, i32, i64, u8, u16, u32, u64),
+                      Evaluate,
+                      arg0.get_element_type(),
+                      arg0,
+                      arg1,
+                      out,
+                      attrs);
 }
 }  // namespace
 }  // namespace prior_box_clustered
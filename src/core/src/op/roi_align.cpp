@@ -4,6 +4,7 @@
 
 #include "openvino/reference/roi_align.hpp"
 
+#include "element_visitor.hpp"
 #include "itt.hpp"
 #include "openvino/op/roi_align.hpp"
 #include "roi_align_shape_inference.hpp"
@@ -210,35 +211,39 @@ namespace op {
 namespace roi_align {
 namespace {
 
-template <element::Type_t ET>
-bool evaluate(const Tensor& feature_maps,
-              const Tensor& rois,
-              const std::vector<int64_t>& batch_indices_vec_scaled_up,
-              const Tensor& out,
-              const int pooled_height,
-              const int pooled_width,
-              const int sampling_ratio,
-              const float spatial_scale,
-              const v3::ROIAlign::PoolingMode& pooling_mode,
-              const Shape& batch_indices_shape,
-              const v9::ROIAlign::AlignedMode& aligned_mode = v9::ROIAlign::AlignedMode::ASYMMETRIC) {
-    using T = typename element_type_traits<ET>::value_type;
-    ov::reference::roi_align<T>(feature_maps.data<T>(),
-                                rois.data<T>(),
-                                batch_indices_vec_scaled_up.data(),
-                                out.data<T>(),
-                                feature_maps.get_shape(),
-                                rois.get_shape(),
-                                batch_indices_shape,
-                                out.get_shape(),
-                                pooled_height,
-                                pooled_width,
-                                sampling_ratio,
-                                spatial_scale,
-                                pooling_mode,
-                                aligned_mode);
-    return true;
-}
+struct Evaluate : element::NoAction<bool> {
+    using element::NoAction<bool>::visit;
+
+    template <element::Type_t ET>
+    static result_type visit(const Tensor& feature_maps,
+                             const Tensor& rois,
+                             const std::vector<int64_t>& batch_indices_vec_scaled_up,
+                             const Tensor& out,
+                             const int pooled_height,
+                             const int pooled_width,
+                             const int sampling_ratio,
+                             const float spatial_scale,
+                             const v3::ROIAlign::PoolingMode& pooling_mode,
+                             const Shape& batch_indices_shape,
+                             const v9::ROIAlign::AlignedMode& aligned_mode) {
+        using T = typename element_type_traits<ET>::value_type;
+        ov::reference::roi_align<T>(feature_maps.data<T>(),
+                                    rois.data<T>(),
+                                    batch_indices_vec_scaled_up.data(),
+                                    out.data<T>(),
+                                    feature_maps.get_shape(),
+                                    rois.get_shape(),
+                                    batch_indices_shape,
+                                    out.get_shape(),
+                                    pooled_height,
+                                    pooled_width,
+                                    sampling_ratio,
+                                    spatial_scale,
+                                    pooling_mode,
+                                    aligned_mode);
+        return true;
+    }
+};
 
 bool evaluate(const TensorVector& args,
               const Tensor& out,
@@ -253,53 +258,22 @@ bool evaluate(const TensorVector& args,
     const auto& batch_indices = args[2];
     const auto batch_indices_vec_scaled_up = get_tensor_data_as<int64_t>(batch_indices, ov::util::Cast<int64_t>());
 
-    bool rc;
-    switch (feature_maps.get_element_type()) {
-        OPENVINO_TYPE_CASE(evaluate_roi_align,
-                           bf16,
-                           feature_maps,
-                           rois,
-                           batch_indices_vec_scaled_up,
-                           out,
-                           pooled_height,
-                           pooled_width,
-                           sampling_ratio,
-                           spatial_scale,
-                           pooling_mode,
-                           batch_indices.get_shape(),
-                           aligned_mode);
-        OPENVINO_TYPE_CASE(evaluate_roi_align,
-                           f16,
-                           feature_maps,
-                           rois,
-                           batch_indices_vec_scaled_up,
-                           out,
-                           pooled_height,
-                           pooled_width,
-                           sampling_ratio,
-                           spatial_scale,
-                           pooling_mode,
-                           batch_indices.get_shape(),
-                           aligned_mode);
-        OPENVINO_TYPE_CASE(evaluate_roi_align,
-                           f32,
-                           feature_maps,
-                           rois,
-                           batch_indices_vec_scaled_up,
-                           out,
-                           pooled_height,
-                           pooled_width,
-                           sampling_ratio,
-                           spatial_scale,
-                           pooling_mode,
-                           batch_indices.get_shape(),
-                           aligned_mode);
-    default:
-        rc = false;
-        break;
-    }
-
-    return rc;
+    using namespace ov::element;
+    return IF_TYPE_OF(evaluate_roi_align,
+                      OV_PP_ET_LIST(bf16, f16, f32),
+                      Evaluate,
+                      feature_maps.get_element_type(),
+                      feature_maps,
+                      rois,
+                      batch_indices_vec_scaled_up,
+                      out,
+                      pooled_height,
+                      pooled_width,
+                      sampling_ratio,
+                      spatial_scale,
+                      pooling_mode,
+                      batch_indices.get_shape(),
+                      aligned_mode);
 }
 }  // namespace
 }  // namespace roi_align
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <vector>
 
+#include "element_visitor.hpp"
 #include "itt.hpp"
 #include "openvino/core/dimension.hpp"
 #include "openvino/op/constant.hpp"
@@ -18,25 +19,25 @@ namespace ov {
 namespace op {
 namespace shape_of {
 namespace {
-template <element::Type_t ET>
-inline bool evaluate(const Shape& shape, Tensor& output_value) {
-    reference::shape_of(shape, output_value.data<fundamental_type_for<ET>>());
-    return true;
-}
+struct Evaluate : element::NoAction<bool> {
+    using element::NoAction<bool>::visit;
+
+    template <element::Type_t ET>
+    static result_type visit(const Shape& shape, Tensor& output_value) {
+        reference::shape_of(shape, output_value.data<fundamental_type_for<ET>>());
+        return true;
+    }
+};
 
 bool evaluate_shape_of(Tensor& output_value, const Shape& input_shape) {
-    bool rc;
     output_value.set_shape(Shape{input_shape.size()});
-    switch (output_value.get_element_type()) {
-        OPENVINO_TYPE_CASE(evaluate_shape_of, i32, input_shape, output_value);
-        OPENVINO_TYPE_CASE(evaluate_shape_of, i64, input_shape, output_value);
-        OPENVINO_TYPE_CASE(evaluate_shape_of, u32, input_shape, output_value);
-        OPENVINO_TYPE_CASE(evaluate_shape_of, u64, input_shape, output_value);
-    default:
-        rc = false;
-        break;
-    }
-    return rc;
+    using namespace ov::element;
+    return IF_TYPE_OF(evaluate_shape_of,
+                      OV_PP_ET_LIST(i32, i64, u32, u64),
+                      Evaluate,
+                      output_value.get_element_type(),
+                      input_shape,
+                      output_value);
 }
 
 bool constant_fold_shape_of(Node* shape_of_node, Output<Node>& replacement, const Output<Node>& shape_of_input) {
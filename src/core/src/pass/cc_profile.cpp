@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cc_profile.hpp"
+
+#include <fstream>
+#include <mutex>
+#include <unordered_set>
+
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/opsets/opset.hpp"
+#include "openvino/util/env_util.hpp"
+#include "openvino/util/file_util.hpp"
+
+namespace {
+
+struct CCProfile {
+    std::mutex mutex;
+    std::unordered_set<std::string> emitted;
+    std::ofstream file;
+    bool enabled = false;
+
+    CCProfile() {
+        const auto dir = ov::util::getenv_string("OV_CC_STATS_DIR");
+        if (dir.empty())
+            return;
+        try {
+            ov::util::create_directory_recursive(dir);
+        } catch (...) {
+            return;
+        }
+        // Rows are appended, so profiles accumulate over multiple runs; concurrent
+        // processes may interleave rows, which ccheader.py tolerates per-line.
+        file.open(ov::util::make_path(dir, std::string("ov_cc_profile.csv")), std::ios::app);
+        enabled = file.is_open();
+    }
+
+    // Must be called under `mutex`
+    void emit(const std::string& domain, const std::string& region) {
+        auto row = domain + "," + region;
+        if (emitted.insert(row).second)
+            file << row << "\n";
+    }
+};
+
+CCProfile& cc_profile() {
+    static CCProfile profile;
+    return profile;
+}
+
+void collect_model_types(const std::shared_ptr<const ov::Model>& model,
+                         std::unordered_set<const ov::DiscreteTypeInfo*>& types) {
+    for (const auto& op : model->get_ops()) {
+        types.insert(&op->get_type_info());
+        if (auto multi_subgraph_op = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& sub_graph : multi_subgraph_op->get_functions()) {
+                if (sub_graph)
+                    collect_model_types(sub_graph, types);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+bool ov::pass::cc_profile_enabled() {
+    return cc_profile().enabled;
+}
+
+void ov::pass::cc_profile_record_pass(const std::string& pass_name) {
+    auto& profile = cc_profile();
+    if (!profile.enabled)
+        return;
+    std::lock_guard<std::mutex> lock(profile.mutex);
+    // Cover all region flavours derived from the pass type name: RUN_ON_MODEL_SCOPE,
+    // RUN_ON_FUNCTION_SCOPE and the bare MATCHER_SCOPE region.
+    profile.emit("SIMPLE_ov_pass", pass_name + "_run_on_model");
+    profile.emit("SIMPLE_ov_pass", pass_name + "_run_on_function");
+    profile.emit("SIMPLE_ov_pass", pass_name);
+    profile.file.flush();
+}
+
+void ov::pass::cc_profile_record_model(const std::shared_ptr<const Model>& model) {
+    auto& profile = cc_profile();
+    if (!profile.enabled)
+        return;
+
+    std::unordered_set<const DiscreteTypeInfo*> types;
+    collect_model_types(model, types);
+
+    std::lock_guard<std::mutex> lock(profile.mutex);
+    for (const auto* type : types) {
+        // An op is registered in every opset that contains its exact type; keep all of
+        // them creatable so opset-agnostic frontend code keeps working.
+        for (const auto& opset : ov::get_available_opsets()) {
+            if (opset.second().contains_type(*type))
+                profile.emit("SIMPLE_ov_opset", opset.first + "_" + type->name);
+        }
+    }
+    profile.file.flush();
+}
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace pass {
+
+/*
+ * Runtime collector of conditional compilation profiles.
+ *
+ * When the OV_CC_STATS_DIR environment variable points to a directory, pass execution
+ * and the op sets of processed models are appended to `ov_cc_profile.csv` in that
+ * directory. The rows use the same `<domain>,<region>` format as the IntelSEAPI
+ * statistics consumed by conditional_compilation/scripts/ccheader.py, so the file can
+ * be passed to `ccheader.py --stat` (alone or merged with analyzer-collected CSVs) to
+ * produce a selective build that keeps only the ops and passes production models use.
+ */
+
+/// \brief Whether profile collection is active (OV_CC_STATS_DIR is set and writable).
+bool cc_profile_enabled();
+
+/// \brief Records an executed pass or matcher by its type name.
+void cc_profile_record_pass(const std::string& pass_name);
+
+/// \brief Records the op types of the model (including subgraph bodies) against every
+/// opset that contains them.
+void cc_profile_record_model(const std::shared_ptr<const Model>& model);
+
+}  // namespace pass
+}  // namespace ov
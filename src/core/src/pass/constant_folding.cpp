@@ -6,6 +6,7 @@
 
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
@@ -104,6 +105,11 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
     bool rewritten = pre_calculated_values_folding(model);
 
+    // Evaluate mutually independent candidates concurrently first; whatever is left
+    // (precision conversions, inner subgraphs, newly enabled chains) is handled by
+    // the serial sweep below
+    rewritten = fold_independent_nodes_in_parallel(model) || rewritten;
+
     for (const auto& original_node : model->get_ordered_ops()) {
         auto node = original_node;
         if (node_has_requires_precision_conversion_attribute(node)) {
@@ -118,7 +124,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
         }
 
         OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
+        if (within_size_budget(*node) && node->constant_fold(replacements, node->input_values())) {
             OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
                             "Node folded but constant folding disabled. Check constant_fold implementation for ",
                             node);
@@ -165,6 +171,96 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::fold_independent_nodes_in_parallel(const std::shared_ptr<ov::Model>& model) {
+#if OV_THREAD == OV_THREAD_SEQ
+    (void)model;
+    return false;
+#else
+    // Thread dispatch only pays off when a wave has enough candidates; chains of
+    // folds are handled by running several waves
+    constexpr size_t min_parallel_candidates = 8;
+    constexpr size_t max_waves = 8;
+
+    bool rewritten = false;
+    for (size_t wave = 0; wave < max_waves; ++wave) {
+        std::vector<std::shared_ptr<Node>> candidates;
+        for (const auto& node : model->get_ordered_ops()) {
+            if (node->get_input_size() == 0 || constant_folding_is_disabled(node) ||
+                node_has_requires_precision_conversion_attribute(node) ||
+                std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node) || !within_size_budget(*node)) {
+                continue;
+            }
+            const auto& input_values = node->input_values();
+            const bool all_constants = std::all_of(input_values.begin(), input_values.end(), [](const Output<Node>& input) {
+                return ov::op::util::is_constant(input.get_node());
+            });
+            if (all_constants) {
+                candidates.push_back(node);
+            }
+        }
+        if (candidates.size() < min_parallel_candidates) {
+            return rewritten;
+        }
+
+        std::vector<OutputVector> replacements(candidates.size());
+        std::vector<char> folded(candidates.size(), 0);
+        ov::parallel_for(candidates.size(), [&](size_t i) {
+            OutputVector node_replacements(candidates[i]->get_output_size());
+            try {
+                if (candidates[i]->constant_fold(node_replacements, candidates[i]->input_values())) {
+                    replacements[i] = std::move(node_replacements);
+                    folded[i] = 1;
+                }
+            } catch (...) {
+                // The serial sweep will re-attempt this node and report the failure
+            }
+        });
+
+        bool progressed = false;
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            if (!folded[i]) {
+                continue;
+            }
+            const auto& node = candidates[i];
+            for (size_t out_idx = 0; out_idx < replacements[i].size(); ++out_idx) {
+                auto node_output = node->output(out_idx);
+                const auto& replacement = replacements[i].at(out_idx);
+                auto replacement_ptr = replacement.get_node_shared_ptr();
+                if (replacement_ptr && (node_output != replacement)) {
+                    replacement_ptr->set_friendly_name(friendly_name_from(*node, replacements[i].size(), out_idx));
+                    node_output.replace(replacement);
+                    copy_runtime_info_from_input_values(node);
+                    copy_runtime_info(node, replacement_ptr);
+                    progressed = true;
+                    rewritten = true;
+                }
+            }
+        }
+        if (!progressed) {
+            return rewritten;
+        }
+    }
+    return rewritten;
+#endif
+}
+
+bool ov::pass::ConstantFolding::within_size_budget(const ov::Node& node) const {
+    if (m_max_folded_constant_size == 0)
+        return true;
+    // Existing constants only pass through folding, no new memory is materialized
+    if (ov::is_type<ov::op::v0::Constant>(&node))
+        return true;
+    size_t total_bytes = 0;
+    for (const auto& output : node.outputs()) {
+        const auto& shape = output.get_partial_shape();
+        const auto& type = output.get_element_type();
+        if (shape.is_dynamic() || type.is_dynamic())
+            return true;  // cannot be materialized into a Constant anyway
+        total_bytes += ov::shape_size(shape.to_shape()) * type.size();
+    }
+    return total_bytes <= m_max_folded_constant_size;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node) {
     if (is_type<op::util::ShapeOfBase>(node)) {
         // Don't propogate names of ShapeOf source node since it is not fused itself
@@ -9,9 +9,11 @@
 #include <iostream>
 #include <regex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "cc_profile.hpp"
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
@@ -85,6 +87,36 @@ bool ov::pass::GraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
     return apply_matcher_passes(f, std::move(nodes_to_run));
 }
 
+bool ov::pass::GraphRewrite::run_on_nodes(const std::shared_ptr<ov::Model>& model,
+                                          const std::vector<std::weak_ptr<Node>>& seeds) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::GraphRewrite::run_on_nodes");
+    // Seed the execution queue with the neighborhood of the changed nodes: producers first
+    // (matchers expect pattern inputs to be final when the root is visited), then the seed,
+    // then its users which may have become matchable by the change.
+    std::deque<std::weak_ptr<Node>> nodes_to_run;
+    std::unordered_set<Node*> enqueued;
+    auto enqueue = [&](const std::shared_ptr<Node>& node) {
+        if (node && enqueued.insert(node.get()).second) {
+            nodes_to_run.emplace_back(node);
+        }
+    };
+    for (const auto& weak_seed : seeds) {
+        auto seed = weak_seed.lock();
+        if (!seed)
+            continue;
+        for (const auto& input : seed->input_values()) {
+            enqueue(input.get_node_shared_ptr());
+        }
+        enqueue(seed);
+        for (const auto& output : seed->outputs()) {
+            for (const auto& target_input : output.get_target_inputs()) {
+                enqueue(target_input.get_node()->shared_from_this());
+            }
+        }
+    }
+    return apply_matcher_passes(model, std::move(nodes_to_run));
+}
+
 bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
                                                   std::deque<std::weak_ptr<Node>> nodes_to_run) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::GraphRewrite::apply_matcher_passes");
@@ -92,42 +124,30 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Index MatcherPasses by the type of their root node. Matchers whose root type cannot be
+    // determined statically (pure pattern roots, passes without a Matcher) fall into the
+    // wildcard bucket and are tried on every node, so one untyped matcher does not degrade
+    // dispatch for the rest of the pipeline.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> wildcard_matchers;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
-        auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
+        // Matchers registered inside a GraphRewrite are invisible to pass::Manager,
+        // so the conditional compilation profile has to be fed from here.
+        if (cc_profile_enabled()) {
+            cc_profile_record_pass(m_matchers[matcher_index]->get_type_info().name);
         }
 
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = std::dynamic_pointer_cast<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
-            }
+        const auto root_types = m_matchers[matcher_index]->get_root_type_infos();
+        if (root_types.empty()) {
+            wildcard_matchers.push_back(matcher_index);
         } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            for (const auto& root_type_info : root_types) {
+                type_to_matcher[root_type_info].push_back(matcher_index);
+            }
         }
 
         // TODO: traverse parents for root_type_info in order to register complete list of matchers
@@ -155,6 +175,14 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
         const auto& new_nodes = m_pass->get_new_nodes();
+        // Registered nodes also seed the dirty set used for scoped revalidation; a
+        // successful rewrite that registered nothing makes the dirty set incomplete.
+        if (status && new_nodes.empty()) {
+            m_dirty_nodes_complete = false;
+        }
+        for (const auto& new_node : new_nodes) {
+            m_dirty_nodes.emplace_back(new_node);
+        }
         if (!new_nodes.empty()) {
             // Need to push nodes in reverse order as we expect that nodes in new_nodes
             // vector are in topological order
@@ -183,7 +211,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
                 size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
                 for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
                     auto sub_graph = sub_graph_node->get_function(sub_graph_ind);
-                    run_on_model(sub_graph);
+                    if (run_on_model(sub_graph)) {
+                        // Body rewrites may change the outer op's inferred shapes in ways
+                        // the dirty set cannot express; force whole-model validation.
+                        m_dirty_nodes_complete = false;
+                    }
                 }
             }
         }
@@ -191,51 +223,141 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
+        // Dispatch only matchers whose root type matches the visited node (walking up the
+        // type hierarchy) plus the wildcard bucket; merged by registration order.
+        const DiscreteTypeInfo* node_type_info = &node->get_type_info();
+        matcher_passes_to_run.clear();
+        matcher_passes_to_run.insert(matcher_passes_to_run.end(), wildcard_matchers.begin(), wildcard_matchers.end());
+        while (node_type_info) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                // do not run found matchers immediately, need to collect all matchers for
+                // parents
+                // and sort them in order of the registration
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
             }
+            node_type_info = node_type_info->parent;
+        }
 
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
 
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
+        // TODO: type_to_matcher with just collected list of matchers to enable
+        // fast processing at the next time when node with the same type will be processed
 
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
+        for (size_t matcher_index : matcher_passes_to_run) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
+            }
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::GraphRewrite::validate_dirty_subgraph(const std::shared_ptr<ov::Model>& model) {
+    if (!m_dirty_nodes_complete) {
+        clear_dirty_nodes();
+        return false;
+    }
+
+    // Collect live seeds; nodes destroyed by later rewrites are covered by the nodes
+    // that replaced them.
+    std::vector<Node*> seeds;
+    std::unordered_set<Node*> cone;
+    for (const auto& weak_node : m_dirty_nodes) {
+        if (auto node = weak_node.lock()) {
+            if (cone.insert(node.get()).second) {
+                seeds.push_back(node.get());
+            }
+        }
+    }
+    clear_dirty_nodes();
+    if (seeds.empty()) {
+        return true;
+    }
+
+    // Downstream cone of the seeds
+    std::deque<Node*> bfs(seeds.begin(), seeds.end());
+    while (!bfs.empty()) {
+        Node* node = bfs.front();
+        bfs.pop_front();
+        for (const auto& output : node->outputs()) {
+            for (const auto& target_input : output.get_target_inputs()) {
+                Node* user = target_input.get_node();
+                if (cone.insert(user).second) {
+                    bfs.push_back(user);
                 }
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
+    }
+
+    // Process the cone in topological order (Kahn by in-cone producers), re-inferring a
+    // node only when it is a seed or one of its producers changed its output shapes/types
+    std::unordered_map<Node*, size_t> indegree;
+    std::deque<Node*> ready;
+    for (Node* node : cone) {
+        size_t in_cone_producers = 0;
+        for (size_t i = 0; i < node->get_input_size(); ++i) {
+            if (cone.count(node->get_input_node_ptr(i))) {
+                ++in_cone_producers;
+            }
+        }
+        indegree[node] = in_cone_producers;
+        if (in_cone_producers == 0) {
+            ready.push_back(node);
+        }
+    }
+
+    const std::unordered_set<Node*> seed_set(seeds.begin(), seeds.end());
+    std::unordered_set<Node*> changed;
+    size_t processed = 0;
+    while (!ready.empty()) {
+        Node* node = ready.front();
+        ready.pop_front();
+        ++processed;
+
+        bool needs_revalidation = seed_set.count(node) > 0;
+        for (size_t i = 0; !needs_revalidation && i < node->get_input_size(); ++i) {
+            needs_revalidation = changed.count(node->get_input_node_ptr(i)) > 0;
+        }
+        if (needs_revalidation) {
+            std::vector<PartialShape> old_shapes;
+            std::vector<element::Type> old_types;
+            for (const auto& output : node->outputs()) {
+                old_shapes.push_back(output.get_partial_shape());
+                old_types.push_back(output.get_element_type());
+            }
+            node->revalidate_and_infer_types();
+            for (size_t i = 0; i < node->get_output_size(); ++i) {
+                if (node->get_output_partial_shape(i) != old_shapes[i] ||
+                    node->get_output_element_type(i) != old_types[i]) {
+                    changed.insert(node);
                     break;
                 }
             }
         }
+
+        for (const auto& output : node->outputs()) {
+            for (const auto& target_input : output.get_target_inputs()) {
+                Node* user = target_input.get_node();
+                const auto it = indegree.find(user);
+                if (it != indegree.end() && --it->second == 0) {
+                    ready.push_back(user);
+                }
+            }
+        }
     }
-    return rewritten;
+
+    // A node reachable through a back reference outside the model would break the order;
+    // be conservative and let the caller run whole-model validation.
+    return processed == cone.size();
+}
+
+void ov::pass::GraphRewrite::clear_dirty_nodes() {
+    m_dirty_nodes.clear();
+    m_dirty_nodes_complete = true;
 }
 
 void ov::pass::GraphRewrite::set_pass_config(const std::shared_ptr<PassConfig>& rhs) {
@@ -265,6 +387,28 @@ void ov::pass::GraphRewrite::set_pass_config(const std::shared_ptr<PassConfig>&
     }
 }
 
+std::vector<ov::DiscreteTypeInfo> ov::pass::MatcherPass::get_root_type_infos() const {
+    if (!m_matcher)
+        return {};
+
+    auto root = m_matcher->get_pattern_value().get_node_shared_ptr();
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to get actual root node we need to take it's parent.
+    if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
+        root = any_type->input_value(0).get_node_shared_ptr();
+    }
+
+    // The type can be extracted when the root is an operation from opset or a
+    // pattern::op::WrapType; any other pattern root matches arbitrary types.
+    if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
+        if (auto any_type = std::dynamic_pointer_cast<ov::pass::pattern::op::WrapType>(p)) {
+            return any_type->get_wrapped_types();
+        }
+        return {};
+    }
+    return {root->get_type_info()};
+}
+
 void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pattern::Matcher>& m,
                                              const ov::graph_rewrite_callback& callback,
                                              const PassPropertyMask& property) {
@@ -9,14 +9,23 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <sstream>
 #include <unordered_map>
+#include <unordered_set>
 
+#include "cc_profile.hpp"
 #include "itt.hpp"
+#include "openvino/core/compile_time_profile.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/serialize.hpp"
 #include "openvino/pass/visualize_tree.hpp"
 #include "openvino/util/env_util.hpp"
+#include "openvino/util/file_util.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
+#include "transformations/hash.hpp"
 
 using namespace std;
 
@@ -39,6 +48,69 @@ namespace {
 bool getenv_visualize_tracing() {
     return ov::util::getenv_bool("OV_ENABLE_VISUALIZE_TRACING");
 }
+
+ov::pass::Manager::cached_model_loader_t& cached_model_loader() {
+    static ov::pass::Manager::cached_model_loader_t loader;
+    return loader;
+}
+
+std::mutex& cached_model_loader_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+const std::string& transformed_model_cache_dir() {
+    static const std::string dir = ov::util::getenv_string("OV_TRANSFORMATIONS_CACHE_DIR");
+    return dir;
+}
+
+// Managers created inside passes (e.g. SmartReshape) run on intermediate states of the
+// outer pipeline and must not consult or populate the transformed-model cache.
+thread_local bool transformed_model_cache_busy = false;
+
+class TransformedModelCacheScope {
+public:
+    explicit TransformedModelCacheScope(bool armed) : m_armed(armed) {
+        if (m_armed)
+            transformed_model_cache_busy = true;
+    }
+    ~TransformedModelCacheScope() {
+        if (m_armed)
+            transformed_model_cache_busy = false;
+    }
+
+private:
+    bool m_armed;
+};
+
+// Splices the body of `cached` (an already transformed copy of `model`) into `model`
+// preserving the caller-visible Parameter/Result nodes. Returns false when the entry
+// is structurally incompatible and cannot be applied.
+bool splice_cached_model(const std::shared_ptr<ov::Model>& model, const std::shared_ptr<ov::Model>& cached) {
+    if (!cached || cached->get_parameters().size() != model->get_parameters().size() ||
+        cached->get_results().size() != model->get_results().size() || !model->get_sinks().empty() ||
+        !cached->get_sinks().empty() || !model->get_variables().empty() || !cached->get_variables().empty()) {
+        return false;
+    }
+    const auto& params = model->get_parameters();
+    const auto& cached_params = cached->get_parameters();
+    for (size_t i = 0; i < params.size(); ++i) {
+        if (params[i]->get_element_type() != cached_params[i]->get_element_type()) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < params.size(); ++i) {
+        params[i]->set_partial_shape(cached_params[i]->get_partial_shape());
+        ov::replace_node(cached_params[i], params[i]);
+    }
+    const auto& results = model->get_results();
+    const auto& cached_results = cached->get_results();
+    for (size_t i = 0; i < results.size(); ++i) {
+        results[i]->set_argument(0, cached_results[i]->input_value(0));
+    }
+    model->validate_nodes_and_infer_types();
+    return true;
+}
 }  // namespace
 
 ov::pass::Manager::Manager() : m_pass_config(std::make_shared<PassConfig>()), m_visualize(getenv_visualize_tracing()) {}
@@ -53,6 +125,30 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+std::string ov::pass::Manager::get_pipeline_fingerprint() const {
+    uint64_t seed = 0;
+    const std::hash<std::string> hasher;
+    for (const auto& pass : m_pass_list) {
+        if (m_pass_config->is_disabled(pass->get_type_info()))
+            continue;
+        const auto& type_info = pass->get_type_info();
+        std::string pass_id(type_info.name);
+        pass_id += ':';
+        if (type_info.version_id) {
+            pass_id += type_info.version_id;
+        }
+        seed = seed * 1099511628211ULL + hasher(pass_id);
+    }
+    std::stringstream fingerprint;
+    fingerprint << std::hex << seed;
+    return fingerprint.str();
+}
+
+void ov::pass::Manager::set_cached_model_loader(const cached_model_loader_t& loader) {
+    std::lock_guard<std::mutex> lock(cached_model_loader_mutex());
+    cached_model_loader() = loader;
+}
+
 namespace {
 class stopwatch {
 public:
@@ -96,6 +192,42 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
     static bool profile_enabled = ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
 
+    // Opt-in persistent cache of transformed models keyed by the model hash and the
+    // fingerprint of the enabled pass pipeline. On a hit the stored body is spliced
+    // into `func` and the whole pipeline is skipped.
+    cached_model_loader_t loader;
+    const auto& cache_dir = transformed_model_cache_dir();
+    if (!cache_dir.empty() && !transformed_model_cache_busy) {
+        std::lock_guard<std::mutex> lock(cached_model_loader_mutex());
+        loader = cached_model_loader();
+    }
+    const bool use_model_cache = loader != nullptr;
+    TransformedModelCacheScope cache_scope(use_model_cache);
+    std::string cache_xml_path, cache_bin_path;
+    if (use_model_cache) {
+        uint64_t model_hash = 0;
+        Hash(model_hash).run_on_model(func);
+        std::stringstream cache_id;
+        cache_id << std::hex << model_hash << "_" << get_pipeline_fingerprint();
+        cache_xml_path = ov::util::make_path(cache_dir, cache_id.str() + ".xml");
+        cache_bin_path = ov::util::make_path(cache_dir, cache_id.str() + ".bin");
+        if (ov::util::file_exists(cache_xml_path) && ov::util::file_exists(cache_bin_path)) {
+            try {
+                if (splice_cached_model(func, loader(cache_xml_path, cache_bin_path))) {
+                    OPENVINO_DEBUG << "Transformed model restored from cache: " << cache_xml_path;
+                    return true;
+                }
+            } catch (...) {
+                // Broken or incompatible entry: fall through to running the pipeline,
+                // the entry will be overwritten below.
+            }
+        }
+    }
+
+    if (cc_profile_enabled()) {
+        cc_profile_record_model(func);
+    }
+
     size_t index = 0;
     stopwatch pass_timer;
     stopwatch overall_timer;
@@ -103,6 +235,48 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     bool pass_applied = false;
     bool function_changed = false;
     bool needs_validate = false;
+    // Rewrite whose dirty-node set can scope the next Validate run to the modified cone
+    std::shared_ptr<GraphRewrite> last_rewrite;
+
+    // Log of nodes recorded dirty by rewrites since the start of the pipeline (or since
+    // the last mutation that could not be expressed as a dirty set). Worklist-enabled
+    // cleanup rewrites remember their position in the log and on a repeated invocation
+    // process only the suffix added since, instead of sweeping the whole model.
+    std::vector<std::weak_ptr<Node>> dirty_log;
+    std::unordered_map<DiscreteTypeInfo, size_t> worklist_positions;
+
+    // Op types present in the model (including base types and subgraph bodies); allows
+    // skipping matcher passes whose pattern root cannot occur in this model without
+    // traversing the graph. Rebuilt lazily after a pass changes the model.
+    std::unordered_set<DiscreteTypeInfo> present_op_types;
+    bool present_op_types_valid = false;
+    std::function<void(const std::shared_ptr<Model>&)> collect_op_types = [&](const std::shared_ptr<Model>& model) {
+        for (const auto& node : model->get_ordered_ops()) {
+            for (const DiscreteTypeInfo* type_info = &node->get_type_info(); type_info;
+                 type_info = type_info->parent) {
+                present_op_types.insert(*type_info);
+            }
+            if (auto sub_graph_node = dynamic_pointer_cast<op::util::MultiSubGraphOp>(node)) {
+                for (size_t i = 0; i < sub_graph_node->get_internal_subgraphs_size(); ++i) {
+                    collect_op_types(sub_graph_node->get_function(static_cast<int>(i)));
+                }
+            }
+        }
+    };
+    auto model_contains_any = [&](const std::vector<DiscreteTypeInfo>& root_types) {
+        if (!present_op_types_valid) {
+            present_op_types.clear();
+            collect_op_types(func);
+            present_op_types_valid = true;
+        }
+        for (const auto& root_type : root_types) {
+            if (present_op_types.count(root_type)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             OPENVINO_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -121,9 +295,18 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                                << "model is dynamic. Skipping this transformation";
                 continue;
             }
-            // GraphRewrite is a temporary container for MatcherPass to make execution
-            // on on entire ov::Model
-            pass_applied = GraphRewrite(matcher_pass).run_on_model(func);
+            const auto root_types = matcher_pass->get_root_type_infos();
+            if (!root_types.empty() && !model_contains_any(root_types)) {
+                // The pattern root type does not occur in the model: nothing to match
+                pass_applied = false;
+            } else {
+                // GraphRewrite is a temporary container for MatcherPass to make execution
+                // on on entire ov::Model; it outlives the iteration so the following
+                // Validate pass can reuse its dirty-node bookkeeping
+                auto rewrite = make_shared<GraphRewrite>(matcher_pass);
+                pass_applied = rewrite->run_on_model(func);
+                last_rewrite = std::move(rewrite);
+            }
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -135,11 +318,30 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
             if (dynamic_pointer_cast<Validate>(pass)) {
                 if (needs_validate) {
-                    function_pass->run_on_model(func);
+                    // Prefer validating only the cone modified by the preceding rewrite;
+                    // fall back to the whole model when the dirty set is incomplete
+                    if (!(last_rewrite && last_rewrite->validate_dirty_subgraph(func))) {
+                        function_pass->run_on_model(func);
+                    }
                     needs_validate = false;
                 }
+            } else if (auto rewrite = dynamic_pointer_cast<GraphRewrite>(pass)) {
+                rewrite->clear_dirty_nodes();
+                auto position = rewrite->is_worklist_enabled() ? worklist_positions.find(rewrite->get_type_info())
+                                                               : worklist_positions.end();
+                if (position != worklist_positions.end()) {
+                    // Every mutation since this cleanup last ran is in the log suffix;
+                    // revisit the neighborhood of those nodes only.
+                    pass_applied = rewrite->run_on_nodes(
+                        func,
+                        std::vector<std::weak_ptr<Node>>(dirty_log.begin() + position->second, dirty_log.end()));
+                } else {
+                    pass_applied = rewrite->run_on_model(func);
+                }
+                last_rewrite = rewrite;
             } else {
                 pass_applied = function_pass->run_on_model(func);
+                last_rewrite = nullptr;
             }
         }
 
@@ -156,18 +358,51 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 vt.run_on_model(func);
             }
         }
+        if (cc_profile_enabled()) {
+            cc_profile_record_pass(pass->get_type_info().name);
+        }
         index++;
         pass_timer.stop();
+        if (ov::util::compile_time_profile_enabled()) {
+            ov::util::compile_time_profile_add(std::string("pass::") + pass->get_name(), pass_timer.get_timer_value());
+        }
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms" << (pass_applied ? " + " : "   ")
                  << pass->get_name() << "\n";
         }
         function_changed = function_changed || pass_applied;
         needs_validate = pass_applied;
+        if (pass_applied) {
+            present_op_types_valid = false;
+            if (last_rewrite && last_rewrite->dirty_nodes_complete()) {
+                const auto& dirty = last_rewrite->get_dirty_nodes();
+                dirty_log.insert(dirty_log.end(), dirty.begin(), dirty.end());
+            } else {
+                // Mutation not captured by a dirty set: worklist consumers must do a
+                // full sweep again before they can go back to suffix processing.
+                dirty_log.clear();
+                worklist_positions.clear();
+            }
+        }
+        if (auto rewrite = dynamic_pointer_cast<GraphRewrite>(pass)) {
+            if (rewrite->is_worklist_enabled()) {
+                // The model is clean with respect to this rewrite up to the current log end
+                worklist_positions[rewrite->get_type_info()] = dirty_log.size();
+            }
+        }
     }
     if (profile_enabled) {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
     }
 
+    if (use_model_cache) {
+        try {
+            Serialize(cache_xml_path, cache_bin_path).run_on_model(func);
+        } catch (...) {
+            // The cache is best effort; failure to store an entry must not fail compilation
+            OPENVINO_DEBUG << "Failed to store transformed model in cache: " << cache_xml_path;
+        }
+    }
+
     return function_changed;
 }
@@ -6,9 +6,13 @@
 
 #include <array>
 #include <cassert>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <fstream>
+#include <mutex>
 #include <openvino/cc/pass/itt.hpp>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -91,27 +95,55 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::multimap<HashValue, std::pair<FilePosition, void const*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool skip_payload = false)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
-          m_blob_offset(bin_data.tellp()) {}
+          m_skip_payload(skip_payload) {}
 
+    ~ConstantWriter() {
+        // finalize() is expected to be called by the serializer; join here as a safety net
+        // for the exception paths so the writer thread never outlives the output stream
+        try {
+            finalize();
+        } catch (...) {
+        }
+    }
+
+    // data_owner keeps temporary source buffers (e.g. packed string tensor headers) alive
+    // until the background thread has written them; constant payloads owned by the model
+    // do not need it
     FilePosition write(const char* ptr,
                        size_t size,
                        size_t* new_size,
                        bool compress_to_fp16 = false,
-                       ov::element::Type src_type = ov::element::dynamic) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
+                       ov::element::Type src_type = ov::element::dynamic,
+                       std::shared_ptr<void> data_owner = nullptr) {
+        // Offsets are tracked by a running counter instead of tellp(): payloads are written by
+        // a background thread, so the stream position lags behind the enqueued layout
+        const FilePosition offset = m_write_offset;
         *new_size = size;
 
+        if (m_skip_payload) {
+            // Model the bin file layout only: offset/size attributes stay deterministic while
+            // the constant payloads themselves are hashed separately by the caller
+            // (see ModelCache::compute_hash)
+            if (compress_to_fp16) {
+                OPENVINO_ASSERT(size % src_type.size() == 0);
+                *new_size = (size / src_type.size()) * ov::element::f16.size();
+            }
+            const FilePosition skipped_offset = m_skipped_offset;
+            m_skipped_offset += *new_size;
+            return skipped_offset;
+        }
+
         if (!m_enable_compression) {
             if (!compress_to_fp16) {
-                m_binary_output.write(ptr, size);
+                enqueue_write(ptr, size, std::move(data_owner));
             } else {
                 OPENVINO_ASSERT(size % src_type.size() == 0);
                 auto fp16_buffer = compress_data_to_fp16(ptr, size, src_type, new_size);
-                m_binary_output.write(fp16_buffer.get(), *new_size);
+                const char* buffer_ptr = fp16_buffer.get();
+                enqueue_write(buffer_ptr, *new_size, std::shared_ptr<void>(std::move(fp16_buffer)));
             }
             return offset;
         } else {
@@ -142,12 +174,77 @@ public:
             // Since fp16_compressed data will be disposed at exit point and since we cannot reread it from the ostream,
             // we store pointer to the original uncompressed blob.
             m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
-            m_binary_output.write(ptr_to_write, *new_size);
+            if (fp16_buffer) {
+                enqueue_write(ptr_to_write, *new_size, std::shared_ptr<void>(std::move(fp16_buffer)));
+            } else {
+                enqueue_write(ptr_to_write, *new_size, std::move(data_owner));
+            }
         }
         return offset;
     }
 
+    // Waits until all queued payloads hit the output stream and joins the writer thread.
+    // Must be called before anything else is written to (or positioned in) the stream
+    void finalize() {
+        std::thread writer;
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_queue_done = true;
+            writer = std::move(m_writer_thread);
+        }
+        m_queue_not_empty.notify_all();
+        if (writer.joinable()) {
+            writer.join();
+        }
+    }
+
 private:
+    // Queues a payload for the background writer thread. Uncompressed payloads are referenced
+    // in place (the Constants outlive serialization), fp16-compressed ones transfer ownership
+    // of the temporary buffer; the amount of owned data in flight is bounded so serializing
+    // a compressed model cannot buffer all converted weights in memory at once
+    void enqueue_write(const char* ptr, size_t size, std::shared_ptr<void> data_owner) {
+        static constexpr size_t max_owned_bytes_in_flight = 64 * 1024 * 1024;
+
+        m_write_offset += size;
+        std::unique_lock<std::mutex> lock(m_queue_mutex);
+        if (!m_writer_thread.joinable()) {
+            m_writer_thread = std::thread([this] {
+                write_queued_payloads();
+            });
+        }
+        if (data_owner) {
+            m_queue_space_available.wait(lock, [&] {
+                return m_owned_bytes_in_flight < max_owned_bytes_in_flight;
+            });
+            m_owned_bytes_in_flight += size;
+        }
+        m_write_queue.push_back({ptr, size, std::move(data_owner)});
+        lock.unlock();
+        m_queue_not_empty.notify_one();
+    }
+
+    void write_queued_payloads() {
+        std::unique_lock<std::mutex> lock(m_queue_mutex);
+        while (true) {
+            m_queue_not_empty.wait(lock, [&] {
+                return !m_write_queue.empty() || m_queue_done;
+            });
+            if (m_write_queue.empty()) {
+                // the predicate passed with an empty queue, so m_queue_done is set
+                return;
+            }
+            auto payload = std::move(m_write_queue.front());
+            m_write_queue.pop_front();
+            if (payload.data_owner) {
+                m_owned_bytes_in_flight -= payload.size;
+                m_queue_space_available.notify_one();
+            }
+            lock.unlock();
+            m_binary_output.write(payload.ptr, payload.size);
+            lock.lock();
+        }
+    }
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          ov::element::Type src_type,
@@ -184,10 +281,26 @@ private:
         }
     }
 
+    struct WritePayload {
+        const char* ptr;
+        size_t size;
+        std::shared_ptr<void> data_owner;
+    };
+
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
-    FilePosition m_blob_offset;  // blob offset inside output stream
+    bool m_skip_payload;
+    FilePosition m_write_offset = 0;      // offset of the next payload relative to the blob start
+    FilePosition m_skipped_offset = 0;    // simulated offset when payloads are skipped
+
+    std::thread m_writer_thread;
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_not_empty;
+    std::condition_variable m_queue_space_available;
+    std::deque<WritePayload> m_write_queue;
+    size_t m_owned_bytes_in_flight = 0;
+    bool m_queue_done = false;
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -528,11 +641,13 @@ public:
                     a2->get_header(header_ptr, header_size);
                 }
 
+                // the header is a temporary buffer, so it is handed over to the writer as its owner
                 int64_t offset = m_constant_write_handler.write(reinterpret_cast<const char*>(header_ptr.get()),
                                                                 header_size,
                                                                 &inter_size,
                                                                 m_compress_to_fp16,
-                                                                m_output_element_type);
+                                                                m_output_element_type,
+                                                                header_ptr);
                 new_size += inter_size;
 
                 // write raw strings part
@@ -1130,13 +1245,19 @@ void ngfunction_2_ir(pugi::xml_node& netXml,
     }
 }
 
+bool is_binary_ir_path(const std::string& path) {
+    const char* const extension = ".bir";
+    return path.length() > std::strlen(extension) && path.rfind(extension) == path.size() - std::strlen(extension);
+}
+
 std::string valid_xml_path(const std::string& path) {
     OPENVINO_ASSERT(path.length() > 4, "Path for xml file is too short: \"" + path + "\"");
 
     const char* const extension = ".xml";
-    const bool has_xml_extension = path.rfind(extension) == path.size() - std::strlen(extension);
+    const bool has_xml_extension =
+        path.rfind(extension) == path.size() - std::strlen(extension) || is_binary_ir_path(path);
     OPENVINO_ASSERT(has_xml_extension,
-                    "Path for xml file doesn't contains file name with 'xml' extension: \"" + path + "\"");
+                    "Path for xml file doesn't contains file name with 'xml' or 'bir' extension: \"" + path + "\"");
     return path;
 }
 
@@ -1152,11 +1273,104 @@ std::string provide_bin_path(const std::string& xmlPath, const std::string& binP
     return bestPath;
 }
 
+/* Compact binary encoding of the IR xml document, produced instead of text xml when
+ * Serialize gets a path with the ".bir" extension. The IR frontend decodes it back into
+ * a DOM (see src/frontends/ir/src/utils.cpp), skipping the text tokenization cost.
+ * Layout:
+ *   char[4]  magic "OVBX"
+ *   u32      format version (1)
+ *   u32      IR version (10 / 11)
+ *   u32      string count, then per string: u32 byte size + data
+ *   node records, document element first:
+ *     u8 kind: 0 element / 1 pcdata
+ *     element: u32 name, u32 attribute count, (u32 name, u32 value) per attribute,
+ *              u32 child count, child records
+ *     pcdata:  u32 value
+ * Indices refer to the string table. Like StreamSerialize's DataHeader the integers are
+ * written in host byte order: the artifact is cache-grade and not expected to travel
+ * between machines of different endianness. */
+const char binary_xml_magic[4] = {'O', 'V', 'B', 'X'};
+constexpr uint32_t binary_xml_format_version = 1;
+
+class BinaryXmlWriter {
+public:
+    explicit BinaryXmlWriter(std::ostream& stream) : m_stream(stream) {}
+
+    void write(const pugi::xml_document& doc, uint32_t ir_version) {
+        std::ostringstream body(std::ios::binary);
+        encode(doc.document_element(), body);
+
+        m_stream.write(binary_xml_magic, sizeof(binary_xml_magic));
+        write_u32(m_stream, binary_xml_format_version);
+        write_u32(m_stream, ir_version);
+        write_u32(m_stream, static_cast<uint32_t>(m_strings.size()));
+        for (const auto& str : m_strings) {
+            write_u32(m_stream, static_cast<uint32_t>(str.size()));
+            m_stream.write(str.data(), str.size());
+        }
+        const auto& data = body.str();
+        m_stream.write(data.data(), data.size());
+    }
+
+private:
+    static void write_u32(std::ostream& out, uint32_t value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    static bool is_encoded(const pugi::xml_node& node) {
+        return node.type() == pugi::node_element || node.type() == pugi::node_pcdata;
+    }
+
+    uint32_t intern(const char* str) {
+        auto it = m_string_ids.find(str);
+        if (it != m_string_ids.end())
+            return it->second;
+        const auto id = static_cast<uint32_t>(m_strings.size());
+        m_strings.emplace_back(str);
+        m_string_ids.emplace(m_strings.back(), id);
+        return id;
+    }
+
+    void encode(const pugi::xml_node& node, std::ostream& out) {
+        if (node.type() == pugi::node_pcdata) {
+            out.put(1);
+            write_u32(out, intern(node.value()));
+            return;
+        }
+        out.put(0);
+        write_u32(out, intern(node.name()));
+
+        uint32_t attribute_count = 0;
+        for (auto attr = node.first_attribute(); attr; attr = attr.next_attribute())
+            ++attribute_count;
+        write_u32(out, attribute_count);
+        for (auto attr = node.first_attribute(); attr; attr = attr.next_attribute()) {
+            write_u32(out, intern(attr.name()));
+            write_u32(out, intern(attr.value()));
+        }
+
+        uint32_t child_count = 0;
+        for (const auto& child : node.children())
+            if (is_encoded(child))
+                ++child_count;
+        write_u32(out, child_count);
+        for (const auto& child : node.children())
+            if (is_encoded(child))
+                encode(child, out);
+    }
+
+    std::ostream& m_stream;
+    std::unordered_map<std::string, uint32_t> m_string_ids;
+    std::vector<std::string> m_strings;
+};
+
 void serializeFunc(std::ostream& xml_file,
                    std::ostream& bin_file,
                    std::shared_ptr<ov::Model> model,
                    ov::pass::Serialize::Version ver,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool binary_format = false,
+                   bool skip_weights = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = model->get_rt_info();
@@ -1177,11 +1391,18 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, true, skip_weights);
     XmlSerializer visitor(net_node, name, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
+    // the background thread keeps writing blobs while the XML document is being built;
+    // wait for it before the streams are flushed
+    constant_write_handler.finalize();
 
-    xml_doc.save(xml_file);
+    if (binary_format) {
+        BinaryXmlWriter(xml_file).write(xml_doc, static_cast<uint32_t>(version));
+    } else {
+        xml_doc.save(xml_file);
+    }
     xml_file.flush();
     bin_file.flush();
 };
@@ -1210,11 +1431,12 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         OPENVINO_ASSERT(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
         // create xml file
-        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        const bool binary_format = is_binary_ir_path(m_xmlPath);
+        std::ofstream xml_file(m_xmlPath, binary_format ? std::ios::out | std::ios::binary : std::ios::out);
         OPENVINO_ASSERT(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
         try {
-            serializeFunc(xml_file, bin_file, model, m_version);
+            serializeFunc(xml_file, bin_file, model, m_version, false, binary_format);
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -1303,6 +1525,8 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
     XmlSerializer visitor(net_node, name, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = model;
     visitor.on_attribute(name, fun);
+    // blobs and IR share the stream: all queued blob writes must land before tellp is read
+    constant_write_handler.finalize();
 
     // IR
     hdr.model_offset = m_stream.tellp();
@@ -1367,7 +1591,7 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     std::ostream bin(&binHash);
 
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, true);
+    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, true, false, m_skip_weights);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
@@ -1378,6 +1602,8 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     return false;
 }
 
-pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
+pass::Hash::Hash(uint64_t& output_hash_value, bool skip_weights)
+    : m_hash(output_hash_value),
+      m_skip_weights(skip_weights) {}
 
 }  // namespace ov
@@ -200,6 +200,82 @@ std::shared_ptr<Model> PrePostProcessor::build() {
     return function;
 }
 
+std::pair<std::shared_ptr<Model>, std::shared_ptr<Model>> PrePostProcessor::build_separate() {
+    auto function = m_impl->m_function;
+    std::tuple<std::unordered_set<std::string>, bool> existing_names{std::unordered_set<std::string>{}, false};
+    FunctionGuard guard(function);
+
+    // Build a pass-through model over stand-ins of the original parameters; applying the per-input
+    // pipelines to it leaves the inputs of 'function' untouched
+    ParameterVector pre_params;
+    ResultVector pre_results;
+    for (const auto& param : function->get_parameters()) {
+        auto stand_in = std::make_shared<opset8::Parameter>(param->get_element_type(), param->get_partial_shape());
+        stand_in->set_friendly_name(param->get_friendly_name());
+        stand_in->get_default_output().get_tensor().set_names(param->get_default_output().get_tensor().get_names());
+        stand_in->get_rt_info() = param->get_rt_info();
+        stand_in->output(0).get_rt_info() = param->output(0).get_rt_info();
+        if (!param->get_layout().empty()) {
+            stand_in->set_layout(param->get_layout());
+        }
+        pre_params.push_back(stand_in);
+        pre_results.push_back(std::make_shared<opset8::Result>(stand_in));
+    }
+    auto preprocess_model =
+        std::make_shared<Model>(pre_results, pre_params, function->get_friendly_name() + "_preprocess");
+
+    bool need_validate = false;
+    auto parameters_list = std::list<std::shared_ptr<opset8::Parameter>>(pre_params.begin(), pre_params.end());
+
+    // Retarget resolved parameters to the stand-ins, so that the regular per-input build inserts the
+    // pipelines into the standalone model
+    std::vector<std::shared_ptr<op::v0::Parameter>> resolved_params;
+    for (size_t i = 0; i < m_impl->m_inputs.size(); i++) {
+        resolved_params.push_back(m_impl->m_inputs[i].m_impl->m_resolved_param);
+        m_impl->m_inputs[i].m_impl->m_resolved_param = pre_params[i];
+    }
+    try {
+        for (const auto& input_info : m_impl->m_inputs) {
+            if (input_info.m_impl->build(preprocess_model, existing_names, parameters_list)) {
+                need_validate = true;
+            }
+        }
+    } catch (...) {
+        for (size_t i = 0; i < m_impl->m_inputs.size(); i++) {
+            m_impl->m_inputs[i].m_impl->m_resolved_param = resolved_params[i];
+        }
+        throw;
+    }
+    for (size_t i = 0; i < m_impl->m_inputs.size(); i++) {
+        m_impl->m_inputs[i].m_impl->m_resolved_param = resolved_params[i];
+    }
+
+    // Add parameters with right order
+    {
+        while (!preprocess_model->get_parameters().empty()) {
+            preprocess_model->remove_parameter(*preprocess_model->get_parameters().begin());
+        }
+        auto parameters_vec = ParameterVector(parameters_list.begin(), parameters_list.end());
+        preprocess_model->add_parameters(parameters_vec);
+    }
+    if (need_validate) {
+        preprocess_model->validate_nodes_and_infer_types();
+    }
+
+    // Post processing stays with the main model
+    auto results = function->get_results();
+    for (const auto& output_info : m_impl->m_outputs) {
+        output_info.m_impl->build(results);
+    }
+    // Add results with right order
+    while (!function->get_results().empty())
+        function->remove_result(*function->get_results().begin());
+    function->add_results(results);
+
+    guard.reset();
+    return {preprocess_model, function};
+}
+
 // --------------------- InputTensorInfo ------------------
 InputTensorInfo::InputTensorInfo() : m_impl(std::unique_ptr<InputTensorInfoImpl>(new InputTensorInfoImpl())) {}
 InputTensorInfo::~InputTensorInfo() = default;
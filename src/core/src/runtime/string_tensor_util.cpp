@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/string_tensor_util.hpp"
+
+#include <cstring>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace util {
+
+Tensor pack_string_tensor(const Tensor& strings) {
+    OPENVINO_ASSERT(strings.get_element_type() == element::string,
+                    "pack_string_tensor accepts a string tensor, got: ",
+                    strings.get_element_type());
+    const auto* elements = strings.data<std::string>();
+    const auto num_elements = strings.get_size();
+
+    // first run over all elements: calculate total memory required to hold all strings
+    size_t symbols_size = 0;
+    for (size_t idx = 0; idx < num_elements; ++idx) {
+        symbols_size += elements[idx].size();
+    }
+    const auto header_size = sizeof(int32_t) * (1 + 1 + num_elements);
+
+    auto packed = Tensor(element::u8, Shape{header_size + symbols_size});
+    auto* pindices = static_cast<int32_t*>(packed.data());
+    pindices[0] = static_cast<int32_t>(num_elements);
+    pindices[1] = 0;
+    auto* symbols = reinterpret_cast<char*>(pindices + 2 + num_elements);
+    size_t current_symbols_pos = 0;
+    for (size_t idx = 0; idx < num_elements; ++idx) {
+        const auto& str = elements[idx];
+        std::memcpy(symbols + current_symbols_pos, str.data(), str.size());
+        current_symbols_pos += str.size();
+        pindices[2 + idx] = static_cast<int32_t>(current_symbols_pos);
+    }
+    return packed;
+}
+
+Tensor unpack_string_tensor(const Tensor& packed) {
+    OPENVINO_ASSERT(packed.get_element_type() == element::u8,
+                    "unpack_string_tensor accepts an u8 tensor, got: ",
+                    packed.get_element_type());
+    const auto size = packed.get_byte_size();
+    OPENVINO_ASSERT(size >= 4, "Incorrect packed string tensor format: no batch size in the packed string tensor");
+    const auto* pindices = static_cast<const int32_t*>(packed.data());
+    const auto num_elements = pindices[0];
+    OPENVINO_ASSERT(num_elements >= 0 && int64_t(size) >= int64_t(4 + 4 + 4 * num_elements),
+                    "Incorrect packed string tensor format: the packed string tensor must contain first "
+                    "string offset and end indices");
+    const auto* begin_ids = pindices + 1;
+    const auto* end_ids = pindices + 2;
+    const auto* symbols = reinterpret_cast<const char*>(pindices + 2 + num_elements);
+
+    auto strings = Tensor(element::string, Shape{static_cast<size_t>(num_elements)});
+    auto* elements = strings.data<std::string>();
+    for (int32_t idx = 0; idx < num_elements; ++idx) {
+        elements[idx].assign(symbols + begin_ids[idx], symbols + end_ids[idx]);
+    }
+    return strings;
+}
+
+}  // namespace util
+}  // namespace ov
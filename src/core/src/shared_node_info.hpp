@@ -7,6 +7,7 @@
 #include <memory>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <vector>
 
 namespace ov {
 class SharedRTInfo {
@@ -15,13 +16,78 @@ public:
 
     void set_use_topological_cache(bool status) {
         m_use_topological_cache = status;
+        if (!status) {
+            m_pending_topological_updates.clear();
+            m_pending_cleanups.clear();
+        }
     }
 
     bool get_use_topological_cache() const {
         return m_use_topological_cache;
     }
 
+    // Registers a node whose position in the cached topological order has to be
+    // re-derived after a local graph rewrite. While the pending list stays within
+    // the budget the cache remains valid and Model::get_ordered_ops patches only
+    // the affected region instead of re-sorting the whole graph. Returns false
+    // if the cache was (or became) invalid.
+    bool add_pending_topological_update(const std::shared_ptr<Node>& node) {
+        if (!m_use_topological_cache)
+            return false;
+        for (const auto& pending : m_pending_topological_updates) {
+            if (pending.lock() == node)
+                return true;
+        }
+        if (m_pending_topological_updates.size() >= PENDING_UPDATES_BUDGET) {
+            set_use_topological_cache(false);
+            return false;
+        }
+        m_pending_topological_updates.emplace_back(node);
+        return true;
+    }
+
+    // Registers destruction of a node, so its leftovers (e.g. the raw pointer kept
+    // in the Model ops cache) can be swept out during the next patching instead of
+    // dropping the whole cached order. The pointer may be dangling and must only
+    // be used as a key.
+    void add_pending_cleanup(Node* node) {
+        if (!m_use_topological_cache)
+            return;
+        if (m_pending_cleanups.size() >= PENDING_UPDATES_BUDGET) {
+            set_use_topological_cache(false);
+            return;
+        }
+        m_pending_cleanups.push_back(node);
+    }
+
+    bool has_pending_topological_updates() const {
+        return !m_pending_topological_updates.empty() || !m_pending_cleanups.empty();
+    }
+
+    std::vector<Node*> take_pending_cleanups() {
+        std::vector<Node*> cleanups;
+        cleanups.swap(m_pending_cleanups);
+        return cleanups;
+    }
+
+    std::vector<std::shared_ptr<Node>> take_pending_topological_updates() {
+        std::vector<std::shared_ptr<Node>> pending;
+        pending.reserve(m_pending_topological_updates.size());
+        for (const auto& weak_node : m_pending_topological_updates) {
+            if (auto node = weak_node.lock())
+                pending.push_back(node);
+        }
+        m_pending_topological_updates.clear();
+        return pending;
+    }
+
 private:
+    // Above this number of pending local rewrites a full re-sort is cheaper
+    // than patching, so the cache is dropped instead.
+    static const size_t PENDING_UPDATES_BUDGET = 64;
+
     bool m_use_topological_cache;
+    std::vector<std::weak_ptr<Node>> m_pending_topological_updates;
+    std::vector<Node*> m_pending_cleanups;
 };
 }  // namespace ov
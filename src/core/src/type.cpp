@@ -4,6 +4,9 @@
 
 #include "openvino/core/type.hpp"
 
+#include <unordered_map>
+#include <utility>
+
 #include "openvino/util/common_util.hpp"
 
 namespace std {
@@ -14,11 +17,24 @@ size_t std::hash<ov::DiscreteTypeInfo>::operator()(const ov::DiscreteTypeInfo& k
 
 namespace ov {
 
+namespace {
+// Content hash over a C string; avoids the std::string temporaries which
+// std::hash would require and which showed up in rt_info lookup profiles
+size_t hash_c_string(const char* str) {
+    size_t hash = 0;
+    if (str) {
+        for (; *str != '\0'; ++str)
+            hash = hash * 31 + static_cast<size_t>(*str);
+    }
+    return hash;
+}
+}  // namespace
+
 size_t DiscreteTypeInfo::hash() const {
     if (hash_value != 0)
         return hash_value;
-    size_t name_hash = name ? std::hash<std::string>()(std::string(name)) : 0;
-    size_t version_id_hash = version_id ? std::hash<std::string>()(std::string(version_id)) : 0;
+    const size_t name_hash = hash_c_string(name);
+    const size_t version_id_hash = hash_c_string(version_id);
 
     return ov::util::hash_combine(std::vector<size_t>{name_hash, version_id_hash});
 }
@@ -41,7 +57,23 @@ std::string DiscreteTypeInfo::get_version() const {
 }
 
 DiscreteTypeInfo::operator std::string() const {
-    return std::string(name) + "_" + get_version();
+    // This conversion keys every rt_info lookup, so graph rewrites hit it millions
+    // of times. The composed string is interned per (name, version_id) literal pair
+    // to avoid re-concatenating it on each query; the table is thread-local, so no
+    // locking is needed on the hot path.
+    struct LiteralPairHash {
+        size_t operator()(const std::pair<const void*, const void*>& key) const {
+            return std::hash<const void*>()(key.first) ^ (std::hash<const void*>()(key.second) << 1);
+        }
+    };
+    static thread_local std::unordered_map<std::pair<const void*, const void*>, std::string, LiteralPairHash>
+        interned_names;
+    const auto key = std::make_pair(static_cast<const void*>(name), static_cast<const void*>(version_id));
+    auto it = interned_names.find(key);
+    if (it == interned_names.end()) {
+        it = interned_names.emplace(key, std::string(name) + "_" + get_version()).first;
+    }
+    return it->second;
 }
 
 std::ostream& operator<<(std::ostream& s, const DiscreteTypeInfo& info) {
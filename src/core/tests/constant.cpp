@@ -11,6 +11,7 @@
 #include "common_test_utils/test_assertions.hpp"
 #include "common_test_utils/type_prop.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 
@@ -1974,6 +1975,57 @@ TEST(constant, hold_tensor_ov_string) {
     ASSERT_EQ(constDataPtr, hostDataPtr);
 }
 
+TEST(constant, get_alignment_internal_allocation) {
+    auto constant = op::v0::Constant::create(element::f32, Shape{4}, {1.0f, 2.0f, 3.0f, 4.0f});
+    EXPECT_GE(constant->get_alignment(), op::v0::Constant::host_alignment());
+}
+
+TEST(constant, get_alignment_adopted_external_memory) {
+    // 64-byte aligned backing store adopted without a copy
+    auto backing = std::make_shared<ov::AlignedBuffer>(64 * sizeof(float), 64);
+    auto* base = backing->get_ptr<char>();
+    auto weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(base,
+                                                                                          16 * sizeof(float),
+                                                                                          backing);
+    auto aligned_constant = std::make_shared<op::v0::Constant>(element::f32, Shape{16}, weights);
+    EXPECT_EQ(aligned_constant->get_data_ptr(), base);
+    EXPECT_GE(aligned_constant->get_alignment(), 64);
+
+    // Intentionally misaligned view into the same store
+    auto misaligned = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(base + sizeof(float),
+                                                                                             16 * sizeof(float),
+                                                                                             backing);
+    auto misaligned_constant = std::make_shared<op::v0::Constant>(element::f32, Shape{16}, misaligned);
+    EXPECT_LT(misaligned_constant->get_alignment(), 64);
+}
+
+TEST(constant, lazy_decompression_expands_on_first_access) {
+    const auto compressed =
+        op::v0::Constant::create(element::f16, Shape{2, 2}, std::vector<float16>{1.f, -2.f, 0.5f, 4.f});
+    const auto constant = op::v0::Constant::create_lazily_decompressed(element::f32, compressed);
+    ASSERT_NE(constant, nullptr);
+    EXPECT_EQ(constant->get_element_type(), element::f32);
+    EXPECT_EQ(constant->get_shape(), (Shape{2, 2}));
+    // the expanded size is reported before the payload is expanded
+    EXPECT_EQ(constant->get_byte_size(), 4 * sizeof(float));
+    EXPECT_THAT(constant->cast_vector<float>(), ElementsAre(1.f, -2.f, 0.5f, 4.f));
+    // once expanded the data pointer is stable
+    const auto* data = constant->get_data_ptr<float>();
+    EXPECT_EQ(data, constant->get_data_ptr<float>());
+}
+
+TEST(constant, lazy_decompression_folds_convert) {
+    // a decompression Convert folds into a constant which keeps the compressed payload
+    const auto compressed = op::v0::Constant::create(element::f16, Shape{4}, std::vector<float16>{1.f, 2.f, 3.f, 4.f});
+    const auto convert = std::make_shared<op::v0::Convert>(compressed, element::f32);
+    OutputVector folded(1);
+    ASSERT_TRUE(convert->constant_fold(folded, {compressed}));
+    const auto folded_constant = ov::as_type_ptr<op::v0::Constant>(folded[0].get_node_shared_ptr());
+    ASSERT_NE(folded_constant, nullptr);
+    EXPECT_EQ(folded_constant->get_element_type(), element::f32);
+    EXPECT_THAT(folded_constant->cast_vector<float>(), ElementsAre(1.f, 2.f, 3.f, 4.f));
+}
+
 // Test verifies 2 things:
 // a) Checks that bitwise comparison happens on first call of 'get_all_data_elements_bitwise_identical'
 // b) Next call of 'get_all_data_elements_bitwise_identical' takes already calculated value
@@ -16,6 +16,7 @@
 #include "openvino/op/tanh.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -267,6 +268,70 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+class RegisteringTestPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("RegisteringTestPass");
+    RegisteringTestPass() : MatcherPass() {
+        auto divide = ov::pass::pattern::wrap_type<ov::op::v1::Divide>();
+        ov::matcher_pass_callback callback = [this](pattern::Matcher& m) {
+            auto relu = register_new_node<ov::op::v0::Relu>(m.get_match_root()->input_value(0));
+            ov::replace_node(m.get_match_root(), relu);
+            return true;
+        };
+
+        auto m = std::make_shared<ov::pass::pattern::Matcher>(divide, "RegisteringTestPass");
+        this->register_matcher(m, callback);
+    }
+};
+
+TEST(GraphRewriteTest, ScopedValidationAfterRegisteredRewrite) {
+    auto f = get_model();
+
+    // Per-pass validation after a rewrite whose nodes were registered via
+    // register_new_node goes through the dirty-cone path; the model must end up
+    // fully valid with correct shapes downstream of the replacement.
+    ov::pass::Manager m;
+    m.register_pass<RegisteringTestPass>();
+    m.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Divide>(f), 0);
+    ASSERT_EQ(f->get_results()[0]->get_shape(), (ov::Shape{3, 1, 2}));
+}
+
+TEST(GraphRewriteTest, RunOnNodesProcessesSeedNeighborhoodOnly) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{3, 1, 2});
+    auto divide_a =
+        std::make_shared<op::v1::Divide>(data, op::v0::Constant::create(element::f32, Shape{3, 1, 2}, {2}));
+    auto divide_b =
+        std::make_shared<op::v1::Divide>(data, op::v0::Constant::create(element::f32, Shape{3, 1, 2}, {4}));
+    auto f = std::make_shared<ov::Model>(NodeVector{divide_a, divide_b}, ParameterVector{data});
+
+    Anchor anchor;
+    anchor.add_matcher<RegisteringTestPass>();
+    anchor.run_on_nodes(f, {divide_a});
+
+    // Only the seeded branch is visited; the second Divide stays untouched
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Divide>(f), 1);
+    ASSERT_EQ(f->get_results()[1]->input_value(0).get_node_shared_ptr(), divide_b);
+}
+
+TEST(GraphRewriteTest, MixedTypedAndWildcardRootMatcherPass) {
+    auto f = get_model();
+
+    // An untyped-root matcher must not prevent type-based dispatch of the other matchers,
+    // and both kinds have to be applied in registration order.
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    ASSERT_EQ(order.size(), f->get_ordered_ops().size());
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
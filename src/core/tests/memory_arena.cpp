@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/memory_arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/parameter.hpp"
+
+using namespace ov;
+
+TEST(memory_arena, bump_allocation_and_bulk_teardown) {
+    auto arena = std::make_shared<util::MemoryArena>(1024);
+    auto* a = arena->allocate(16, 8);
+    auto* b = arena->allocate(16, 8);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(arena->get_live_allocations(), 2);
+    EXPECT_GE(arena->get_capacity(), 1024);
+    arena->deallocate(a, 16);
+    arena->deallocate(b, 16);
+    EXPECT_EQ(arena->get_live_allocations(), 0);
+}
+
+TEST(memory_arena, grows_beyond_single_block) {
+    auto arena = std::make_shared<util::MemoryArena>(64);
+    arena->allocate(48, 8);
+    arena->allocate(48, 8);
+    EXPECT_GE(arena->get_capacity(), 128);
+}
+
+TEST(memory_arena, scope_installs_current_arena) {
+    EXPECT_EQ(util::MemoryArena::current(), nullptr);
+    auto arena = std::make_shared<util::MemoryArena>();
+    {
+        util::ArenaScope scope(arena);
+        EXPECT_EQ(util::MemoryArena::current(), arena);
+        {
+            auto nested = std::make_shared<util::MemoryArena>();
+            util::ArenaScope nested_scope(nested);
+            EXPECT_EQ(util::MemoryArena::current(), nested);
+        }
+        EXPECT_EQ(util::MemoryArena::current(), arena);
+    }
+    EXPECT_EQ(util::MemoryArena::current(), nullptr);
+}
+
+TEST(memory_arena, model_descriptors_carved_from_active_arena) {
+    auto arena = std::make_shared<util::MemoryArena>();
+    std::shared_ptr<Model> model;
+    {
+        util::ArenaScope scope(arena);
+        auto param = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 2});
+        auto add = std::make_shared<op::v1::Add>(param, param);
+        model = std::make_shared<Model>(OutputVector{add}, ParameterVector{param});
+    }
+    EXPECT_GT(arena->get_live_allocations(), 0);
+    // Objects outlive the scope and keep the arena alive until the model is destroyed
+    model.reset();
+    EXPECT_EQ(arena->get_live_allocations(), 0);
+}
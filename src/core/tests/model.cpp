@@ -957,6 +957,66 @@ TEST(model_reshape, IncoreectReshapeBatchWithMultipleInputs) {
     EXPECT_THROW(f->reshape(shape), ov::Exception);
 }
 
+TEST(model_reshape, ReshapeShapeCandidatesReplay) {
+    std::shared_ptr<ov::Model> model;
+    {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 22, 22});
+        param->get_output_tensor(0).set_names({"tensor"});
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto result = std::make_shared<ov::op::v0::Result>(relu);
+        model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+    }
+
+    const auto port = model->input("tensor");
+    std::vector<std::map<ov::Output<ov::Node>, ov::PartialShape>> candidates;
+    candidates.push_back({{port, ov::PartialShape{2, 3, 22, 22}}});
+    candidates.push_back({{port, ov::PartialShape{4, 3, 22, 22}}});
+
+    // warm the memoization cache; the model ends up reshaped to the last candidate
+    EXPECT_NO_THROW(model->reshape(candidates));
+    EXPECT_EQ(model->get_results()[0]->get_shape(), ov::Shape({4, 3, 22, 22}));
+
+    // switching between the warmed candidates replays memoized shapes
+    EXPECT_NO_THROW(model->reshape(candidates[0]));
+    EXPECT_EQ(model->get_parameters()[0]->get_shape(), ov::Shape({2, 3, 22, 22}));
+    EXPECT_EQ(model->get_results()[0]->get_shape(), ov::Shape({2, 3, 22, 22}));
+
+    EXPECT_NO_THROW(model->reshape(candidates[1]));
+    EXPECT_EQ(model->get_results()[0]->get_shape(), ov::Shape({4, 3, 22, 22}));
+}
+
+TEST(model_reshape, ReshapeReplayRestoresValueBounds) {
+    // Reshape output depends on the value bounds of the ShapeOf subgraph, not only on
+    // tensor shapes; replaying a memoized reshape has to restore the bounds recorded for
+    // that shape signature instead of keeping the ones from the previously active shapes.
+    auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape::dynamic());
+    auto shape_src = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 2, 2});
+    shape_src->get_output_tensor(0).set_names({"shape_src"});
+    auto shape_of = std::make_shared<ov::opset8::ShapeOf>(shape_src);
+    auto reshape = std::make_shared<ov::op::v1::Reshape>(data, shape_of, false);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{reshape}, ov::ParameterVector{data, shape_src});
+
+    const auto port = model->input("shape_src");
+    std::map<ov::Output<ov::Node>, ov::PartialShape> small{{port, ov::PartialShape{2, 3, 2, 2}}};
+    std::map<ov::Output<ov::Node>, ov::PartialShape> large{{port, ov::PartialShape{4, 3, 2, 2}}};
+
+    model->reshape(small);
+    EXPECT_EQ(model->get_results()[0]->get_shape(), ov::Shape({2, 3, 2, 2}));
+    model->reshape(large);
+    EXPECT_EQ(model->get_results()[0]->get_shape(), ov::Shape({4, 3, 2, 2}));
+
+    // memoized replay back to the first shape set
+    model->reshape(small);
+    EXPECT_EQ(model->get_results()[0]->get_shape(), ov::Shape({2, 3, 2, 2}));
+
+    // the cached bounds on the ShapeOf output must match the replayed shapes
+    const auto& lower = shape_of->get_output_tensor(0).get_lower_value();
+    ASSERT_TRUE(static_cast<bool>(lower));
+    const auto* lower_data = lower.data<int64_t>();
+    const std::vector<int64_t> expected{2, 3, 2, 2};
+    EXPECT_EQ(std::vector<int64_t>(lower_data, lower_data + lower.get_size()), expected);
+}
+
 TEST(model, add_output_tensor_name) {
     auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
     arg0->set_friendly_name("data");
@@ -1457,15 +1517,55 @@ TEST(model, topological_sort_caching_replace_node) {
     auto new_relu = std::make_shared<ov::opset8::Relu>(relu1);
     ov::replace_node(relu2, new_relu);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    // Local rewrite keeps the cache valid and only registers pending updates
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(shared_info->has_pending_topological_updates());
 
     // Before get_ordered_ops, new_node shouldn't have shared_info, but after
-    // it will be set to the model shared_info and cache will be used.
+    // patching it will be set to the model shared_info and cache will be used.
     ASSERT_FALSE(ov::NodeAccessor(new_relu).get_shared_info().count(shared_info));
     ASSERT_EQ(f->get_ordered_ops().size(), 4);
     ASSERT_TRUE(ov::NodeAccessor(new_relu).get_shared_info().count(shared_info));
     ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_FALSE(shared_info->has_pending_topological_updates());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_incremental_patch_after_rewrite) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(relu1);
+    auto result = std::make_shared<ov::opset8::Result>(relu2);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // Multi-node replacement subgraph, with the replaced node destroyed right away
+    // as transformation passes do
+    {
+        auto new_abs = std::make_shared<ov::opset8::Abs>(relu1);
+        auto new_relu = std::make_shared<ov::opset8::Relu>(new_abs);
+        ov::replace_node(relu2, new_relu);
+        relu2.reset();
+    }
+
+    // The cache stays valid, the rewritten region is patched in place
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(shared_info->has_pending_topological_updates());
+
+    const auto order = f->get_ordered_ops();
+    ASSERT_EQ(order.size(), 5);
+    // Every producer must come before its consumers
+    std::unordered_map<ov::Node*, size_t> position;
+    for (size_t i = 0; i < order.size(); ++i)
+        position[order[i].get()] = i;
+    for (const auto& op : order) {
+        for (size_t i = 0; i < op->get_input_size(); ++i) {
+            ASSERT_LT(position.at(op->get_input_node_ptr(i)), position.at(op.get()));
+        }
+    }
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
     ASSERT_TRUE(all_ops_have_same_info(f));
 }
 
@@ -1481,8 +1581,9 @@ TEST(model, topological_sort_caching_replace_source_output) {
 
     relu2->input(0).replace_source_output(relu1);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    // Local rewrite keeps the cache valid and only registers pending updates
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(shared_info->has_pending_topological_updates());
 
     ASSERT_EQ(f->get_ordered_ops().size(), 4);
     ASSERT_TRUE(shared_info->get_use_topological_cache());
@@ -1520,8 +1621,9 @@ TEST(model, topological_sort_caching_replace_output) {
     auto new_relu = std::make_shared<ov::opset8::Relu>(relu1);
     relu2->output(0).replace(new_relu);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    // Local rewrite keeps the cache valid and only registers pending updates
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(shared_info->has_pending_topological_updates());
     ASSERT_EQ(f->get_ordered_ops().size(), 4);
     ASSERT_TRUE(shared_info->get_use_topological_cache());
     ASSERT_TRUE(all_ops_have_same_info(f));
@@ -1539,8 +1641,9 @@ TEST(model, topological_sort_caching_set_argument) {
 
     relu2->set_argument(0, arg0);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    // Local rewrite keeps the cache valid and only registers pending updates
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(shared_info->has_pending_topological_updates());
     ASSERT_EQ(f->get_ordered_ops().size(), 3);
     ASSERT_TRUE(shared_info->get_use_topological_cache());
     ASSERT_TRUE(all_ops_have_same_info(f));
@@ -4055,3 +4055,25 @@ INSTANTIATE_TEST_SUITE_P(constant_folding,
                          UnsupportedTypesTest,
                          testing::ValuesIn(ov::util::unsupported_types()),
                          unsupported_types_test_case_name);
+
+TEST(constant_folding, size_budget_defers_large_results) {
+    // 256 f32 elements = 1024 bytes result, folded only when the budget allows it
+    auto constant = op::v0::Constant::create(element::f32, Shape{256}, std::vector<float>(256, 1.0f));
+    auto abs = std::make_shared<op::v0::Abs>(constant);
+    auto model = std::make_shared<Model>(abs, ParameterVector{});
+
+    pass::Manager limited_manager;
+    limited_manager.register_pass<pass::ConstantFolding>(512);
+    limited_manager.run_passes(model);
+
+    // Folding the Abs would materialize more bytes than the budget allows
+    EXPECT_EQ(count_ops_of_type<op::v0::Abs>(model), 1);
+
+    pass::Manager unlimited_manager;
+    unlimited_manager.register_pass<pass::ConstantFolding>();
+    unlimited_manager.run_passes(model);
+
+    // The deferred subgraph stays foldable for a pass without the budget
+    EXPECT_EQ(count_ops_of_type<op::v0::Abs>(model), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Constant>(model), 1);
+}
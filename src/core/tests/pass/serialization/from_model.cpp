@@ -27,6 +27,7 @@ public:
     ModelBuilder m_builder;
     std::string m_out_xml_path;
     std::string m_out_bin_path;
+    std::string m_out_bir_path;
 
     static std::string getTestCaseName(const testing::TestParamInfo<SerializationFromModelParams>& obj) {
         std::string res = std::get<1>(obj.param);
@@ -38,11 +39,13 @@ public:
         std::string filePrefix = ov::test::utils::generateTestFilePrefix();
         m_out_xml_path = filePrefix + ".xml";
         m_out_bin_path = filePrefix + ".bin";
+        m_out_bir_path = filePrefix + ".bir";
     }
 
     void TearDown() override {
         std::remove(m_out_xml_path.c_str());
         std::remove(m_out_bin_path.c_str());
+        std::remove(m_out_bir_path.c_str());
     }
 };
 
@@ -58,6 +61,18 @@ TEST_P(SerializationFromModelTest, CompareFunctions) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+TEST_P(SerializationFromModelTest, CompareFunctionsBinaryFormat) {
+    auto expected = m_builder();
+    ov::pass::Serialize(m_out_bir_path, m_out_bin_path).run_on_model(expected);
+    auto result = ov::test::readModel(m_out_bir_path, m_out_bin_path);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(result, expected);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
 namespace {
 std::shared_ptr<ov::Model> create_model_if_mixed_inputs() {
     // Then inputs mapping: 1->0, 0->1
@@ -16,6 +16,7 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -90,3 +91,26 @@ TEST(pass_manager, add) {
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
+
+TEST(pass_manager, pipeline_fingerprint_is_stable_and_pipeline_sensitive) {
+    pass::Manager manager1;
+    manager1.set_per_pass_validation(false);
+    manager1.register_pass<ov::pass::ConstantFolding>();
+
+    pass::Manager manager2;
+    manager2.set_per_pass_validation(false);
+    manager2.register_pass<ov::pass::ConstantFolding>();
+
+    // equal pipelines produce equal fingerprints
+    EXPECT_EQ(manager1.get_pipeline_fingerprint(), manager2.get_pipeline_fingerprint());
+
+    // registering another pass changes the fingerprint
+    manager2.register_pass<ov::pass::Validate>();
+    EXPECT_NE(manager1.get_pipeline_fingerprint(), manager2.get_pipeline_fingerprint());
+
+    // disabling a pass excludes it from the fingerprint
+    manager1.get_pass_config()->disable<ov::pass::ConstantFolding>();
+    pass::Manager manager3;
+    manager3.set_per_pass_validation(false);
+    EXPECT_EQ(manager1.get_pipeline_fingerprint(), manager3.get_pipeline_fingerprint());
+}
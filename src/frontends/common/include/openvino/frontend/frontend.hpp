@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -24,6 +25,9 @@ class FRONTEND_API FrontEnd {
 
     std::shared_ptr<void> m_shared_object = {};  // Library handle
     std::shared_ptr<FrontEnd> m_actual = {};
+    // Duration of the last load_impl call, reported with the conversion statistics when
+    // profiling is enabled with the OV_FRONTEND_PROFILE_ENABLE environment variable
+    mutable int64_t m_load_time_ms = -1;
 
 public:
     using Ptr = std::shared_ptr<FrontEnd>;
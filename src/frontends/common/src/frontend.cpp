@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <openvino/util/env_util.hpp>
 #include <openvino/util/file_util.hpp>
 
@@ -16,6 +17,31 @@
 using namespace ov;
 using namespace ov::frontend;
 
+namespace {
+
+// Conversion phases are timed when the OV_FRONTEND_PROFILE_ENABLE environment variable is set;
+// the durations are recorded in the "conversion_statistics" rt_info map of the produced model,
+// so import time can be attributed per phase right after read_model without a profiler
+bool profile_enabled() {
+    static const bool enabled = ov::util::getenv_bool("OV_FRONTEND_PROFILE_ENABLE");
+    return enabled;
+}
+
+int64_t elapsed_ms(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+void record_statistic(const std::shared_ptr<ov::Model>& model, const std::string& name, const ov::Any& value) {
+    auto& rt_info = model->get_rt_info();
+    auto found = rt_info.find("conversion_statistics");
+    if (found == rt_info.end()) {
+        found = rt_info.emplace("conversion_statistics", ov::AnyMap{}).first;
+    }
+    found->second.as<ov::AnyMap>()[name] = value;
+}
+
+}  // namespace
+
 std::shared_ptr<ov::Model> FrontEnd::create_copy(const std::shared_ptr<ov::Model>& ov_model,
                                                  const std::shared_ptr<void>& shared_object) {
     // Recreate ov::Model using main runtime, not FrontEnd's one
@@ -44,36 +70,81 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     FRONT_END_CHECK_IMPLEMENTED(m_actual, load_impl);
     auto model = std::make_shared<InputModel>();
     model->m_shared_object = m_shared_object;
+    const auto start = std::chrono::steady_clock::now();
     FRONTEND_CALL_STATEMENT("Loading input model", model->m_actual = m_actual->load_impl(variants))
+    if (profile_enabled()) {
+        m_load_time_ms = elapsed_ms(start);
+    }
     return model;
 }
 
 std::shared_ptr<ov::Model> FrontEnd::convert(const InputModel::Ptr& model) const {
     FRONT_END_CHECK_IMPLEMENTED(m_actual, convert);
+    if (profile_enabled()) {
+        const auto start = std::chrono::steady_clock::now();
+        std::shared_ptr<ov::Model> converted;
+        FRONTEND_CALL_STATEMENT("Converting input model", converted = m_actual->convert(model->m_actual))
+        auto copy = FrontEnd::create_copy(converted, m_shared_object);
+        record_statistic(copy, "frontend", get_name());
+        if (m_load_time_ms >= 0) {
+            record_statistic(copy, "load_time_ms", m_load_time_ms);
+        }
+        record_statistic(copy, "convert_time_ms", elapsed_ms(start));
+        return copy;
+    }
     FRONTEND_RETURN_STATEMENT("Converting input model",
                               FrontEnd::create_copy(m_actual->convert(model->m_actual), m_shared_object))
 }
 
 void FrontEnd::convert(const std::shared_ptr<Model>& model) const {
     FRONT_END_CHECK_IMPLEMENTED(m_actual, convert);
+    const auto start = std::chrono::steady_clock::now();
     FRONTEND_CALL_STATEMENT("Converting partially converted model", m_actual->convert(model))
+    if (profile_enabled()) {
+        record_statistic(model, "convert_remaining_time_ms", elapsed_ms(start));
+    }
 }
 
 std::shared_ptr<Model> FrontEnd::convert_partially(const InputModel::Ptr& model) const {
     FRONT_END_CHECK_IMPLEMENTED(m_actual, convert_partially);
+    if (profile_enabled()) {
+        const auto start = std::chrono::steady_clock::now();
+        std::shared_ptr<ov::Model> converted;
+        FRONTEND_CALL_STATEMENT("Partially convert model", converted = m_actual->convert_partially(model->m_actual))
+        auto copy = FrontEnd::create_copy(converted, m_shared_object);
+        record_statistic(copy, "frontend", get_name());
+        if (m_load_time_ms >= 0) {
+            record_statistic(copy, "load_time_ms", m_load_time_ms);
+        }
+        record_statistic(copy, "convert_time_ms", elapsed_ms(start));
+        return copy;
+    }
     FRONTEND_RETURN_STATEMENT("Partially convert model",
                               FrontEnd::create_copy(m_actual->convert_partially(model->m_actual), m_shared_object))
 }
 
 std::shared_ptr<Model> FrontEnd::decode(const InputModel::Ptr& model) const {
     FRONT_END_CHECK_IMPLEMENTED(m_actual, decode);
+    if (profile_enabled()) {
+        const auto start = std::chrono::steady_clock::now();
+        std::shared_ptr<ov::Model> decoded;
+        FRONTEND_CALL_STATEMENT("Decoding model", decoded = m_actual->decode(model->m_actual))
+        auto copy = FrontEnd::create_copy(decoded, m_shared_object);
+        record_statistic(copy, "frontend", get_name());
+        record_statistic(copy, "decode_time_ms", elapsed_ms(start));
+        return copy;
+    }
     FRONTEND_RETURN_STATEMENT("Decoding model",
                               FrontEnd::create_copy(m_actual->decode(model->m_actual), m_shared_object))
 }
 
 void FrontEnd::normalize(const std::shared_ptr<Model>& model) const {
     FRONT_END_CHECK_IMPLEMENTED(m_actual, normalize);
+    const auto start = std::chrono::steady_clock::now();
     FRONTEND_CALL_STATEMENT("Normalizing model", m_actual->normalize(model);)
+    if (profile_enabled()) {
+        record_statistic(model, "normalize_time_ms", elapsed_ms(start));
+    }
 }
 
 void FrontEnd::add_extension(const std::shared_ptr<ov::Extension>& extension) {
@@ -38,9 +38,19 @@ size_t get_ir_version(std::istream& model) {
 
     model.seekg(0, model.beg);
     model.read(header.data(), header.size());
+    const auto header_size = static_cast<size_t>(model.gcount());
     model.clear();
     model.seekg(0, model.beg);
 
+    // Binary IR documents carry the IR version in the fixed header
+    if (ov::is_binary_xml(header.data(), header_size)) {
+        try {
+            return ov::binary_xml_ir_version(header.data(), header_size);
+        } catch (...) {
+            return 0;
+        }
+    }
+
     pugi::xml_document doc;
     auto res =
         doc.load_buffer(header.data(), header.size(), pugi::parse_default | pugi::parse_fragment, pugi::encoding_utf8);
@@ -117,6 +127,7 @@ void FrontEnd::add_extension(const ov::Extension::Ptr& ext) {
 InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const {
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
+    std::shared_ptr<ov::AlignedBuffer> model_buffer;
     std::shared_ptr<ov::AlignedBuffer> weights;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
@@ -129,7 +140,9 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     };
 
     auto create_input_model = [&]() -> std::shared_ptr<InputModel> {
-        if (provided_model_stream) {
+        if (model_buffer) {
+            return std::make_shared<InputModel>(model_buffer, weights, create_extensions_map());
+        } else if (provided_model_stream) {
             return std::make_shared<InputModel>(*provided_model_stream, weights, create_extensions_map());
         } else if (local_model_stream.is_open()) {
             auto input_model = std::make_shared<InputModel>(local_model_stream, weights, create_extensions_map());
@@ -186,6 +199,18 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     }
     bool enable_mmap = variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>() : false;
 
+    // Map the xml instead of reading it through the stream: the buffer is parsed on the
+    // first convert() call, so loading costs only the mapping for models that are never
+    // compiled.
+    if (enable_mmap && !model_path.empty()) {
+        auto mapped_model = ov::load_mmap_object(model_path);
+        model_buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_model->data(),
+                                                                                         mapped_model->size(),
+                                                                                         mapped_model);
+        if (local_model_stream.is_open())
+            local_model_stream.close();
+    }
+
     // Find weights if only path to xml was provided
     if (weights_path.empty()) {
         auto pos = model_path.rfind('.');
@@ -4,6 +4,7 @@
 
 #include "input_model.hpp"
 
+#include <iterator>
 #include <pugixml.hpp>
 
 #include "ir_deserializer.hpp"
@@ -205,23 +206,54 @@ class InputModel::InputModelIRImpl {
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
-
-public:
-    InputModelIRImpl(std::istream& stream,
-                     const std::shared_ptr<ov::AlignedBuffer>& weights,
-                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
-        : m_weights(weights),
-          m_extensions(extensions) {
-        pugi::xml_parse_result res = m_xml_doc.load(stream);
-        if (res.status != pugi::status_ok) {
-            OPENVINO_THROW(res.description(), " at offset ", res.offset);
+    // Raw xml, either shared (memory mapped file) or buffered from the input stream;
+    // the DOM and the opset maps are built on the first convert() call so that models
+    // which are loaded but never converted do not pay for parsing.
+    std::shared_ptr<ov::AlignedBuffer> m_model_buffer;
+    std::string m_model_text;
+    bool m_parsed = false;
+
+    void ensure_parsed() {
+        if (m_parsed)
+            return;
+        const char* data = m_model_buffer ? m_model_buffer->get_ptr<char>() : m_model_text.data();
+        const size_t data_size = m_model_buffer ? m_model_buffer->size() : m_model_text.size();
+        if (ov::is_binary_xml(data, data_size)) {
+            ov::load_binary_xml(m_xml_doc, data, data_size);
+        } else {
+            pugi::xml_parse_result res;
+            if (m_model_buffer) {
+                // The mapping may be read-only, parse without modifying the buffer
+                res = m_xml_doc.load_buffer(data, data_size);
+            } else {
+                res = m_xml_doc.load_buffer_inplace(&m_model_text[0], m_model_text.size());
+            }
+            if (res.status != pugi::status_ok) {
+                OPENVINO_THROW(res.description(), " at offset ", res.offset);
+            }
         }
         m_root = m_xml_doc.document_element();
         for (const auto& it : ov::get_available_opsets()) {
             m_opsets[it.first] = it.second();
         }
+        m_parsed = true;
     }
 
+public:
+    InputModelIRImpl(std::istream& stream,
+                     const std::shared_ptr<ov::AlignedBuffer>& weights,
+                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+        : m_weights(weights),
+          m_extensions(extensions),
+          m_model_text((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>()) {}
+
+    InputModelIRImpl(const std::shared_ptr<ov::AlignedBuffer>& model,
+                     const std::shared_ptr<ov::AlignedBuffer>& weights,
+                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+        : m_weights(weights),
+          m_extensions(extensions),
+          m_model_buffer(model) {}
+
     std::shared_ptr<ov::Model> convert();
 };
 
@@ -231,11 +263,19 @@ InputModel::InputModel(std::istream& stream,
     _impl = std::make_shared<InputModelIRImpl>(stream, weights, extensions);
 }
 
+InputModel::InputModel(const std::shared_ptr<ov::AlignedBuffer>& model,
+                       const std::shared_ptr<ov::AlignedBuffer>& weights,
+                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions) {
+    _impl = std::make_shared<InputModelIRImpl>(model, weights, extensions);
+}
+
 std::shared_ptr<ov::Model> InputModel::convert() {
     return _impl->convert();
 }
 
 std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
+    ensure_parsed();
+
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
 
     // Load default opsets
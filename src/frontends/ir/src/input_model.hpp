@@ -24,6 +24,12 @@ public:
                const std::shared_ptr<ov::AlignedBuffer>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
 
+    /// \brief Shares an already loaded (e.g. memory mapped) IR xml buffer. The buffer is
+    /// not parsed until convert() is called, so unused models cost no DOM construction.
+    InputModel(const std::shared_ptr<ov::AlignedBuffer>& model,
+               const std::shared_ptr<ov::AlignedBuffer>& weights,
+               const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
+
     std::shared_ptr<Model> convert();
 };
 
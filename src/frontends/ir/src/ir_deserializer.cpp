@@ -9,6 +9,7 @@
 
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/loop.hpp"
@@ -461,10 +462,21 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
-    // Read all layers and store their parameters in params map
+    // Parse layer headers (ports, dims, precisions, tensor names) in parallel: the DOM is
+    // immutable at this point and parse_generic_params touches no deserializer state.
+    std::vector<pugi::xml_node> layer_nodes;
     FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
-        params[node_param.layerId] = {node, node_param};
+        layer_nodes.push_back(node);
+    }
+    std::vector<GenericLayerParams> layer_params(layer_nodes.size());
+    ov::parallel_for(layer_nodes.size(), [&](size_t i) {
+        layer_params[i] = parse_generic_params(layer_nodes[i]);
+    });
+
+    // Store their parameters in params map
+    for (size_t i = 0; i < layer_nodes.size(); ++i) {
+        const auto& node_param = layer_params[i];
+        params[node_param.layerId] = {layer_nodes[i], node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
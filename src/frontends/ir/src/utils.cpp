@@ -4,11 +4,119 @@
 
 #include "utils.hpp"
 
+#include <cstring>
+
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/util/common_util.hpp"
 
+namespace {
+
+// Must match the writer in src/core/src/pass/serialize.cpp
+const char binary_xml_magic[4] = {'O', 'V', 'B', 'X'};
+constexpr uint32_t binary_xml_format_version = 1;
+
+class BinaryXmlReader {
+public:
+    BinaryXmlReader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    uint8_t read_u8() {
+        require(sizeof(uint8_t));
+        return static_cast<uint8_t>(m_data[m_pos++]);
+    }
+
+    uint32_t read_u32() {
+        require(sizeof(uint32_t));
+        uint32_t value;
+        std::memcpy(&value, m_data + m_pos, sizeof(value));
+        m_pos += sizeof(value);
+        return value;
+    }
+
+    std::string read_string() {
+        const auto size = read_u32();
+        require(size);
+        std::string value(m_data + m_pos, size);
+        m_pos += size;
+        return value;
+    }
+
+    void skip(size_t bytes) {
+        require(bytes);
+        m_pos += bytes;
+    }
+
+private:
+    void require(size_t bytes) {
+        if (m_size - m_pos < bytes)
+            OPENVINO_THROW("Binary IR document is truncated");
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+void decode_node(BinaryXmlReader& reader, const std::vector<std::string>& strings, pugi::xml_node parent) {
+    auto string_at = [&](uint32_t index) -> const std::string& {
+        if (index >= strings.size())
+            OPENVINO_THROW("Binary IR document refers to a string out of the string table");
+        return strings[index];
+    };
+
+    const auto kind = reader.read_u8();
+    if (kind == 1) {
+        parent.append_child(pugi::node_pcdata).set_value(string_at(reader.read_u32()).c_str());
+        return;
+    }
+    if (kind != 0)
+        OPENVINO_THROW("Binary IR document contains an unknown node kind: ", static_cast<int>(kind));
+
+    auto element = parent.append_child(string_at(reader.read_u32()).c_str());
+    const auto attribute_count = reader.read_u32();
+    for (uint32_t i = 0; i < attribute_count; ++i) {
+        const auto& name = string_at(reader.read_u32());
+        const auto& value = string_at(reader.read_u32());
+        element.append_attribute(name.c_str()).set_value(value.c_str());
+    }
+    const auto child_count = reader.read_u32();
+    for (uint32_t i = 0; i < child_count; ++i)
+        decode_node(reader, strings, element);
+}
+
+}  // namespace
+
 namespace ov {
 
+bool is_binary_xml(const char* data, size_t size) {
+    return size >= sizeof(binary_xml_magic) && std::memcmp(data, binary_xml_magic, sizeof(binary_xml_magic)) == 0;
+}
+
+uint32_t binary_xml_ir_version(const char* data, size_t size) {
+    if (!is_binary_xml(data, size))
+        OPENVINO_THROW("Not a binary IR document");
+    BinaryXmlReader reader(data, size);
+    reader.skip(sizeof(binary_xml_magic));
+    const auto format_version = reader.read_u32();
+    if (format_version != binary_xml_format_version)
+        OPENVINO_THROW("Unsupported binary IR format version: ", format_version);
+    return reader.read_u32();
+}
+
+void load_binary_xml(pugi::xml_document& doc, const char* data, size_t size) {
+    // Validates the magic and the format version
+    binary_xml_ir_version(data, size);
+
+    BinaryXmlReader reader(data, size);
+    reader.skip(sizeof(binary_xml_magic) + 2 * sizeof(uint32_t));
+    const auto string_count = reader.read_u32();
+    std::vector<std::string> strings;
+    strings.reserve(string_count);
+    for (uint32_t i = 0; i < string_count; ++i)
+        strings.push_back(reader.read_string());
+
+    decode_node(reader, strings, doc);
+}
+
 void operator>>(const std::stringstream& in, ov::element::Type& type) {
     type = ov::element::Type(ov::util::trim(in.str()));
 }
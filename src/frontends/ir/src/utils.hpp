@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <pugixml.hpp>
 
@@ -19,6 +20,12 @@ bool get_partial_shape_from_attribute(const pugi::xml_node& node, const std::str
 
 void str_to_container(const std::string& value, std::vector<std::string>& res);
 
+// Binary IR document support (".bir" files written by ov::pass::Serialize; the format is
+// documented next to the writer in src/core/src/pass/serialize.cpp)
+bool is_binary_xml(const char* data, size_t size);
+uint32_t binary_xml_ir_version(const char* data, size_t size);
+void load_binary_xml(pugi::xml_document& doc, const char* data, size_t size);
+
 template <class T>
 void str_to_container(const std::string& value, T& res) {
     std::stringstream ss(value);
@@ -6,6 +6,7 @@
 
 #include <exception>
 #include <functional>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 
@@ -17,6 +18,7 @@
 #include "onnx_framework_node.hpp"
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/onnx/extension/conversion.hpp"
 #include "openvino/frontend/onnx/node_context.hpp"
@@ -41,8 +43,8 @@ bool common_node_for_all_outputs(const ov::OutputVector& outputs) {
     return ret;
 };
 
-OperatorsBridge register_extensions(OperatorsBridge& bridge,
-                                    const std::vector<ov::frontend::ConversionExtensionBase::Ptr>& conversions) {
+void register_extensions(OperatorsBridge& bridge,
+                         const std::vector<ov::frontend::ConversionExtensionBase::Ptr>& conversions) {
     for (const auto& extension : conversions) {
         if (const auto common_conv_ext = std::dynamic_pointer_cast<ov::frontend::ConversionExtension>(extension)) {
             bridge.overwrite_operator(
@@ -60,12 +62,20 @@ OperatorsBridge register_extensions(OperatorsBridge& bridge,
                                       });
         }
     }
-    return bridge;
 }
 
-OperatorsBridge init_ops_bridge(const std::vector<ov::frontend::ConversionExtensionBase::Ptr>& conversions) {
-    OperatorsBridge bridge;
-    return register_extensions(bridge, conversions);
+std::shared_ptr<const OperatorsBridge> init_ops_bridge(
+    const std::vector<ov::frontend::ConversionExtensionBase::Ptr>& conversions) {
+    // Registering the default operator set is not cheap and its result is identical for every
+    // imported model, so all graphs (and subgraphs) in the process share a single instance.
+    // Models with conversion extensions get a private copy with the extensions applied on top
+    static const auto default_bridge = std::make_shared<const OperatorsBridge>();
+    if (conversions.empty()) {
+        return default_bridge;
+    }
+    auto bridge = std::make_shared<OperatorsBridge>(*default_bridge);
+    register_extensions(*bridge, conversions);
+    return bridge;
 }
 
 Model::ModelOpSet build_model_opset(const ModelProto& model_proto, const OperatorsBridge& ops_bridge) {
@@ -127,31 +137,54 @@ Graph::Graph(const std::string& model_dir,
       m_model_dir{model_dir},
       m_mmap_cache{mmap_cache},
       m_ops_bridge{detail::init_ops_bridge(m_extensions.conversions)} {
-    m_model = common::make_unique<Model>(model_proto, detail::build_model_opset(*model_proto, m_ops_bridge));
+    m_model = common::make_unique<Model>(model_proto, detail::build_model_opset(*model_proto, *m_ops_bridge));
 
     transform::expand_onnx_functions(*model_proto);
 
     std::map<std::string, Tensor> initializers;
 
-    // Process all initializers in the graph
-    for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
-        if (initializer_tensor.has_name()) {
+    // Process all initializers in the graph. Creating the Constant nodes (protobuf data decoding
+    // and external data reads) is independent per initializer and dominates the import time of
+    // large models, so it runs in parallel; the cache hookup below stays serial
+    const auto& initializer_list = m_model->get_graph().initializer();
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> ov_constants(initializer_list.size());
+    std::exception_ptr initializer_error;
+    std::mutex initializer_error_mutex;
+    ov::parallel_for(initializer_list.size(), [&](size_t i) {
+        const auto& initializer_tensor = initializer_list[static_cast<int>(i)];
+        if (!initializer_tensor.has_name()) {
+            return;
+        }
+        try {
             Tensor tensor = Tensor{initializer_tensor, m_model_dir, m_mmap_cache};
-            std::shared_ptr<ov::op::v0::Constant> ov_constant;
-            // For each initializer create a Constant node and store it in cache
             try {
-                ov_constant = tensor.get_ov_constant();
+                ov_constants[i] = tensor.get_ov_constant();
             } catch (const error::invalid_external_data&) {
                 // invalid external data makes initializers creation impossible
                 throw;
             } catch (const ov::Exception&) {
-                ov_constant = ov::frontend::onnx::common::make_failsafe_constant(tensor.get_ov_type());
+                ov_constants[i] = ov::frontend::onnx::common::make_failsafe_constant(tensor.get_ov_type());
             }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(initializer_error_mutex);
+            if (!initializer_error) {
+                initializer_error = std::current_exception();
+            }
+        }
+    });
+    if (initializer_error) {
+        std::rethrow_exception(initializer_error);
+    }
 
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ov_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ov_constant));
+    // Serial hookup phase: name the outputs and populate the cache in graph order
+    for (int i = 0; i < initializer_list.size(); ++i) {
+        const auto& initializer_tensor = initializer_list[i];
+        if (!initializer_tensor.has_name()) {
+            continue;
         }
+        initializers.emplace(initializer_tensor.name(), Tensor{initializer_tensor, m_model_dir, m_mmap_cache});
+        ov_constants[i]->get_output_tensor(0).set_names({initializer_tensor.name()});
+        m_cache->emplace_node(initializer_tensor.name(), std::move(ov_constants[i]));
     }
 
     // Process all ONNX graph inputs, convert them to OV nodes and store in cache
@@ -183,7 +216,7 @@ void Graph::convert_to_ov_nodes() {
         const Node node{node_proto, this};
         if (!m_model->is_operator_available(node.op_type(), node.domain())) {
             // If a node from an unregistered domain is detected, try registering that domain
-            m_model->enable_opset_domain(node.domain(), m_ops_bridge);
+            m_model->enable_opset_domain(node.domain(), *m_ops_bridge);
         }
         if (node.has_subgraphs()) {
             const auto& subgraphs = node.get_subgraphs();
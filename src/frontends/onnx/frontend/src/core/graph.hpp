@@ -89,7 +89,8 @@ private:
 
     std::string m_model_dir;
     detail::MappedMemoryHandles m_mmap_cache;
-    OperatorsBridge m_ops_bridge;
+    // Shared process-wide unless conversion extensions require a private copy
+    std::shared_ptr<const OperatorsBridge> m_ops_bridge;
 };
 
 /// \brief      Representation of ONNX subgraph. It is used for example by ONNX Loop op.
@@ -218,21 +218,7 @@ private:
         std::shared_ptr<ov::op::v0::Constant> constant{nullptr};
         size_t data_size = get_data_size();
         if (has_external_data()) {
-            const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
-            if (m_mmap_cache) {
-                constant =
-                    std::make_shared<ov::op::v0::Constant>(type,
-                                                           m_shape,
-                                                           ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache));
-            } else {
-                constant =
-                    std::make_shared<ov::op::v0::Constant>(type, m_shape, ext_data.load_external_data(m_model_dir));
-            }
-            if (constant->get_byte_size() != ov::shape_size(m_shape) * type.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
+            constant = make_ov_constant_from_external_data(type);
         } else if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ov::op::v0::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
@@ -254,6 +240,15 @@ private:
                                       bool>::type = true>
     std::shared_ptr<ov::op::v0::Constant> make_ov_constant(const ov::element::Type& type) const {
         std::shared_ptr<ov::op::v0::Constant> constant{nullptr};
+        if (has_external_data()) {
+            // external data is stored in the same layout as raw_data, so it can be wrapped as is
+            // without the per-element conversion the in-proto fields of these types require
+            constant = make_ov_constant_from_external_data(type);
+            if (m_tensor_proto->has_name()) {
+                constant->set_friendly_name(get_name());
+            }
+            return constant;
+        }
         auto data = get_data<T>();
         auto data_size = data.size();
         if (data_size == shape_size(m_shape)) {
@@ -269,6 +264,27 @@ private:
         return constant;
     }
 
+    // Wraps the external data buffer into a Constant without copying: with mmap enabled the
+    // Constant becomes a view over the mapped file and the weights are paged in on first use
+    std::shared_ptr<ov::op::v0::Constant> make_ov_constant_from_external_data(const ov::element::Type& type) const {
+        std::shared_ptr<ov::op::v0::Constant> constant{nullptr};
+        const auto ext_data = detail::TensorExternalData(*m_tensor_proto);
+        if (m_mmap_cache) {
+            constant =
+                std::make_shared<ov::op::v0::Constant>(type,
+                                                       m_shape,
+                                                       ext_data.load_external_mmap_data(m_model_dir, m_mmap_cache));
+        } else {
+            constant = std::make_shared<ov::op::v0::Constant>(type, m_shape, ext_data.load_external_data(m_model_dir));
+        }
+        if (constant->get_byte_size() != ov::shape_size(m_shape) * type.size()) {
+            throw error::invalid_external_data(
+                "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                "' in the model");
+        }
+        return constant;
+    }
+
     bool has_external_data() const {
         return m_tensor_proto->has_data_location() &&
                m_tensor_proto->data_location() == TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
@@ -5,6 +5,7 @@
 #include "utils/tensor_external_data.hpp"
 
 #include <fstream>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -15,6 +16,10 @@ namespace ov {
 namespace frontend {
 namespace onnx {
 namespace detail {
+namespace {
+// Guards the mapped memory cache: initializers may be loaded from worker threads
+std::mutex mmap_cache_mutex;
+}  // namespace
 TensorExternalData::TensorExternalData(const TensorProto& tensor) {
     for (const auto& entry : tensor.external_data()) {
         if (entry.key() == "location") {
@@ -39,13 +44,16 @@ Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::
     if (file_size <= 0 || m_offset + m_data_length > static_cast<uint64_t>(file_size)) {
         throw error::invalid_external_data{*this};
     }
-    auto cached_mapped_memory = cache->find(full_path);
     std::shared_ptr<ov::MappedMemory> mapped_memory;
-    if (cached_mapped_memory != cache->end()) {
-        mapped_memory = cached_mapped_memory->second;
-    } else {
-        mapped_memory = ov::load_mmap_object(full_path);
-        (*cache)[full_path] = mapped_memory;
+    {
+        std::lock_guard<std::mutex> lock(mmap_cache_mutex);
+        auto cached_mapped_memory = cache->find(full_path);
+        if (cached_mapped_memory != cache->end()) {
+            mapped_memory = cached_mapped_memory->second;
+        } else {
+            mapped_memory = ov::load_mmap_object(full_path);
+            (*cache)[full_path] = mapped_memory;
+        }
     }
     if (m_data_length > mapped_memory->size() || mapped_memory->size() == 0) {
         throw error::invalid_external_data{*this};
@@ -13,8 +13,10 @@
 #include "decoder_proto.hpp"
 #include "framework.pb.h"
 #include "input_model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
 #include "paddle_utils.hpp"
@@ -277,6 +279,9 @@ std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::determine_cut_
 // load_consts with folder is compatible with old PaddlePaddle API.
 template <typename T>
 void InputModel::InputModelImpl::load_consts(const std::basic_string<T>& folder_with_weights) {
+    // Collect the persistable variables first: each one lives in its own file, so they can be
+    // read concurrently below
+    std::vector<std::pair<std::string, const ::paddle::framework::proto::VarDesc*>> const_vars;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
@@ -286,14 +291,24 @@ void InputModel::InputModelImpl::load_consts(const std::basic_string<T>& folder_
             continue;
 
         FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
-        const auto& tensor = var_desc.type().lod_tensor().tensor();
-        Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
-        const auto& type = get_ov_type(tensor.data_type());
-        const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
+        const_vars.emplace_back(name, &var_desc);
+    }
+    if (const_vars.empty())
+        return;
+    FRONT_END_GENERAL_CHECK(!folder_with_weights.empty(), "Folder with weights must be provided.");
+
+    // Weight files are independent, so they are read in parallel; worker exceptions are stored
+    // aside and rethrown from the calling thread
+    std::vector<std::shared_ptr<opset7::Constant>> const_nodes(const_vars.size());
+    std::vector<std::exception_ptr> errors(const_vars.size());
+    ov::parallel_for(const_vars.size(), [&](size_t i) {
+        try {
+            const auto& name = const_vars[i].first;
+            const auto& tensor = const_vars[i].second->type().lod_tensor().tensor();
+            Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
+            const auto& type = get_ov_type(tensor.data_type());
+            const auto& data_length = shape_size(shape) * type.size();
 
-        bool read_succeed = false;
-        if (!folder_with_weights.empty()) {
 #if defined(__MINGW32__) || defined(__MINGW64__)
             std::ifstream is(std::filesystem::path(get_const_path(folder_with_weights, name)),
                              std::ios::in | std::ifstream::binary);
@@ -309,17 +324,27 @@ void InputModel::InputModelImpl::load_consts(const std::basic_string<T>& folder_
             is.read(reinterpret_cast<char*>(&dims_len), 4);
             std::vector<char> dims_struct(dims_len);
             is.read(&dims_struct[0], dims_len);
-            read_succeed = read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else {
-            FRONT_END_GENERAL_CHECK(false, "Folder with weights must be provided.");
+            // Read the weight directly into the Constant's buffer, without an intermediate copy
+            auto tensor_data = std::make_shared<ov::AlignedBuffer>(data_length);
+            bool read_succeed = read_tensor(is, tensor_data->get_ptr<char>(), data_length);
+            FRONT_END_GENERAL_CHECK(read_succeed,
+                                    "File containing constant with name ",
+                                    name,
+                                    " wasn't successfully read.");
+            auto const_node = std::make_shared<opset7::Constant>(type, shape, tensor_data);
+            const_node->set_friendly_name(name);
+            const_nodes[i] = const_node;
+        } catch (...) {
+            errors[i] = std::current_exception();
         }
-        FRONT_END_GENERAL_CHECK(read_succeed,
-                                "File containing constant with name ",
-                                name,
-                                " wasn't successfully read.");
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
-        const_node->set_friendly_name(name);
-        m_tensor_values[name] = const_node;
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    for (size_t i = 0; i < const_vars.size(); ++i) {
+        m_tensor_values[const_vars[i].first] = const_nodes[i];
     }
 }
 
@@ -367,15 +392,16 @@ void InputModel::InputModelImpl::load_consts(std::istream* weight_stream) {
         Shape shape(tensor_desc->dims().cbegin(), tensor_desc->dims().cend());
         const auto& type = get_ov_type(tensor_desc->data_type());
         const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
+        // Read the weight directly into the Constant's buffer, without an intermediate copy
+        auto tensor_data = std::make_shared<ov::AlignedBuffer>(data_length);
 
-        bool read_succeed = read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length);
+        bool read_succeed = read_tensor(*weight_stream, tensor_data->get_ptr<char>(), data_length);
         FRONT_END_GENERAL_CHECK(read_succeed,
                                 "File containing constant with name ",
                                 name,
                                 " wasn't successfully read.");
 
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
+        auto const_node = std::make_shared<opset7::Constant>(type, shape, tensor_data);
         const_node->set_friendly_name(name);
         m_tensor_values[name] = const_node;
     }
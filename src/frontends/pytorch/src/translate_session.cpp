@@ -148,8 +148,10 @@ std::shared_ptr<Model> TranslateSession::convert_pytorch_model(
                 }
             }
             auto context = NodeContext(node, external_tensor_map, tensor_map, parameters, mutated_tensors, this);
-            // Add op type in the statistics
-            m_op_statistics[context.get_op_type()]++;
+            if (m_telemetry) {
+                // Add op type in the statistics
+                m_op_statistics[context.get_op_type()]++;
+            }
             auto converted_outputs = convert_node(context);
 
             const auto& fw_outputs = node->outputs();
@@ -285,9 +287,18 @@ std::shared_ptr<Model> TranslateSession::convert_pytorch_model(
 OutputVector TranslateSession::convert_node(const NodeContext& context) {
     std::string exception;
     try {
-        auto it = m_translator_map.find(context.get_op_type());
-        if (it != m_translator_map.end()) {
-            return it->second(context);
+        const CreatorFunction* translator;
+        auto cached = m_translator_cache.find(context.get_op_type());
+        if (cached != m_translator_cache.end()) {
+            translator = cached->second;
+        } else {
+            auto it = m_translator_map.find(context.get_op_type());
+            // Pointers into m_translator_map stay valid: the map outlives the session and is not modified
+            translator = it != m_translator_map.end() ? &it->second : nullptr;
+            m_translator_cache[context.get_op_type()] = translator;
+        }
+        if (translator) {
+            return (*translator)(context);
         }
         OPENVINO_DEBUG << "No translator found for: " << context.get_op_type() << "\n";
     } catch (std::exception& e) {
@@ -408,7 +419,7 @@ using ReversepropCreatorFunction = std::function<ov::Output<ov::Node>(const Outp
 Output<Node> TranslateSession::get_reverseprop_op(const std::shared_ptr<TorchDecoder>& node,
                                                   const Output<Node>& direct_op_output,
                                                   const Output<Node>& value) {
-    std::map<std::string, ReversepropCreatorFunction> backprop_map = {
+    static const std::map<std::string, ReversepropCreatorFunction> backprop_map = {
         {"aten::slice", slice_reverseprop},
         {"aten::select", select_reverseprop},
     };
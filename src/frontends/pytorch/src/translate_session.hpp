@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "input_model.hpp"
 #include "openvino/frontend/extension/telemetry.hpp"
 #include "openvino/frontend/pytorch/node_context.hpp"
@@ -61,6 +63,8 @@ private:
 
     std::map<size_t, std::pair<size_t, Output<Node>>> m_counter_map;
     std::map<std::string, uint64_t> m_op_statistics;
+    // Memoized lookups into m_translator_map: big models repeat the same few op kinds many times
+    std::unordered_map<std::string, const CreatorFunction*> m_translator_cache;
 };
 
 }  // namespace pytorch
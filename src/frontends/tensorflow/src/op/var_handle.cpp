@@ -9,6 +9,7 @@
 #include "openvino/frontend/tensorflow/variable.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/reshape.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "ov_tensorflow/tensor_bundle.pb.h"
@@ -52,14 +53,15 @@ static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> v
                                                                               entry.size(),
                                                                               mapped_memory));
     } else {
-        std::vector<T> var_data;
-        var_data.resize(size);
         auto fs = var_index->get_data_file(entry.shard_id());
         if (!fs.get()) {
             TENSORFLOW_OP_VALIDATION(node, var_index, "[TensorFlow Frontend] Internal error: Cannot get shard file.");
         }
+        // Read the variable from the shard directly into the Constant's buffer,
+        // without materializing an intermediate std::vector copy of the data
+        auto var_data = std::make_shared<ov::AlignedBuffer>(entry.size());
         fs->seekg(entry.offset(), std::ios::beg);
-        fs->read(reinterpret_cast<char*>(var_data.data()), entry.size());
+        fs->read(var_data->get_ptr<char>(), entry.size());
         return std::make_shared<v0::Constant>(ov_type, shape, var_data);
     }
 }
@@ -9,6 +9,7 @@
 
 #include "checkpoint_utils.hpp"
 #include "graph_iterator_saved_model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/util/mmap_object.hpp"
@@ -191,21 +192,39 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string&
     read_bundle_header();
 
     std::vector<char> suffix(20);
+    std::vector<std::string> shard_paths(m_total_shards);
+    std::vector<VariableStorage*> shard_storages(m_total_shards);
     for (int32_t shard = 0; shard < m_total_shards; ++shard) {
         std::snprintf(suffix.data(), suffix.size(), "data-%05d-of-%05d", shard, m_total_shards);
-        std::string fullPath;
         if (is_saved_model) {
-            fullPath = ov::util::path_join({path, "variables", std::string("variables.") + suffix.data()});
+            shard_paths[shard] = ov::util::path_join({path, "variables", std::string("variables.") + suffix.data()});
         } else {
-            fullPath = path + "." + suffix.data();
+            shard_paths[shard] = path + "." + suffix.data();
         }
-        if (m_mmap_enabled) {
-            m_data_files[shard].mmap = load_mmap_object(fullPath);
-            FRONT_END_GENERAL_CHECK(m_data_files[shard].mmap->data(), "Variable index data cannot be mapped");
-        } else {
-            m_data_files[shard].stream = std::shared_ptr<std::ifstream>(
-                new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-            FRONT_END_GENERAL_CHECK(m_data_files[shard].stream->is_open(), "Variable index data file does not exist");
+        shard_storages[shard] = &m_data_files[shard];
+    }
+
+    // Shards are independent files, so they are mapped (or opened) in parallel.
+    // Exceptions are stored aside to be rethrown from the calling thread
+    std::vector<std::exception_ptr> shard_errors(m_total_shards);
+    ov::parallel_for(m_total_shards, [&](int32_t shard) {
+        try {
+            if (m_mmap_enabled) {
+                shard_storages[shard]->mmap = load_mmap_object(shard_paths[shard]);
+                FRONT_END_GENERAL_CHECK(shard_storages[shard]->mmap->data(), "Variable index data cannot be mapped");
+            } else {
+                shard_storages[shard]->stream = std::shared_ptr<std::ifstream>(
+                    new std::ifstream(shard_paths[shard].c_str(), std::ifstream::in | std::ifstream::binary));
+                FRONT_END_GENERAL_CHECK(shard_storages[shard]->stream->is_open(),
+                                        "Variable index data file does not exist");
+            }
+        } catch (...) {
+            shard_errors[shard] = std::current_exception();
+        }
+    });
+    for (const auto& error : shard_errors) {
+        if (error) {
+            std::rethrow_exception(error);
         }
     }
 
@@ -220,21 +239,40 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::wstring
     read_bundle_header();
 
     std::vector<wchar_t> suffix(20);
+    std::vector<std::wstring> shard_paths(m_total_shards);
+    std::vector<VariableStorage*> shard_storages(m_total_shards);
     for (int32_t shard = 0; shard < m_total_shards; ++shard) {
         swprintf_s(suffix.data(), suffix.size(), L"data-%05d-of-%05d", shard, m_total_shards);
-        std::wstring fullPath;
         if (is_saved_model) {
-            fullPath = ov::util::path_join_w({path, L"variables", std::wstring(L"variables.") + suffix.data()});
+            shard_paths[shard] =
+                ov::util::path_join_w({path, L"variables", std::wstring(L"variables.") + suffix.data()});
         } else {
-            fullPath = path + L"." + suffix.data();
+            shard_paths[shard] = path + L"." + suffix.data();
         }
-        if (m_mmap_enabled) {
-            m_data_files[shard].mmap = load_mmap_object(fullPath);
-            FRONT_END_GENERAL_CHECK(m_data_files[shard].mmap->data(), "Variable index data cannot be mapped");
-        } else {
-            m_data_files[shard].stream = std::shared_ptr<std::ifstream>(
-                new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-            FRONT_END_GENERAL_CHECK(m_data_files[shard].stream->is_open(), "Variable index data file does not exist");
+        shard_storages[shard] = &m_data_files[shard];
+    }
+
+    // Shards are independent files, so they are mapped (or opened) in parallel.
+    // Exceptions are stored aside to be rethrown from the calling thread
+    std::vector<std::exception_ptr> shard_errors(m_total_shards);
+    ov::parallel_for(m_total_shards, [&](int32_t shard) {
+        try {
+            if (m_mmap_enabled) {
+                shard_storages[shard]->mmap = load_mmap_object(shard_paths[shard]);
+                FRONT_END_GENERAL_CHECK(shard_storages[shard]->mmap->data(), "Variable index data cannot be mapped");
+            } else {
+                shard_storages[shard]->stream = std::shared_ptr<std::ifstream>(
+                    new std::ifstream(shard_paths[shard].c_str(), std::ifstream::in | std::ifstream::binary));
+                FRONT_END_GENERAL_CHECK(shard_storages[shard]->stream->is_open(),
+                                        "Variable index data file does not exist");
+            }
+        } catch (...) {
+            shard_errors[shard] = std::current_exception();
+        }
+    });
+    for (const auto& error : shard_errors) {
+        if (error) {
+            std::rethrow_exception(error);
         }
     }
 
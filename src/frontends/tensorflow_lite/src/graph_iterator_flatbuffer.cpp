@@ -18,13 +18,12 @@ GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path)
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
 GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path) {
-    std::ifstream model_file(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
+    // Flatbuffers are a zero-copy format: map the file instead of reading it into an owned
+    // buffer, so constant data can be adopted as views into the mapping
+    m_data = ov::load_mmap_object(path);
+    FRONT_END_GENERAL_CHECK(m_data && m_data->data(), "Model file cannot be mapped: ", path);
 
-    m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
-    model_file.close();
-
-    m_model = tflite::GetModel(m_data.data());
+    m_model = tflite::GetModel(m_data->data());
     auto sub_graphs = m_model->subgraphs();
     m_subgraphs = {sub_graphs->begin(), sub_graphs->end()};
     m_graph = m_subgraphs[0];
@@ -46,6 +45,7 @@ std::shared_ptr<GraphIteratorFlatBuffer> GraphIteratorFlatBuffer::get_subgraph(c
     FRONT_END_GENERAL_CHECK(m_subgraphs.size() > idx, "There is no subgraph with idx ", idx);
     auto iterator = std::make_shared<GraphIteratorFlatBuffer>();
     iterator->node_index = 0;
+    iterator->m_data = m_data;
     iterator->m_model = m_model;
     iterator->m_subgraphs = {};  // TODO: check if we need to pass all sub-graphs here (while in a while situation)
     iterator->m_graph = m_subgraphs[idx];
@@ -13,6 +13,7 @@
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -36,7 +37,7 @@ std::basic_string<wchar_t> get_model_extension<wchar_t>();
 
 class GraphIteratorFlatBuffer {
     size_t node_index = 0;
-    std::vector<uint8_t> m_data;
+    std::shared_ptr<ov::MappedMemory> m_data;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -107,6 +108,12 @@ public:
     /// Return Decoder for the current node that iterator points to
     std::shared_ptr<ov::frontend::tensorflow_lite::DecoderFlatBuffer> get_decoder() const;
 
+    /// \brief Returns the memory the flatbuffer model is mapped into; constant data views share
+    /// ownership of it so weights are not duplicated at import
+    std::shared_ptr<ov::MappedMemory> get_model_memory() const {
+        return m_data;
+    }
+
     /// \brief Returns the number of sub-graphs that can be enumerated with get_subgraph
     size_t get_subgraph_size() const;
 
@@ -7,8 +7,10 @@
 #include <iterator>
 #include <queue>
 
+#include "openvino/core/type/element_iterator.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/log.hpp"
 #include "tensor_lite_place.hpp"
 #include "utils.hpp"
@@ -19,6 +21,30 @@ namespace ov {
 namespace frontend {
 namespace tensorflow_lite {
 
+namespace {
+// Adopts constant data as a view into the mapped flatbuffer model when the pointer belongs to the
+// mapping (sparse tensors are densified into a separate buffer and still have to be copied);
+// the Constant shares ownership of the mapping, so weights are not duplicated at import
+std::shared_ptr<ov::op::v0::Constant> create_constant(const ov::element::Type& type,
+                                                      const ov::Shape& shape,
+                                                      const void* data,
+                                                      const std::shared_ptr<ov::MappedMemory>& model_memory) {
+    if (model_memory) {
+        const auto* mapping_begin = model_memory->data();
+        const auto* data_ptr = static_cast<const char*>(data);
+        if (data_ptr >= mapping_begin && data_ptr < mapping_begin + model_memory->size()) {
+            const auto byte_size = ov::element::get_byte_size(type, ov::shape_size(shape));
+            auto buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+                const_cast<char*>(data_ptr),
+                byte_size,
+                model_memory);
+            return std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
+        }
+    }
+    return ov::op::v0::Constant::create(type, shape, data);
+}
+}  // namespace
+
 class InputModel::InputModelTFLiteImpl {
 public:
     InputModelTFLiteImpl(const GraphIteratorFlatBuffer::Ptr& graph_iterator,
@@ -110,9 +136,10 @@ void InputModel::InputModelTFLiteImpl::load_model() {
             if (m_tensor_places.count(name) == 0) {
                 m_tensor_places[name] = place;
                 if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant = create_constant(place->get_element_type(),
+                                                    place->get_partial_shape().to_shape(),
+                                                    data,
+                                                    m_graph_iterator->get_model_memory());
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <future>
 #include <memory>
 
@@ -220,6 +222,16 @@ private:
                          const Pipeline::iterator itEndStage,
                          const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor = {});
 
+    /**
+     * @brief Checks whether the pipeline may run inline on the calling thread, see start_async_thread_unsafe()
+     */
+    bool should_run_inline() const;
+
+    /**
+     * @brief Runs the synchronous request and updates the average inference duration
+     */
+    void run_timed_infer();
+
     ov::threading::Task make_next_stage_task(const Pipeline::iterator itStage,
                                              const Pipeline::iterator itEndStage,
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor);
@@ -277,6 +289,7 @@ private:
         m_sync_callback_executor;  //!< Used to run post inference callback in synchronous pipline
     mutable std::mutex m_mutex;
     std::function<void(std::exception_ptr)> m_callback;
+    std::atomic<int64_t> m_mean_infer_us{-1};  //!< Average duration of the synchronous stage, -1 until measured
 };
 
 }  // namespace ov
@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <ostream>
+#include <string>
 #include <vector>
 
 #include "openvino/core/node_output.hpp"
@@ -97,6 +99,28 @@ public:
      */
     virtual std::shared_ptr<ov::IAsyncInferRequest> create_infer_request() const;
 
+    /**
+     * @brief Primes the compiled model for the given input shape signatures
+     *
+     * The base implementation runs the inference pipeline over zero-filled tensors of the requested
+     * shapes on an internal request, which exercises lazy primitive preparation, buffer growth and
+     * page touching on every device. A plugin may override it with a cheaper device specific walk.
+     *
+     * @param shape_set Shape signatures, each entry holds one static shape per model input; when
+     * empty, a single signature is derived from the (then necessarily static) model input shapes
+     */
+    virtual void warmup(const std::vector<std::vector<ov::Shape>>& shape_set);
+
+    /**
+     * @brief Replaces the data of selected model constants without recompiling the model
+     *
+     * The base implementation throws; a plugin which can re-pack the affected weights in place
+     * overrides it.
+     *
+     * @param weights Map from the friendly name of a model constant to a tensor with the new data
+     */
+    virtual void update_weights(const std::map<std::string, ov::SoPtr<ov::ITensor>>& weights);
+
     /**
      * @brief Export compiled model to stream
      *
@@ -134,6 +158,21 @@ public:
      */
     ov::SoPtr<ov::IRemoteContext> get_context() const;
 
+    /**
+     * @brief Stores per-stage compile time telemetry; called by the core after compilation
+     *
+     * @param profile Stage name to duration in milliseconds map
+     */
+    void set_compile_time_profile(std::map<std::string, double> profile);
+
+    /**
+     * @brief Returns per-stage compile time telemetry recorded during compilation
+     *
+     * Served to the user through the ov::compile_time_profile property; the map is empty
+     * when the model was compiled outside of the core (e.g. directly by a plugin).
+     */
+    const std::map<std::string, double>& get_compile_time_profile() const;
+
     virtual ~ICompiledModel() = default;
 
 private:
@@ -145,6 +184,8 @@ private:
     std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor = nullptr;      //!< Holds a task executor
     std::shared_ptr<ov::threading::ITaskExecutor> m_callback_executor = nullptr;  //!< Holds a callback executor
 
+    std::map<std::string, double> m_compile_time_profile;  //!< Per-stage compile durations in ms
+
     friend ov::CoreImpl;
 
 protected:
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <istream>
 #include <memory>
 
 #include "openvino/runtime/icompiled_model.hpp"
@@ -54,6 +55,15 @@ public:
      */
     virtual std::shared_ptr<ov::Model> read_model(const std::string& model_path, const std::string& bin_path) const = 0;
 
+    /**
+     * @brief Reads a model from a stream
+     * @param model stream with a serialized model representation; it is consumed by the frontend as it
+     * parses, so the model does not need to be staged to a local file or a contiguous buffer first
+     * @param weights shared pointer to constant blob with weights
+     * @return shared pointer to ov::Model
+     */
+    virtual std::shared_ptr<ov::Model> read_model(std::istream& model, const ov::Tensor& weights) const = 0;
+
     /**
      * @brief Creates a compiled mdel from a model object.
      *
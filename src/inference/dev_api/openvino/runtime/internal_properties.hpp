@@ -10,6 +10,7 @@
 #pragma once
 
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 
 namespace ov {
@@ -76,5 +77,27 @@ static constexpr Property<bool, PropertyMutability::RO> compiled_model_runtime_p
  */
 static constexpr Property<float, PropertyMutability::RW> query_model_ratio{"QUERY_MODEL_RATIO"};
 
+/**
+ * @brief It contains the whole cached blob as a tensor which is passed to plugin's import_model() along with the
+ * stream when the cache manager was able to memory map the cache entry.
+ *
+ * The tensor keeps the mapping alive, so a plugin may keep a reference to it and adopt the blob content zero-copy
+ * instead of copying the import stream into its own buffers.
+ *
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<ov::Tensor, PropertyMutability::RW> cached_model_buffer{"CACHED_MODEL_BUFFER"};
+
+/**
+ * @brief Path of the original model file the cached blob was compiled from. Passed to import_model() on a cache
+ * hit when the model was compiled by path, so plugins supporting weightless (weights-by-reference) blobs can
+ * reload the weights from the source IR instead of duplicating them in the blob.
+ *
+ * Only passed to plugins that list this property in ov::internal::supported_properties.
+ *
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cached_model_path{"CACHED_MODEL_PATH"};
+
 }  // namespace internal
 }  // namespace ov
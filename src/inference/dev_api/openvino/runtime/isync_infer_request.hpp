@@ -22,6 +22,8 @@
 
 namespace ov {
 
+class TensorArena;
+
 /**
  * @brief Interface for syncronous infer request
  * @ingroup ov_dev_api_sync_infer_request_api
@@ -156,6 +158,30 @@ protected:
     void allocate_tensor(const ov::Output<const ov::Node>& port,
                          const std::function<void(ov::SoPtr<ov::ITensor>& tensor)>& allocate_callback);
 
+    /**
+     * @brief Allocate the default tensor for the port with storage placed on the given NUMA node
+     *
+     * Plugins with NUMA-pinned streams pass the node of the stream which will consume the tensor
+     * (see ov::threading::IStreamsExecutor::get_numa_node_id()), so the data is not read from remote
+     * memory. A tensor which already matches the port is kept as is.
+     *
+     * @param port input/output port for tensor
+     * @param numa_node_id NUMA node to place the tensor storage on
+     */
+    void allocate_tensor(const ov::Output<const ov::Node>& port, int numa_node_id);
+
+    /**
+     * @brief Allocate the default tensor for the port with storage sliced out of an arena
+     *
+     * Plugins call this for outputs sized per request (e.g. dynamic shapes), so the storage is a
+     * view into the request-scoped arena block and no malloc/free pair is paid per output. A
+     * tensor which already matches the port is kept as is.
+     *
+     * @param port input/output port for tensor
+     * @param arena arena providing the tensor storage
+     */
+    void allocate_tensor(const ov::Output<const ov::Node>& port, const std::shared_ptr<ov::TensorArena>& arena);
+
     std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, std::vector<ov::SoPtr<ov::ITensor>>> m_batched_tensors;
     ov::SoPtr<ov::ITensor>& get_tensor_ptr(const ov::Output<const ov::Node>& port) const;
 
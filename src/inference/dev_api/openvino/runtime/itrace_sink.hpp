@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief OpenVINO Runtime pluggable inference trace sink interface
+ * @file openvino/runtime/itrace_sink.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "openvino/runtime/common.hpp"
+
+namespace ov {
+
+/**
+ * @brief Interface of a user-pluggable sink receiving inference trace spans
+ *
+ * A sink observes every inference (request spans) and, at a configurable sample rate,
+ * the per-node execution spans of a request, so production traffic can feed an external
+ * tracing collector without ITT/VTune attached. Timestamps are nanoseconds of
+ * std::chrono::steady_clock. Callbacks run on inference threads and may be invoked
+ * concurrently, so implementations must be thread-safe and cheap; anything expensive
+ * belongs on the sink's own export thread.
+ */
+class OPENVINO_RUNTIME_API ITraceSink {
+public:
+    virtual ~ITraceSink();
+
+    /**
+     * @brief Called after every completed inference of any request in the process
+     *
+     * @param start_ns Start of the synchronous inference
+     * @param end_ns End of the synchronous inference
+     */
+    virtual void on_request_span(uint64_t start_ns, uint64_t end_ns) noexcept = 0;
+
+    /**
+     * @brief Called for every executed node of a sampled request
+     *
+     * The name and type pointers are only valid for the duration of the call.
+     */
+    virtual void on_node_span(const char* name, const char* type, uint64_t start_ns, uint64_t end_ns) noexcept = 0;
+};
+
+namespace trace {
+
+/**
+ * @brief Installs the process-wide trace sink (pass nullptr to disable tracing)
+ *
+ * @param sink Sink receiving the spans; kept alive by in-flight requests that picked it up
+ * @param node_span_period Emit node-level spans for every Nth inference; 0 disables node spans
+ */
+OPENVINO_RUNTIME_API void set_sink(const std::shared_ptr<ITraceSink>& sink, uint32_t node_span_period = 0);
+
+/**
+ * @brief Returns true when a sink is installed; a single relaxed atomic pointer load
+ */
+OPENVINO_RUNTIME_API bool enabled();
+
+/**
+ * @brief Returns true when the inference running on the current thread was sampled for node spans
+ *
+ * Plugins check this once per inference and bracket node execution only when it holds.
+ */
+OPENVINO_RUNTIME_API bool node_spans_active();
+
+/**
+ * @brief RAII guard bracketing one synchronous inference
+ *
+ * Does nothing when no sink is installed. At construction it snapshots the sink and
+ * decides whether this inference is sampled for node spans (published to the current
+ * thread for the plugin to pick up); at destruction it emits the request span.
+ */
+class OPENVINO_RUNTIME_API RequestSpan {
+public:
+    RequestSpan();
+    ~RequestSpan();
+
+    RequestSpan(const RequestSpan&) = delete;
+    RequestSpan& operator=(const RequestSpan&) = delete;
+
+private:
+    std::shared_ptr<ITraceSink> m_sink;
+    uint64_t m_start_ns = 0;
+    bool m_sampled = false;
+};
+
+/**
+ * @brief RAII guard emitting one node execution span
+ *
+ * Inactive when `name` is nullptr, so callers can fold the sampling decision into the
+ * constructor argument. The name and type strings must outlive the guard.
+ */
+class OPENVINO_RUNTIME_API ScopedNodeSpan {
+public:
+    ScopedNodeSpan(const char* name, const char* type);
+    ~ScopedNodeSpan();
+
+    ScopedNodeSpan(const ScopedNodeSpan&) = delete;
+    ScopedNodeSpan& operator=(const ScopedNodeSpan&) = delete;
+
+private:
+    const char* m_name;
+    const char* m_type;
+    uint64_t m_start_ns = 0;
+};
+
+}  // namespace trace
+}  // namespace ov
@@ -51,6 +51,18 @@ public:
      */
     virtual ov::SoPtr<ov::ITensor> get_state() const;
 
+    /**
+     * @brief Adopts the value of another variable state, e.g. to migrate a KV cache between the
+     * devices of a pipeline
+     * @details The default implementation stages the value through the tensor exposed by the source
+     * state and uploads it with a single set_state() call. Implementations which can reach the
+     * source memory directly (same device or a shared fabric) may override this with a
+     * device-to-device transfer and do any layout translation on device
+     * @param source The state to take the value from; its shape and element type must be accepted
+     * by this state's set_state()
+     */
+    virtual void copy_state_from(const ov::SoPtr<ov::IVariableState>& source);
+
 protected:
     /**
      * @brief A default dtor
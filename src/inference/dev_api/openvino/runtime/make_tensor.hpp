@@ -39,6 +39,76 @@ OPENVINO_RUNTIME_API std::shared_ptr<ITensor> make_tensor(const element::Type ty
                                                           void* host_ptr,
                                                           const Strides& strides = {});
 
+/**
+ * @brief Returns an allocator which commits memory on the given NUMA node
+ * @note On platforms without memory binding support the allocator falls back to regular (first touch)
+ * allocation, so callers do not need a separate code path
+ * @param numa_node_id NUMA node to place the allocations on
+ */
+OPENVINO_RUNTIME_API ov::Allocator get_numa_node_allocator(int numa_node_id);
+
+/**
+ * @brief Constructs Tensor using element type and shape with storage placed on the given NUMA node
+ * @param type Tensor element type
+ * @param shape Tensor shape
+ * @param numa_node_id NUMA node to place the tensor storage on, e.g. the node of the stream which
+ * will read the data (see ov::threading::IStreamsExecutor::get_numa_node_id())
+ */
+OPENVINO_RUNTIME_API std::shared_ptr<ITensor> make_numa_pinned_tensor(const element::Type type,
+                                                                      const Shape& shape,
+                                                                      int numa_node_id);
+
+/**
+ * @brief Request-scoped arena for tensor storage
+ *
+ * The arena owns one storage block and hands out bump-allocated slices of it through the
+ * ov::Allocator returned by get_allocator(), so tensors sized per request (e.g. outputs of models
+ * with dynamic shapes) reuse the same block instead of paying a malloc/free pair each request.
+ * Freeing a slice is a no-op; reset() rewinds the whole block at once. Slices which do not fit
+ * into the block fall back to regular heap allocation, so correctness never depends on the
+ * capacity estimate.
+ */
+class OPENVINO_RUNTIME_API TensorArena {
+public:
+    /**
+     * @brief Creates an arena owning a storage block of @p capacity bytes
+     * @param capacity Size of the storage block in bytes
+     */
+    explicit TensorArena(size_t capacity);
+
+    /**
+     * @brief Returns an allocator which slices tensor storage out of the arena block
+     */
+    ov::Allocator get_allocator();
+
+    /**
+     * @brief Rewinds the arena so the block is reused from the beginning
+     * @note The caller guarantees tensors holding slices from before the reset are no longer read
+     */
+    void reset();
+
+    /**
+     * @brief Returns the number of bytes currently sliced out of the block
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the capacity of the storage block in bytes
+     */
+    size_t capacity() const;
+
+    /**
+     * @cond
+     */
+    struct State;
+    /**
+     * @endcond
+     */
+
+private:
+    std::shared_ptr<State> m_state;
+};
+
 /**
  * @brief Constructs region of interest (ROI) tensor form another tensor.
  * @note Does not perform memory allocation internally
@@ -119,58 +119,55 @@ public:
         _time_duration = normalize_boxes(_boxes);
     }
 
-    inline bool popup_together_with(MemorySolver::Box& box_new, const MemorySolver::Box& box_old) {
-        if (box_new.id + box_new.size > box_old.id && box_old.id + box_old.size > box_new.id) {
-            // Move the new one up. There is an intersection
-            box_new.id = box_old.id + box_old.size;
-            return true;
-        } else {
-            return false;
-        }
-    }
-
     /**
      * @brief Solve memory location with maximal reuse.
      * @return Size of common memory blob required for storing all
      */
     int64_t solve() {
         max_top_depth();  // at first make sure that we no need more for boxes sorted by box.start
-        std::vector<std::vector<const Box*>> time_slots(_time_duration);
-        for (auto& slot : time_slots)
-            slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
-        // Sort be box size. First is biggest
-        // Comment this line to check other order of box putting
+        // First-fit decreasing: the biggest (then longest living) boxes are placed first, each at
+        // the lowest offset interval which is free for the whole box lifetime, so the smaller
+        // boxes fill the gaps between them. Unlike lifting a box up over every intersection, the
+        // gap search never skips a feasible lower placement, which keeps the plan near the
+        // max_depth() lower bound.
         std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
-            return l.size > r.size;
+            if (l.size != r.size)
+                return l.size > r.size;
+            const auto l_lifetime = l.finish - l.start;
+            const auto r_lifetime = r.finish - r.start;
+            if (l_lifetime != r_lifetime)
+                return l_lifetime > r_lifetime;
+            return l.start < r.start;
         });
 
         int64_t _min_required = 0;
+        std::vector<const Box*> placed;
+        placed.reserve(_boxes.size());
+        std::vector<std::pair<int64_t, int64_t>> taken;
 
         for (Box& box : _boxes) {
-            // start from bottom and will lift it up if intersect with other present
-            int64_t id = box.id;
-            box.id = 0;  // id will be used as a temp offset storage
-            bool popped_up;
-            do {
-                popped_up = false;
-                for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                    for (auto* box_in_slot : time_slots[i_slot]) {
-                        // intersect with already stored boxes for all covered time slots
-                        // and move up the new one if needed
-                        // Execution of 'popup_together_with' is important even if 'popped_up' is already 'true'
-                        popped_up = popup_together_with(box, *box_in_slot) || popped_up;
-                    }
-                }
-            } while (popped_up);
-
-            // add current box to covered time slot
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-                time_slots[i_slot].push_back(&box);
-
-            // store the max top bound for each box
-            _min_required = std::max(_min_required, box.id + box.size);
-            _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+            const int64_t id = box.id;
+
+            // offset intervals of already placed boxes which overlap the current box in time
+            taken.clear();
+            for (const Box* other : placed) {
+                if (other->start <= box.finish && box.start <= other->finish)
+                    taken.emplace_back(other->id, other->id + other->size);
+            }
+            std::sort(taken.begin(), taken.end());
+
+            int64_t offset = 0;
+            for (const auto& interval : taken) {
+                if (interval.first - offset >= box.size)
+                    break;  // the gap below this interval is big enough
+                offset = std::max(offset, interval.second);
+            }
+
+            box.id = offset;  // id is reused as the offset storage, as before
+            placed.push_back(&box);
+            _min_required = std::max(_min_required, offset + box.size);
+            _offsets[id] = offset;
         }
 
         return _min_required;
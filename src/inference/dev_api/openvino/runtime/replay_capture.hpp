@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief OpenVINO Runtime inference replay capture facility
+ * @file openvino/runtime/replay_capture.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "openvino/runtime/common.hpp"
+
+namespace ov {
+
+class IInferRequest;
+
+namespace replay {
+
+/**
+ * @brief Returns true when replay capture was enabled for this process
+ *
+ * Capture is opt-in: it activates when the OV_REPLAY_CAPTURE environment variable holds a
+ * writable file path at the time of the first inference. The recorded log contains the input
+ * shape signatures and timings of every inference of the process (no tensor data), so a
+ * production request sequence can be replayed later against the same model to reproduce
+ * scheduling and shape-dependent performance issues.
+ */
+OPENVINO_RUNTIME_API bool capture_active();
+
+/**
+ * @brief Appends one executed inference to the capture log
+ *
+ * Called by the async request machinery right after the synchronous inference completes.
+ * Safe to call concurrently from multiple inference threads; records are serialized under
+ * an internal lock. Timestamps are nanoseconds of std::chrono::steady_clock.
+ *
+ * @param request The synchronous request whose input signatures are recorded
+ * @param start_ns Start of the synchronous inference
+ * @param end_ns End of the synchronous inference
+ */
+OPENVINO_RUNTIME_API void record_infer(const IInferRequest& request, uint64_t start_ns, uint64_t end_ns);
+
+}  // namespace replay
+}  // namespace ov
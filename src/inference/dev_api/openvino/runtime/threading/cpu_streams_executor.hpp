@@ -45,10 +45,16 @@ public:
 
     void run(Task task) override;
 
+    void run_with_priority(Task task, ov::hint::Priority priority) override;
+
+    bool high_priority_pending() const override;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
 
+    bool is_stream_thread() override;
+
     int get_numa_node_id() override;
 
     int get_socket_id() override;
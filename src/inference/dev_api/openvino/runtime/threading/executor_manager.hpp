@@ -80,6 +80,44 @@ public:
      */
     virtual void execute_task_by_streams_executor(ov::threading::IStreamsExecutor::Config::PreferredCoreType core_type,
                                                   ov::threading::Task task) = 0;
+
+    /**
+     * @brief Leases a share of the host cores for a compiled model
+     *
+     * The manager acts as a host-level arbiter: the grants of all owners never exceed the number
+     * of host threads, so many compiled models on one host do not oversubscribe the cores. The
+     * grant may shrink or grow when other owners come and go or report different load; owners
+     * re-query with get_leased_cores() and resize their stream usage, no recompilation is needed.
+     *
+     * @param owner_id Unique identifier of the lease owner (e.g. the compiled model name)
+     * @param requested_cores Upper bound the owner can make use of
+     * @return Number of cores currently granted to the owner, at least 1
+     */
+    virtual int lease_cores(const std::string& owner_id, int requested_cores) = 0;
+
+    /**
+     * @brief Reports the load observed by a lease owner
+     *
+     * The load is used as the owner's weight on the next repartitioning, so busy models receive
+     * a larger share of the pool than idle ones
+     *
+     * @param owner_id Unique identifier of the lease owner
+     * @param active_requests Number of inference requests currently in flight for the owner
+     */
+    virtual void report_load(const std::string& owner_id, int active_requests) = 0;
+
+    /**
+     * @brief Returns the owner's current grant without changing its request
+     * @param owner_id Unique identifier of the lease owner
+     * @return Number of cores currently granted, 0 when the owner holds no lease
+     */
+    virtual int get_leased_cores(const std::string& owner_id) const = 0;
+
+    /**
+     * @brief Releases the owner's lease, its cores return to the pool
+     * @param owner_id Unique identifier of the lease owner
+     */
+    virtual void release_cores(const std::string& owner_id) = 0;
 };
 
 OPENVINO_API std::shared_ptr<ExecutorManager> executor_manager();
@@ -266,12 +266,47 @@ public:
      */
     virtual int get_socket_id() = 0;
 
+    /**
+     * @brief Checks whether the calling thread is one of the executor streams
+     * @return `true` when called from a stream thread of this executor, `false` otherwise
+     */
+    virtual bool is_stream_thread() {
+        return false;
+    }
+
     /**
      * @brief Execute the task in the current thread using streams executor configuration and constraints
      * @param task A task to start
      */
     virtual void execute(Task task) = 0;
 
+    /**
+     * @brief Schedules the task with the given scheduling class
+     *
+     * High priority tasks are dequeued before any pending normal or low priority ones, low
+     * priority tasks run only when no other work is queued. The default implementation ignores
+     * the priority and behaves like run().
+     *
+     * @param task A task to start
+     * @param priority Scheduling class of the task
+     */
+    virtual void run_with_priority(Task task, ov::hint::Priority priority) {
+        run(std::move(task));
+    }
+
+    /**
+     * @brief Checks whether a high priority task is waiting to be dequeued
+     *
+     * Long-running low priority tasks can poll this at convenient boundaries (e.g. between graph
+     * nodes) and split the remaining work into a new low priority task to let the high priority
+     * one preempt them
+     *
+     * @return `true` when a high priority task is queued on this executor
+     */
+    virtual bool high_priority_pending() const {
+        return false;
+    }
+
     /**
      * @brief Execute ov::Task inside sub stream of task executor context
      * @param task A task to start
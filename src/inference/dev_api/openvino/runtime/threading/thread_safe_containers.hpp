@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <type_traits>
@@ -21,6 +22,83 @@
 namespace ov {
 namespace threading {
 
+/**
+ * @brief Bounded MPMC queue where neither producers nor consumers take a lock.
+ *
+ * Each ring cell carries a sequence number (D. Vyukov's algorithm); a producer claims a cell
+ * when its sequence matches the enqueue position and publishes the value by bumping it, a
+ * consumer does the symmetric check on the dequeue side. try_push() fails when the ring is
+ * full, so callers keep a locked queue as overflow fallback.
+ */
+template <typename T>
+class LockFreeBoundedQueue {
+public:
+    explicit LockFreeBoundedQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i)
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        _mask = size - 1;
+    }
+
+    bool try_push(T value) {
+        Cell* cell;
+        std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;  // the ring is full
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(T& value) {
+        Cell* cell;
+        std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto seq = cell->_sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;  // the ring is empty
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        // drop the payload so state captured by the value is released promptly
+        cell->_value = T{};
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+protected:
+    struct Cell {
+        std::atomic<std::size_t> _sequence{0};
+        T _value{};
+    };
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    // producers and consumers bounce different cache lines
+    alignas(64) std::atomic<std::size_t> _enqueuePos{0};
+    alignas(64) std::atomic<std::size_t> _dequeuePos{0};
+};
+
 template <typename T>
 class ThreadSafeQueueWithSize {
 public:
@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file openvino/runtime/threading/work_stealing_executor.hpp
+ * @brief A header file for OpenVINO work-stealing Executor implementation.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
+
+namespace ov {
+namespace threading {
+
+/**
+ * @class WorkStealingExecutor
+ * @ingroup ov_dev_api_threading
+ * @brief Work-stealing executor implementation. Each worker owns a deque of tasks; an idle worker
+ *        steals from busy ones, preferring victims on the same NUMA node, so cores do not idle
+ *        while tasks of uneven duration queue on other workers.
+ */
+class OPENVINO_RUNTIME_API WorkStealingExecutor : public IStreamsExecutor {
+public:
+    /**
+     * @brief A shared pointer to a WorkStealingExecutor object
+     */
+    using Ptr = std::shared_ptr<WorkStealingExecutor>;
+
+    /**
+     * @brief Constructor
+     * @param config Stream executor parameters, the number of streams defines the number of workers
+     */
+    explicit WorkStealingExecutor(const Config& config);
+
+    /**
+     * @brief A class destructor
+     */
+    ~WorkStealingExecutor() override;
+
+    void run(Task task) override;
+
+    void execute(Task task) override;
+
+    int get_stream_id() override;
+
+    bool is_stream_thread() override;
+
+    int get_numa_node_id() override;
+
+    int get_socket_id() override;
+
+    void run_sub_stream(Task task, int id) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace threading
+}  // namespace ov
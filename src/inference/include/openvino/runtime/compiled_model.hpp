@@ -147,6 +147,72 @@ public:
      */
     InferRequest create_infer_request();
 
+    /**
+     * @brief Starts a batch of inference requests in one call with a single aggregated completion.
+     *
+     * All requests are submitted in one pass and run concurrently, subject to the device stream
+     * configuration. The per-request callbacks are replaced by an internal aggregator; when every
+     * request of the batch has finished, @p on_complete is called once with `nullptr` on success
+     * or with the first raised exception. This amortizes the per-request submission and callback
+     * overhead for micro-batch workloads which submit many small requests at once.
+     *
+     * @param requests Inference requests to start. Must be created from this compiled model.
+     * @param on_complete Optional callback called once after the whole batch has completed.
+     */
+    void submit_batch(const std::vector<InferRequest>& requests,
+                      const std::function<void(std::exception_ptr)>& on_complete = {});
+
+    /**
+     * @brief Runs one synchronous inference with the batch of the request split across several requests.
+     *
+     * On a latency-configured model a single large-batch request occupies one execution stream while
+     * the remaining streams idle. This method slices every input of @p request along the leading
+     * (batch) dimension into up to @p num_shards chunks, runs the chunks as concurrent internal
+     * requests (the device schedules them onto its idle streams) and leaves the merged result in the
+     * output tensors of @p request. The slices are zero-copy views, so no data is moved on either the
+     * split or the merge side. The method is a drop-in replacement for InferRequest::infer on the
+     * requests which should be split; other requests of the same compiled model are not affected.
+     *
+     * The model must be batchable: the leading dimension of every input tensor must be the same batch
+     * and all the non-batch output dimensions must be static. Models compiled with a static batch
+     * reject the sliced shapes, so the split requires batch-dynamic model inputs.
+     *
+     * @param request The request to run. Input tensors must be set and share the leading dimension.
+     * @param num_shards Maximum number of concurrent chunks. The default 0 derives the value from
+     * ov::optimal_number_of_infer_requests. Values are clamped to the batch; 1 falls back to a plain
+     * InferRequest::infer call.
+     */
+    void infer_split_batch(InferRequest& request, size_t num_shards = 0);
+
+    /**
+     * @brief Primes the compiled model for the given input shape signatures ahead of time.
+     *
+     * The first inference of a freshly compiled model (and, for dynamically shaped models, the first
+     * inference of every new shape bucket) pays for lazy primitive preparation, buffer growth and the
+     * page faults of freshly allocated memory. This method performs that work eagerly by running the
+     * inference pipeline over zero-filled tensors of the requested shapes, so production requests and
+     * latency metrics are not polluted by warmup effects.
+     *
+     * @param shape_set Shape signatures to prime, each entry lists one static shape per model input
+     * (in the order of CompiledModel::inputs). When empty, a single signature is derived from the
+     * model input shapes, which therefore must be static.
+     */
+    void warmup(const std::vector<std::vector<ov::Shape>>& shape_set = {});
+
+    /**
+     * @brief Replaces the data of selected model constants without recompiling the model.
+     *
+     * Swapping a small set of weights (e.g. LoRA adapter matrices) through a fresh compile_model
+     * pays for the whole compilation again. This method copies the new data into the named
+     * constants in place and re-packs only the primitives consuming them, leaving the rest of the
+     * compiled model intact. No inference request of this compiled model may be running during the
+     * update. Not every device supports the update; unsupported devices throw.
+     *
+     * @param weights Map from the friendly name of a model constant to a tensor with the new data;
+     * each tensor must match the element type and byte size of the constant it replaces.
+     */
+    void update_weights(const std::map<std::string, Tensor>& weights);
+
     /**
      * @brief Exports the current compiled model to an output stream `std::ostream`.
      * The exported model can also be imported via the ov::Core::import_model method.
@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -98,6 +99,20 @@ public:
      */
     std::shared_ptr<ov::Model> read_model(const std::string& model_path, const std::string& bin_path = {}) const;
 
+    /**
+     * @brief Reads a model asynchronously, overlapping file I/O and parsing with the caller's work.
+     *
+     * Behaves like Core::read_model(model_path, bin_path) but runs on a background thread and returns
+     * a future immediately. Useful to hide the fetch latency of models kept on slow (e.g. network)
+     * storage behind other initialization, or to read several models concurrently.
+     * Any error is reported from future::get().
+     * @param model_path Path to a model.
+     * @param bin_path Path to a data file, resolved the same way as in Core::read_model.
+     * @return A future delivering the model.
+     */
+    std::shared_future<std::shared_ptr<ov::Model>> read_model_async(const std::string& model_path,
+                                                                    const std::string& bin_path = {}) const;
+
     /**
      * @brief Reads models from IR / ONNX / PDPD / TF / TFLite formats.
      * @param model String with a model in IR / ONNX / PDPD / TF / TFLite format.
@@ -110,6 +125,22 @@ public:
      */
     std::shared_ptr<ov::Model> read_model(const std::string& model, const Tensor& weights) const;
 
+    /**
+     * @brief Reads a model from a stream, e.g. a model streamed from remote storage.
+     *
+     * The stream is consumed by the frontend directly, so the model does not have to be staged
+     * to a local file or materialized in a contiguous memory buffer first. Any std::istream works,
+     * including a custom streambuf over a network download in progress.
+     * @param model Stream with a model in IR / ONNX / PDPD / TF / TFLite format.
+     * @param weights Shared pointer to a constant tensor with weights.
+     * Reading ONNX / PDPD / TF / TFLite models does not support loading weights from the @p weights tensors.
+     * @note Created model object shares the weights with the @p weights object.
+     * Thus, do not create @p weights on temporary data that can be freed later, since the model
+     * constant data will point to an invalid memory.
+     * @return A model.
+     */
+    std::shared_ptr<ov::Model> read_model(std::istream& model, const Tensor& weights = {}) const;
+
     /**
      * @brief Creates and loads a compiled model from a source model to the default OpenVINO device selected by the AUTO
      * plugin.
@@ -181,6 +212,25 @@ public:
         return compile_model(model, device_name, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Compiles several models for the same device concurrently.
+     *
+     * Before compilation, Constants with identical content are rewritten to share one backing allocation
+     * across all given models, so models built from the same base weights do not duplicate them per
+     * compiled model. The models are modified in place and must not be used from other threads while
+     * this call is running.
+     *
+     * @param models Models to compile. Each entry goes through the regular Core::compile_model flow,
+     * including the model cache.
+     * @param device_name Name of a device to compile the models for.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return Compiled models in the same order as `models`.
+     */
+    std::vector<CompiledModel> compile_models(const std::vector<std::shared_ptr<ov::Model>>& models,
+                                              const std::string& device_name,
+                                              const AnyMap& properties = {});
+
     /**
      * @brief Reads and loads a compiled model from the IR/ONNX/PDPD file to the default OpenVINO device selected by the
      * AUTO plugin.
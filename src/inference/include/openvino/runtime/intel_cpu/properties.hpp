@@ -63,5 +63,22 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief Read-only property to get the host memory currently allocated for a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The statistics are collected at the plugin allocator level, so they reflect the live allocations of this
+ * compiled model without parsing the process memory maps. The returned map contains byte counters keyed by:
+ * - "weights_bytes" - constant data owned by the model (packed and replicated weights included)
+ * - "activations_bytes" / "activations_peak_bytes" - intermediate tensor space and its high-water mark
+ * - "scratch_bytes" / "scratch_peak_bytes" - scratch buffers of the primitives and their high-water mark
+ *
+ * @code
+ * auto stats = compiled_model.get_property(ov::intel_cpu::memory_statistics);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> memory_statistics{
+    "CPU_MEMORY_STATISTICS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
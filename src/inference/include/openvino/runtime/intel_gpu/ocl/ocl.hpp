@@ -294,6 +294,44 @@ public:
         return create_tensor(type, shape, buffer.get());
     }
 
+#ifndef _WIN32
+    /**
+     * @brief This function is used to obtain remote tensor object importing a dma_buf file descriptor,
+     * e.g. an exported VA surface plane or a DRM PRIME buffer. Requires cl_khr_external_memory support
+     * in the OpenCL driver. The underlying OpenCL buffer keeps its own reference on the dma_buf, so the
+     * descriptor may be closed by the caller once the tensor is created
+     * @param type Tensor element type
+     * @param shape Tensor shape
+     * @param dma_buf_fd A dma_buf file descriptor that should be imported by a remote tensor
+     * @return A remote tensor instance
+     */
+    ClBufferTensor create_tensor_from_dma_buf(const element::Type type, const Shape& shape, const int dma_buf_fd) {
+        AnyMap params = {{ov::intel_gpu::shared_mem_type.name(), ov::intel_gpu::SharedMemType::DMA_BUF},
+                         {ov::intel_gpu::mem_handle.name(),
+                          reinterpret_cast<gpu_handle_param>(static_cast<intptr_t>(dma_buf_fd))}};
+        return create_tensor(type, shape, params).as<ClBufferTensor>();
+    }
+
+    /**
+     * @brief This function is used to obtain an NV12 tensor from dma_buf file descriptors of a decoded
+     * frame, e.g. a VA surface exported with separate layers. The resulting tensor contains two remote
+     * tensors for Y and UV planes of the surface
+     * @param height A height of Y plane
+     * @param width A width of Y plane
+     * @param y_plane_fd A dma_buf file descriptor of the Y plane
+     * @param uv_plane_fd A dma_buf file descriptor of the UV plane
+     * @return A pair of remote tensors for each plane
+     */
+    std::pair<ClBufferTensor, ClBufferTensor> create_tensor_nv12_from_dma_buf(const size_t height,
+                                                                              const size_t width,
+                                                                              const int y_plane_fd,
+                                                                              const int uv_plane_fd) {
+        auto y_tensor = create_tensor_from_dma_buf(element::u8, {1, height, width, 1}, y_plane_fd);
+        auto uv_tensor = create_tensor_from_dma_buf(element::u8, {1, height / 2, width / 2, 2}, uv_plane_fd);
+        return std::make_pair(y_tensor, uv_tensor);
+    }
+#endif
+
     /**
      * @brief This function is used to obtain remote tensor object from user-supplied cl::Image2D object
      * @param type Tensor element type
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides the Pipeline class.
+ *
+ * @file openvino/runtime/pipeline.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "openvino/runtime/compiled_model.hpp"
+
+namespace ov {
+
+/**
+ * @brief This class chains several compiled models into one logical pipeline.
+ * @ingroup ov_runtime_cpp_api
+ * The outputs of every stage are bound to the inputs of the next stage by position and the
+ * intermediate tensors are shared between the adjacent stages instead of being copied through
+ * user code. Each enqueued set of inputs travels through the stages asynchronously, so while
+ * one item is processed by a later stage the next item already runs through the earlier ones;
+ * with the default depth of 2 this gives double-buffered stage overlap across requests.
+ * An instance is not intended to be used from multiple threads simultaneously, the overlap
+ * happens inside.
+ */
+class OPENVINO_RUNTIME_API Pipeline {
+    class Impl;
+    std::shared_ptr<Impl> m_impl;
+
+public:
+    /**
+     * @brief Default constructor.
+     */
+    Pipeline() = default;
+
+    /**
+     * @brief Composes compiled models into a pipeline.
+     * @param stages Compiled models in execution order. The number of outputs of every stage must
+     * match the number of inputs of the next one; shape and type compatibility is validated by the
+     * devices when the items flow through.
+     * @param depth Number of items processed concurrently, which is also the number of infer
+     * requests created per stage. The default of 2 overlaps every pair of adjacent items.
+     */
+    explicit Pipeline(const std::vector<CompiledModel>& stages, size_t depth = 2);
+
+    /**
+     * @brief Runs one set of inputs through every stage and returns the final outputs.
+     * All previously enqueued items must be collected first.
+     * @param inputs Input tensors of the first stage, by position.
+     * @return Output tensors of the last stage, by position.
+     */
+    TensorVector infer(const TensorVector& inputs);
+
+    /**
+     * @brief Enqueues a set of inputs and returns once a processing slot has accepted it, which
+     * may require waiting for the results of the oldest in-flight item to be collected.
+     * The input tensors must stay valid until the results of this item are collected.
+     * @param inputs Input tensors of the first stage, by position.
+     */
+    void start_async(const TensorVector& inputs);
+
+    /**
+     * @brief Waits for and returns the results of the oldest enqueued item.
+     * Results are returned in submission order; an error of any stage is rethrown here.
+     * @return Output tensors of the last stage, by position.
+     */
+    TensorVector get_results();
+};
+
+}  // namespace ov
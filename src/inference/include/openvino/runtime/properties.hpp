@@ -684,12 +684,39 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief This property defines a total size budget in bytes for the directory set by ov::cache_dir.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When the budget is exceeded, the least recently used cached blobs are removed until the cache fits again,
+ * so the cache directory does not grow without bound. The value 0 (default) disables eviction.
+ *
+ * @code
+ * core.set_property(ov::cache_max_size(1024 * 1024 * 1024)); // limit the model cache to 1 GB
+ * @endcode
+ */
+static constexpr Property<uint64_t> cache_max_size{"CACHE_MAX_SIZE"};
+
 /**
  * @brief Read-only property to notify user that compiled model was loaded from the cache
  * @ingroup ov_runtime_cpp_prop_api
  */
 static constexpr Property<bool, PropertyMutability::RO> loaded_from_cache{"LOADED_FROM_CACHE"};
 
+/**
+ * @brief Read-only property to get per-stage compile time telemetry of a compiled model
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The value maps stage names to durations in milliseconds accumulated on the thread which
+ * called Core::compile_model: the total under "core::compile_model", model reading under
+ * "core::read_model", time spent inside a device plugin under "plugin::<DEVICE>::compile_model"
+ * (or "::import_model" when the model was restored from the cache) and every executed
+ * transformation pass under "pass::<Name>". Unlike ITT instrumentation the telemetry is
+ * always available, so compile-time regressions can be tracked in production logs.
+ */
+static constexpr Property<std::map<std::string, double>, PropertyMutability::RO> compile_time_profile{
+    "COMPILE_TIME_PROFILE"};
+
 /**
  * @brief Enum to define possible cache mode
  * @ingroup ov_runtime_cpp_prop_api
@@ -794,6 +821,20 @@ static constexpr Property<std::tuple<unsigned int, unsigned int, unsigned int>,
  */
 static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FORCE_TBB_TERMINATE"};
 
+/**
+ * @brief Read-write property to use work-stealing task executors for shared executors. Disabled by default.
+ *
+ * With static streams a short task leaves its worker idle while longer tasks queue elsewhere; a work-stealing
+ * executor lets idle workers take queued tasks from busy ones (preferring victims on the same NUMA node),
+ * which helps when task durations vary a lot
+ *
+ * value type: boolean
+ *   - True create work-stealing executors for subsequently requested shared task executors
+ *   - False use the default streams executors
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_work_stealing{"ENABLE_WORK_STEALING"};
+
 /**
  * @brief Read-write property to configure `mmap()` use for model read. Enabled by default.
  * For the moment only IR Frontend supports the property.
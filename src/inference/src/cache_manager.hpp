@@ -9,15 +9,71 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
 #include <fstream>
 #include <functional>
+#include <istream>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <streambuf>
 #include <string>
+#include <vector>
 
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
 
 namespace ov {
 
+/**
+ * @brief Read-only stream buffer over an externally owned memory region, e.g. a memory mapped cache entry
+ *
+ */
+class ReadOnlyStreamBuffer : public std::streambuf {
+public:
+    ReadOnlyStreamBuffer(char* data, size_t size) {
+        setg(data, data, data + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        char* target = nullptr;
+        switch (dir) {
+        case std::ios_base::beg:
+            target = eback() + off;
+            break;
+        case std::ios_base::cur:
+            target = gptr() + off;
+            break;
+        case std::ios_base::end:
+            target = egptr() + off;
+            break;
+        default:
+            return pos_type(off_type(-1));
+        }
+        if (target < eback() || target > egptr())
+            return pos_type(off_type(-1));
+        setg(eback(), target, egptr());
+        return pos_type(target - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
 /**
  * @brief This class represents private interface for Cache Manager
  *
@@ -61,6 +117,50 @@ public:
      */
     virtual void read_cache_entry(const std::string& id, StreamReader reader) = 0;
 
+    /**
+     * @brief Function passing created input stream together with a zero-copy view of the cache entry
+     */
+    using MappedStreamReader = std::function<void(std::istream&, const ov::Tensor&)>;
+
+    /**
+     * @brief Same as read_cache_entry(id, reader), but additionally exposes the whole cache entry as a tensor
+     * when the implementation can memory map it and `enable_mmap` is set
+     *
+     * The tensor owns the mapping and stays valid after the reader returns, so the content may be adopted
+     * zero-copy instead of being copied out of the stream. Implementations without mapping support pass
+     * an empty tensor
+     *
+     * @param id Id of cache (hash of the model)
+     * @param enable_mmap Allow the implementation to memory map the cache entry
+     * @param reader Lambda function to be called when input stream is created
+     */
+    virtual void read_cache_entry(const std::string& id, bool enable_mmap, MappedStreamReader reader) {
+        read_cache_entry(id, [&](std::istream& stream) {
+            reader(stream, ov::Tensor());
+        });
+    }
+
+    /**
+     * @brief Hint that the cache entry is about to be read
+     *
+     * Implementations can kick off background readahead here, so the blob I/O overlaps with the
+     * plugin initialization and header checks that precede the actual import. The default
+     * implementation does nothing
+     *
+     * @param id Id of cache (hash of the model)
+     */
+    virtual void prefetch_cache_entry(const std::string& id) {}
+
+    /**
+     * @brief Sets a total size budget for the cached entries
+     *
+     * When the budget is exceeded, implementations are expected to evict least recently used entries
+     * until the cache fits again. The default implementation ignores the budget
+     *
+     * @param size Budget in bytes, 0 (the default) means unlimited
+     */
+    virtual void set_max_cache_size(uint64_t size) {}
+
     /**
      * @brief Callback when OpenVINO intends to remove cache entry
      *
@@ -79,11 +179,102 @@ public:
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    uint64_t m_maxCacheSize = 0;  // 0 means unlimited, see ov::cache_max_size
+    std::mutex m_manifestMutex;
+
+    // One line of the manifest, which tracks size and recency of each blob for LRU eviction
+    struct ManifestEntry {
+        std::string id;
+        uint64_t size = 0;
+        uint64_t lastUsed = 0;
+    };
 
     std::string getBlobFile(const std::string& blobHash) const {
         return ov::util::make_path(m_cachePath, blobHash + ".blob");
     }
 
+    std::string getManifestFile() const {
+        return ov::util::make_path(m_cachePath, std::string("cache_manifest.txt"));
+    }
+
+    static uint64_t timestamp() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+
+    std::vector<ManifestEntry> readManifest() const {
+        std::vector<ManifestEntry> entries;
+        std::ifstream manifest(getManifestFile());
+        std::string line;
+        while (std::getline(manifest, line)) {
+            std::istringstream parser(line);
+            ManifestEntry entry;
+            if (parser >> entry.id >> entry.size >> entry.lastUsed)
+                entries.push_back(std::move(entry));
+        }
+        return entries;
+    }
+
+    void writeManifest(const std::vector<ManifestEntry>& entries) const {
+        const auto manifestFile = getManifestFile();
+        const auto tempFile = manifestFile + ".tmp";
+        {
+            std::ofstream manifest(tempFile, std::ios_base::trunc);
+            for (const auto& entry : entries)
+                manifest << entry.id << ' ' << entry.size << ' ' << entry.lastUsed << '\n';
+        }
+        // rename is atomic on POSIX, so concurrent readers never observe a partially written manifest
+        if (std::rename(tempFile.c_str(), manifestFile.c_str()) != 0) {
+            // e.g. Windows refuses to replace an existing file via rename
+            std::remove(manifestFile.c_str());
+            std::rename(tempFile.c_str(), manifestFile.c_str());
+        }
+    }
+
+    // Records the entry as just used and, when the budget is exceeded, reaps least recently used blobs
+    void updateManifest(const std::string& id, uint64_t size) {
+        std::lock_guard<std::mutex> lock(m_manifestMutex);
+        auto entries = readManifest();
+        auto it = std::find_if(entries.begin(), entries.end(), [&](const ManifestEntry& entry) {
+            return entry.id == id;
+        });
+        if (it == entries.end()) {
+            entries.push_back({id, size, timestamp()});
+        } else {
+            it->size = size;
+            it->lastUsed = timestamp();
+        }
+        if (m_maxCacheSize > 0) {
+            uint64_t total = 0;
+            for (const auto& entry : entries)
+                total += entry.size;
+            std::sort(entries.begin(), entries.end(), [](const ManifestEntry& a, const ManifestEntry& b) {
+                return a.lastUsed < b.lastUsed;
+            });
+            // The entry just used sorts last and is never evicted, even if it alone exceeds the
+            // budget, since the caller is about to consume it
+            while (total > m_maxCacheSize && entries.size() > 1) {
+                std::remove(getBlobFile(entries.front().id).c_str());
+                total -= entries.front().size;
+                entries.erase(entries.begin());
+            }
+        }
+        writeManifest(entries);
+    }
+
+    void dropManifestEntry(const std::string& id) {
+        std::lock_guard<std::mutex> lock(m_manifestMutex);
+        auto entries = readManifest();
+        entries.erase(std::remove_if(entries.begin(),
+                                     entries.end(),
+                                     [&](const ManifestEntry& entry) {
+                                         return entry.id == id;
+                                     }),
+                      entries.end());
+        writeManifest(entries);
+    }
+
 public:
     /**
      * @brief Constructor
@@ -99,22 +290,69 @@ public:
 
 private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        const auto blobFileName = getBlobFile(id);
+        {
+            std::ofstream stream(blobFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+        }
+        updateManifest(id, static_cast<uint64_t>(ov::util::file_size(blobFileName)));
     }
 
     void read_cache_entry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (ov::util::file_exists(blobFileName)) {
+            updateManifest(id, static_cast<uint64_t>(ov::util::file_size(blobFileName)));
             std::ifstream stream(blobFileName, std::ios_base::binary);
             reader(stream);
         }
     }
 
+    void read_cache_entry(const std::string& id, bool enable_mmap, MappedStreamReader reader) override {
+        auto blobFileName = getBlobFile(id);
+        if (!ov::util::file_exists(blobFileName))
+            return;
+        updateManifest(id, static_cast<uint64_t>(ov::util::file_size(blobFileName)));
+        if (enable_mmap) {
+            auto mapped_memory = ov::load_mmap_object(blobFileName);
+            // Tensor view over the mapped pages; the mapping is kept alive by the tensor itself
+            ov::SoPtr<ov::ITensor> blob{
+                ov::make_tensor(ov::element::u8, ov::Shape{mapped_memory->size()}, mapped_memory->data()),
+                mapped_memory};
+            ReadOnlyStreamBuffer buffer(mapped_memory->data(), mapped_memory->size());
+            std::istream stream(&buffer);
+            reader(stream, ov::make_tensor(blob));
+        } else {
+            std::ifstream stream(blobFileName, std::ios_base::binary);
+            reader(stream, ov::Tensor());
+        }
+    }
+
+    void prefetch_cache_entry(const std::string& id) override {
+#if defined(__linux__)
+        // posix_fadvise(WILLNEED) is asynchronous: the kernel starts reading the blob into the
+        // page cache while compilation proceeds, so both the mmap and the ifstream read paths
+        // hit warm pages by the time the plugin imports the model
+        const auto blobFileName = getBlobFile(id);
+        const int fd = ::open(blobFileName.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        ::close(fd);
+#else
+        (void)id;
+#endif
+    }
+
+    void set_max_cache_size(uint64_t size) override {
+        std::lock_guard<std::mutex> lock(m_manifestMutex);
+        m_maxCacheSize = size;
+    }
+
     void remove_cache_entry(const std::string& id) override {
         auto blobFileName = getBlobFile(id);
         if (ov::util::file_exists(blobFileName))
             std::remove(blobFileName.c_str());
+        dropManifestEntry(id);
     }
 };
 
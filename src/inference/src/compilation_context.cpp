@@ -12,7 +12,10 @@
 #endif
 
 #include "itt.hpp"
+#include "openvino/core/model.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
@@ -37,6 +40,47 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+static void collect_constants(const std::shared_ptr<const ov::Model>& model,
+                              std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants) {
+    for (const auto& op : model->get_ordered_ops()) {
+        if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            constants.push_back(constant);
+        } else if (auto multi_subgraph_op = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& body : multi_subgraph_op->get_functions())
+                collect_constants(body, constants);
+        }
+    }
+}
+
+// Weights hash: constant payloads are hashed per-Constant in parallel and combined in the
+// deterministic ordered-ops order. The topology part of the cache key is computed separately
+// by ov::pass::Hash with skip_weights set, so both stay much cheaper than streaming the whole
+// serialized model through one hash
+static uint64_t compute_weights_hash(const std::shared_ptr<const ov::Model>& model) {
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+    collect_constants(model, constants);
+
+    std::vector<uint64_t> constant_hashes(constants.size(), 0);
+    ov::parallel_for(constants.size(), [&](size_t idx) {
+        const auto byte_size = constants[idx]->get_byte_size();
+        const auto* data = static_cast<const uint8_t*>(constants[idx]->get_data_ptr());
+
+        uint64_t local_hash = hash_combine(0, byte_size);
+        const auto word_count = byte_size / sizeof(uint64_t);
+        const auto* words = reinterpret_cast<const uint64_t*>(data);
+        for (size_t i = 0; i < word_count; i++)
+            local_hash = hash_combine(local_hash, words[i]);
+        for (size_t i = word_count * sizeof(uint64_t); i < byte_size; i++)
+            local_hash = hash_combine(local_hash, data[i]);
+        constant_hashes[idx] = local_hash;
+    });
+
+    uint64_t seed = 0;
+    for (const auto& hash : constant_hashes)
+        seed = hash_combine(seed, hash);
+    return seed;
+}
+
 }  // namespace ov
 
 namespace ov {
@@ -69,11 +113,15 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     OPENVINO_ASSERT(model);
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate topology hash on function; constant payloads are skipped here and hashed
+    // per-Constant below, in parallel
     ov::pass::Manager m;
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(seed, true);
     m.run_passes(std::const_pointer_cast<ov::Model>(model));
 
+    // 1a. Weights hash
+    seed = ov::hash_combine(seed, compute_weights_hash(model));
+
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
         seed = ov::hash_combine(seed, kvp.first + kvp.second.as<std::string>());
@@ -4,8 +4,13 @@
 
 #include "openvino/runtime/compiled_model.hpp"
 
+#include <atomic>
+#include <mutex>
+
+#include "openvino/core/coordinate.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
 
 #define OV_COMPILED_MODEL_CALL_STATEMENT(...)                 \
@@ -128,6 +133,190 @@ InferRequest CompiledModel::create_infer_request() {
     OV_COMPILED_MODEL_CALL_STATEMENT(return {_impl->create_infer_request(), _so});
 }
 
+void CompiledModel::submit_batch(const std::vector<InferRequest>& requests,
+                                 const std::function<void(std::exception_ptr)>& on_complete) {
+    OV_COMPILED_MODEL_CALL_STATEMENT({
+        OPENVINO_ASSERT(!requests.empty(), "submit_batch expects at least one infer request");
+
+        struct BatchState {
+            std::atomic<size_t> remaining{0};
+            std::mutex mutex;
+            std::exception_ptr first_error = nullptr;
+            std::function<void(std::exception_ptr)> on_complete;
+        };
+        auto state = std::make_shared<BatchState>();
+        state->remaining = requests.size();
+        state->on_complete = on_complete;
+
+        auto complete_one = [state](std::exception_ptr error) {
+            if (error) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (!state->first_error)
+                    state->first_error = error;
+            }
+            if (state->remaining.fetch_sub(1) == 1 && state->on_complete) {
+                std::exception_ptr batch_error;
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    batch_error = state->first_error;
+                }
+                state->on_complete(batch_error);
+            }
+        };
+
+        // aggregate the per-request callbacks into a single completion notification
+        for (auto request : requests) {
+            request.set_callback(complete_one);
+        }
+        for (auto request : requests) {
+            try {
+                request.start_async();
+            } catch (...) {
+                // the callback does not fire for a request that failed to start,
+                // count it as completed so the aggregation is not left hanging
+                complete_one(std::current_exception());
+            }
+        }
+    });
+}
+
+void CompiledModel::infer_split_batch(InferRequest& request, size_t num_shards) {
+    OV_COMPILED_MODEL_CALL_STATEMENT({
+        const auto& in_ports = _impl->inputs();
+        const auto& out_ports = _impl->outputs();
+        OPENVINO_ASSERT(!in_ports.empty(), "infer_split_batch expects a model with at least one input");
+
+        // the split is structurally validated from the request tensors: the symbol based batch
+        // detection is bound to the original ov::Model, which a compiled model no longer holds
+        std::vector<Tensor> inputs;
+        inputs.reserve(in_ports.size());
+        size_t batch = 0;
+        for (size_t i = 0; i < in_ports.size(); i++) {
+            auto tensor = request.get_tensor(in_ports[i]);
+            const auto& shape = tensor.get_shape();
+            OPENVINO_ASSERT(!shape.empty(), "infer_split_batch cannot split the scalar input ", i);
+            if (i == 0)
+                batch = shape[0];
+            OPENVINO_ASSERT(shape[0] == batch,
+                            "infer_split_batch requires the same leading (batch) dimension on every input, "
+                            "but input 0 holds ",
+                            batch,
+                            " and input ",
+                            i,
+                            " holds ",
+                            shape[0]);
+            inputs.push_back(std::move(tensor));
+        }
+
+        // resolve the output shapes up front so the shards can write into zero-copy views of the
+        // merged output tensors
+        std::vector<Shape> out_shapes;
+        out_shapes.reserve(out_ports.size());
+        for (size_t i = 0; i < out_ports.size(); i++) {
+            const auto& pshape = out_ports[i].get_partial_shape();
+            OPENVINO_ASSERT(pshape.rank().is_static() && pshape.size() >= 1,
+                            "infer_split_batch cannot split output ",
+                            i,
+                            " with shape ",
+                            pshape);
+            Shape shape(pshape.size());
+            shape[0] = batch;
+            for (size_t d = 1; d < pshape.size(); d++) {
+                OPENVINO_ASSERT(pshape[d].is_static(),
+                                "infer_split_batch supports only static non-batch output dimensions, "
+                                "but output ",
+                                i,
+                                " has shape ",
+                                pshape);
+                shape[d] = pshape[d].get_length();
+            }
+            out_shapes.push_back(std::move(shape));
+        }
+
+        if (num_shards == 0)
+            num_shards = std::max<size_t>(get_property(ov::optimal_number_of_infer_requests), 1);
+        num_shards = std::min(num_shards, batch);
+        if (num_shards < 2) {
+            request.infer();
+            return;
+        }
+
+        std::vector<Tensor> outputs;
+        outputs.reserve(out_ports.size());
+        for (size_t i = 0; i < out_ports.size(); i++) {
+            auto tensor = request.get_tensor(out_ports[i]);
+            if (!tensor || tensor.get_shape() != out_shapes[i]) {
+                tensor = Tensor(out_ports[i].get_element_type(), out_shapes[i]);
+                request.set_tensor(out_ports[i], tensor);
+            }
+            outputs.push_back(std::move(tensor));
+        }
+
+        auto roi = [](const Tensor& tensor, size_t offset, size_t count) {
+            auto begin = Coordinate(tensor.get_shape().size(), 0);
+            auto end = Coordinate(tensor.get_shape());
+            begin[0] = offset;
+            end[0] = offset + count;
+            return Tensor(tensor, begin, end);
+        };
+
+        std::vector<InferRequest> shards;
+        shards.reserve(num_shards);
+        const size_t chunk = batch / num_shards;
+        const size_t remainder = batch % num_shards;
+        size_t offset = 0;
+        for (size_t n = 0; n < num_shards; n++) {
+            const size_t shard_batch = chunk + (n < remainder ? 1 : 0);
+            InferRequest shard(_impl->create_infer_request(), _so);
+            for (size_t i = 0; i < in_ports.size(); i++)
+                shard.set_tensor(in_ports[i], roi(inputs[i], offset, shard_batch));
+            for (size_t i = 0; i < out_ports.size(); i++)
+                shard.set_tensor(out_ports[i], roi(outputs[i], offset, shard_batch));
+            offset += shard_batch;
+            shards.push_back(std::move(shard));
+        }
+
+        // each shard is an ordinary request, so the device stream scheduler spreads the concurrent
+        // shards over the idle streams
+        std::exception_ptr error;
+        size_t started = 0;
+        for (auto& shard : shards) {
+            try {
+                shard.start_async();
+                started++;
+            } catch (...) {
+                error = std::current_exception();
+                break;
+            }
+        }
+        // the started shards write into views of the caller visible tensors, so they have to be
+        // drained even when the submission failed half way
+        for (size_t n = 0; n < started; n++) {
+            try {
+                shards[n].wait();
+            } catch (...) {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+        if (error)
+            std::rethrow_exception(error);
+    });
+}
+
+void CompiledModel::warmup(const std::vector<std::vector<ov::Shape>>& shape_set) {
+    OV_COMPILED_MODEL_CALL_STATEMENT(_impl->warmup(shape_set));
+}
+
+void CompiledModel::update_weights(const std::map<std::string, Tensor>& weights) {
+    OV_COMPILED_MODEL_CALL_STATEMENT({
+        std::map<std::string, ov::SoPtr<ov::ITensor>> impl_weights;
+        for (const auto& entry : weights)
+            impl_weights.emplace(entry.first, get_tensor_impl(entry.second));
+        _impl->update_weights(impl_weights);
+    });
+}
+
 void CompiledModel::export_model(std::ostream& networkModel) {
     OV_COMPILED_MODEL_CALL_STATEMENT(_impl->export_model(networkModel));
 }
@@ -138,6 +327,10 @@ void CompiledModel::set_property(const AnyMap& config) {
 
 Any CompiledModel::get_property(const std::string& name) const {
     OV_COMPILED_MODEL_CALL_STATEMENT({
+        // Compile telemetry is recorded by the core, so it is served here without
+        // involving the plugin specific property handlers
+        if (name == ov::compile_time_profile.name())
+            return Any(_impl->get_compile_time_profile());
         auto property = _impl->get_property(name);
         if (!property._so)
             property._so = _so;
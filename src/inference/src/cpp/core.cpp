@@ -96,6 +96,24 @@ std::shared_ptr<ov::Model> Core::read_model(const std::string& model, const ov::
     OV_CORE_CALL_STATEMENT(return _impl->read_model(model, weights););
 }
 
+std::shared_ptr<ov::Model> Core::read_model(std::istream& model, const ov::Tensor& weights) const {
+    OV_CORE_CALL_STATEMENT(return _impl->read_model(model, weights););
+}
+
+std::shared_future<std::shared_ptr<ov::Model>> Core::read_model_async(const std::string& model_path,
+                                                                      const std::string& bin_path) const {
+    OV_CORE_CALL_STATEMENT({
+        // The implementation is captured by value, so the future stays valid even if this Core
+        // object is destroyed before the read finishes
+        auto impl = _impl;
+        return std::async(std::launch::async,
+                          [impl, model_path, bin_path] {
+                              return impl->read_model(model_path, bin_path);
+                          })
+            .share();
+    });
+}
+
 CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model, const AnyMap& config) {
     return compile_model(model, ov::DEFAULT_DEVICE_NAME, config);
 }
@@ -109,6 +127,19 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
     });
 }
 
+std::vector<CompiledModel> Core::compile_models(const std::vector<std::shared_ptr<ov::Model>>& models,
+                                                const std::string& device_name,
+                                                const AnyMap& config) {
+    OV_CORE_CALL_STATEMENT({
+        auto execs = _impl->compile_models(models, device_name, config);
+        std::vector<CompiledModel> compiled_models;
+        compiled_models.reserve(execs.size());
+        for (auto& exec : execs)
+            compiled_models.emplace_back(CompiledModel{exec._ptr, exec._so});
+        return compiled_models;
+    });
+}
+
 CompiledModel Core::compile_model(const std::string& model_path, const AnyMap& config) {
     return compile_model(model_path, ov::DEFAULT_DEVICE_NAME, config);
 }
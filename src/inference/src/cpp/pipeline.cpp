@@ -0,0 +1,206 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/pipeline.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/infer_request.hpp"
+
+#define OV_PIPELINE_CALL_STATEMENT(...)                                 \
+    OPENVINO_ASSERT(m_impl != nullptr, "Pipeline was not initialized."); \
+    try {                                                               \
+        __VA_ARGS__;                                                    \
+    } catch (const std::exception& ex) {                                \
+        OPENVINO_THROW(ex.what());                                      \
+    } catch (...) {                                                     \
+        OPENVINO_THROW("Unexpected exception");                         \
+    }
+
+namespace ov {
+
+class Pipeline::Impl {
+public:
+    Impl(const std::vector<CompiledModel>& stages, size_t depth) : m_stages(stages) {
+        OPENVINO_ASSERT(!m_stages.empty(), "ov::Pipeline requires at least one compiled model");
+        OPENVINO_ASSERT(depth >= 1, "ov::Pipeline depth must be at least 1");
+        for (size_t i = 0; i + 1 < m_stages.size(); i++) {
+            const auto produced = m_stages[i].outputs().size();
+            const auto consumed = m_stages[i + 1].inputs().size();
+            OPENVINO_ASSERT(produced == consumed,
+                            "Pipeline stage ",
+                            i,
+                            " produces ",
+                            produced,
+                            " output(s) while stage ",
+                            i + 1,
+                            " consumes ",
+                            consumed,
+                            " input(s)");
+        }
+        m_num_inputs = m_stages.front().inputs().size();
+        m_num_outputs = m_stages.back().outputs().size();
+
+        m_slots.resize(depth);
+        for (auto& slot : m_slots) {
+            for (auto& stage : m_stages) {
+                slot.requests.push_back(stage.create_infer_request());
+            }
+            // share each stage's output tensors with the inputs of the next stage, so the
+            // intermediates stay where the producing device put them instead of being copied
+            // through user code
+            for (size_t i = 0; i + 1 < slot.requests.size(); i++) {
+                for (size_t port = 0; port < m_stages[i].outputs().size(); port++) {
+                    slot.requests[i + 1].set_input_tensor(port, slot.requests[i].get_output_tensor(port));
+                }
+            }
+            // the stages of one item are chained through the request callbacks, so an item
+            // advances through the pipeline without blocking the submission thread
+            for (size_t i = 0; i < slot.requests.size(); i++) {
+                auto* slot_ptr = &slot;
+                slot.requests[i].set_callback([this, slot_ptr, i](std::exception_ptr error) {
+                    on_stage_done(*slot_ptr, i, std::move(error));
+                });
+            }
+        }
+    }
+
+    ~Impl() {
+        // the callbacks reference this object, so no slot may stay in flight beyond this point
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] {
+            for (const auto& slot : m_slots) {
+                if (slot.state == Slot::State::InFlight)
+                    return false;
+            }
+            return true;
+        });
+    }
+
+    void start_async(const TensorVector& inputs) {
+        OPENVINO_ASSERT(inputs.size() == m_num_inputs,
+                        "ov::Pipeline expects ",
+                        m_num_inputs,
+                        " input tensor(s), got ",
+                        inputs.size());
+        auto& slot = m_slots[m_submitted % m_slots.size()];
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            // the slot of this ticket becomes free once its previous item has been collected
+            m_cv.wait(lock, [&slot] {
+                return slot.state == Slot::State::Free;
+            });
+            slot.state = Slot::State::InFlight;
+        }
+        m_submitted++;
+        for (size_t port = 0; port < inputs.size(); port++) {
+            slot.requests.front().set_input_tensor(port, inputs[port]);
+        }
+        slot.requests.front().start_async();
+    }
+
+    TensorVector get_results() {
+        OPENVINO_ASSERT(m_collected < m_submitted, "ov::Pipeline has no enqueued items to collect");
+        auto& slot = m_slots[m_collected % m_slots.size()];
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [&slot] {
+                return slot.state == Slot::State::Done;
+            });
+            error = slot.error;
+            slot.error = nullptr;
+        }
+        m_collected++;
+
+        TensorVector results;
+        if (!error) {
+            try {
+                // copy the final outputs out of the slot, which is re-armed for the next item below
+                auto& last = slot.requests.back();
+                for (size_t port = 0; port < m_num_outputs; port++) {
+                    const auto src = last.get_output_tensor(port);
+                    Tensor dst(src.get_element_type(), src.get_shape());
+                    src.copy_to(dst);
+                    results.push_back(std::move(dst));
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            slot.state = Slot::State::Free;
+            m_cv.notify_all();
+        }
+        if (error)
+            std::rethrow_exception(error);
+        return results;
+    }
+
+    TensorVector infer(const TensorVector& inputs) {
+        OPENVINO_ASSERT(m_submitted == m_collected,
+                        "ov::Pipeline::infer() cannot be used while start_async() items are pending");
+        start_async(inputs);
+        return get_results();
+    }
+
+private:
+    struct Slot {
+        enum class State { Free, InFlight, Done };
+        std::vector<InferRequest> requests;  // one per stage
+        State state = State::Free;
+        std::exception_ptr error;
+    };
+
+    void on_stage_done(Slot& slot, size_t stage, std::exception_ptr error) {
+        if (!error && stage + 1 < slot.requests.size()) {
+            try {
+                slot.requests[stage + 1].start_async();
+                return;
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        slot.state = Slot::State::Done;
+        slot.error = std::move(error);
+        m_cv.notify_all();
+    }
+
+    std::vector<CompiledModel> m_stages;
+    std::vector<Slot> m_slots;
+    size_t m_num_inputs = 0;
+    size_t m_num_outputs = 0;
+    size_t m_submitted = 0;
+    size_t m_collected = 0;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+Pipeline::Pipeline(const std::vector<CompiledModel>& stages, size_t depth) {
+    try {
+        m_impl = std::make_shared<Impl>(stages, depth);
+    } catch (const std::exception& ex) {
+        OPENVINO_THROW(ex.what());
+    } catch (...) {
+        OPENVINO_THROW("Unexpected exception");
+    }
+}
+
+TensorVector Pipeline::infer(const TensorVector& inputs) {
+    OV_PIPELINE_CALL_STATEMENT(return m_impl->infer(inputs));
+}
+
+void Pipeline::start_async(const TensorVector& inputs) {
+    OV_PIPELINE_CALL_STATEMENT(m_impl->start_async(inputs));
+}
+
+TensorVector Pipeline::get_results() {
+    OV_PIPELINE_CALL_STATEMENT(return m_impl->get_results());
+}
+
+}  // namespace ov
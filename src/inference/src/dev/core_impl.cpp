@@ -4,18 +4,26 @@
 
 #include "core_impl.hpp"
 
+#include <chrono>
+#include <cstring>
 #include <memory>
+#include <thread>
 
 #include "check_network_batchable.hpp"
 #include "compilation_context.hpp"
 #include "itt.hpp"
 #include "model_reader.hpp"
 #include "openvino/core/any.hpp"
+#include "openvino/core/compile_time_profile.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/graph_util.hpp"
 #include "openvino/core/op_extension.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/core/rt_info.hpp"
 #include "openvino/core/so_extension.hpp"
 #include "openvino/core/version.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/opsets/opset.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/runtime/device_id_parser.hpp"
@@ -24,6 +32,8 @@
 #include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/remote_context.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
@@ -57,6 +67,23 @@ void allowNotImplemented(F&& f) {
     }
 }
 
+// Attaches the compile-time telemetry collected on this thread to the compiled model,
+// adding the total duration of the Core::compile_model call under "core::compile_model".
+// No-op for a nested compilation: its scope does not own the accumulator and the data
+// stays with the outermost call.
+void attach_compile_time_profile(const ov::SoPtr<ov::ICompiledModel>& compiled_model,
+                                 ov::util::CompileTimeProfileScope& profile_scope,
+                                 std::chrono::steady_clock::time_point compile_start) {
+    if (!compiled_model)
+        return;
+    auto profile = profile_scope.take();
+    if (profile.empty())
+        return;
+    profile["core::compile_model"] =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - compile_start).count();
+    compiled_model->set_compile_time_profile(std::move(profile));
+}
+
 void stripDeviceName(std::string& device, const std::string& substr) {
     auto pos = device.find(substr);
     if (pos == 0) {
@@ -88,8 +115,8 @@ bool is_virtual_device(const std::string& device_name) {
  * @param user_properties Original set of properties
  * @return ov::AnyMap Flattened ov::AnyMap with properties
  */
-ov::AnyMap flatten_sub_properties(const std::string& user_device_name, const ov::AnyMap& user_properties) {
-    ov::AnyMap result_properties = user_properties;
+ov::AnyMap flatten_sub_properties(const std::string& user_device_name, ov::AnyMap user_properties) {
+    ov::AnyMap result_properties = std::move(user_properties);
 
     // puts sub-property to result_properties if it's not there yet
     auto update_result_properties = [&result_properties](const ov::AnyMap& sub_properties) -> void {
@@ -204,6 +231,78 @@ void clean_batch_properties(const std::string& deviceName, ov::AnyMap& config, c
         }
     }
 }
+
+// Weak content hash; candidates with the same hash are always confirmed with a byte comparison
+// (same approach as the constant writer in ov::pass::Serialize)
+size_t constant_data_hash(const char* data, size_t size) {
+    constexpr size_t p = 1000000007;
+    size_t hash = size;
+    for (size_t i = 0; i < size; ++i)
+        hash = hash * 58 + static_cast<size_t>(static_cast<unsigned char>(data[i])) * p;
+    return hash;
+}
+
+void collect_constants(const std::shared_ptr<ov::Model>& model,
+                       std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants) {
+    for (const auto& op : model->get_ordered_ops()) {
+        if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            constants.push_back(constant);
+        } else if (auto multi_subgraph_op = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& body : multi_subgraph_op->get_functions())
+                collect_constants(body, constants);
+        }
+    }
+}
+
+// Rewrites Constants with identical content to share one backing allocation across all given
+// models, so fleets of models built from the same base weights keep a single copy of them
+void deduplicate_constants(const std::vector<std::shared_ptr<ov::Model>>& models) {
+    // Small constants are cheaper to keep than to track
+    constexpr size_t min_constant_byte_size = 1024;
+
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+    for (const auto& model : models)
+        collect_constants(model, constants);
+
+    std::unordered_multimap<size_t, std::shared_ptr<ov::op::v0::Constant>> canonical;
+    for (const auto& constant : constants) {
+        const auto byte_size = constant->get_byte_size();
+        if (byte_size < min_constant_byte_size)
+            continue;
+        const auto* data = static_cast<const char*>(constant->get_data_ptr());
+        const auto hash = constant_data_hash(data, byte_size);
+
+        bool replaced = false;
+        const auto candidates = canonical.equal_range(hash);
+        for (auto it = candidates.first; it != candidates.second; ++it) {
+            const auto& candidate = it->second;
+            if (candidate->get_byte_size() != byte_size)
+                continue;
+            const auto* candidate_data = static_cast<const char*>(candidate->get_data_ptr());
+            if (candidate_data == data) {
+                replaced = true;  // already shares the canonical allocation
+                break;
+            }
+            if (std::memcmp(candidate_data, data, byte_size) != 0)
+                continue;
+            // The shared buffer keeps the canonical constant (and so its allocation) alive
+            auto shared_data = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::op::v0::Constant>>>(
+                const_cast<char*>(candidate_data),
+                byte_size,
+                candidate);
+            auto replacement = std::make_shared<ov::op::v0::Constant>(constant->get_element_type(),
+                                                                      constant->get_shape(),
+                                                                      shared_data);
+            replacement->set_friendly_name(constant->get_friendly_name());
+            ov::copy_runtime_info(constant, replacement);
+            ov::replace_node(constant, replacement);
+            replaced = true;
+            break;
+        }
+        if (!replaced)
+            canonical.emplace(hash, constant);
+    }
+}
 }  // namespace
 
 bool ov::is_config_applicable(const std::string& user_device_name, const std::string& subprop_device_name) {
@@ -238,9 +337,7 @@ bool ov::is_config_applicable(const std::string& user_device_name, const std::st
     return false;
 }
 
-ov::Parsed ov::parseDeviceNameIntoConfig(const std::string& deviceName,
-                                         const AnyMap& config,
-                                         const bool keep_core_property) {
+ov::Parsed ov::parseDeviceNameIntoConfig(const std::string& deviceName, AnyMap config, const bool keep_core_property) {
     // check to the validity of device name
     auto bracket_pos = deviceName.find(")");
     while (bracket_pos != std::string::npos) {
@@ -251,7 +348,7 @@ ov::Parsed ov::parseDeviceNameIntoConfig(const std::string& deviceName,
         bracket_pos = deviceName.find(")", bracket_pos + 1);
     }
 
-    auto updated_config = config;
+    auto updated_config = std::move(config);
     auto updated_device_name = deviceName;
 
     /** Note: auto-batching is already applied by this time, so the call:
@@ -268,7 +365,7 @@ ov::Parsed ov::parseDeviceNameIntoConfig(const std::string& deviceName,
      * 'flatten_sub_properties' call to have proper behavior
      */
 
-    updated_config = flatten_sub_properties(deviceName, updated_config);
+    updated_config = flatten_sub_properties(deviceName, std::move(updated_config));
     std::string parsed_device_priority;
 
     // try to find ':' to extract name of virtual device
@@ -307,7 +404,7 @@ ov::Parsed ov::parseDeviceNameIntoConfig(const std::string& deviceName,
         clean_batch_properties(updated_device_name, updated_config, ov::auto_batch_timeout);
     }
 
-    return {updated_device_name, updated_config};
+    return {std::move(updated_device_name), std::move(updated_config)};
 }
 
 ov::CoreImpl::CoreImpl() {
@@ -316,6 +413,12 @@ ov::CoreImpl::CoreImpl() {
     for (const auto& it : ov::get_available_opsets()) {
         opsetNames.insert(it.first);
     }
+    // Core cannot deserialize IR itself, so back the opt-in transformed-model cache
+    // in pass::Manager with the frontend-based reader
+    ov::pass::Manager::set_cached_model_loader(
+        [](const std::string& xml_path, const std::string& bin_path) -> std::shared_ptr<ov::Model> {
+            return ov::util::read_model(xml_path, bin_path, {}, false);
+        });
 }
 
 bool ov::CoreImpl::is_proxy_device(const ov::Plugin& plugin) const {
@@ -720,12 +823,14 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
                                                           const std::string& device_name,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::LoadTime, "Core::compile_model::model");
+    ov::util::CompileTimeProfileScope profile_scope;
+    const auto compile_start = std::chrono::steady_clock::now();
     std::string deviceName = device_name;
     ov::AnyMap config_with_batch = config;
     // if auto-batching is applicable, the below function will patch the device name and config accordingly:
     auto model = apply_auto_batching(model_, deviceName, config_with_batch);
 
-    auto parsed = parseDeviceNameIntoConfig(deviceName, config_with_batch, is_proxy_device(device_name));
+    auto parsed = parseDeviceNameIntoConfig(deviceName, std::move(config_with_batch), is_proxy_device(device_name));
     auto plugin = get_plugin(parsed._deviceName);
     ov::SoPtr<ov::ICompiledModel> res;
     auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
@@ -733,6 +838,10 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     if (cacheManager && device_supports_model_caching(plugin) && !is_proxy_device(plugin)) {
         CacheContent cacheContent{cacheManager};
         cacheContent.blobId = ov::ModelCache::compute_hash(model, create_compile_config(plugin, parsed._config));
+        cacheContent.mmapEnabled = coreConfig.get_enable_mmap();
+        // Start blob readahead before the hash lock: the I/O overlaps with a concurrent
+        // compilation of the same model and with the import preparations below
+        cacheContent.cacheManager->prefetch_cache_entry(cacheContent.blobId);
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         res = load_model_from_cache(cacheContent, plugin, parsed._config, ov::SoPtr<ov::IRemoteContext>{}, [&]() {
             return compile_model_and_cache(plugin,
@@ -744,6 +853,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     } else {
         res = plugin.compile_model(model, parsed._config);
     }
+    attach_compile_time_profile(res, profile_scope, compile_start);
     return res;
 }
 
@@ -751,6 +861,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
                                                           const ov::SoPtr<ov::IRemoteContext>& context,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::LoadTime, "Core::compile_model::RemoteContext");
+    ov::util::CompileTimeProfileScope profile_scope;
+    const auto compile_start = std::chrono::steady_clock::now();
     if (!context)
         OPENVINO_THROW("Remote context is null");
     std::string deviceName = context->get_device_name();
@@ -758,7 +870,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     // if auto-batching is applicable, the below function will patch the device name and config accordingly:
     auto model = apply_auto_batching(model_, deviceName, config_with_batch);
 
-    auto parsed = parseDeviceNameIntoConfig(deviceName, config_with_batch, is_proxy_device(deviceName));
+    auto parsed = parseDeviceNameIntoConfig(deviceName, std::move(config_with_batch), is_proxy_device(deviceName));
     auto plugin = get_plugin(parsed._deviceName);
     ov::SoPtr<ov::ICompiledModel> res;
     auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
@@ -766,6 +878,10 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     if (cacheManager && device_supports_model_caching(plugin) && !is_proxy_device(plugin)) {
         CacheContent cacheContent{cacheManager};
         cacheContent.blobId = ov::ModelCache::compute_hash(model, create_compile_config(plugin, parsed._config));
+        cacheContent.mmapEnabled = coreConfig.get_enable_mmap();
+        // Start blob readahead before the hash lock: the I/O overlaps with a concurrent
+        // compilation of the same model and with the import preparations below
+        cacheContent.cacheManager->prefetch_cache_entry(cacheContent.blobId);
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         res = load_model_from_cache(cacheContent, plugin, parsed._config, context, [&]() {
             return compile_model_and_cache(plugin, model, parsed._config, context, cacheContent);
@@ -773,6 +889,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     } else {
         res = plugin.compile_model(model, context, parsed._config);
     }
+    attach_compile_time_profile(res, profile_scope, compile_start);
     return res;
 }
 
@@ -780,6 +897,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
                                                           const std::string& device_name,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::LoadTime, "Core::compile_model::Path");
+    ov::util::CompileTimeProfileScope profile_scope;
+    const auto compile_start = std::chrono::steady_clock::now();
     auto parsed = parseDeviceNameIntoConfig(device_name, config);
     // in case of compile_model(file_name), we need to clear-up core-level properties
     auto plugin = get_plugin(parsed._deviceName);
@@ -791,15 +910,25 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
         // Skip caching for proxy plugin. HW plugin will load network from the cache
         CacheContent cacheContent{cacheManager, model_path};
         cacheContent.blobId = ov::ModelCache::compute_hash(model_path, create_compile_config(plugin, parsed._config));
+        cacheContent.mmapEnabled = coreConfig.get_enable_mmap();
+        // Start blob readahead before the hash lock: the I/O overlaps with a concurrent
+        // compilation of the same model and with the import preparations below
+        cacheContent.cacheManager->prefetch_cache_entry(cacheContent.blobId);
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         compiled_model =
             load_model_from_cache(cacheContent, plugin, parsed._config, ov::SoPtr<ov::IRemoteContext>{}, [&]() {
+                const auto read_start = std::chrono::steady_clock::now();
                 auto model = read_model(model_path, std::string{});
+                ov::util::compile_time_profile_add(
+                    "core::read_model",
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                         read_start));
                 return compile_model_and_cache(plugin, model, parsed._config, {}, cacheContent);
             });
     } else {
         compiled_model = plugin.compile_model(model_path, parsed._config);
     }
+    attach_compile_time_profile(compiled_model, profile_scope, compile_start);
     return compiled_model;
 }
 
@@ -808,6 +937,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
                                                           const std::string& device_name,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::OV, "Core::compile_model::from_memory");
+    ov::util::CompileTimeProfileScope profile_scope;
+    const auto compile_start = std::chrono::steady_clock::now();
     auto parsed = parseDeviceNameIntoConfig(device_name, config);
     // in case of compile_model(file_name), we need to clear-up core-level properties
     auto plugin = get_plugin(parsed._deviceName);
@@ -819,10 +950,19 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
         CacheContent cacheContent{cacheManager};
         cacheContent.blobId =
             ov::ModelCache::compute_hash(model_str, weights, create_compile_config(plugin, parsed._config));
+        cacheContent.mmapEnabled = coreConfig.get_enable_mmap();
+        // Start blob readahead before the hash lock: the I/O overlaps with a concurrent
+        // compilation of the same model and with the import preparations below
+        cacheContent.cacheManager->prefetch_cache_entry(cacheContent.blobId);
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         compiled_model =
             load_model_from_cache(cacheContent, plugin, parsed._config, ov::SoPtr<ov::IRemoteContext>{}, [&]() {
+                const auto read_start = std::chrono::steady_clock::now();
                 auto model = read_model(model_str, weights);
+                ov::util::compile_time_profile_add(
+                    "core::read_model",
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                         read_start));
                 return compile_model_and_cache(plugin,
                                                model,
                                                parsed._config,
@@ -830,12 +970,48 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
                                                cacheContent);
             });
     } else {
+        const auto read_start = std::chrono::steady_clock::now();
         auto model = read_model(model_str, weights);
+        ov::util::compile_time_profile_add(
+            "core::read_model",
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - read_start));
         compiled_model = plugin.compile_model(model, parsed._config);
     }
+    attach_compile_time_profile(compiled_model, profile_scope, compile_start);
     return compiled_model;
 }
 
+std::vector<ov::SoPtr<ov::ICompiledModel>> ov::CoreImpl::compile_models(
+    const std::vector<std::shared_ptr<ov::Model>>& models,
+    const std::string& device_name,
+    const ov::AnyMap& config) const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::OV, "Core::compile_models");
+    deduplicate_constants(models);
+
+    std::vector<ov::SoPtr<ov::ICompiledModel>> compiled_models(models.size());
+    std::vector<std::exception_ptr> errors(models.size());
+    std::vector<ov::threading::Task> tasks;
+    tasks.reserve(models.size());
+    for (size_t i = 0; i < models.size(); ++i) {
+        tasks.emplace_back([&, i] {
+            try {
+                compiled_models[i] = compile_model(models[i], device_name, config);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    // One stream per model; the executor is local, so its threads are released once all
+    // compilations finished
+    auto executor = std::make_shared<ov::threading::CPUStreamsExecutor>(
+        ov::threading::IStreamsExecutor::Config{"CoreCompileModels", static_cast<int>(models.size())});
+    executor->run_and_wait(tasks);
+    for (const auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+    return compiled_models;
+}
+
 ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::import_model(std::istream& model,
                                                          const std::string& device_name,
                                                          const ov::AnyMap& config) const {
@@ -858,7 +1034,23 @@ ov::SupportedOpsMap ov::CoreImpl::query_model(const std::shared_ptr<const ov::Mo
                                               const ov::AnyMap& config) const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::OV, "Core::query_model");
     auto parsed = parseDeviceNameIntoConfig(device_name, config);
-    return get_plugin(parsed._deviceName).query_model(model, parsed._config);
+    auto plugin = get_plugin(parsed._deviceName);
+    // the capability analysis is deterministic for a given model, device and config, so repeated
+    // queries (e.g. a routing layer probing many model variants at startup) reuse the memoized result
+    const auto key =
+        parsed._deviceName + "_" + ov::ModelCache::compute_hash(model, create_compile_config(plugin, parsed._config));
+    {
+        std::lock_guard<std::mutex> lock(queryModelCacheMutex);
+        auto it = queryModelCache.find(key);
+        if (it != queryModelCache.end())
+            return it->second;
+    }
+    auto res = plugin.query_model(model, parsed._config);
+    {
+        std::lock_guard<std::mutex> lock(queryModelCacheMutex);
+        queryModelCache[key] = res;
+    }
+    return res;
 }
 
 bool ov::CoreImpl::is_hidden_device(const std::string& device_name) const {
@@ -882,8 +1074,28 @@ bool ov::CoreImpl::is_hidden_device(const std::string& device_name) const {
 std::vector<std::string> ov::CoreImpl::get_available_devices() const {
     std::vector<std::string> devices;
     const std::string propertyName = ov::available_devices.name();
+    const auto registeredDevices = get_registered_devices();
+
+    // Load the plugins in parallel first: get_plugin() serializes per device, not globally, so the
+    // shared object loading and initialization of independent plugins overlap instead of paying the
+    // sum of all load times. Failures are swallowed here and reported by the per-device query
+    // below, which keeps the original error behavior.
+    std::vector<std::thread> pluginLoaders;
+    for (auto&& deviceName : registeredDevices) {
+        if (is_hidden_device(deviceName))
+            continue;
+        pluginLoaders.emplace_back([&, deviceName] {
+            try {
+                get_plugin(deviceName);
+            } catch (...) {
+            }
+        });
+    }
+    for (auto& loader : pluginLoaders) {
+        loader.join();
+    }
 
-    for (auto&& deviceName : get_registered_devices()) {
+    for (auto&& deviceName : registeredDevices) {
         std::vector<std::string> devicesIDs;
         // Skip hidden devices
         if (is_hidden_device(deviceName))
@@ -1117,8 +1329,13 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     if (name == ov::force_tbb_terminate.name()) {
         const auto flag = ov::threading::executor_manager()->get_property(name).as<bool>();
         return decltype(ov::force_tbb_terminate)::value_type(flag);
+    } else if (name == ov::enable_work_stealing.name()) {
+        const auto flag = ov::threading::executor_manager()->get_property(name).as<bool>();
+        return decltype(ov::enable_work_stealing)::value_type(flag);
     } else if (name == ov::cache_dir.name()) {
         return ov::Any(coreConfig.get_cache_dir());
+    } else if (name == ov::cache_max_size.name()) {
+        return decltype(ov::cache_max_size)::value_type(coreConfig.get_cache_max_size());
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
@@ -1242,10 +1459,22 @@ void ov::CoreImpl::set_property_for_device(const ov::AnyMap& configMap, const st
                 config.erase(it);
             }
 
+            it = config.find(ov::enable_work_stealing.name());
+            if (it != config.end()) {
+                auto flag = it->second.as<bool>();
+                ov::threading::executor_manager()->set_property({{it->first, flag}});
+                config.erase(it);
+            }
+
             it = config.find(ov::enable_mmap.name());
             if (it != config.end()) {
                 config.erase(it);
             }
+
+            it = config.find(ov::cache_max_size.name());
+            if (it != config.end()) {
+                config.erase(it);
+            }
         }
 
         if (!config.empty()) {
@@ -1398,41 +1627,57 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
 
     OPENVINO_ASSERT(cacheContent.cacheManager != nullptr);
     try {
-        cacheContent.cacheManager->read_cache_entry(cacheContent.blobId, [&](std::istream& networkStream) {
-            OV_ITT_SCOPE(FIRST_INFERENCE,
-                         ov::itt::domains::LoadTime,
-                         "Core::load_model_from_cache::ReadStreamAndImport");
-            try {
-                ov::CompiledBlobHeader header;
-                networkStream >> header;
-                if (header.getFileInfo() != ov::ModelCache::calculate_file_info(cacheContent.modelPath)) {
-                    // Original file is changed, don't use cache
-                    OPENVINO_THROW("Original model file is changed");
-                }
-                if (util::contains(plugin.get_property(ov::internal::supported_properties),
-                                   ov::internal::compiled_model_runtime_properties_supported.name())) {
-                    ov::AnyMap compiled_model_runtime_properties = {
-                        {ov::internal::compiled_model_runtime_properties.name(), std::string(header.getRuntimeInfo())}};
-                    auto res = plugin.get_property(ov::internal::compiled_model_runtime_properties_supported.name(),
-                                                   compiled_model_runtime_properties);
-                    if (!res.as<bool>()) {
-                        OPENVINO_THROW("Original model runtime properties have been changed, not supported anymore!");
+        cacheContent.cacheManager->read_cache_entry(
+            cacheContent.blobId,
+            cacheContent.mmapEnabled,
+            [&](std::istream& networkStream, const ov::Tensor& blob) {
+                OV_ITT_SCOPE(FIRST_INFERENCE,
+                             ov::itt::domains::LoadTime,
+                             "Core::load_model_from_cache::ReadStreamAndImport");
+                try {
+                    ov::CompiledBlobHeader header;
+                    networkStream >> header;
+                    if (header.getFileInfo() != ov::ModelCache::calculate_file_info(cacheContent.modelPath)) {
+                        // Original file is changed, don't use cache
+                        OPENVINO_THROW("Original model file is changed");
                     }
-                } else {
-                    if (header.getIeVersion() != ov::get_openvino_version().buildNumber) {
-                        // Build number mismatch, don't use this cache
-                        OPENVINO_THROW("Version does not match");
+                    if (util::contains(plugin.get_property(ov::internal::supported_properties),
+                                       ov::internal::compiled_model_runtime_properties_supported.name())) {
+                        ov::AnyMap compiled_model_runtime_properties = {
+                            {ov::internal::compiled_model_runtime_properties.name(),
+                             std::string(header.getRuntimeInfo())}};
+                        auto res =
+                            plugin.get_property(ov::internal::compiled_model_runtime_properties_supported.name(),
+                                                compiled_model_runtime_properties);
+                        if (!res.as<bool>()) {
+                            OPENVINO_THROW(
+                                "Original model runtime properties have been changed, not supported anymore!");
+                        }
+                    } else {
+                        if (header.getIeVersion() != ov::get_openvino_version().buildNumber) {
+                            // Build number mismatch, don't use this cache
+                            OPENVINO_THROW("Version does not match");
+                        }
                     }
+                } catch (...) {
+                    throw HeaderException();
                 }
-            } catch (...) {
-                throw HeaderException();
-            }
 
-            ov::AnyMap update_config = config;
-            update_config[ov::loaded_from_cache.name()] = true;
-            compiled_model = context ? plugin.import_model(networkStream, context, update_config)
-                                     : plugin.import_model(networkStream, update_config);
-        });
+                ov::AnyMap update_config = config;
+                update_config[ov::loaded_from_cache.name()] = true;
+                if (!cacheContent.modelPath.empty() &&
+                    util::contains(plugin.get_property(ov::internal::supported_properties),
+                                   ov::internal::cached_model_path.name())) {
+                    // Let plugins with weightless blobs resolve the original weights file
+                    update_config[ov::internal::cached_model_path.name()] = cacheContent.modelPath;
+                }
+                if (blob) {
+                    // Let the plugin adopt the mapped blob zero-copy instead of copying the stream
+                    update_config[ov::internal::cached_model_buffer.name()] = blob;
+                }
+                compiled_model = context ? plugin.import_model(networkStream, context, update_config)
+                                         : plugin.import_model(networkStream, update_config);
+            });
     } catch (const HeaderException&) {
         // For these exceptions just remove old cache and set that import didn't work
         cacheContent.cacheManager->remove_cache_entry(cacheContent.blobId);
@@ -1485,14 +1730,28 @@ ov::AnyMap ov::CoreImpl::create_compile_config(const ov::Plugin& plugin, const o
 }
 
 void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
-    auto it = config.find(ov::cache_dir.name());
+    auto it = config.find(ov::cache_max_size.name());
+    if (it != config.end()) {
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        _cacheMaxSize = it->second.as<uint64_t>();
+        // apply the new budget to already created cache managers
+        if (_cacheConfig._cacheManager)
+            _cacheConfig._cacheManager->set_max_cache_size(_cacheMaxSize);
+        for (auto& deviceCfg : _cacheConfigPerDevice) {
+            if (deviceCfg.second._cacheManager)
+                deviceCfg.second._cacheManager->set_max_cache_size(_cacheMaxSize);
+        }
+        config.erase(it);
+    }
+
+    it = config.find(ov::cache_dir.name());
     if (it != config.end()) {
         std::lock_guard<std::mutex> lock(_cacheConfigMutex);
         // fill global cache config
-        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cacheMaxSize);
         // sets cache config per-device if it's not set explicitly before
         for (auto& deviceCfg : _cacheConfigPerDevice) {
-            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cacheMaxSize);
         }
         config.erase(it);
     }
@@ -1504,6 +1763,13 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
         config.erase(it);
     }
 
+    it = config.find(ov::enable_work_stealing.name());
+    if (it != config.end()) {
+        auto flag = it->second.as<bool>();
+        ov::threading::executor_manager()->set_property({{it->first, flag}});
+        config.erase(it);
+    }
+
     it = config.find(ov::enable_mmap.name());
     if (it != config.end()) {
         auto flag = it->second.as<bool>();
@@ -1514,7 +1780,7 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
 
 void ov::CoreImpl::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
     std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir);
+    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir, _cacheMaxSize);
 }
 
 std::string ov::CoreImpl::CoreConfig::get_cache_dir() const {
@@ -1522,6 +1788,11 @@ std::string ov::CoreImpl::CoreConfig::get_cache_dir() const {
     return _cacheConfig._cacheDir;
 }
 
+uint64_t ov::CoreImpl::CoreConfig::get_cache_max_size() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    return _cacheMaxSize;
+}
+
 bool ov::CoreImpl::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
@@ -1534,7 +1805,7 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     // cache_dir is enabled locally in compile_model only
     if (parsedConfig.count(ov::cache_dir.name())) {
         auto cache_dir_val = parsedConfig.at(ov::cache_dir.name()).as<std::string>();
-        auto tempConfig = CoreConfig::CacheConfig::create(cache_dir_val);
+        auto tempConfig = CoreConfig::CacheConfig::create(cache_dir_val, _cacheMaxSize);
         // if plugin does not explicitly support cache_dir, and if plugin is not virtual, we need to remove
         // it from config
         if (!util::contains(plugin.get_property(ov::supported_properties), ov::cache_dir) &&
@@ -1552,12 +1823,14 @@ ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config
     }
 }
 
-ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::CacheConfig::create(const std::string& dir) {
+ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::CacheConfig::create(const std::string& dir,
+                                                                                    uint64_t max_cache_size) {
     std::shared_ptr<ov::ICacheManager> cache_manager = nullptr;
 
     if (!dir.empty()) {
         ov::util::create_directory_recursive(dir);
         cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir);
+        cache_manager->set_max_cache_size(max_cache_size);
     }
 
     return {dir, cache_manager};
@@ -1589,6 +1862,11 @@ std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& model,
     return ov::util::read_model(model, weights, extensions, frontendMode);
 }
 
+std::shared_ptr<ov::Model> ov::CoreImpl::read_model(std::istream& model, const ov::Tensor& weights) const {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "CoreImpl::read_model from stream");
+    return ov::util::read_model(model, weights, extensions);
+}
+
 std::map<std::string, ov::Version> ov::CoreImpl::get_versions(const std::string& deviceName) const {
     std::map<std::string, ov::Version> versions;
     std::vector<std::string> deviceNames;
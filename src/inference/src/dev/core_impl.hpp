@@ -27,9 +27,7 @@ struct Parsed {
     AnyMap _config;
 };
 
-Parsed parseDeviceNameIntoConfig(const std::string& deviceName,
-                                 const AnyMap& config = {},
-                                 const bool keep_core_property = false);
+Parsed parseDeviceNameIntoConfig(const std::string& deviceName, AnyMap config = {}, const bool keep_core_property = false);
 
 /**
  * @brief Checks whether config is applicable for device with 'device_name'
@@ -67,7 +65,7 @@ private:
             std::string _cacheDir;
             std::shared_ptr<ov::ICacheManager> _cacheManager;
 
-            static CacheConfig create(const std::string& dir);
+            static CacheConfig create(const std::string& dir, uint64_t max_cache_size = 0);
         };
 
         /**
@@ -81,6 +79,8 @@ private:
 
         std::string get_cache_dir() const;
 
+        uint64_t get_cache_max_size() const;
+
         bool get_enable_mmap() const;
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -92,6 +92,8 @@ private:
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
         bool _flag_enable_mmap = true;
+        // Size budget for the cache directory, see ov::cache_max_size; 0 means unlimited
+        uint64_t _cacheMaxSize = 0;
     };
 
     struct CacheContent {
@@ -102,6 +104,8 @@ private:
         std::shared_ptr<ov::ICacheManager> cacheManager;
         std::string blobId = {};
         std::string modelPath = {};
+        // Allow the cache manager to memory map the blob on read, see CoreConfig::get_enable_mmap()
+        bool mmapEnabled = false;
     };
 
     // Core settings (cache config, etc)
@@ -143,6 +147,10 @@ private:
 
     std::map<std::string, PluginDescriptor> pluginRegistry;
 
+    // memoized query_model() results keyed by device name and model/config hash, see query_model()
+    mutable std::map<std::string, ov::SupportedOpsMap> queryModelCache;
+    mutable std::mutex queryModelCacheMutex;
+
     ov::SoPtr<ov::ICompiledModel> compile_model_and_cache(ov::Plugin& plugin,
                                                           const std::shared_ptr<const ov::Model>& model,
                                                           const ov::AnyMap& parsedConfig,
@@ -252,6 +260,8 @@ public:
 
     std::shared_ptr<ov::Model> read_model(const std::string& model_path, const std::string& bin_path) const override;
 
+    std::shared_ptr<ov::Model> read_model(std::istream& model, const ov::Tensor& weights) const override;
+
     ov::SoPtr<ov::ICompiledModel> compile_model(const std::shared_ptr<const ov::Model>& model,
                                                 const std::string& device_name,
                                                 const ov::AnyMap& config = {}) const override;
@@ -269,6 +279,23 @@ public:
                                                 const std::string& device_name,
                                                 const ov::AnyMap& config) const override;
 
+    /**
+     * @brief Compiles several models for the same device concurrently
+     *
+     * Before compilation, Constants with identical content are rewritten to share one backing
+     * allocation across all given models, so fleets of models built from the same base weights
+     * don't duplicate them per compiled model. The models are modified in place.
+     *
+     * @param models Models to compile; entries are compiled through the regular compile_model flow
+     *        (including the model cache)
+     * @param device_name Name of a device to compile the models for
+     * @param config Optional map of pairs: (property name, property value) relevant only for this load operation
+     * @return Compiled models in the same order as `models`
+     */
+    std::vector<ov::SoPtr<ov::ICompiledModel>> compile_models(const std::vector<std::shared_ptr<ov::Model>>& models,
+                                                              const std::string& device_name,
+                                                              const ov::AnyMap& config = {}) const;
+
     ov::SoPtr<ov::ICompiledModel> import_model(std::istream& model,
                                                const std::string& device_name = {},
                                                const ov::AnyMap& config = {}) const override;
@@ -4,10 +4,13 @@
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 
+#include <chrono>
 #include <memory>
 
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/itrace_sink.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
+#include "openvino/runtime/replay_capture.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/variable_state.hpp"
@@ -37,16 +40,16 @@ ov::IAsyncInferRequest::IAsyncInferRequest(const std::shared_ptr<IInferRequest>&
       m_callback_executor(callback_executor) {
     if (m_request_executor && m_sync_request)
         m_pipeline = {{m_request_executor, [this] {
-                           m_sync_request->infer();
+                           run_timed_infer();
                        }}};
     if (m_sync_request)
         m_sync_pipeline = {{std::make_shared<ov::threading::ImmediateExecutor>(), [this] {
-                                m_sync_request->infer();
+                                run_timed_infer();
                             }}};
     auto streams_executor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_request_executor);
     if (streams_executor != nullptr) {
         m_sync_pipeline = {{std::make_shared<ImmediateStreamsExecutor>(std::move(streams_executor)), [this] {
-                                m_sync_request->infer();
+                                run_timed_infer();
                             }}};
     }
 }
@@ -107,9 +110,49 @@ void ov::IAsyncInferRequest::infer_thread_unsafe() {
 }
 
 void ov::IAsyncInferRequest::start_async_thread_unsafe() {
+    if (should_run_inline()) {
+        // Already on a stream of the request executor and the model runs well under a millisecond:
+        // run the whole pipeline on this thread, as the two executor hops would cost a visible share
+        // of the inference itself. The null callback executor makes the completion callback run
+        // inline as well.
+        run_first_stage(m_sync_pipeline.begin(), m_sync_pipeline.end(), nullptr);
+        return;
+    }
     run_first_stage(m_pipeline.begin(), m_pipeline.end(), m_callback_executor);
 }
 
+bool ov::IAsyncInferRequest::should_run_inline() const {
+    // engage only for sub-millisecond models, longer ones amortize the hops and
+    // benefit from releasing the calling thread early
+    constexpr int64_t inline_threshold_us = 1000;
+    const auto mean_us = m_mean_infer_us.load(std::memory_order_relaxed);
+    if (mean_us < 0 || mean_us >= inline_threshold_us)
+        return false;
+    // a derived class may have installed a multi-stage pipeline, keep its executor assignment
+    if (m_pipeline.size() != 1 || m_sync_pipeline.size() != 1)
+        return false;
+    const auto streams_executor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_request_executor);
+    return streams_executor != nullptr && streams_executor->is_stream_thread();
+}
+
+void ov::IAsyncInferRequest::run_timed_infer() {
+    // no-op unless a trace sink is installed; emits the request span on scope exit
+    ov::trace::RequestSpan trace_span;
+    const auto start = std::chrono::steady_clock::now();
+    m_sync_request->infer();
+    const auto end = std::chrono::steady_clock::now();
+    if (ov::replay::capture_active()) {
+        ov::replay::record_infer(
+            *m_sync_request,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count(),
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end.time_since_epoch()).count());
+    }
+    const auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    const auto mean_us = m_mean_infer_us.load(std::memory_order_relaxed);
+    // exponential moving average biased to history, so a one-off stall does not flip the decision
+    m_mean_infer_us.store(mean_us < 0 ? elapsed_us : (3 * mean_us + elapsed_us) / 4, std::memory_order_relaxed);
+}
+
 void ov::IAsyncInferRequest::run_first_stage(const Pipeline::iterator itBeginStage,
                                              const Pipeline::iterator itEndStage,
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
@@ -4,9 +4,12 @@
 
 #include "openvino/runtime/icompiled_model.hpp"
 
+#include <cstring>
+
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iplugin.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "transformations/utils/utils.hpp"
 
@@ -144,6 +147,56 @@ ov::SoPtr<ov::IRemoteContext> ov::ICompiledModel::get_context() const {
     return m_plugin->get_default_context({});
 }
 
+void ov::ICompiledModel::warmup(const std::vector<std::vector<ov::Shape>>& shape_set) {
+    auto signatures = shape_set;
+    if (signatures.empty()) {
+        std::vector<ov::Shape> signature;
+        for (const auto& input : inputs()) {
+            const auto& shape = input.get_partial_shape();
+            OPENVINO_ASSERT(shape.is_static(),
+                            "warmup() without an explicit shape set requires static input shapes, but input ",
+                            signature.size(),
+                            " has shape ",
+                            shape);
+            signature.push_back(shape.to_shape());
+        }
+        signatures.push_back(std::move(signature));
+    }
+    auto request = create_infer_request();
+    for (const auto& signature : signatures) {
+        OPENVINO_ASSERT(signature.size() == inputs().size(),
+                        "warmup() shape signature holds ",
+                        signature.size(),
+                        " shapes while the model has ",
+                        inputs().size(),
+                        " inputs");
+        for (size_t i = 0; i < signature.size(); i++) {
+            const auto& port = inputs()[i];
+            auto tensor = ov::make_tensor(port.get_element_type(), signature[i]);
+            // zero data: the values do not matter, but the pages have to be touched so the
+            // first real inference does not fault them in
+            if (port.get_element_type() != ov::element::string)
+                std::memset(tensor->data(), 0, tensor->get_byte_size());
+            request->set_tensor(port, ov::SoPtr<ov::ITensor>(tensor, nullptr));
+        }
+        request->infer();
+    }
+}
+
+void ov::ICompiledModel::update_weights(const std::map<std::string, ov::SoPtr<ov::ITensor>>&) {
+    OPENVINO_THROW_NOT_IMPLEMENTED("update_weights is not implemented for the ",
+                                   m_plugin ? m_plugin->get_device_name() : std::string("current"),
+                                   " plugin");
+}
+
+void ov::ICompiledModel::set_compile_time_profile(std::map<std::string, double> profile) {
+    m_compile_time_profile = std::move(profile);
+}
+
+const std::map<std::string, double>& ov::ICompiledModel::get_compile_time_profile() const {
+    return m_compile_time_profile;
+}
+
 void ov::ICompiledModel::set_model_shared_object(ov::Model& model, const std::shared_ptr<void>& shared_object) {
     model.m_shared_object = shared_object;
 }
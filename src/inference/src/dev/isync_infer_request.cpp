@@ -296,6 +296,26 @@ void ov::ISyncInferRequest::allocate_tensor(
     allocate_callback(tensor);
 }
 
+void ov::ISyncInferRequest::allocate_tensor(const ov::Output<const ov::Node>& port, int numa_node_id) {
+    allocate_tensor(port, [&](ov::SoPtr<ov::ITensor>& tensor) {
+        const auto& shape = port.get_partial_shape().is_dynamic() ? ov::Shape{0} : port.get_shape();
+        if (!tensor || tensor->get_element_type() != port.get_element_type() || tensor->get_shape() != shape) {
+            tensor = {ov::make_numa_pinned_tensor(port.get_element_type(), shape, numa_node_id), nullptr};
+        }
+    });
+}
+
+void ov::ISyncInferRequest::allocate_tensor(const ov::Output<const ov::Node>& port,
+                                            const std::shared_ptr<ov::TensorArena>& arena) {
+    OPENVINO_ASSERT(arena, "Tensor arena was not initialized");
+    allocate_tensor(port, [&](ov::SoPtr<ov::ITensor>& tensor) {
+        const auto& shape = port.get_partial_shape().is_dynamic() ? ov::Shape{0} : port.get_shape();
+        if (!tensor || tensor->get_element_type() != port.get_element_type() || tensor->get_shape() != shape) {
+            tensor = {ov::make_tensor(port.get_element_type(), shape, arena->get_allocator()), nullptr};
+        }
+    });
+}
+
 void ov::ISyncInferRequest::check_tensors() const {
     const auto& inputs = m_compiled_model->inputs();
     for (size_t i = 0; i < inputs.size(); i++) {
@@ -25,3 +25,10 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
 ov::SoPtr<ov::ITensor> ov::IVariableState::get_state() const {
     return m_state;
 }
+
+void ov::IVariableState::copy_state_from(const ov::SoPtr<ov::IVariableState>& source) {
+    OPENVINO_ASSERT(source != nullptr, "Cannot copy variable state: source state is nullptr");
+    auto source_state = source->get_state();
+    OPENVINO_ASSERT(source_state, "Cannot copy variable state: source state has no value");
+    set_state(source_state);
+}
@@ -15,6 +15,12 @@
 #    include "openvino/proxy/plugin.hpp"
 #endif
 
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
 namespace ov {
 
 namespace {
@@ -283,6 +289,158 @@ std::shared_ptr<ITensor> make_tensor(const element::Type element_type, const Sha
     return std::make_shared<AllocatedTensor>(element_type, shape, allocator);
 }
 
+/**
+ * @brief Allocator which binds the allocated pages to a NUMA node
+ *
+ * On Linux the pages are bound through the mbind syscall, so the data stays local to the node
+ * regardless of which thread touches it first. On other platforms, or when binding fails, the
+ * pages keep the regular first-touch placement.
+ */
+class NumaNodeAllocator {
+public:
+    explicit NumaNodeAllocator(int numa_node_id) : m_numa_node_id(numa_node_id) {}
+
+#if defined(__linux__)
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t)) {
+        // mmap returns page-aligned memory, which satisfies any fundamental alignment
+        (void)alignment;
+        const auto size = std::max<size_t>(bytes, 1);
+        auto ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        OPENVINO_ASSERT(ptr != MAP_FAILED, "Failed to allocate ", bytes, " bytes for NUMA node ", m_numa_node_id);
+#    if defined(__NR_mbind)
+        if (m_numa_node_id >= 0 && m_numa_node_id < static_cast<int>(sizeof(unsigned long) * 8)) {
+            const unsigned long nodemask = 1ul << m_numa_node_id;
+            constexpr int mpol_bind = 2;  // MPOL_BIND, spelled out to avoid a libnuma dependency
+            // best effort: on failure the pages keep first-touch placement
+            ::syscall(__NR_mbind, ptr, size, mpol_bind, &nodemask, sizeof(nodemask) * 8 + 1, 0);
+        }
+#    endif
+        return ptr;
+    }
+
+    void deallocate(void* handle, const size_t bytes, size_t alignment = alignof(max_align_t)) {
+        (void)alignment;
+        if (handle != nullptr)
+            ::munmap(handle, std::max<size_t>(bytes, 1));
+    }
+#else
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t)) {
+        return m_fallback.allocate(bytes, alignment);
+    }
+
+    void deallocate(void* handle, const size_t bytes, size_t alignment = alignof(max_align_t)) {
+        m_fallback.deallocate(handle, bytes, alignment);
+    }
+#endif
+
+    bool is_equal(const NumaNodeAllocator& other) const {
+        return m_numa_node_id == other.m_numa_node_id;
+    }
+
+private:
+    int m_numa_node_id;
+#if !defined(__linux__)
+    Allocator m_fallback;
+#endif
+};
+
+ov::Allocator get_numa_node_allocator(int numa_node_id) {
+    return ov::Allocator(NumaNodeAllocator(numa_node_id));
+}
+
+std::shared_ptr<ITensor> make_numa_pinned_tensor(const element::Type type, const Shape& shape, int numa_node_id) {
+    return make_tensor(type, shape, get_numa_node_allocator(numa_node_id));
+}
+
+struct TensorArena::State {
+    explicit State(size_t capacity) : m_capacity{capacity} {
+        m_block = static_cast<uint8_t*>(m_heap.allocate(m_capacity));
+    }
+
+    ~State() {
+        m_heap.deallocate(m_block, m_capacity);
+    }
+
+    void* allocate(const size_t bytes, const size_t alignment) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // slices start on their own cache line, so tensors written by different threads
+        // (e.g. outputs filled in parallel) do not false-share
+        const auto slice_alignment = std::max<size_t>(alignment, 64);
+        const auto offset = (m_offset + slice_alignment - 1) / slice_alignment * slice_alignment;
+        if (bytes <= m_capacity && offset <= m_capacity - bytes) {
+            m_offset = offset + bytes;
+            return m_block + offset;
+        }
+        // the block is exhausted, this slice pays the regular heap price
+        return m_heap.allocate(bytes, alignment);
+    }
+
+    void deallocate(void* handle, const size_t bytes, const size_t alignment) {
+        if (handle >= m_block && handle < m_block + m_capacity)
+            return;  // arena slices are reclaimed all at once by reset()
+        m_heap.deallocate(handle, bytes, alignment);
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_offset = 0;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_offset;
+    }
+
+    mutable std::mutex m_mutex;
+    Allocator m_heap;
+    uint8_t* m_block = nullptr;
+    size_t m_capacity;
+    size_t m_offset = 0;
+};
+
+namespace {
+
+/** @brief Copyable allocator handle which slices storage out of a TensorArena block */
+class ArenaAllocator {
+public:
+    explicit ArenaAllocator(const std::shared_ptr<TensorArena::State>& state) : m_state{state} {}
+
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t)) {
+        return m_state->allocate(bytes, alignment);
+    }
+
+    void deallocate(void* handle, const size_t bytes, size_t alignment = alignof(max_align_t)) {
+        m_state->deallocate(handle, bytes, alignment);
+    }
+
+    bool is_equal(const ArenaAllocator& other) const {
+        return m_state == other.m_state;
+    }
+
+private:
+    std::shared_ptr<TensorArena::State> m_state;
+};
+
+}  // namespace
+
+TensorArena::TensorArena(size_t capacity) : m_state{std::make_shared<State>(capacity)} {}
+
+ov::Allocator TensorArena::get_allocator() {
+    return ov::Allocator(ArenaAllocator(m_state));
+}
+
+void TensorArena::reset() {
+    m_state->reset();
+}
+
+size_t TensorArena::size() const {
+    return m_state->size();
+}
+
+size_t TensorArena::capacity() const {
+    return m_state->m_capacity;
+}
+
 /**
  * @brief ROI tensor on other tensor
  * ROI tensor holds the owner
@@ -4,12 +4,37 @@
 
 #include "plugin.hpp"
 
+#include <chrono>
 #include <memory>
 
+#include "openvino/core/compile_time_profile.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
+namespace {
+
+// Records the lifetime of one plugin compile/import call into the compile-time telemetry
+// of the current thread (active only during Core::compile_model).
+class PluginStageTimer {
+public:
+    PluginStageTimer(const std::string& device_name, const char* stage)
+        : m_stage("plugin::" + device_name + "::" + stage),
+          m_start(std::chrono::steady_clock::now()) {}
+
+    ~PluginStageTimer() {
+        ov::util::compile_time_profile_add(
+            m_stage,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start));
+    }
+
+private:
+    std::string m_stage;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+}  // namespace
+
 #define OV_PLUGIN_CALL_STATEMENT(...)                                                  \
     OPENVINO_ASSERT(m_ptr != nullptr, "OpenVINO Runtime Plugin was not initialized."); \
     try {                                                                              \
@@ -51,18 +76,27 @@ void ov::Plugin::set_property(const ov::AnyMap& config) {
 
 ov::SoPtr<ov::ICompiledModel> ov::Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
                                                         const ov::AnyMap& properties) const {
-    OV_PLUGIN_CALL_STATEMENT(return {m_ptr->compile_model(model, properties), m_so});
+    OV_PLUGIN_CALL_STATEMENT({
+        PluginStageTimer timer(get_name(), "compile_model");
+        return {m_ptr->compile_model(model, properties), m_so};
+    });
 }
 
 ov::SoPtr<ov::ICompiledModel> ov::Plugin::compile_model(const std::string& model_path,
                                                         const ov::AnyMap& properties) const {
-    OV_PLUGIN_CALL_STATEMENT(return {m_ptr->compile_model(model_path, properties), m_so});
+    OV_PLUGIN_CALL_STATEMENT({
+        PluginStageTimer timer(get_name(), "compile_model");
+        return {m_ptr->compile_model(model_path, properties), m_so};
+    });
 }
 
 ov::SoPtr<ov::ICompiledModel> ov::Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
                                                         const ov::SoPtr<ov::IRemoteContext>& context,
                                                         const ov::AnyMap& properties) const {
-    OV_PLUGIN_CALL_STATEMENT(return {m_ptr->compile_model(model, properties, context), m_so});
+    OV_PLUGIN_CALL_STATEMENT({
+        PluginStageTimer timer(get_name(), "compile_model");
+        return {m_ptr->compile_model(model, properties, context), m_so};
+    });
 }
 
 ov::SupportedOpsMap ov::Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
@@ -71,13 +105,19 @@ ov::SupportedOpsMap ov::Plugin::query_model(const std::shared_ptr<const ov::Mode
 }
 
 ov::SoPtr<ov::ICompiledModel> ov::Plugin::import_model(std::istream& model, const ov::AnyMap& properties) const {
-    OV_PLUGIN_CALL_STATEMENT(return {m_ptr->import_model(model, properties), m_so});
+    OV_PLUGIN_CALL_STATEMENT({
+        PluginStageTimer timer(get_name(), "import_model");
+        return {m_ptr->import_model(model, properties), m_so};
+    });
 }
 
 ov::SoPtr<ov::ICompiledModel> ov::Plugin::import_model(std::istream& networkModel,
                                                        const ov::SoPtr<ov::IRemoteContext>& context,
                                                        const ov::AnyMap& config) const {
-    OV_PLUGIN_CALL_STATEMENT(return {m_ptr->import_model(networkModel, context, config), m_so});
+    OV_PLUGIN_CALL_STATEMENT({
+        PluginStageTimer timer(get_name(), "import_model");
+        return {m_ptr->import_model(networkModel, context, config), m_so};
+    });
 }
 
 ov::SoPtr<ov::IRemoteContext> ov::Plugin::create_context(const AnyMap& params) const {
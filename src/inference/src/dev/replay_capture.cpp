@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/replay_capture.hpp"
+
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include "openvino/core/node_output.hpp"
+#include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/util/env_util.hpp"
+
+namespace {
+
+// Log layout (little-endian), one file per process:
+//   header:  "OVRP" magic, u32 version
+//   record:  u64 start_ns, u64 end_ns, u32 input count, then per input
+//            u8 element type name length, the name bytes, u32 rank, u64 dims[rank]
+constexpr uint32_t capture_version = 1;
+
+struct Capture {
+    std::mutex mutex;
+    std::ofstream file;
+    bool active = false;
+
+    Capture() {
+        const auto path = ov::util::getenv_string("OV_REPLAY_CAPTURE");
+        if (path.empty())
+            return;
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return;
+        file.write("OVRP", 4);
+        write_u32(capture_version);
+        active = true;
+    }
+
+    void write_u32(uint32_t value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void write_u64(uint64_t value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+};
+
+Capture& capture() {
+    static Capture instance;
+    return instance;
+}
+
+}  // namespace
+
+bool ov::replay::capture_active() {
+    return capture().active;
+}
+
+void ov::replay::record_infer(const IInferRequest& request, uint64_t start_ns, uint64_t end_ns) {
+    auto& cap = capture();
+    if (!cap.active)
+        return;
+
+    // gather the signatures outside the lock; a request in a state where a tensor cannot be
+    // queried just drops the record instead of failing the inference it observes
+    struct InputSignature {
+        std::string type_name;
+        std::vector<uint64_t> dims;
+    };
+    std::vector<InputSignature> signatures;
+    try {
+        for (const auto& port : request.get_inputs()) {
+            const auto tensor = request.get_tensor(port);
+            InputSignature signature;
+            signature.type_name = tensor->get_element_type().get_type_name();
+            for (const auto dim : tensor->get_shape())
+                signature.dims.push_back(dim);
+            signatures.push_back(std::move(signature));
+        }
+    } catch (...) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(cap.mutex);
+    cap.write_u64(start_ns);
+    cap.write_u64(end_ns);
+    cap.write_u32(static_cast<uint32_t>(signatures.size()));
+    for (const auto& signature : signatures) {
+        const auto name_length = static_cast<uint8_t>(signature.type_name.size());
+        cap.file.write(reinterpret_cast<const char*>(&name_length), sizeof(name_length));
+        cap.file.write(signature.type_name.data(), name_length);
+        cap.write_u32(static_cast<uint32_t>(signature.dims.size()));
+        for (const auto dim : signature.dims)
+            cap.write_u64(dim);
+    }
+    // keep the log usable even when the process is killed while reproducing a stall
+    cap.file.flush();
+}
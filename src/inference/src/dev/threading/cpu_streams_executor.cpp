@@ -21,6 +21,7 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/runtime/threading/thread_local.hpp"
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
 
 namespace ov {
 namespace threading {
@@ -304,6 +305,11 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 
+        // _thread_ids is filled once on construction, so the lookup needs no lock
+        bool this_thread_is_stream() const {
+            return _thread_ids.count(std::this_thread::get_id()) > 0;
+        }
+
     private:
         std::set<std::thread::id> _thread_ids;
         Impl* _impl;
@@ -337,15 +343,44 @@ struct CPUStreamsExecutor::Impl {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
+                    // the high priority lane preempts everything else at dequeue
+                    if (_pendingHighPriority.load() > 0) {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if (!_highPriorityTaskQueue.empty()) {
+                            task = std::move(_highPriorityTaskQueue.front());
+                            _highPriorityTaskQueue.pop();
+                            _pendingHighPriority--;
+                        }
+                    }
+                    if (!task && !_fastTaskQueue.try_pop(task)) {
                         std::unique_lock<std::mutex> lock(_mutex);
+                        _idleStreams++;
+                        // the predicate re-checks the lock-free ring after the stream registered
+                        // itself as idle, so a push racing with going to sleep is never missed;
+                        // the low priority lane is drained only when every other lane is empty
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            if (!_highPriorityTaskQueue.empty()) {
+                                task = std::move(_highPriorityTaskQueue.front());
+                                _highPriorityTaskQueue.pop();
+                                _pendingHighPriority--;
+                                return true;
+                            }
+                            if (!_taskQueue.empty()) {
+                                task = std::move(_taskQueue.front());
+                                _taskQueue.pop();
+                                return true;
+                            }
+                            if (_fastTaskQueue.try_pop(task)) {
+                                return true;
+                            }
+                            if (!_lowPriorityTaskQueue.empty()) {
+                                task = std::move(_lowPriorityTaskQueue.front());
+                                _lowPriorityTaskQueue.pop();
+                                return true;
+                            }
+                            return (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                        _idleStreams--;
                     }
                     if (task) {
                         Execute(task, *(_streams.local()));
@@ -382,6 +417,16 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        if (_fastTaskQueue.try_push(std::move(task))) {
+            // wake a stream only when one is parked: busy streams poll the ring before sleeping,
+            // so skipping the wakeup here avoids mutex traffic and wakeup jitter under load
+            if (_idleStreams.load() > 0) {
+                { std::lock_guard<std::mutex> lock(_mutex); }
+                _queueCondVar.notify_one();
+            }
+            return;
+        }
+        // the ring is full, fall back to the unbounded locked queue
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -389,6 +434,23 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    void EnqueueWithPriority(Task task, ov::hint::Priority priority) {
+        if (priority == ov::hint::Priority::MEDIUM) {
+            Enqueue(std::move(task));
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (priority == ov::hint::Priority::HIGH) {
+                _highPriorityTaskQueue.emplace(std::move(task));
+                _pendingHighPriority++;
+            } else {
+                _lowPriorityTaskQueue.emplace(std::move(task));
+            }
+        }
+        _queueCondVar.notify_one();
+    }
+
     void Enqueue_sub(Task task, int id) {
         _subTaskThread[id]->que_push(std::move(task));
     }
@@ -462,7 +524,15 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _subThreads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
+    // fast path for Enqueue: bounded lock-free MPMC ring, the locked _taskQueue takes the overflow
+    LockFreeBoundedQueue<Task> _fastTaskQueue{512};
+    std::atomic<int> _idleStreams{0};
     std::queue<Task> _taskQueue;
+    // priority lanes, see run_with_priority(): high preempts every other lane at dequeue,
+    // low runs only when nothing else is queued
+    std::queue<Task> _highPriorityTaskQueue;
+    std::queue<Task> _lowPriorityTaskQueue;
+    std::atomic<int> _pendingHighPriority{0};
     bool _isStopped = false;
     std::vector<std::shared_ptr<SubQueue>> _subTaskThread;
     std::vector<int> _usedNumaNodes;
@@ -475,6 +545,10 @@ int CPUStreamsExecutor::get_stream_id() {
     return stream->_streamId;
 }
 
+bool CPUStreamsExecutor::is_stream_thread() {
+    return _impl->_streams.this_thread_is_stream();
+}
+
 int CPUStreamsExecutor::get_numa_node_id() {
     auto stream = _impl->_streams.local();
     return stream->_numaNodeId;
@@ -524,6 +598,18 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::run_with_priority(Task task, ov::hint::Priority priority) {
+    if (0 == _impl->_config.get_streams()) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->EnqueueWithPriority(std::move(task), priority);
+    }
+}
+
+bool CPUStreamsExecutor::high_priority_pending() const {
+    return _impl->_pendingHighPriority.load() > 0;
+}
+
 void CPUStreamsExecutor::run_sub_stream(Task task, int id) {
     _impl->Enqueue_sub(std::move(task), id);
 }
@@ -7,6 +7,7 @@
 #include "openvino/core/parallel.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "openvino/runtime/threading/work_stealing_executor.hpp"
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
 #    if (TBB_INTERFACE_VERSION < 12000)
 #        include <tbb/task_scheduler_init.h>
@@ -15,6 +16,8 @@
 #    endif
 #endif
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -36,16 +39,32 @@ public:
     ov::Any get_property(const std::string& name) const override;
     void execute_task_by_streams_executor(ov::threading::IStreamsExecutor::Config::PreferredCoreType core_type,
                                           ov::threading::Task task) override;
+    int lease_cores(const std::string& owner_id, int requested_cores) override;
+    void report_load(const std::string& owner_id, int active_requests) override;
+    int get_leased_cores(const std::string& owner_id) const override;
+    void release_cores(const std::string& owner_id) override;
 
 private:
     void reset_tbb();
 
+    struct CoreLease {
+        int requested = 0;
+        int load = 1;
+        int granted = 0;
+    };
+    // splits the host cores between the owners, weighted by their reported load; must be called
+    // with leaseMutex held
+    void repartition_leases();
+
     std::unordered_map<std::string, std::shared_ptr<ov::threading::ITaskExecutor>> executors;
     std::vector<std::pair<ov::threading::IStreamsExecutor::Config, std::shared_ptr<ov::threading::IStreamsExecutor>>>
         cpuStreamsExecutors;
     mutable std::mutex streamExecutorMutex;
     mutable std::mutex taskExecutorMutex;
     bool tbbTerminateFlag = false;
+    bool workStealingFlag = false;
+    std::map<std::string, CoreLease> coreLeases;
+    mutable std::mutex leaseMutex;
     mutable std::mutex global_mutex;
     bool tbbThreadsCreated = false;
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
@@ -84,6 +103,8 @@ void ExecutorManagerImpl::set_property(const ov::AnyMap& properties) {
                 tbbTaskScheduler = nullptr;
             }
 #endif
+        } else if (it.first == ov::enable_work_stealing.name()) {
+            workStealingFlag = it.second.as<bool>();
         }
     }
 }
@@ -91,6 +112,8 @@ ov::Any ExecutorManagerImpl::get_property(const std::string& name) const {
     std::lock_guard<std::mutex> guard(global_mutex);
     if (name == ov::force_tbb_terminate.name()) {
         return tbbTerminateFlag;
+    } else if (name == ov::enable_work_stealing.name()) {
+        return workStealingFlag;
     }
     OPENVINO_THROW("Property ", name, " is not supported.");
 }
@@ -117,8 +140,17 @@ std::shared_ptr<ov::threading::ITaskExecutor> ExecutorManagerImpl::get_executor(
     std::lock_guard<std::mutex> guard(taskExecutorMutex);
     auto foundEntry = executors.find(id);
     if (foundEntry == executors.end()) {
-        auto newExec = std::make_shared<ov::threading::CPUStreamsExecutor>(ov::threading::IStreamsExecutor::Config{id});
-        tbbThreadsCreated = true;
+        std::shared_ptr<ov::threading::ITaskExecutor> newExec;
+        if (workStealingFlag) {
+            // see ov::enable_work_stealing: idle workers steal queued tasks instead of waiting for
+            // their own queue, which helps when task durations vary a lot
+            const auto workers = ov::threading::IStreamsExecutor::Config::get_default_num_streams();
+            newExec = std::make_shared<ov::threading::WorkStealingExecutor>(
+                ov::threading::IStreamsExecutor::Config{id, workers});
+        } else {
+            newExec = std::make_shared<ov::threading::CPUStreamsExecutor>(ov::threading::IStreamsExecutor::Config{id});
+            tbbThreadsCreated = true;
+        }
         executors[id] = newExec;
         return newExec;
     }
@@ -171,6 +203,68 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     }
 }
 
+void ExecutorManagerImpl::repartition_leases() {
+    const int total = parallel_get_max_threads();
+    int64_t total_weight = 0;
+    for (const auto& it : coreLeases)
+        total_weight += std::max(1, it.second.load);
+    if (total_weight == 0)
+        return;
+    int remaining = total;
+    for (auto& it : coreLeases) {
+        auto& lease = it.second;
+        const auto weight = std::max(1, lease.load);
+        auto share = static_cast<int>(static_cast<int64_t>(total) * weight / total_weight);
+        share = std::max(1, std::min(share, lease.requested));
+        lease.granted = share;
+        remaining -= share;
+    }
+    // hand the rounding leftover to owners which can still make use of more cores
+    while (remaining > 0) {
+        bool assigned = false;
+        for (auto& it : coreLeases) {
+            if (remaining == 0)
+                break;
+            if (it.second.granted < it.second.requested) {
+                ++it.second.granted;
+                --remaining;
+                assigned = true;
+            }
+        }
+        if (!assigned)
+            break;
+    }
+}
+
+int ExecutorManagerImpl::lease_cores(const std::string& owner_id, int requested_cores) {
+    std::lock_guard<std::mutex> guard(leaseMutex);
+    auto& lease = coreLeases[owner_id];
+    lease.requested = std::max(1, requested_cores);
+    repartition_leases();
+    return lease.granted;
+}
+
+void ExecutorManagerImpl::report_load(const std::string& owner_id, int active_requests) {
+    std::lock_guard<std::mutex> guard(leaseMutex);
+    auto it = coreLeases.find(owner_id);
+    if (it == coreLeases.end())
+        return;
+    it->second.load = std::max(0, active_requests);
+    repartition_leases();
+}
+
+int ExecutorManagerImpl::get_leased_cores(const std::string& owner_id) const {
+    std::lock_guard<std::mutex> guard(leaseMutex);
+    auto it = coreLeases.find(owner_id);
+    return it == coreLeases.end() ? 0 : it->second.granted;
+}
+
+void ExecutorManagerImpl::release_cores(const std::string& owner_id) {
+    std::lock_guard<std::mutex> guard(leaseMutex);
+    coreLeases.erase(owner_id);
+    repartition_leases();
+}
+
 void ExecutorManagerImpl::execute_task_by_streams_executor(
     ov::threading::IStreamsExecutor::Config::PreferredCoreType core_type,
     ov::threading::Task task) {
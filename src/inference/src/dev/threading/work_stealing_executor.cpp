@@ -0,0 +1,206 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/threading/work_stealing_executor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/itt.hpp"
+#include "openvino/runtime/system_conf.hpp"
+
+namespace ov {
+namespace threading {
+
+struct WorkStealingExecutor::Impl {
+    struct Worker {
+        std::deque<Task> _queue;
+        std::mutex _queueMutex;
+        int _numaNodeId = 0;
+        // Worker indices ordered by stealing preference: same NUMA node first, remote nodes last,
+        // so stolen tasks keep their data close when possible
+        std::vector<size_t> _victimOrder;
+    };
+
+    struct ThreadContext {
+        Impl* _impl = nullptr;
+        int _workerIndex = -1;
+    };
+
+    explicit Impl(const Config& config) : _config(config) {
+        const auto workers_number = static_cast<size_t>(std::max(1, _config.get_streams()));
+        auto numa_nodes = get_available_numa_nodes();
+        if (numa_nodes.empty())
+            numa_nodes.push_back(0);
+
+        _workers.reserve(workers_number);
+        for (size_t index = 0; index < workers_number; ++index) {
+            auto worker = std::unique_ptr<Worker>(new Worker{});
+            worker->_numaNodeId = numa_nodes[index % numa_nodes.size()];
+            _workers.emplace_back(std::move(worker));
+        }
+        for (size_t index = 0; index < workers_number; ++index) {
+            auto& victims = _workers[index]->_victimOrder;
+            for (size_t distance = 1; distance < workers_number; ++distance) {
+                const size_t victim = (index + distance) % workers_number;
+                if (_workers[victim]->_numaNodeId == _workers[index]->_numaNodeId)
+                    victims.push_back(victim);
+            }
+            for (size_t distance = 1; distance < workers_number; ++distance) {
+                const size_t victim = (index + distance) % workers_number;
+                if (_workers[victim]->_numaNodeId != _workers[index]->_numaNodeId)
+                    victims.push_back(victim);
+            }
+        }
+
+        _threads.reserve(workers_number);
+        for (size_t index = 0; index < workers_number; ++index) {
+            _threads.emplace_back([this, index] {
+                openvino::itt::threadName(_config.get_name() + "_" + std::to_string(index));
+                t_context._impl = this;
+                t_context._workerIndex = static_cast<int>(index);
+                worker_loop(index);
+            });
+        }
+    }
+
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(_wakeMutex);
+            _stopped = true;
+        }
+        _wakeEvent.notify_all();
+        for (auto& thread : _threads) {
+            if (thread.joinable())
+                thread.join();
+        }
+    }
+
+    void enqueue(Task task) {
+        size_t target;
+        if (t_context._impl == this) {
+            // a task spawned from a worker goes to its own queue
+            target = static_cast<size_t>(t_context._workerIndex);
+        } else {
+            target = _roundRobin++ % _workers.size();
+        }
+        {
+            std::lock_guard<std::mutex> lock(_workers[target]->_queueMutex);
+            _workers[target]->_queue.push_back(std::move(task));
+        }
+        {
+            // taken to pair with the predicate check inside wait(), so the wakeup cannot be lost
+            std::lock_guard<std::mutex> lock(_wakeMutex);
+            ++_queuedTasks;
+        }
+        _wakeEvent.notify_one();
+    }
+
+    void worker_loop(size_t index) {
+        for (;;) {
+            Task task = pop_own(index);
+            if (!task)
+                task = steal(index);
+            if (task) {
+                {
+                    std::lock_guard<std::mutex> lock(_wakeMutex);
+                    --_queuedTasks;
+                }
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_wakeMutex);
+            _wakeEvent.wait(lock, [this] {
+                return _stopped || _queuedTasks > 0;
+            });
+            // on shutdown the queues are drained first, so already submitted tasks still run
+            if (_stopped && _queuedTasks == 0)
+                return;
+        }
+    }
+
+    Task pop_own(size_t index) {
+        std::lock_guard<std::mutex> lock(_workers[index]->_queueMutex);
+        auto& queue = _workers[index]->_queue;
+        if (queue.empty())
+            return {};
+        Task task = std::move(queue.front());
+        queue.pop_front();
+        return task;
+    }
+
+    Task steal(size_t index) {
+        for (const size_t victim : _workers[index]->_victimOrder) {
+            std::lock_guard<std::mutex> lock(_workers[victim]->_queueMutex);
+            auto& queue = _workers[victim]->_queue;
+            if (queue.empty())
+                continue;
+            // steal the newest task: the owner works from the front, so contention on one entry is rare
+            Task task = std::move(queue.back());
+            queue.pop_back();
+            return task;
+        }
+        return {};
+    }
+
+    Config _config;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::vector<std::thread> _threads;
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeEvent;
+    bool _stopped = false;
+    int64_t _queuedTasks = 0;  // guarded by _wakeMutex
+    std::atomic<size_t> _roundRobin{0};
+
+    static thread_local ThreadContext t_context;
+};
+
+thread_local WorkStealingExecutor::Impl::ThreadContext WorkStealingExecutor::Impl::t_context;
+
+WorkStealingExecutor::WorkStealingExecutor(const Config& config) : _impl(new Impl(config)) {}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+    _impl.reset();
+}
+
+void WorkStealingExecutor::run(Task task) {
+    _impl->enqueue(std::move(task));
+}
+
+void WorkStealingExecutor::execute(Task task) {
+    task();
+}
+
+int WorkStealingExecutor::get_stream_id() {
+    // like CPUStreamsExecutor, calls from foreign threads fall back to the first stream
+    return Impl::t_context._impl == _impl.get() ? Impl::t_context._workerIndex : 0;
+}
+
+bool WorkStealingExecutor::is_stream_thread() {
+    return Impl::t_context._impl == _impl.get();
+}
+
+int WorkStealingExecutor::get_numa_node_id() {
+    const int index = get_stream_id();
+    return _impl->_workers[static_cast<size_t>(index)]->_numaNodeId;
+}
+
+int WorkStealingExecutor::get_socket_id() {
+    return get_org_socket_id(get_numa_node_id());
+}
+
+void WorkStealingExecutor::run_sub_stream(Task task, int id) {
+    // sub streams are not distinguished here: any idle worker may pick the task up
+    (void)id;
+    _impl->enqueue(std::move(task));
+}
+
+}  // namespace threading
+}  // namespace ov
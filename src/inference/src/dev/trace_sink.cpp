@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/itrace_sink.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace {
+
+// Fast-path flag: the pointer value is only used for the null check, the sink itself is
+// always accessed through the shared_ptr snapshot taken under the mutex.
+std::atomic<ov::ITraceSink*> g_sink_flag{nullptr};
+
+std::mutex g_sink_mutex;
+std::shared_ptr<ov::ITraceSink> g_sink;
+uint32_t g_node_span_period = 0;
+
+// Counts inferences for the node-span sampling decision
+std::atomic<uint32_t> g_request_counter{0};
+
+// Set while a sampled inference runs on this thread; read by plugins via node_spans_active()
+thread_local bool t_node_spans_active = false;
+
+uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+std::shared_ptr<ov::ITraceSink> snapshot_sink() {
+    std::lock_guard<std::mutex> lock(g_sink_mutex);
+    return g_sink;
+}
+
+}  // namespace
+
+ov::ITraceSink::~ITraceSink() = default;
+
+void ov::trace::set_sink(const std::shared_ptr<ITraceSink>& sink, uint32_t node_span_period) {
+    std::lock_guard<std::mutex> lock(g_sink_mutex);
+    g_sink = sink;
+    g_node_span_period = sink ? node_span_period : 0;
+    g_sink_flag.store(sink.get(), std::memory_order_release);
+}
+
+bool ov::trace::enabled() {
+    return g_sink_flag.load(std::memory_order_relaxed) != nullptr;
+}
+
+bool ov::trace::node_spans_active() {
+    return t_node_spans_active;
+}
+
+ov::trace::RequestSpan::RequestSpan() {
+    if (!enabled())
+        return;
+    uint32_t period;
+    {
+        std::lock_guard<std::mutex> lock(g_sink_mutex);
+        m_sink = g_sink;
+        period = g_node_span_period;
+    }
+    if (!m_sink)
+        return;
+    if (period != 0 && g_request_counter.fetch_add(1, std::memory_order_relaxed) % period == 0) {
+        m_sampled = true;
+        t_node_spans_active = true;
+    }
+    m_start_ns = now_ns();
+}
+
+ov::trace::RequestSpan::~RequestSpan() {
+    if (!m_sink)
+        return;
+    if (m_sampled)
+        t_node_spans_active = false;
+    m_sink->on_request_span(m_start_ns, now_ns());
+}
+
+ov::trace::ScopedNodeSpan::ScopedNodeSpan(const char* name, const char* type) : m_name(name), m_type(type) {
+    if (m_name)
+        m_start_ns = now_ns();
+}
+
+ov::trace::ScopedNodeSpan::~ScopedNodeSpan() {
+    if (!m_name)
+        return;
+    if (auto sink = snapshot_sink())
+        sink->on_node_span(m_name, m_type, m_start_ns, now_ns());
+}
@@ -13,7 +13,27 @@
 #include "openvino/util/file_util.hpp"
 #include "transformations/utils/utils.hpp"
 
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
 namespace {
+
+// Kick off kernel readahead for the given file, so the I/O overlaps with the frontend
+// probing and parsing that follow; see the same hint in FileStorageCacheManager
+void prefetch_file(const std::string& path) {
+#if defined(__linux__)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    ::close(fd);
+#else
+    (void)path;
+#endif
+}
+
 ov::element::Type to_legacy_type(const ov::element::Type& legacy_type, bool input) {
     if (input) {
         return legacy_type == ov::element::f16 ? ov::element::f32 : legacy_type;
@@ -118,6 +138,17 @@ std::shared_ptr<ov::Model> read_model(const std::string& modelPath,
     std::string model_path = modelPath;
 #endif
 
+    prefetch_file(modelPath);
+    if (!binPath.empty()) {
+        prefetch_file(binPath);
+    } else {
+        // IR weights convention: a .bin file next to the model; prefetching a non-existing
+        // file is a no-op
+        const auto pos = modelPath.rfind('.');
+        if (pos != std::string::npos)
+            prefetch_file(modelPath.substr(0, pos) + ".bin");
+    }
+
     // Try to load with FrontEndManager
     ov::frontend::FrontEndManager manager;
     ov::frontend::FrontEnd::Ptr FE;
@@ -165,14 +196,19 @@ std::shared_ptr<ov::Model> read_model(const std::string& model,
                                       const std::vector<ov::Extension::Ptr>& ov_exts,
                                       bool frontendMode) {
     std::istringstream modelStringStream(model);
-    std::istream& modelStream = modelStringStream;
+    return read_model(static_cast<std::istream&>(modelStringStream), weights, ov_exts, frontendMode);
+}
 
+std::shared_ptr<ov::Model> read_model(std::istream& model,
+                                      const ov::Tensor& weights,
+                                      const std::vector<ov::Extension::Ptr>& ov_exts,
+                                      bool frontendMode) {
     // Try to load with FrontEndManager
     ov::frontend::FrontEndManager manager;
     ov::frontend::FrontEnd::Ptr FE;
     ov::frontend::InputModel::Ptr inputModel;
 
-    ov::AnyVector params{&modelStream};
+    ov::AnyVector params{&model};
     if (weights) {
         std::shared_ptr<ov::AlignedBuffer> weights_buffer =
             std::make_shared<ov::SharedBuffer<ov::Tensor>>(reinterpret_cast<char*>(weights.data()),
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <istream>
 #include <string>
 #include <vector>
 
@@ -41,5 +42,19 @@ std::shared_ptr<ov::Model> read_model(const std::string& model,
                                       const std::vector<ov::Extension::Ptr>& extensions,
                                       bool frontendMode = false);
 
+/**
+ * @brief Reads model from a stream
+ * @param model Stream with a serialized model representation; it is consumed by the frontend directly,
+ * so the model does not have to be staged to a local file or a contiguous buffer first
+ * @param weights constant Tensor with weights
+ * @param extensions vector with OpenVINO extensions
+ * @param frontendMode read network without post-processing or other transformations
+ * @return Shared pointer to ov::Model
+ */
+std::shared_ptr<ov::Model> read_model(std::istream& model,
+                                      const ov::Tensor& weights,
+                                      const std::vector<ov::Extension::Ptr>& extensions,
+                                      bool frontendMode = false);
+
 }  // namespace util
 }  // namespace ov
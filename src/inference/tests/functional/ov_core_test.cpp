@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <sstream>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
@@ -95,4 +96,57 @@ TEST(CoreBaseTest, LoadOVFolderOverCWPathPluginXML) {
     remove_plugin_xml(ov_file_path);
 }
 
-#endif
\ No newline at end of file
+#endif
+#ifdef ENABLE_OV_IR_FRONTEND
+TEST(CoreBaseTest, ReadModelFromStream) {
+    const std::string model = R"V0G0N(
+<net name="relu_model" version="11">
+    <layers>
+        <layer id="0" name="input" type="Parameter" version="opset1">
+            <data shape="1,3" element_type="f32"/>
+            <output>
+                <port id="0" precision="FP32" names="input">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="relu" type="ReLU" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1" precision="FP32" names="relu">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    ov::Core core;
+    std::istringstream model_stream(model);
+    std::shared_ptr<ov::Model> model_from_stream;
+    ASSERT_NO_THROW(model_from_stream = core.read_model(model_stream));
+    ASSERT_NE(model_from_stream, nullptr);
+    EXPECT_EQ(model_from_stream->inputs().size(), 1);
+    EXPECT_EQ(model_from_stream->outputs().size(), 1);
+}
+#endif
@@ -93,6 +93,30 @@ TEST_F(VariableStateTests, VariableStateInternalCanSaveStateByReference) {
     ASSERT_FLOAT_EQ(saver->data<float>()[2], 123);
 }
 
+TEST_F(VariableStateTests, VariableStateInternalCanCopyStateFromAnotherState) {
+    std::shared_ptr<ov::IVariableState> src_state(new VariableStateMockImpl("src"));
+    std::shared_ptr<ov::IVariableState> dst_state(new VariableStateMockImpl("dst"));
+    float data[] = {123, 124, 125};
+    state_tensor = ov::make_tensor(ov::element::f32, {3}, data);
+
+    src_state->set_state(state_tensor);
+    dst_state->copy_state_from({src_state, nullptr});
+    auto saver = dst_state->get_state();
+
+    ASSERT_NE(saver, nullptr);
+    ASSERT_FLOAT_EQ(saver->data<float>()[0], 123);
+    ASSERT_FLOAT_EQ(saver->data<float>()[1], 124);
+    ASSERT_FLOAT_EQ(saver->data<float>()[2], 125);
+}
+
+TEST_F(VariableStateTests, VariableStateInternalCopyStateFromThrowsOnEmptySource) {
+    std::shared_ptr<ov::IVariableState> src_state(new VariableStateMockImpl("src"));
+    std::shared_ptr<ov::IVariableState> dst_state(new VariableStateMockImpl("dst"));
+
+    ASSERT_THROW(dst_state->copy_state_from({src_state, nullptr}), ov::Exception);
+    ASSERT_THROW(dst_state->copy_state_from({}), ov::Exception);
+}
+
 // Tests for InferRequest::QueryState
 TEST_F(VariableStateTests, InferRequestCanConvertOneVariableStateFromCppToAPI) {
     std::vector<ov::SoPtr<ov::IVariableState>> toReturn(1);
@@ -10,6 +10,35 @@
 // ------------------------------AutoSchedule----------------------------
 namespace ov {
 namespace auto_plugin {
+namespace {
+// Accelerator readiness history within this process, keyed by model path and device name.
+// When a previous compile of the same model on the same device reached readiness quickly
+// (typically because the core loaded a cached blob), the CPU helper would be released almost
+// immediately anyway, so spending host threads on its compilation only delays the accelerator.
+constexpr double FAST_READINESS_THRESHOLD_MS = 5000.0;
+std::mutex readiness_history_mutex;
+std::map<std::string, double> readiness_history;
+
+std::string readiness_history_key(const std::string& model_path, const std::string& device_name) {
+    return model_path + "|" + device_name;
+}
+
+bool is_device_known_fast(const std::string& model_path, const std::string& device_name) {
+    if (model_path.empty())
+        return false;
+    std::lock_guard<std::mutex> lock(readiness_history_mutex);
+    auto it = readiness_history.find(readiness_history_key(model_path, device_name));
+    return it != readiness_history.end() && it->second < FAST_READINESS_THRESHOLD_MS;
+}
+
+void update_readiness_history(const std::string& model_path, const std::string& device_name, double compile_ms) {
+    if (model_path.empty())
+        return;
+    std::lock_guard<std::mutex> lock(readiness_history_mutex);
+    readiness_history[readiness_history_key(model_path, device_name)] = compile_ms;
+}
+}  // namespace
+
 bool AutoSchedule::select_other_device(const std::string& cur_dev_name) {
     {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
@@ -96,8 +125,16 @@ void AutoSchedule::init() {
                                 m_context->m_model_priority);
 
     auto load_device_task = [&](AutoCompileContext* context_ptr,  const std::shared_ptr<ov::Model>& model) {
+        auto compile_start_time = std::chrono::steady_clock::now();
         try_to_compile_model(*context_ptr, model);
         if (context_ptr->m_is_load_success) {
+            if (context_ptr == &m_compile_context[ACTUALDEVICE]) {
+                std::chrono::duration<double, std::milli> compile_time =
+                    std::chrono::steady_clock::now() - compile_start_time;
+                update_readiness_history(m_context->m_model_path,
+                                         context_ptr->m_device_info.device_name,
+                                         compile_time.count());
+            }
             if (context_ptr->m_worker_name.empty()) {
                 context_ptr->m_worker_name = context_ptr->m_device_info.device_name;
             }
@@ -134,6 +171,13 @@ void AutoSchedule::init() {
         // m_compile_context[ACTUALDEVICE]
         if (is_actual_cpu || !m_context->m_startup_fallback) {
             m_compile_context[CPU].m_is_enabled = false;
+        } else if (is_device_known_fast(m_context->m_model_path,
+                                        m_compile_context[ACTUALDEVICE].m_device_info.device_name)) {
+            // A previous compile of this model reached readiness on the selected device quickly
+            // (e.g. the core loaded a cached blob), so the helper would be torn down almost
+            // immediately - skip it and let the accelerator have all compilation threads
+            m_compile_context[CPU].m_is_enabled = false;
+            LOG_INFO_TAG("accelerator readiness known to be fast for this model, skip CPU helper");
         } else {
             const auto cpu_iter = deviceChecker().check_and_return_if_device_in_list("CPU", m_context->m_device_priorities);
             // if have CPU Device,  enable m_compile_context[CPU]
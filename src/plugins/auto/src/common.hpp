@@ -65,6 +65,7 @@ struct WorkerInferRequest {
     std::exception_ptr            m_exception_ptr = nullptr;
     std::list<Time>               m_start_times;
     std::list<Time>               m_end_times;
+    Time                          m_infer_start_time;
     int                           m_index = 0;
     AutoImmediateExecutor::Ptr    m_fallback_exec;
 };
@@ -76,6 +77,7 @@ struct ThisRequestExecutor : public ov::threading::ITaskExecutor {
     void run(ov::threading::Task task) override {
         (*m_workptrptr)->m_task = std::move(task);
         (*m_workptrptr)->m_fallback_exec = m_fallback_exec;
+        (*m_workptrptr)->m_infer_start_time = std::chrono::steady_clock::now();
         (*m_workptrptr)->m_inferrequest->start_async();
     };
     WorkerInferRequest** m_workptrptr = nullptr;
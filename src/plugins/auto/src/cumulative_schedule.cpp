@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+
 #include "cumulative_schedule.hpp"
 #include "async_infer_request.hpp"
 #include "plugin.hpp"
@@ -10,6 +12,21 @@
 // ------------------------------CumuSchedule----------------------------
 namespace ov {
 namespace auto_plugin {
+namespace {
+// weight of the newest sample in the per-device latency moving average
+constexpr double latency_ewma_alpha = 0.2;
+}  // namespace
+
+void CumuSchedule::on_worker_infer_done(const std::string& device, double latency_ms) {
+    std::lock_guard<std::mutex> lock(m_device_latency_mutex);
+    auto iter = m_device_avg_latency_ms.find(device);
+    if (iter == m_device_avg_latency_ms.end()) {
+        m_device_avg_latency_ms[device] = latency_ms;
+    } else {
+        iter->second = latency_ewma_alpha * latency_ms + (1.0 - latency_ewma_alpha) * iter->second;
+    }
+}
+
 std::string CumuSchedule::schedule_to_next_device(const std::vector<DeviceInformation>& devices,
                                                   std::size_t current_device_index) {
     std::string selected_device_name = "";
@@ -25,6 +42,10 @@ std::string CumuSchedule::schedule_to_next_device(const std::vector<DeviceInform
         m_n_ctput_schedule_next_device++;
     } else if (schedule_policy == ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY) {
         selected_device_name = devices[current_device_index].device_name;
+    } else {
+        // DEFAULT: the caller pre-ordered the devices by expected completion time,
+        // walk them in that order
+        selected_device_name = devices[current_device_index].device_name;
     }
     return selected_device_name;
 }
@@ -239,6 +260,22 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
     }
     lock.unlock();
 
+    if (preferred_device.empty() && m_context->m_schedule_policy == ov::intel_auto::SchedulePolicy::DEFAULT) {
+        // latency feedback routing: try the device with the lowest measured infer latency first,
+        // so that each request lands on the device expected to complete it soonest among those
+        // with a vacant worker. Devices without a measurement yet sort first and get sampled
+        std::lock_guard<std::mutex> latency_lock(m_device_latency_mutex);
+        auto avg_latency = [this](const DeviceName& device_name) {
+            auto iter = m_device_avg_latency_ms.find(device_name);
+            return iter == m_device_avg_latency_ms.end() ? 0.0 : iter->second;
+        };
+        std::stable_sort(devices.begin(),
+                         devices.end(),
+                         [&avg_latency](const DeviceInformation& a, const DeviceInformation& b) {
+                             return avg_latency(a.device_name) < avg_latency(b.device_name);
+                         });
+    }
+
     std::size_t current_device_index = 0;
     while (current_device_index < devices.size()) {
         if (!preferred_device.empty() && (devices[current_device_index].device_name != preferred_device)) {
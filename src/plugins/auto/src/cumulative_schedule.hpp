@@ -26,6 +26,10 @@ private:
     bool schedule_to_worker_infer_request(ov::threading::Task, DeviceName preferred_device = "") override;
     void try_to_compile_model(AutoCompileContext& context, const std::shared_ptr<ov::Model>& model) override;
     bool select_other_device(const std::string& cur_dev_name) override;
+    void on_worker_infer_done(const std::string& device, double latency_ms) override;
+    // moving average of the measured infer latency per device, feeds the DEFAULT schedule policy
+    std::mutex                              m_device_latency_mutex;
+    std::map<DeviceName, double>            m_device_avg_latency_ms;
 };
 } // namespace auto_plugin
 } // namespace ov
@@ -103,6 +103,13 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
             [worker_request_ptr, this, device, idle_workerrequests_ptr](std::exception_ptr exception_ptr) mutable {
                 IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{worker_request_ptr, *idle_workerrequests_ptr};
                 worker_request_ptr->m_exception_ptr = std::move(exception_ptr);
+                if (worker_request_ptr->m_exception_ptr == nullptr) {
+                    const auto latency_ms =
+                        std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+                            std::chrono::steady_clock::now() - worker_request_ptr->m_infer_start_time)
+                            .count();
+                    on_worker_infer_done(device, latency_ms);
+                }
                 {
                     auto stop_retry_and_continue = [worker_request_ptr]() {
                         auto captured_task = std::move(worker_request_ptr->m_task);
@@ -69,8 +69,9 @@ CompiledModel::GetWorkerInferRequest() const {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
-                // notify the individual requests on the completion
-                for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
+                // notify the individual requests on the completion (only the occupied slots,
+                // the tail of a partially filled batch carries no requests)
+                for (int c = 0; c < workerRequestPtr->_active_batch_size; c++) {
                     workerRequestPtr->_completion_tasks[c]();
                 }
                 // reset the timeout
@@ -92,6 +93,7 @@ CompiledModel::GetWorkerInferRequest() const {
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                        workerRequestPtr->_active_batch_size = sz;
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completion_tasks[n] = std::move(t.second);
@@ -100,6 +102,23 @@ CompiledModel::GetWorkerInferRequest() const {
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
                         workerRequestPtr->_infer_request_batched->start_async();
+                    } else if ((status == std::cv_status::timeout) && sz * 2 >= workerRequestPtr->_batch_size) {
+                        // timeout with the batch at least half full: running the already-compiled
+                        // padded model on the occupied slots beats falling back to per-request
+                        // batch1 execution, the unoccupied slots are computed and discarded
+                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                        workerRequestPtr->_active_batch_size = sz;
+                        for (int n = 0; n < sz; n++) {
+                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            workerRequestPtr->_completion_tasks[n] = std::move(t.second);
+                            t.first->m_sync_request->copy_inputs_if_needed();
+                            t.first->m_sync_request->m_batched_request_status =
+                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+                        }
+                        workerRequestPtr->_infer_request_batched->start_async();
+                        // the released requests may refill the queue while this batch is in flight,
+                        // wait for the completion so that the next dispatch finds the request idle
+                        workerRequestPtr->_infer_request_batched->wait();
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
@@ -23,6 +23,9 @@ public:
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
         int _batch_size;
+        // number of slots actually occupied by the current dispatch, less than _batch_size
+        // when a partially filled batch is executed on timeout via the padded model
+        int _active_batch_size = 0;
         ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
         std::vector<ov::threading::Task> _completion_tasks;
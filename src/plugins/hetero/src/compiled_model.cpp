@@ -304,10 +304,14 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         return decltype(ov::loaded_from_cache)::value_type{m_loaded_from_cache};
     } else if (ov::optimal_number_of_infer_requests == name) {
         unsigned int value = 0u;
+        // Subgraphs of a single request run strictly sequentially, so devices only overlap across
+        // requests: with enough requests in flight, subgraph i of one request runs while subgraph
+        // i+1 still processes the previous one. Sum the per-device optima so the advertised count
+        // can keep every stage of the pipeline busy instead of being sized for the widest stage
+        // only (which degenerates to 1 for a latency-tuned multi-device split).
         for (const auto& comp_model_desc : m_compiled_submodels) {
-            value = std::max(value,
-                             comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
-                                 .as<unsigned int>());
+            value += comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
+                         .as<unsigned int>();
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
@@ -100,6 +100,14 @@ void ov::hetero::Plugin::get_device_memory_map(const std::vector<std::string>& d
     }
 }
 
+// Assigns every node to the first device (in priority order) which reports it as supported and
+// masks the claimed regions into DeviceSubgraph ops before querying the next device. Note that
+// this is purely greedy: a node is never moved to a lower-priority device for performance
+// reasons, even when it forms a small island whose reassignment would remove two subgraph
+// boundaries. A cost-driven repartitioning cannot be bolted onto this loop as-is, because
+// support sets of later devices are only ever computed for the residual subgraphs (deliberately,
+// so query results match what each device will actually compile) - moving an already-claimed
+// node requires querying every device over the pristine model first and masking once at the end.
 std::pair<ov::SupportedOpsMap, ov::hetero::SubgraphsMappingInfo> ov::hetero::Plugin::query_model_update(
     std::shared_ptr<ov::Model>& model,
     const ov::AnyMap& properties,
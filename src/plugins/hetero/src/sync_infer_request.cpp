@@ -44,9 +44,29 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
         const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
         if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
-            temp_tensor_map[output_port] = {
-                ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
-                nullptr};
+            // Allocate the intermediate tensor through a remote context of one of the adjacent
+            // submodels when available: e.g. a GPU context returns a USM host tensor which the
+            // device reads and writes in place, so the subgraph boundary costs a single shared
+            // allocation instead of a staging copy on each side
+            ov::SoPtr<ov::ITensor> tensor;
+            for (const auto& submodel_idx : {submodel_idx_out, submodel_idx_in}) {
+                try {
+                    auto context = m_subrequests[submodel_idx]->get_compiled_model()->get_context();
+                    if (context) {
+                        tensor = context->create_host_tensor(output_tensor->get_element_type(),
+                                                             output_tensor->get_shape());
+                        if (!tensor._so)
+                            tensor._so = m_subrequests[submodel_idx]._so;
+                        break;
+                    }
+                } catch (const ov::Exception&) {
+                    // this submodel's device has no remote context (e.g. CPU) - try the other
+                    // side or fall back to a regular host tensor
+                }
+            }
+            if (!tensor)
+                tensor = {ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()), nullptr};
+            temp_tensor_map[output_port] = tensor;
         }
         m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
         const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
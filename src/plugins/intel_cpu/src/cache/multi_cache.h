@@ -5,8 +5,10 @@
 #pragma once
 
 #include <functional>
+#include <future>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
@@ -15,7 +17,14 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * When constructed with useSharedInstance, a local miss falls through to a process-wide shared
+ * instance, so kernels and primitives already built by another stream or another compiled model of
+ * the same process are reused instead of being JIT-ed again (the keys embed the isa and all kernel
+ * parameters, so a reused object is exact). Shared hits are read-mostly: they load an immutable
+ * snapshot through an atomic shared_ptr and don't serialize the streams; only publishing a newly
+ * built record takes a lock, and the builder itself runs outside of it.
+ *
+ * @attention Apart from the synchronized shared-instance lookup, this implementation IS NOT THREAD SAFE!
  */
 
 class MultiCache {
@@ -29,9 +38,13 @@ public:
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param useSharedInstance when set, a local miss is looked up in the process-wide shared instance
+    *        before the builder runs, and newly built objects are published there
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool useSharedInstance = false)
+        : _capacity(capacity),
+          _useSharedInstance(useSharedInstance) {}
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -49,19 +62,137 @@ public:
               typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
 #endif
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
+        if (0 == _capacity) {
+            // caching is disabled for this instance, don't consult the shared instance either
+            return {builder(key), CacheEntryBase::LookUpStatus::Miss};
+        }
         auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        if (!_useSharedInstance) {
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        return entry->getOrCreate(key, [&](const KeyType& missed) {
+            return getOrCreateShared<KeyType, ValueType>(missed, std::move(builder));
+        });
     }
 
 private:
+    /**
+     * @brief A process-wide cache entry with a read-mostly lookup path.
+     *
+     * Hits read an immutable snapshot map published through an atomic shared_ptr. A miss builds the
+     * value outside of any lock, so a long compilation doesn't stall the other streams, and
+     * publishes it by copying the snapshot under the lock. Building is single-flight: the first
+     * requester of a key runs the builder while concurrent requesters of the same key wait for its
+     * result, so a startup storm of identical models doesn't funnel N-1 redundant compilations of
+     * every primitive through the internal locks of oneDNN. Records are immutable and never
+     * evicted; once the capacity is reached new records are used locally without being published.
+     */
+    template <typename KeyType, typename ValueType>
+    class SharedCacheEntry {
+    public:
+        explicit SharedCacheEntry(size_t capacity) : _capacity(capacity) {}
+
+        template <typename BuilderType>
+        ValueType getOrCreate(const KeyType& key, BuilderType builder) {
+            auto snapshot = std::atomic_load_explicit(&_snapshot, std::memory_order_acquire);
+            if (snapshot) {
+                auto itr = snapshot->find(key);
+                if (itr != snapshot->end())
+                    return itr->second;
+            }
+
+            std::promise<ValueType> promise;
+            std::shared_future<ValueType> inflight;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto current = _snapshot;  // the snapshot pointer only changes under the lock
+                if (current) {
+                    auto itr = current->find(key);
+                    if (itr != current->end())
+                        return itr->second;
+                }
+                auto itr = _inflight.find(key);
+                if (itr != _inflight.end()) {
+                    inflight = itr->second;
+                } else {
+                    _inflight.emplace(key, promise.get_future().share());
+                }
+            }
+
+            if (inflight.valid()) {
+                auto value = inflight.get();
+                if (value != ValueType())
+                    return value;
+                // the first requester failed to build the record, retry locally
+                return builder(key);
+            }
+
+            ValueType value{};
+            try {
+                value = builder(key);
+            } catch (...) {
+                publishAndComplete(key, promise, ValueType());
+                throw;
+            }
+            publishAndComplete(key, promise, value);
+            return value;
+        }
+
+    private:
+        void publishAndComplete(const KeyType& key,
+                                std::promise<ValueType>& promise,
+                                const ValueType& value) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _inflight.erase(key);
+                // an empty value is not publishable (the builder either failed or produced nothing)
+                if (value != ValueType()) {
+                    auto current = _snapshot;
+                    bool publishable =
+                        !current || (current->find(key) == current->end() && current->size() < _capacity);
+                    if (publishable) {
+                        auto updated = current ? std::make_shared<SnapshotType>(*current)
+                                               : std::make_shared<SnapshotType>();
+                        (*updated)[key] = value;
+                        std::atomic_store_explicit(&_snapshot,
+                                                   std::shared_ptr<const SnapshotType>(std::move(updated)),
+                                                   std::memory_order_release);
+                    }
+                }
+            }
+            // set outside of the lock, the waiters resume immediately
+            promise.set_value(value);
+        }
+        struct KeyHasher {
+            std::size_t operator()(const KeyType& key) const {
+                return key.hash();
+            }
+        };
+        using SnapshotType = std::unordered_map<KeyType, ValueType, KeyHasher>;
+
+        size_t _capacity;
+        std::mutex _mutex;
+        std::shared_ptr<const SnapshotType> _snapshot;
+        std::unordered_map<KeyType, std::shared_future<ValueType>, KeyHasher> _inflight;
+    };
+
     template<typename T>
     size_t getTypeId();
     template<typename KeyType, typename ValueType>
     EntryPtr<KeyType, ValueType> getEntry();
 
+    template <typename KeyType, typename ValueType, typename BuilderType>
+    ValueType getOrCreateShared(const KeyType& key, BuilderType builder) {
+        // one process-wide entry per key/value pair type, the capacity matches the
+        // Config::rtCacheCapacity default
+        static SharedCacheEntry<KeyType, ValueType> sharedEntry(5000ul);
+        return sharedEntry.getOrCreate(key, std::move(builder));
+    }
+
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _useSharedInstance = false;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "result_memo.h"
+
+namespace ov {
+namespace intel_cpu {
+
+uint64_t ResultMemoCache::hashBytes(const void* data, size_t size, uint64_t seed) {
+    // FNV-1a is cheap enough to rehash the designated inputs on every inference and is stable
+    // across runs, so fingerprints of identical content always collide on purpose
+    constexpr uint64_t fnv_prime = 0x100000001b3lu;
+    constexpr uint64_t fnv_offset = 0xcbf29ce484222325lu;
+    uint64_t hash = seed ^ fnv_offset;
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0lu; i < size; i++) {
+        hash = (hash ^ bytes[i]) * fnv_prime;
+    }
+    return hash;
+}
+
+ResultMemoCache::RecordCPtr ResultMemoCache::get(const Key& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto itr = m_cacheMapper.find(key);
+    if (itr == m_cacheMapper.end()) {
+        return nullptr;
+    }
+    m_lruList.splice(m_lruList.begin(), m_lruList, itr->second);
+    return m_lruList.front().second;
+}
+
+void ResultMemoCache::put(const Key& key, RecordCPtr record) {
+    if (!record || record->bytes > m_capacityBytes) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto itr = m_cacheMapper.find(key);
+    if (itr != m_cacheMapper.end()) {
+        m_totalBytes -= itr->second->second->bytes;
+        m_lruList.splice(m_lruList.begin(), m_lruList, itr->second);
+        m_lruList.front().second = record;
+    } else {
+        auto listItr = m_lruList.insert(m_lruList.begin(), {key, record});
+        m_cacheMapper.insert({key, listItr});
+    }
+    m_totalBytes += record->bytes;
+    // never evict the just refreshed front record, even when it exhausts the budget on its own
+    while (m_totalBytes > m_capacityBytes && m_lruList.size() > 1lu) {
+        m_totalBytes -= m_lruList.back().second->bytes;
+        m_cacheMapper.erase(m_lruList.back().first);
+        m_lruList.pop_back();
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
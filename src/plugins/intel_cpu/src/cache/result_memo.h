@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "cpu_types.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Content-hash keyed cache of node output blobs for cross-request result deduplication.
+ *
+ * Workloads which repeat identical sub-inputs across requests (a shared prompt prefix, a constant
+ * watermark image) recompute the same subgraph results on every inference. Nodes designated with the
+ * "memoize" runtime attribute look their outputs up here by a fingerprint of the node and the content
+ * of all its inputs and skip execution on a hit. The cache is bounded by a byte budget with LRU
+ * eviction (see ov::intel_cpu::memoization_cache_size) and is shared by all streams of a compiled
+ * model, so a result computed by one request is reused by the others.
+ *
+ * @note The key is a 64-bit content fingerprint rather than the full input content, which trades a
+ *       theoretical collision probability for not retaining the inputs. Designation is therefore
+ *       opt-in and meant for deterministic stateless subgraphs.
+ */
+class ResultMemoCache {
+public:
+    using Ptr = std::shared_ptr<ResultMemoCache>;
+
+    struct Key {
+        uint64_t contentHash = 0lu;
+
+        size_t hash() const {
+            return static_cast<size_t>(contentHash);
+        }
+        bool operator==(const Key& rhs) const {
+            return contentHash == rhs.contentHash;
+        }
+    };
+
+    struct Record {
+        std::vector<VectorDims> shapes;           // output shapes, in port order
+        std::vector<std::vector<uint8_t>> blobs;  // raw output payloads, in port order
+        size_t bytes = 0lu;                       // total payload size, drives the eviction
+    };
+    using RecordCPtr = std::shared_ptr<const Record>;
+
+    explicit ResultMemoCache(size_t capacityBytes) : m_capacityBytes(capacityBytes) {}
+
+    /**
+     * @brief Searches a record by the content fingerprint.
+     * @return the cached record or nullptr on a miss
+     */
+    RecordCPtr get(const Key& key);
+
+    /**
+     * @brief Stores the record and evicts the least recently used records until the byte budget is
+     *        respected again. Records larger than the whole budget are dropped silently.
+     */
+    void put(const Key& key, RecordCPtr record);
+
+    /**
+     * @brief Mixes a raw byte span into the fingerprint, FNV-1a style.
+     */
+    static uint64_t hashBytes(const void* data, size_t size, uint64_t seed);
+
+private:
+    // same structure as LruCache, with the eviction driven by the stored payload bytes instead of
+    // the record count, and guarded by a lock since the streams of a compiled model share the cache
+    using value_type = std::pair<Key, RecordCPtr>;
+    using lru_list_type = std::list<value_type>;
+
+    struct key_hasher {
+        std::size_t operator()(const Key& k) const {
+            return k.hash();
+        }
+    };
+
+    std::mutex m_mutex;
+    lru_list_type m_lruList;
+    std::unordered_map<Key, lru_list_type::iterator, key_hasher> m_cacheMapper;
+    size_t m_capacityBytes;
+    size_t m_totalBytes = 0lu;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -40,16 +40,28 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     std::mutex _mutex;
 };
 
+namespace {
+// weights cache entries which are keyed by graph local names (e.g. edge names) have to be
+// isolated per compiled model, since the cache itself is shared on the plugin level
+std::string make_weights_cache_scope() {
+    static std::atomic<size_t> counter{0};
+    return "model#" + std::to_string(counter++) + "/";
+}
+}  // namespace
+
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const Config& cfg,
+                             SocketsWeights& socketWeights,
                              const bool loaded_from_cache)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
       m_cfg{cfg},
       m_name{model->get_name()},
-      m_loaded_from_cache(loaded_from_cache) {
+      m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(socketWeights),
+      m_weightsCacheScope(make_weights_cache_scope()) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
     if (!core)
@@ -137,7 +149,12 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                         (m_cfg.lpTransformsMode == Config::On) &&
                         ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
 
-                    ctx = std::make_shared<GraphContext>(m_cfg, weightsCache, isQuantizedFlag, streamsExecutor);
+                    ctx = std::make_shared<GraphContext>(m_cfg,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         streamsExecutor,
+                                                         m_weightsCacheScope,
+                                                         m_memoryStatistics);
                 }
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.CreateGraph(model, ctx);
@@ -222,8 +239,10 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::log::level.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::memory_statistics.name()),
             RO_property(ov::hint::dynamic_quantization_group_size.name()),
             RO_property(ov::hint::kv_cache_precision.name()),
+            RO_property(ov::cache_mode.name()),
         };
     }
 
@@ -290,17 +309,39 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(
             config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::memory_statistics) {
+        return decltype(ov::intel_cpu::memory_statistics)::value_type(m_memoryStatistics->report());
     } else if (name == ov::hint::dynamic_quantization_group_size) {
         return decltype(ov::hint::dynamic_quantization_group_size)::value_type(
             config.fcDynamicQuantizationGroupSize);
     } else if (name == ov::hint::kv_cache_precision) {
         return decltype(ov::hint::kv_cache_precision)::value_type(config.kvCachePrecision);
+    } else if (name == ov::cache_mode) {
+        return decltype(ov::cache_mode)::value_type(config.cacheMode);
     }
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
+void CompiledModel::update_weights(const std::map<std::string, ov::SoPtr<ov::ITensor>>& weights) {
+    if (weights.empty())
+        return;
+    // the per-stream graphs are materialized lazily on the first inference of the stream; a graph
+    // created after this call would replicate the original constants again
+    bool anyReady = false;
+    for (auto& graph : m_graphs) {
+        GraphGuard::Lock graphLock{graph};
+        if (!graphLock._graph.IsReady())
+            continue;
+        graphLock._graph.UpdateWeights(weights);
+        anyReady = true;
+    }
+    OPENVINO_ASSERT(anyReady,
+                    "update_weights can only be applied to a compiled model which has run at least "
+                    "one inference (see also CompiledModel::warmup)");
+}
+
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream);
+    ModelSerializer serializer(modelStream, m_cfg.cacheMode == ov::CacheMode::OPTIMIZE_SIZE);
     serializer << m_model;
 }
 
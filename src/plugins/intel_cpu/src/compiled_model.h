@@ -25,6 +25,7 @@ public:
     CompiledModel(const std::shared_ptr<ov::Model>& model,
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   const Config& cfg,
+                  SocketsWeights& socketWeights,
                   const bool loaded_from_cache);
 
     std::shared_ptr<ov::IAsyncInferRequest> create_infer_request() const override;
@@ -35,6 +36,8 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
+    void update_weights(const std::map<std::string, ov::SoPtr<ov::ITensor>>& weights) override;
+
     void set_property(const ov::AnyMap& properties) override {
         OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
                                        "Set property to Core::compile_model during compilation");
@@ -66,7 +69,14 @@ private:
     const bool m_loaded_from_cache;
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
-    mutable SocketsWeights m_socketWeights;
+    // plugin level weights caches, so compiled models of the same plugin share identically
+    // packed weights (e.g. the same model compiled with different inference precision hints)
+    SocketsWeights& m_socketWeights;
+    // isolates the name-keyed weights cache entries of this compiled model, see GraphContext
+    const std::string m_weightsCacheScope;
+    // live allocation counters shared by the graph contexts of all streams of this compiled model,
+    // reported through ov::intel_cpu::memory_statistics
+    const MemoryStatistics::Ptr m_memoryStatistics = std::make_shared<MemoryStatistics>();
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
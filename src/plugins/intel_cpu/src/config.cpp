@@ -272,6 +272,56 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                key,
                                ". Expected value only ov::intel_cpu::Config::LPTransformsMode::On/Off");
             }
+        } else if (key == ov::intel_cpu::weights_replication.name()) {
+            try {
+                enableWeightsReplication = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               key,
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::streams_auto_tune.name()) {
+            try {
+                streamsAutoTune = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               key,
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::activations_memory_budget.name()) {
+            try {
+                activationsMemoryBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               key,
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::memoization_cache_size.name()) {
+            try {
+                memoizationCacheSize = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               key,
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::use_hugepages.name()) {
+            try {
+                hugePages = val.as<ov::intel_cpu::HugePages>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               key,
+                               ". Expected only DISABLE/2M/1G");
+            }
         } else if (key == ov::device::id.name()) {
             device_id = val.as<std::string>();
             if (!device_id.empty()) {
@@ -355,6 +405,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::hint::execution_mode.name(),
                                ". Supported values: ov::hint::ExecutionMode::PERFORMANCE/ACCURACY");
             }
+        } else if (key == ov::cache_mode.name()) {
+            try {
+                cacheMode = val.as<ov::CacheMode>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::cache_mode.name(),
+                               ". Supported values: ov::CacheMode::OPTIMIZE_SIZE/OPTIMIZE_SPEED");
+            }
         } else if (key == ov::hint::kv_cache_precision.name()) {
             try {
                 auto const prec = val.as<ov::element::Type>();
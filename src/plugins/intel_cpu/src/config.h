@@ -45,12 +45,23 @@ struct Config {
 
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
+    bool enableWeightsReplication = false;
+    bool streamsAutoTune = false;
+    // bytes of live activation memory allowed before buffers are released after their last use; 0 - no limit
+    uint64_t activationsMemoryBudget = 0;
+    // byte budget of the cross-request result memoization cache; 0 - memoization disabled
+    uint64_t memoizationCacheSize = 0;
+    // explicit hugepage mode for the big long-lived allocations (packed weights, KV cache state)
+    HugePages hugePages = HugePages::DISABLE;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot = {};
     std::string device_id = {};
     float fcSparseWeiDecompressionRate = 1.0f;
     uint64_t fcDynamicQuantizationGroupSize = 0;
     ov::element::Type kvCachePrecision = ov::element::f16;
+    // OPTIMIZE_SIZE produces weightless cache blobs: the model is reloaded from the original
+    // file at import instead of being embedded into the blob
+    ov::CacheMode cacheMode = ov::CacheMode::OPTIMIZE_SPEED;
 #if defined(OPENVINO_ARCH_X86_64)
     size_t rtCacheCapacity = 5000ul;
 #else
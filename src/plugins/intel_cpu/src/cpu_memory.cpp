@@ -6,10 +6,15 @@
 #include <common/memory_desc_wrapper.hpp>
 #include "nodes/reorder.h"
 #if defined(__linux__)
+#    include <sys/mman.h>
 #    include <sys/syscall.h> /* Definition of SYS_* constants */
 #    include <unistd.h>
 #endif
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 namespace ov {
 namespace intel_cpu {
 template <>
@@ -210,6 +215,139 @@ void* Memory::getData() const {
     return data;
 }
 
+namespace {
+// Accounting binding of the current thread, installed by MemoryAccountingScope during graph
+// construction and captured by the memory managers created while it is active
+thread_local MemoryStatistics::Ptr t_accountingStats = nullptr;
+thread_local MemoryStatistics::Category t_accountingCategory = MemoryStatistics::Activations;
+}   // namespace
+
+void MemoryStatistics::record(Category category, ptrdiff_t delta) {
+    auto& counter = m_counters[category];
+    auto current = counter.current.fetch_add(static_cast<uint64_t>(delta), std::memory_order_relaxed) +
+                   static_cast<uint64_t>(delta);
+    auto peak = counter.peak.load(std::memory_order_relaxed);
+    while (current > peak && !counter.peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t MemoryStatistics::current(Category category) const {
+    return m_counters[category].current.load(std::memory_order_relaxed);
+}
+
+std::map<std::string, uint64_t> MemoryStatistics::report() const {
+    return {
+        {"weights_bytes", m_counters[Weights].current.load(std::memory_order_relaxed)},
+        {"activations_bytes", m_counters[Activations].current.load(std::memory_order_relaxed)},
+        {"activations_peak_bytes", m_counters[Activations].peak.load(std::memory_order_relaxed)},
+        {"scratch_bytes", m_counters[Scratch].current.load(std::memory_order_relaxed)},
+        {"scratch_peak_bytes", m_counters[Scratch].peak.load(std::memory_order_relaxed)},
+    };
+}
+
+MemoryStatsCharge::MemoryStatsCharge() : m_stats(t_accountingStats), m_category(t_accountingCategory) {}
+
+MemoryStatsCharge::~MemoryStatsCharge() {
+    set(0ul);
+}
+
+void MemoryStatsCharge::set(size_t allocated) {
+    if (m_stats && allocated != m_charged) {
+        m_stats->record(m_category, static_cast<ptrdiff_t>(allocated) - static_cast<ptrdiff_t>(m_charged));
+        m_charged = allocated;
+    }
+}
+
+MemoryAccountingScope::MemoryAccountingScope(MemoryStatistics::Ptr stats, MemoryStatistics::Category category)
+    : m_prevStats(t_accountingStats),
+      m_prevCategory(t_accountingCategory) {
+    t_accountingStats = std::move(stats);
+    t_accountingCategory = category;
+}
+
+MemoryAccountingScope::~MemoryAccountingScope() {
+    t_accountingStats = m_prevStats;
+    t_accountingCategory = m_prevCategory;
+}
+
+namespace {
+
+std::atomic<HugePagesMode> huge_pages_mode{HugePagesMode::Disable};
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+
+#ifndef MAP_HUGE_SHIFT
+#    define MAP_HUGE_SHIFT 26
+#endif
+
+// mmap does not remember the mapping length for us, so the hugepage allocations are tracked here;
+// the map stays tiny since only buffers of at least one hugepage are eligible
+std::mutex huge_pages_mutex;
+std::unordered_map<void*, size_t>& huge_pages_registry() {
+    static std::unordered_map<void*, size_t> registry;
+    return registry;
+}
+
+// serves the allocation from explicit hugepages when the mode is enabled and the buffer spans at
+// least one page; rounds the capacity up to a page multiple on success, returns nullptr otherwise
+void* huge_pages_alloc(size_t& capacity) {
+    const auto mode = huge_pages_mode.load(std::memory_order_relaxed);
+    if (mode == HugePagesMode::Disable)
+        return nullptr;
+    const size_t pageShift = mode == HugePagesMode::Use1G ? 30 : 21;
+    const size_t pageSize = 1ul << pageShift;
+    // small buffers stay on the regular path, the padding waste would dominate otherwise
+    if (capacity < pageSize)
+        return nullptr;
+    const size_t rounded = (capacity + pageSize - 1) & ~(pageSize - 1);
+    void* ptr = mmap(nullptr,
+                     rounded,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | static_cast<int>(pageShift << MAP_HUGE_SHIFT),
+                     -1,
+                     0);
+    if (ptr == MAP_FAILED) {
+        // transparent fallback: the hugepage pool is exhausted or not reserved at all
+        DEBUG_LOG("hugepage allocation of ", rounded, " bytes failed, falling back to regular pages\n");
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> lock(huge_pages_mutex);
+        huge_pages_registry()[ptr] = rounded;
+    }
+    capacity = rounded;
+    return ptr;
+}
+
+bool huge_pages_free(void* ptr) {
+    std::lock_guard<std::mutex> lock(huge_pages_mutex);
+    auto& registry = huge_pages_registry();
+    auto itr = registry.find(ptr);
+    if (itr == registry.end())
+        return false;
+    munmap(ptr, itr->second);
+    registry.erase(itr);
+    return true;
+}
+
+#else
+
+void* huge_pages_alloc(size_t&) {
+    return nullptr;
+}
+
+bool huge_pages_free(void*) {
+    return false;
+}
+
+#endif
+
+}   // namespace
+
+void set_huge_pages_mode(HugePagesMode mode) {
+    huge_pages_mode.store(mode, std::memory_order_relaxed);
+}
+
 void* MemoryMngrWithReuse::getRawPtr() const noexcept {
     return m_data.get();
 }
@@ -218,23 +356,38 @@ void MemoryMngrWithReuse::setExtBuff(void *ptr, size_t size) {
     m_useExternalStorage = true;
     m_memUpperBound = size;
     m_data = decltype(m_data)(ptr, release);
+    m_statsCharge.set(0ul);  // the external buffer is owned (and accounted) elsewhere
 }
 
 bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > m_memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+        // bucket the capacity to the next power of two: dynamic workloads which keep growing a
+        // dimension a little (e.g. a novel sequence length on every request) then reuse the buffer
+        // instead of paying an allocation plus a NUMA move per new size
+        size_t capacity = size;
+        if (capacity > static_cast<size_t>(cacheLineSize)) {
+            capacity--;
+            for (size_t shift = 1; shift < sizeof(capacity) * 8; shift <<= 1)
+                capacity |= capacity >> shift;
+            capacity++;
+        }
+        void *ptr = huge_pages_alloc(capacity);  // rounds the capacity up to a page multiple on success
         if (!ptr) {
-            OPENVINO_THROW("Failed to allocate ", size, " bytes of memory");
+            ptr = dnnl::impl::malloc(capacity, cacheLineSize);
         }
-        m_memUpperBound = size;
+        if (!ptr) {
+            OPENVINO_THROW("Failed to allocate ", capacity, " bytes of memory");
+        }
+        m_memUpperBound = capacity;
         m_useExternalStorage = false;
         m_data = decltype(m_data)(ptr, destroy);
+        m_statsCharge.set(capacity);
         sizeChanged = true;
 
         if (numa_node >= 0) {
-            if (!mbind_move(ptr, size, numa_node)) {
+            if (!mbind_move(ptr, capacity, numa_node)) {
                 DEBUG_LOG("MemoryMngrWithReuse move_memory to node ", numa_node, " failed\n");
             }
         }
@@ -246,9 +399,86 @@ bool MemoryMngrWithReuse::hasExtBuffer() const noexcept {
     return m_useExternalStorage;
 }
 
+void MemoryMngrWithReuse::releaseBuffer() {
+    if (m_useExternalStorage) {
+        return;
+    }
+    m_data = decltype(m_data)(nullptr, release);
+    m_memUpperBound = 0ul;
+    m_statsCharge.set(0ul);
+}
+
 void MemoryMngrWithReuse::release(void *ptr) {}
 
 void MemoryMngrWithReuse::destroy(void *ptr) {
+    if (huge_pages_free(ptr)) {
+        return;
+    }
+    dnnl::impl::free(ptr);
+}
+
+void* MemoryMngrWithShrink::getRawPtr() const noexcept {
+    return m_data.get();
+}
+
+void MemoryMngrWithShrink::setExtBuff(void *ptr, size_t size) {
+    m_useExternalStorage = true;
+    m_memUpperBound = size;
+    m_data = decltype(m_data)(ptr, release);
+    m_statsCharge.set(0ul);  // the external buffer is owned (and accounted) elsewhere
+}
+
+bool MemoryMngrWithShrink::resize(size_t size) {
+    constexpr int cacheLineSize = 64;
+    bool sizeChanged = false;
+    m_windowPeak = std::max(m_windowPeak, size);
+    size_t capacity = 0;
+    if (size > m_memUpperBound) {
+        capacity = size;
+    } else if (++m_windowCount >= decayWindow) {
+        // release the excess when the recent working set stays well below the allocation,
+        // e.g. after a single oversized warmup request
+        if (m_windowPeak * 2 <= m_memUpperBound)
+            capacity = std::max(m_windowPeak, static_cast<size_t>(1));
+        m_windowCount = 0;
+        m_windowPeak = size;
+    }
+    if (capacity) {
+        // bucket the capacity to the next power of two just like MemoryMngrWithReuse does
+        if (capacity > static_cast<size_t>(cacheLineSize)) {
+            capacity--;
+            for (size_t shift = 1; shift < sizeof(capacity) * 8; shift <<= 1)
+                capacity |= capacity >> shift;
+            capacity++;
+        }
+    }
+    if (capacity && capacity != m_memUpperBound) {
+        void *ptr = dnnl::impl::malloc(capacity, cacheLineSize);
+        if (!ptr) {
+            OPENVINO_THROW("Failed to allocate ", capacity, " bytes of memory");
+        }
+        m_memUpperBound = capacity;
+        m_useExternalStorage = false;
+        m_data = decltype(m_data)(ptr, destroy);
+        m_statsCharge.set(capacity);
+        sizeChanged = true;
+
+        if (numa_node >= 0) {
+            if (!mbind_move(ptr, capacity, numa_node)) {
+                DEBUG_LOG("MemoryMngrWithShrink move_memory to node ", numa_node, " failed\n");
+            }
+        }
+    }
+    return sizeChanged;
+}
+
+bool MemoryMngrWithShrink::hasExtBuffer() const noexcept {
+    return m_useExternalStorage;
+}
+
+void MemoryMngrWithShrink::release(void *ptr) {}
+
+void MemoryMngrWithShrink::destroy(void *ptr) {
     dnnl::impl::free(ptr);
 }
 
@@ -260,6 +490,7 @@ void MemoryMngrRealloc::setExtBuff(void *ptr, size_t size) {
     m_useExternalStorage = true;
     m_memUpperBound = size;
     m_data = decltype(m_data)(ptr, release);
+    m_statsCharge.set(0ul);  // the external buffer is owned (and accounted) elsewhere
 }
 
 bool MemoryMngrRealloc::resize(size_t size) {
@@ -280,6 +511,7 @@ bool MemoryMngrRealloc::resize(size_t size) {
         m_memUpperBound = size;
         m_useExternalStorage = false;
         m_data = decltype(m_data)(ptr, destroy);
+        m_statsCharge.set(size);
         sizeChanged = true;
     }
     return sizeChanged;
@@ -446,6 +678,11 @@ bool DnnlMemoryMngr::hasExtBuffer() const noexcept {
     return m_pMemMngr->hasExtBuffer();
 }
 
+void DnnlMemoryMngr::releaseBuffer() {
+    m_pMemMngr->releaseBuffer();
+    notifyUpdate();
+}
+
 void DnnlMemoryMngr::registerMemory(Memory* memPtr) {
     if (memPtr) {
         m_setMemPtrs.insert(memPtr);
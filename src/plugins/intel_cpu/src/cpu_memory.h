@@ -13,8 +13,11 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 
+#include <atomic>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_set>
 
 /**
@@ -32,6 +35,84 @@ namespace intel_cpu {
 class Memory;
 class ProxyMemoryMngr;
 
+/**
+ * @brief Live byte accounting of the buffers owned by the plugin memory managers of one compiled model.
+ *
+ * The counters are maintained at the allocator seams, so they reflect what is actually allocated at any
+ * moment (including the high-water marks of the dynamically resized buffers) without parsing the process
+ * memory maps. Thread safe: the managers update the counters from whichever thread triggers a resize.
+ */
+class MemoryStatistics {
+public:
+    typedef std::shared_ptr<MemoryStatistics> Ptr;
+
+    enum Category : size_t {
+        Weights = 0,    // constants resolved through the weights cache and packed weight buffers
+        Activations,    // intermediate tensor space: the solver workspace and dynamically sized edges
+        Scratch,        // per-NUMA-node scratch pads of the oneDNN primitives
+        NumCategories
+    };
+
+    void record(Category category, ptrdiff_t delta);
+
+    // Currently allocated bytes in the given category
+    uint64_t current(Category category) const;
+
+    // Snapshot of the counters keyed the way they are reported through the plugin property
+    std::map<std::string, uint64_t> report() const;
+
+private:
+    struct Counter {
+        std::atomic<uint64_t> current{0};
+        std::atomic<uint64_t> peak{0};
+    };
+    Counter m_counters[NumCategories];
+};
+
+/**
+ * @brief Charges the internal allocations of one memory manager to the statistics object bound to the
+ *        constructing thread (see MemoryAccountingScope); no-op when no binding was active.
+ *
+ * The binding is captured once at construction, so later resize calls are attributed to the right model
+ * no matter which inference thread performs them, and the remaining charge is credited back on
+ * destruction when the manager dies with the model.
+ */
+class MemoryStatsCharge {
+public:
+    MemoryStatsCharge();
+    ~MemoryStatsCharge();
+
+    MemoryStatsCharge(const MemoryStatsCharge&) = delete;
+    MemoryStatsCharge& operator=(const MemoryStatsCharge&) = delete;
+
+    // Re-charges the binding to the new allocation size (0 when the buffer was released or replaced
+    // with an external one)
+    void set(size_t allocated);
+
+private:
+    MemoryStatistics::Ptr m_stats;
+    MemoryStatistics::Category m_category = MemoryStatistics::Activations;
+    size_t m_charged = 0ul;
+};
+
+/**
+ * @brief Scoped guard binding the memory managers constructed on this thread to a statistics object
+ *        under the given category. Scopes nest: the previous binding is restored on destruction.
+ *        A null statistics pointer disables accounting within the scope.
+ */
+class MemoryAccountingScope {
+public:
+    MemoryAccountingScope(MemoryStatistics::Ptr stats, MemoryStatistics::Category category);
+    ~MemoryAccountingScope();
+
+    MemoryAccountingScope(const MemoryAccountingScope&) = delete;
+    MemoryAccountingScope& operator=(const MemoryAccountingScope&) = delete;
+
+private:
+    MemoryStatistics::Ptr m_prevStats;
+    MemoryStatistics::Category m_prevCategory;
+};
+
 /**
  * @interface IMemoryMngr
  * @brief An interface to memory control object
@@ -66,6 +147,12 @@ public:
      * @return status whether the object has control over underlying memory buffer
      */
     virtual bool hasExtBuffer() const noexcept = 0;
+
+    /**
+     * @brief Release the underlying memory buffer (when owned), so the next resize allocates it anew.
+     *        Default is a no-op for the managers which cannot recreate their buffer on demand.
+     */
+    virtual void releaseBuffer() {}
 };
 
 /**
@@ -78,12 +165,44 @@ public:
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
     bool hasExtBuffer() const noexcept override;
+    void releaseBuffer() override;
 
 private:
     bool m_useExternalStorage = false;
     size_t m_memUpperBound = 0ul;
     std::unique_ptr<void, void (*)(void *)> m_data;
     int numa_node;
+    MemoryStatsCharge m_statsCharge;
+
+    static void release(void *ptr);
+    static void destroy(void *ptr);
+};
+
+/**
+ * @brief An implementation of the mem manager for scratch buffers: grows like MemoryMngrWithReuse
+ *        (without preserving the data), but also tracks the high-water mark of the requested sizes over
+ *        a window of resize calls and shrinks the allocation when the working set decays, so a single
+ *        oversized request does not pin the worst-case buffer forever.
+ */
+class MemoryMngrWithShrink : public IMemoryMngr {
+public:
+    MemoryMngrWithShrink(int numa_node = -1) : m_data(nullptr, release), numa_node(numa_node) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+private:
+    // number of resize calls after which the window high-water mark is checked against the allocation
+    static constexpr size_t decayWindow = 256;
+
+    bool m_useExternalStorage = false;
+    size_t m_memUpperBound = 0ul;
+    size_t m_windowPeak = 0ul;
+    size_t m_windowCount = 0ul;
+    std::unique_ptr<void, void (*)(void *)> m_data;
+    int numa_node;
+    MemoryStatsCharge m_statsCharge;
 
     static void release(void *ptr);
     static void destroy(void *ptr);
@@ -101,6 +220,7 @@ private:
     bool m_useExternalStorage = false;
     size_t m_memUpperBound = 0ul;
     std::unique_ptr<void, void (*)(void *)> m_data;
+    MemoryStatsCharge m_statsCharge;
 
     static void release(void *ptr);
     static void destroy(void *ptr);
@@ -122,6 +242,7 @@ public:
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
     bool hasExtBuffer() const noexcept override;
+    void releaseBuffer() override;
     void registerMemory(Memory* memPtr) override;
     void unregisterMemory(Memory* memPtr) override;
 
@@ -460,6 +581,20 @@ using MemoryPtr = std::shared_ptr<IMemory>;
 using MemoryCPtr = std::shared_ptr<const IMemory>;
 using StringMemoryPtr = std::shared_ptr<StringMemory>;
 
+/**
+ * @brief Explicit hugepage backing for the big long-lived allocations (packed weights, KV cache states).
+ *
+ * When enabled, allocations of at least one hugepage are served from explicit 2MB or 1GB pages,
+ * which removes the dTLB pressure of walking multi-gigabyte weights with 4KB pages during decode.
+ * The fallback is transparent: when the hugepage pool is exhausted (or the platform has none
+ * reserved) the allocation silently goes down the regular path. The mode is process-wide, since
+ * the memory managers are constructed far away from any config; it is published by the graph
+ * context when ov::intel_cpu::use_hugepages is set.
+ */
+enum class HugePagesMode { Disable, Use2M, Use1G };
+
+void set_huge_pages_mode(HugePagesMode mode);
+
 bool mbind_move(void* data, size_t size, int numaNodeID);
 bool mbind_move(const MemoryCPtr mem, int numaNodeID);
 bool mbind_move(const dnnl::memory mem, int numaNodeID);
@@ -18,7 +18,9 @@ class DnnlScratchPad {
 
 public:
     DnnlScratchPad(const dnnl::engine& eng, int numa_node = -1) : eng(eng) {
-        mgrPtr = std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>(numa_node));
+        // scratch data never outlives a single primitive execution, so use the manager which tracks
+        // the high-water mark and shrinks the buffer back once the live working set decays
+        mgrPtr = std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithShrink>(numa_node));
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
@@ -296,7 +296,7 @@ std::string Edge::name() const {
     return  result.str();
 }
 
-void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
+void Edge::externalAllocate(WeightsSharing::Ptr weightsCache, const std::string& keyScope) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -311,7 +311,8 @@ void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        // edge names are unique within a graph only, so the key is scoped per compiled model
+        auto ptr = weightsCache->findOrCreate(keyScope + name(), alloc, false);
         memoryPtr = *ptr;
         DEBUG_LOG(*this, " memoryPtr=", memoryPtr);
         useExternalMemory = true;
@@ -53,7 +53,7 @@ public:
     void init();
     void allocate(const void* mem_ptr = nullptr);
     void allocate(MemoryMngrPtr memMngr);
-    void externalAllocate(WeightsSharing::Ptr weightsCache);
+    void externalAllocate(WeightsSharing::Ptr weightsCache, const std::string& keyScope = {});
     void reuse(MemoryPtr ptr);
     void validate();
 
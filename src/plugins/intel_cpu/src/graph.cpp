@@ -8,6 +8,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -32,6 +33,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/runtime/itrace_sink.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #include "utils/ngraph_utils.hpp"
@@ -51,6 +53,11 @@
 #    include <tbb/task.h>
 #endif
 
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
 using namespace dnnl;
 namespace ov {
 namespace intel_cpu {
@@ -63,7 +70,7 @@ Graph::~Graph() {
 }
 
 template<typename NET>
-void Graph::CreateGraph(NET &net, const GraphContext::CPtr ctx) {
+void Graph::CreateGraph(NET &net, const GraphContext::CPtr ctx, bool deferPrimitives) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateGraph");
 
     if (IsReady())
@@ -73,7 +80,7 @@ void Graph::CreateGraph(NET &net, const GraphContext::CPtr ctx) {
 
     Replicate(net);
 
-    InitGraph();
+    InitGraph(true, deferPrimitives);
 
     CPU_DEBUG_CAP_ENABLE(serialize(*this));
 }
@@ -110,7 +117,7 @@ void Graph::CreateGraph(const std::vector<NodePtr>& graphNodes,
     CPU_DEBUG_CAP_ENABLE(serialize(*this));
 }
 
-template void Graph::CreateGraph(const std::shared_ptr<const ov::Model>&, const GraphContext::CPtr);
+template void Graph::CreateGraph(const std::shared_ptr<const ov::Model>&, const GraphContext::CPtr, bool);
 void Graph::Replicate(const std::shared_ptr<const ov::Model> &model) {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "Graph::Replicate", "ov::Model");
     this->_name = model->get_friendly_name();
@@ -253,20 +260,56 @@ void Graph::GroupParallelNodes() {
     }
 }
 
-void Graph::InitGraph(bool optimize) {
+#if defined(__linux__)
+namespace {
+// Starts kernel page-in of the constant inputs in execution order. With ov::enable_mmap the weights
+// are backed by the mapped model file and are paged in on first touch, which serializes the first
+// inference on the disk. madvise(WILLNEED) is asynchronous, so the readahead runs in the kernel
+// while the primitives are compiled and the constant subgraphs are executed.
+void prefetchConstantInputs(const std::vector<NodePtr>& nodes) {
+    // small constants are cheap to fault in and tend to share already resident pages
+    constexpr size_t minPrefetchSize = 64lu * 1024;
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    for (const auto& node : nodes) {
+        if (node->getType() != Type::Input || !node->isConstant())
+            continue;
+        const auto memory = static_cast<node::Input*>(node.get())->getMemoryPtr();
+        if (!memory || memory->getDesc().getPrecision() == element::string || memory->getSize() < minPrefetchSize)
+            continue;
+        const auto addr = reinterpret_cast<uintptr_t>(memory->getData());
+        const auto begin = addr - addr % pageSize;
+        // the advice is best effort: for the constants that were cloned on load it addresses
+        // ordinary heap pages and is simply ignored
+        ::madvise(reinterpret_cast<void*>(begin), memory->getSize() + (addr - begin), MADV_WILLNEED);
+    }
+}
+}  // namespace
+#endif
+
+void Graph::InitGraph(bool optimize, bool deferPrimitives) {
     DEBUG_LOG("Initializing graph with name: ",  GetName());
 
+    // buffers created while the graph is built are dominated by constant data (packed weight
+    // replicas, decompressed constants), so account them as weights by default; Allocate()
+    // reclassifies the intermediate tensor space it plans
+    MemoryAccountingScope accountingScope(context->getMemoryStats(), MemoryStatistics::Weights);
+
     GraphOptimizer optimizer;
 
     SortTopologically();
     InitNodes();
 
-    optimizer.ApplyCommonGraphOptimizations(*this);
+    if (optimize)
+        optimizer.ApplyCommonGraphOptimizations(*this);
 
     SortTopologically();
 
     InitDescriptors();
 
+    // refine the greedy per-node layout choices before they are materialized into reorders
+    optimizer.OptimizeLayoutAssignment(*this);
+
     ResolveInplaceDirections();
 
     InitOptimalPrimitiveDescriptors();
@@ -278,7 +321,8 @@ void Graph::InitGraph(bool optimize) {
 
     ResolveComplexInplaceConflicts();
 
-    optimizer.ApplyImplSpecificGraphOptimizations(*this);
+    if (optimize)
+        optimizer.ApplyImplSpecificGraphOptimizations(*this);
 
     GroupParallelNodes();
 
@@ -288,13 +332,28 @@ void Graph::InitGraph(bool optimize) {
 
     Allocate();
 
-    CreatePrimitivesAndExecConstants();
+#if defined(__linux__)
+    // overlap the page-in of mmap-backed weights with the compilation phase below
+    prefetchConstantInputs(graphNodes);
+#endif
+
+    if (deferPrimitives) {
+        // the memory is planned and wired eagerly (the outer nodes reference it), but primitive
+        // compilation and constant execution wait for the first Infer of this graph
+        primitivesDeferred = true;
+    } else {
+        CreatePrimitivesAndExecConstants();
+
+        // completion barrier for the weight packing the nodes deferred during the stages above:
+        // the reorders run in parallel and must all finish before the graph is marked ready
+        context->runDeferredWeightsPacking();
 
 #ifndef CPU_DEBUG_CAPS
-    for (auto &graphNode : graphNodes) {
-        graphNode->cleanup();
-    }
+        for (auto &graphNode : graphNodes) {
+            graphNode->cleanup();
+        }
 #endif
+    }
 
     ExtractExecutableNodes();
     SearchInternalStateNodes();
@@ -304,6 +363,23 @@ void Graph::InitGraph(bool optimize) {
     CPU_DEBUG_CAP_ENABLE(serialize(*this));
 }
 
+void Graph::MaterializePrimitives() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::MaterializePrimitives");
+
+    CreatePrimitivesAndExecConstants();
+
+    // no weight packing barrier here: once the compilation of the parent graph is over the packing
+    // phase is closed and the nodes pack their weights inline, see GraphContext::deferWeightsPacking
+
+#ifndef CPU_DEBUG_CAPS
+    for (auto &graphNode : graphNodes) {
+        graphNode->cleanup();
+    }
+#endif
+
+    primitivesDeferred = false;
+}
+
 void Graph::InitNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitNodes");
     for (auto &node : graphNodes) {
@@ -647,6 +723,8 @@ void Graph::AllocateWithReuse() {
     size_t remaining_edge_clusters_count = edge_clusters.size();
 
     // Resolve special cases:
+    // this loop materializes the constant edges, so their buffers belong to the weights counter
+    MemoryAccountingScope constantsAccounting(context->getMemoryStats(), MemoryStatistics::Weights);
     for (size_t i = 0; i < remaining_edge_clusters_count;) {
         auto &cluster = edge_clusters[i];
         bool erase = false;
@@ -665,7 +743,7 @@ void Graph::AllocateWithReuse() {
                         auto constNode = static_cast<node::Input *>(edge->getParent().get());
                         edge->reuse(std::const_pointer_cast<IMemory>(constNode->getMemoryPtr()));
                     } else {
-                        edge->externalAllocate(context->getWeightsCache());
+                        edge->externalAllocate(context->getWeightsCache(), context->getWeightsCacheScope());
                     }
                     auto stringMemory = dynamic_cast<StringMemory *>(edge->getMemoryPtr().get());
                     OPENVINO_ASSERT(stringMemory, "[CPU] Edge between nodes '",
@@ -699,9 +777,11 @@ void Graph::AllocateWithReuse() {
             }
             if (edge->getParent()->getType() == Type::Input) {
                 auto constNode = std::static_pointer_cast<node::Input>(edge->getParent());
-                edge->reuse(std::const_pointer_cast<IMemory>(constNode->getMemoryPtr()));
+                // the context may resolve the constant to a NUMA-local replica on multi-socket platforms
+                auto constMemory = context->getWeightsReplica(edge->name(), constNode->getMemoryPtr());
+                edge->reuse(std::const_pointer_cast<IMemory>(constMemory));
             } else {
-                edge->externalAllocate(context->getWeightsCache());
+                edge->externalAllocate(context->getWeightsCache(), context->getWeightsCacheScope());
             }
             erase = true;
         }
@@ -714,6 +794,9 @@ void Graph::AllocateWithReuse() {
         }
     }
 
+    // everything below plans the reusable tensor space, so switch back to the activations counter
+    MemoryAccountingScope activationsAccounting(context->getMemoryStats(), MemoryStatistics::Activations);
+
     const int64_t alignment = 32;  // 32 bytes
 
     // Markup the boxes
@@ -850,6 +933,16 @@ void Graph::AllocateWithReuse() {
             }
         }
 
+        // the budget driven runtime release tracks the box lifetimes in execution index terms, which
+        // normalize_boxes is about to compact, so take a snapshot up front
+        std::map<int64_t, std::pair<int, int>> boxExecLifetimes;
+        const bool trackBoxLifetimes = getConfig().activationsMemoryBudget > 0 && context->getMemoryStats();
+        if (trackBoxLifetimes) {
+            for (const auto& box : undefinedBoxes) {
+                boxExecLifetimes[box.id] = {box.start, box.finish};
+            }
+        }
+
         ov::MemorySolver::normalize_boxes(undefinedBoxes);
 
         std::vector<std::vector<ov::MemorySolver::Box>> groups; //groups of nonoverlapping boxes
@@ -880,13 +973,30 @@ void Graph::AllocateWithReuse() {
         for (auto& group : groups) {
             auto grpMemMngr =
                 std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>());
+            std::vector<std::pair<int, int>> lifetimes;
+            bool releasable = trackBoxLifetimes;
             for (auto& box : group) {
+                bool allocated = false;
                 for (auto& edge : edge_clusters[box.id]) {
                     if (edge->getStatus() == Edge::Status::NeedAllocation) {
                         edge->allocate(grpMemMngr);
+                        allocated = true;
+                    }
+                }
+                if (releasable && allocated) {
+                    const auto& lifetime = boxExecLifetimes[box.id];
+                    if (-1 == lifetime.second) {
+                        // the box has to survive the whole inference, so the group buffer may never be dropped
+                        releasable = false;
+                    } else {
+                        lifetimes.push_back(lifetime);
                     }
                 }
             }
+            if (releasable && !lifetimes.empty()) {
+                std::sort(lifetimes.begin(), lifetimes.end());
+                releasableMemMngrs.push_back({grpMemMngr, std::move(lifetimes)});
+            }
         }
     }
 
@@ -924,6 +1034,10 @@ void Graph::AllocateWithReuse() {
 void Graph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::Allocate");
 
+    // the buffers planned here hold intermediate tensors; the managers of the dynamically shaped
+    // edges keep this binding, so runtime growth still lands on the activations counter
+    MemoryAccountingScope accountingScope(context->getMemoryStats(), MemoryStatistics::Activations);
+
     //resolve inplace dead end nodes
     for (const auto& edge : graphEdges) {
         if (edge->getStatus() == Edge::Status::Uninitialized) {
@@ -981,6 +1095,67 @@ bool Graph::ProcessDynNodes() {
     return result;
 }
 
+// Densifies a strided (e.g. ROI view) input tensor which differs from the graph input memory only
+// by the source strides: the contiguous spans are copied directly in parallel, which is much
+// cheaper than the generic fallback constructing a oneDNN reorder primitive on every input push.
+// Returns false when the descriptors differ in more than the strides, so the caller has to run the
+// generic reorder.
+static bool PushStridedInputData(const CpuBlockedMemoryDescPtr& ext_tensor_desc,
+                                 const void* ext_data_ptr,
+                                 const MemoryPtr& edgeMemory) {
+    const auto& actualDesc = edgeMemory->getDescPtr();
+    if (actualDesc->getPrecision() != ext_tensor_desc->getPrecision() ||
+        !actualDesc->hasLayoutType(LayoutType::ncsp) || !(actualDesc->getType() & MemoryDescType::Blocked)) {
+        return false;
+    }
+
+    const auto& dims = actualDesc->getShape().getStaticDims();
+    if (dims.empty() || dims != ext_tensor_desc->getShape().getStaticDims() ||
+        dims != ext_tensor_desc->getBlockDims()) {
+        return false;
+    }
+
+    VectorDims denseStrides(dims.size(), 1);
+    for (size_t i = dims.size() - 1; i > 0; --i) {
+        denseStrides[i - 1] = denseStrides[i] * dims[i];
+    }
+
+    const auto actualBlockedDesc = MemoryDescUtils::convertToBlockedMemoryDesc(actualDesc);
+    if (actualBlockedDesc->getStrides() != denseStrides || actualBlockedDesc->getOffsetPadding() != 0) {
+        return false;
+    }
+
+    // the trailing dimensions with dense source strides form contiguous spans copied with a single
+    // memcpy each; a non unit innermost stride would degrade the copy to per element moves, so such
+    // tensors are left to the generic reorder
+    const auto& extStrides = ext_tensor_desc->getStrides();
+    size_t axis = dims.size();
+    while (axis > 0 && extStrides[axis - 1] == denseStrides[axis - 1]) {
+        --axis;
+    }
+    if (axis == dims.size()) {
+        return false;
+    }
+
+    const size_t spanElems = axis == 0 ? denseStrides[0] * dims[0] : denseStrides[axis - 1];
+    const size_t outerCount = denseStrides[0] * dims[0] / spanElems;
+    const size_t elemSize = actualDesc->getPrecision().size();
+
+    auto dst = reinterpret_cast<uint8_t*>(edgeMemory->getData());
+    auto src = reinterpret_cast<const uint8_t*>(ext_data_ptr);
+
+    parallel_for(outerCount, [&](size_t it) {
+        size_t srcOff = 0;
+        size_t tmp = it;
+        for (size_t d = axis; d-- > 0;) {
+            srcOff += (tmp % dims[d]) * extStrides[d];
+            tmp /= dims[d];
+        }
+        cpu_memcpy(dst + it * spanElems * elemSize, src + srcOff * elemSize, spanElems * elemSize);
+    });
+    return true;
+}
+
 void Graph::PushInputData(const std::size_t& index, const ov::SoPtr<ITensor>& input) {
     if (!IsReady()) OPENVINO_THROW("Wrong state. Topology not ready.");
     auto input_itr = inputNodesMap.find(index);
@@ -1000,8 +1175,10 @@ void Graph::PushInputData(const std::size_t& index, const ov::SoPtr<ITensor>& in
                 StringMemory ext_mem(getEngine(), ext_tensor_desc, ext_data_ptr);
                 edgeMemory->load(ext_mem);
             } else if (!actualDesc->isCompatible(*ext_tensor_desc)) {
-                Memory ext_mem(getEngine(), ext_tensor_desc, ext_data_ptr, false);
-                edgeMemory->load(ext_mem, false);
+                if (!PushStridedInputData(ext_tensor_desc, ext_data_ptr, edgeMemory)) {
+                    Memory ext_mem(getEngine(), ext_tensor_desc, ext_data_ptr, false);
+                    edgeMemory->load(ext_mem, false);
+                }
             } else {
                 size_t size_to_copy = ext_tensor_desc->getCurrentMemSize();
                 cpu_parallel_memcpy(inter_data_ptr, ext_data_ptr, size_to_copy);
@@ -1093,10 +1270,12 @@ void Graph::PullOutputData(std::unordered_map<std::size_t, ov::SoPtr<ITensor>>&
 
 void Graph::InferStatic(SyncInferRequest* request) {
     dnnl::stream stream(getEngine());
+    const bool traceNodes = ov::trace::node_spans_active();
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, getConfig().debugCaps.verbose);
         PERF(node, getConfig().collectPerfCounters);
+        ov::trace::ScopedNodeSpan span(traceNodes ? node->getName().c_str() : nullptr, node->getTypeStr().c_str());
 
         if (request)
             request->throw_if_canceled();
@@ -1329,6 +1508,9 @@ void Graph::InferDynamic(SyncInferRequest* request) {
         updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
     }
     size_t inferCounter = 0;
+    const bool traceNodes = ov::trace::node_spans_active();
+    // per group, the count of retired lifetime intervals at the moment of the last buffer release
+    std::vector<size_t> releasedBoxes(releasableMemMngrs.size(), 0ul);
 
     for (auto stopIndx : syncIndsWorkSet) {
         updateNodes->run(stopIndx);
@@ -1336,11 +1518,39 @@ void Graph::InferDynamic(SyncInferRequest* request) {
             auto& node = executableGraphNodes[inferCounter];
             VERBOSE(node, getConfig().debugCaps.verbose);
             PERF(node, getConfig().collectPerfCounters);
+            ov::trace::ScopedNodeSpan span(traceNodes ? node->getName().c_str() : nullptr,
+                                           node->getTypeStr().c_str());
 
             if (request)
                 request->throw_if_canceled();
             ExecuteNode(node, stream);
         }
+        // the shape update phase above runs ahead of the execution within a window, so releasing is
+        // only safe here at the window border, where no buffer is prepared beyond the executed nodes
+        if (!releasableMemMngrs.empty() && inferCounter > 0)
+            ReleaseSpentActivationsMemory(executableGraphNodes[inferCounter - 1]->execIndex, releasedBoxes);
+    }
+}
+
+void Graph::ReleaseSpentActivationsMemory(int lastExecIndex, std::vector<size_t>& releasedBoxes) {
+    const auto budget = getConfig().activationsMemoryBudget;
+    const auto& stats = context->getMemoryStats();
+    for (size_t i = 0; i < releasableMemMngrs.size(); ++i) {
+        const auto& lifetimes = releasableMemMngrs[i].lifetimes;
+        size_t retired = 0;
+        while (retired < lifetimes.size() && lifetimes[retired].second <= lastExecIndex)
+            retired++;
+        // drop the buffer only when at least one box has retired since the last release and no box of
+        // the group is in flight, i.e. the data of every retired box has been consumed and the next box
+        // has neither been prepared nor executed yet
+        if (retired == releasedBoxes[i] || (retired < lifetimes.size() && lifetimes[retired].first <= lastExecIndex))
+            continue;
+        if (stats->current(MemoryStatistics::Activations) <= budget)
+            continue;
+        releasableMemMngrs[i].mngr->releaseBuffer();
+        releasedBoxes[i] = retired;
+        DEBUG_LOG("activations budget: released group mngr ", releasableMemMngrs[i].mngr, " after exec index ",
+                  lastExecIndex);
     }
 }
 
@@ -1382,6 +1592,9 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
             node->toNumaNode(getGraphContext()->getCPUStreamExecutor()->get_numa_node_id());
         }
 #endif
+        if (node->isMemoized() && ExecuteNodeMemoized(node, stream)) {
+            return;
+        }
         if (node->isDynamicNode()) {
             node->executeDynamic(stream);
         } else {
@@ -1390,6 +1603,65 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     }
 }
 
+bool Graph::ExecuteNodeMemoized(const NodePtr& node, const dnnl::stream& stream) const {
+    const auto cache = context->getResultMemoCache();
+    if (!cache)
+        return false;
+
+    // fingerprint the node and the content of all its inputs
+    auto seed = ResultMemoCache::hashBytes(node->getName().data(), node->getName().size(), 0lu);
+    for (size_t port = 0; port < node->getParentEdges().size(); port++) {
+        const auto mem = node->getSrcMemoryAtPort(port);
+        if (!mem || !mem->getDesc().isDefined())
+            return false;
+        const auto prc = static_cast<ov::element::Type_t>(mem->getPrecision());
+        const auto& dims = mem->getStaticDims();
+        seed = ResultMemoCache::hashBytes(&prc, sizeof(prc), seed);
+        seed = ResultMemoCache::hashBytes(dims.data(), dims.size() * sizeof(dims[0]), seed);
+        seed = ResultMemoCache::hashBytes(mem->getData(), mem->getSize(), seed);
+    }
+    const ResultMemoCache::Key key{seed};
+
+    if (const auto record = cache->get(key)) {
+        if (node->isDynamicNode())
+            node->redefineOutputMemory(record->shapes);
+        bool restorable = record->blobs.size() == node->outputShapes.size();
+        for (size_t port = 0; restorable && port < record->blobs.size(); port++) {
+            const auto dst = node->getDstMemoryAtPort(port);
+            restorable = dst && dst->getSize() == record->blobs[port].size();
+        }
+        if (restorable) {
+            for (size_t port = 0; port < record->blobs.size(); port++) {
+                cpu_memcpy(node->getDstMemoryAtPort(port)->getData(),
+                           record->blobs[port].data(),
+                           record->blobs[port].size());
+            }
+            DEBUG_LOG("Node ", node->getName(), " is served from the result memoization cache");
+            return true;
+        }
+        // an unexpected output layout; fall through and execute, the node re-infers its shapes itself
+    }
+
+    if (node->isDynamicNode()) {
+        node->executeDynamic(stream);
+    } else {
+        node->execute(stream);
+    }
+
+    auto record = std::make_shared<ResultMemoCache::Record>();
+    for (size_t port = 0; port < node->outputShapes.size(); port++) {
+        const auto dst = node->getDstMemoryAtPort(port);
+        if (!dst || !dst->getDesc().isDefined())
+            return true;  // executed, but the outputs cannot be recorded
+        record->shapes.push_back(dst->getStaticDims());
+        const auto* data = static_cast<const uint8_t*>(dst->getData());
+        record->blobs.emplace_back(data, data + dst->getSize());
+        record->bytes += dst->getSize();
+    }
+    cache->put(key, std::move(record));
+    return true;
+}
+
 void Graph::ParalleMtNuma(size_t num_nodes,
                           ov::threading::CPUStreamsExecutor::Ptr executor,
                           const std::function<void(size_t, size_t)>& func) const {
@@ -1428,12 +1700,28 @@ void Graph::ParalleMtNuma(size_t num_nodes,
     while (nodes_remain.load() > 0) {}
 }
 
+openvino::itt::handle_t Graph::inferIttTask() {
+    // the graph is bound to one stream for its whole lifetime, so the stream index can be baked
+    // into the task name once; VTune then attributes the Infer scopes of concurrent streams
+    // without extra lookups
+    if (!inferIttHandle) {
+        const auto streamExecutor = context->getCPUStreamExecutor();
+        const int streamId = streamExecutor ? streamExecutor->get_stream_id() : -1;
+        inferIttHandle = openvino::itt::handle("Graph::Infer_" + GetName() + "_stream#" + std::to_string(streamId));
+    }
+    return inferIttHandle;
+}
+
 void Graph::Infer(SyncInferRequest* request) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, inferIttTask());
     DEBUG_LOG("Starting inference of the graph: ", GetName(), ". Status: ", static_cast<int>(status));
     if (!IsReady()) {
         OPENVINO_THROW("Wrong state of the ov::intel_cpu::Graph. Topology is not ready.");
     }
 
+    if (primitivesDeferred)
+        MaterializePrimitives();
+
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
@@ -1445,6 +1733,169 @@ void Graph::Infer(SyncInferRequest* request) {
     if (infer_count != -1) infer_count++;
 }
 
+void Graph::UpdateWeights(const std::map<std::string, ov::SoPtr<ITensor>>& weights) {
+    if (!IsReady()) {
+        OPENVINO_THROW("Wrong state of the ov::intel_cpu::Graph. Topology is not ready.");
+    }
+
+    for (const auto& entry : weights) {
+        const auto& name = entry.first;
+        const auto& tensor = entry.second;
+
+        NodePtr constNode;
+        for (const auto& node : graphNodes) {
+            if (node->getType() == Type::Input && node->isConstant() && node->getName() == name) {
+                constNode = node;
+                break;
+            }
+        }
+        OPENVINO_ASSERT(constNode, "UpdateWeights: the graph has no constant named '", name, "'");
+
+        auto input = std::static_pointer_cast<node::Input>(constNode);
+        auto memory = input->getMemoryPtr();
+        OPENVINO_ASSERT(memory && memory->getData(),
+                        "UpdateWeights: the constant '", name, "' has no allocated memory");
+        OPENVINO_ASSERT(memory->getDesc().getPrecision() == tensor->get_element_type(),
+                        "UpdateWeights: the constant '", name, "' holds ",
+                        memory->getDesc().getPrecision(), " while the new tensor holds ",
+                        tensor->get_element_type());
+        OPENVINO_ASSERT(memory->getSize() == tensor->get_byte_size(),
+                        "UpdateWeights: the constant '", name, "' holds ", memory->getSize(),
+                        " bytes while the new tensor holds ", tensor->get_byte_size());
+        OPENVINO_ASSERT(!input->holdsOriginalBlob(),
+                        "UpdateWeights: the constant '", name,
+                        "' aliases the buffer of the original model, which may be file-backed and "
+                        "can not be overwritten in place");
+
+        cpu_memcpy(memory->getData(), tensor->data(), tensor->get_byte_size());
+
+        // re-pack every consumer; the constant subgraphs were folded once on compilation, their
+        // results can not be refreshed this way
+        for (auto& childWeakEdge : constNode->getChildEdges()) {
+            auto childEdge = childWeakEdge.lock();
+            if (!childEdge)
+                continue;
+            auto child = childEdge->getChild();
+            OPENVINO_ASSERT(!child->isConstant(),
+                            "UpdateWeights: the constant '", name,
+                            "' feeds a constant-folded subgraph and can not be updated in place");
+            child->repackWeights();
+        }
+    }
+}
+
+namespace {
+/**
+ * @brief Refines a topological order so that the consumers of the same large constant input
+ *        execute as close to each other as possible.
+ *
+ * When independent branches (e.g. attention heads with tied projections) consume a shared packed
+ * weight, the default order may interleave them with unrelated layers, so by the time the next
+ * consumer runs the weight has been evicted from the LLC and is re-fetched from DRAM. The list
+ * schedule below reproduces the original order exactly (the lowest position ready node is taken),
+ * except that a ready consumer of the weights used by the just scheduled node is hoisted next to
+ * it. Graphs without shared LLC-sized weights are returned untouched.
+ */
+std::vector<NodePtr> scheduleForWeightsLocality(const std::vector<NodePtr>& nodes) {
+    // only LLC-relevant constant inputs are considered: grouping by the small shared constants
+    // (scales, zero points and alike) would shuffle the order without any locality gain
+    constexpr size_t minWeightsSize = 1lu << 20;
+
+    for (const auto& node : nodes) {
+        // sub-stream parallel sections have to be enqueued together, don't reschedule such graphs
+        if (!node->parallelWith.empty())
+            return nodes;
+    }
+
+    std::unordered_map<Node*, size_t> position;
+    position.reserve(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++)
+        position[nodes[i].get()] = i;
+
+    auto largeConstInputs = [](const NodePtr& node) {
+        std::vector<Node*> result;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parent = node->getParentEdgeAt(i)->getParent();
+            if (parent->getType() != Type::Input || !parent->isConstant())
+                continue;
+            const auto& shape = parent->getOutputShapeAtPort(0);
+            if (!shape.isStatic())
+                continue;
+            if (shape.getElementsCount() * parent->getOriginalOutputPrecisionAtPort(0).size() < minWeightsSize)
+                continue;
+            result.push_back(parent.get());
+        }
+        return result;
+    };
+
+    std::unordered_map<Node*, size_t> weightsConsumers;
+    std::vector<std::vector<Node*>> nodeWeights(nodes.size());
+    bool hasSharedWeights = false;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        nodeWeights[i] = largeConstInputs(nodes[i]);
+        for (auto* weights : nodeWeights[i]) {
+            if (++weightsConsumers[weights] > 1)
+                hasSharedWeights = true;
+        }
+    }
+    if (!hasSharedWeights)
+        return nodes;
+
+    std::unordered_map<Node*, std::vector<size_t>> consumersOf;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        for (auto* weights : nodeWeights[i]) {
+            if (weightsConsumers[weights] > 1)
+                consumersOf[weights].push_back(i);
+        }
+    }
+
+    std::vector<size_t> pendingParents(nodes.size());
+    std::set<size_t> ready;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        pendingParents[i] = nodes[i]->getParentEdges().size();
+        if (pendingParents[i] == 0)
+            ready.insert(i);
+    }
+
+    std::vector<NodePtr> result;
+    result.reserve(nodes.size());
+    std::vector<Node*> hotWeights;
+
+    while (!ready.empty()) {
+        size_t next = *ready.begin();
+        size_t hoisted = nodes.size();
+        for (auto* weights : hotWeights) {
+            auto itr = consumersOf.find(weights);
+            if (itr == consumersOf.end())
+                continue;
+            for (size_t pos : itr->second) {
+                if (ready.count(pos))
+                    hoisted = std::min(hoisted, pos);
+            }
+        }
+        if (hoisted < nodes.size())
+            next = hoisted;
+
+        ready.erase(next);
+        const auto& node = nodes[next];
+        result.push_back(node);
+        hotWeights = std::move(nodeWeights[next]);
+
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto child = node->getChildEdgeAt(i)->getChild();
+            const size_t childPos = position.at(child.get());
+            if (--pendingParents[childPos] == 0)
+                ready.insert(childPos);
+        }
+    }
+
+    if (result.size() != nodes.size())  // never expected on a successfully sorted graph
+        return nodes;
+
+    return result;
+}
+}  // namespace
+
 void Graph::SortTopologically() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::SortTopologically");
 
@@ -1493,6 +1944,9 @@ void Graph::SortTopologically() {
     graphNodes = sort(graphNodes);
     // reverse to the actual topological order
     std::reverse(graphNodes.begin(), graphNodes.end());
+    // bring the consumers of shared packed weights together so the weights are reused while still
+    // cache resident (see scheduleForWeightsLocality)
+    graphNodes = scheduleForWeightsLocality(graphNodes);
     // number the nodes based on topological order
     for (size_t i = 0; i < graphNodes.size(); i++) {
         // parallel nodes has same execIndex
@@ -1540,6 +1994,23 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
             pc.node_type = node->typeStr;
             perfMap.emplace_back(pc);
 
+            // a dynamic node executed with several shape signatures additionally reports one entry
+            // per signature, so the shapes responsible for the tail latency can be told apart;
+            // cpu_time carries the bucket average and real_time the estimated bucket p99
+            const auto& buckets = node->PerfCounter().shapeBuckets();
+            if (buckets.size() > 1) {
+                for (const auto& bucket : buckets) {
+                    ov::ProfilingInfo bucketPc;
+                    bucketPc.node_name = node->getName() + " " + bucket.first;
+                    bucketPc.cpu_time = std::chrono::microseconds(bucket.second.avg());
+                    bucketPc.real_time = std::chrono::microseconds(bucket.second.percentile(99));
+                    bucketPc.status = ov::ProfilingInfo::Status::EXECUTED;
+                    bucketPc.exec_type = pc.exec_type;
+                    bucketPc.node_type = pc.node_type;
+                    perfMap.emplace_back(bucketPc);
+                }
+            }
+
             for (auto& fusedNode : node->fusedWith) {
                 getPerfMapFor(perfMap, fusedNode);
             }
@@ -51,7 +51,7 @@ public:
     }
 
     template<typename NET>
-    void CreateGraph(NET &network, const GraphContext::CPtr ctx);
+    void CreateGraph(NET &network, const GraphContext::CPtr ctx, bool deferPrimitives = false);
 
     void CreateGraph(const std::vector<NodePtr> &graphNodes,
                      const std::vector<EdgePtr> &graphEdges,
@@ -63,6 +63,14 @@ public:
 
     void Infer(SyncInferRequest* request = nullptr);
 
+    /**
+     * @brief Copies new data into the named constants in place and re-packs their consumers,
+     * leaving the rest of the compiled graph intact (LoRA-style adapter swap).
+     * @param weights map from the friendly name of a constant to a tensor with the new data;
+     *        every tensor must match the element type and byte size of the constant it replaces
+     */
+    void UpdateWeights(const std::map<std::string, ov::SoPtr<ITensor>>& weights);
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -188,7 +196,11 @@ public:
     getInternalStateNodes() const {
         return internalStateNodes;
     }
-    void InitGraph(bool optimize = true);
+    void InitGraph(bool optimize = true, bool deferPrimitives = false);
+    // compiles the primitives and executes the constant nodes whose processing was postponed at
+    // CreateGraph time (see the deferPrimitives parameter); called from the first Infer of the
+    // graph, so a deferred graph which is never inferred never pays for the compilation
+    void MaterializePrimitives();
 
 protected:
     void ForgetGraphData() {
@@ -208,6 +220,8 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    bool primitivesDeferred = false;
+
     MemoryPtr memWorkspace;
 
     std::vector<NodePtr> graphNodes;
@@ -231,9 +245,14 @@ protected:
     void ExtractExecutableNodes();
     void SearchInternalStateNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
+
+    // serves a node designated for memoization from the result cache, executing and recording it on
+    // a miss; returns false when memoization is off or the node is not eligible this inference
+    bool ExecuteNodeMemoized(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
     void InferStatic(SyncInferRequest* request);
     void InferDynamic(SyncInferRequest* request);
+    void ReleaseSpentActivationsMemory(int lastExecIndex, std::vector<size_t>& releasedBoxes);
     void ParalleMtNuma(size_t num_nodes,
                        ov::threading::CPUStreamsExecutor::Ptr executor,
                        const std::function<void(size_t, size_t)>& func) const;
@@ -256,8 +275,21 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // memory managers of the dynamically shaped edge groups together with the exec index lifetimes of
+    // their boxes; only filled when the activations memory budget is set, so InferDynamic can release
+    // the buffers of the groups with no box in flight (see ReleaseSpentActivationsMemory)
+    struct ReleasableMemMngr {
+        std::shared_ptr<DnnlMemoryMngr> mngr;
+        std::vector<std::pair<int, int>> lifetimes;  // sorted [start, finish] exec index intervals
+    };
+    std::vector<ReleasableMemMngr> releasableMemMngrs;
+
     GraphContext::CPtr context;
 
+    // itt annotation of Infer carrying the graph name and the stream index, see inferIttTask()
+    openvino::itt::handle_t inferIttHandle = nullptr;
+
+    openvino::itt::handle_t inferIttTask();
     void EnforceInferencePrecision();
     void EnforceBF16();
     void insertReorder(EdgePtr& edge, bool isOptimized, std::unordered_set<std::string>& uniqueLayerNames);
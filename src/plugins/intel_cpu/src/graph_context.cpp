@@ -3,6 +3,8 @@
 //
 #include "dnnl_types.h"
 #include "graph_context.h"
+#include "nodes/common/cpu_memcpy.h"
+#include "openvino/core/parallel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -12,5 +14,48 @@ const dnnl::engine& GraphContext::getEngine() {
     return eng;
 }
 
+MemoryCPtr GraphContext::getWeightsReplica(const std::string& key, const MemoryCPtr& weights) const {
+    // a replica only pays off when streams on several NUMA nodes read the same weights
+    if (!config.enableWeightsReplication || !weightsCache || numNumaNodes < 2 || !weights ||
+        weights->getDesc().getPrecision() == element::string)
+        return weights;
+
+    auto create = [&]() {
+        MemoryPtr replica = std::make_shared<Memory>(getEngine(), weights->getDescPtr());
+        cpu_memcpy(replica->getData(), weights->getData(), weights->getSize());
+        if (cpuStreamExecutor) {
+            mbind_move(replica, cpuStreamExecutor->get_numa_node_id());
+        }
+        return replica;
+    };
+    // the weights cache is per socket, so each socket resolves the key to its own local clone;
+    // the key is edge name based, so it is scoped per compiled model
+    MemoryPtr replica = *weightsCache->findOrCreate(weightsCacheScope + key + "_replica", create);
+    return replica;
+}
+
+bool GraphContext::deferWeightsPacking(std::function<void()> task) const {
+    std::lock_guard<std::mutex> lock(weightsPackingMutex);
+    if (!weightsPackingDeferrable)
+        return false;
+    weightsPackingTasks.emplace_back(std::move(task));
+    return true;
+}
+
+void GraphContext::runDeferredWeightsPacking() const {
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(weightsPackingMutex);
+        // from now on the nodes pack inline, e.g. when a dynamic graph repacks during inference
+        weightsPackingDeferrable = false;
+        tasks.swap(weightsPackingTasks);
+    }
+    if (tasks.empty())
+        return;
+    ov::parallel_for(tasks.size(), [&](size_t i) {
+        tasks[i]();
+    });
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -6,6 +6,7 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "cache/multi_cache.h"
+#include "cache/result_memo.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
 #include "weights_cache.hpp"
@@ -21,12 +22,29 @@ public:
     GraphContext(const Config& config,
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
-                 ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr)
+                 ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
+                 std::string weightsCacheScope = {},
+                 MemoryStatistics::Ptr memoryStats = nullptr)
         : config(config),
           weightsCache(std::move(w_cache)),
+          weightsCacheScope(std::move(weightsCacheScope)),
+          memoryStatsPtr(std::move(memoryStats)),
           isGraphQuantizedFlag(isGraphQuantized),
           streamExecutor(streamExecutor) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        // back the per-graph cache by the process-wide shared instance, so streams and other
+        // compiled models of this process reuse already JIT-ed kernels and oneDNN primitives
+        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity, true);
+        // one instance per compiled model, so results memoized by one stream are reused by the others
+        if (config.memoizationCacheSize > 0) {
+            resultMemoCache = std::make_shared<ResultMemoCache>(config.memoizationCacheSize);
+        }
+        // publish the hugepage mode before this model allocates anything big; enable-only, so a
+        // model compiled without the property does not flip the process-wide mode off mid-flight
+        if (config.hugePages == HugePages::PAGE_1G) {
+            set_huge_pages_mode(HugePagesMode::Use1G);
+        } else if (config.hugePages == HugePages::PAGE_2M) {
+            set_huge_pages_mode(HugePagesMode::Use2M);
+        }
         // primitive/executors can be shared across sub-stream
         // but scratch pad cannot be shared.
         numNumaNodes = 1;
@@ -36,6 +54,9 @@ public:
             if (numNumaNodes < nNumaNodes)
                 numNumaNodes = nNumaNodes;
         }
+        // the scratch managers capture the binding at construction, so the runtime growth of the
+        // scratch buffers stays attributed to this model's scratch counter
+        MemoryAccountingScope scratchAccounting(memoryStatsPtr, MemoryStatistics::Scratch);
         for (int i = 0; i < numNumaNodes; i++) {
             rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
         }
@@ -49,11 +70,41 @@ public:
         return weightsCache;
     }
 
+    // Prefix for the name-keyed weights cache entries. The cache itself is shared between
+    // compiled models on the plugin level, so entries which are not content-addressed have
+    // to be isolated per compiled model
+    const std::string& getWeightsCacheScope() const {
+        return weightsCacheScope;
+    }
+
+    // resolves read-only weights to a replica local to the socket this graph runs on (when weights
+    // replication is enabled and there is more than one NUMA node), otherwise returns them as is
+    MemoryCPtr getWeightsReplica(const std::string& key, const MemoryCPtr& weights) const;
+
+    // queues a weight packing task to be executed at the end of graph compilation instead of inline;
+    // returns false once the packing phase is over, in which case the caller has to pack immediately
+    bool deferWeightsPacking(std::function<void()> task) const;
+
+    // executes all deferred weight packing tasks in parallel and closes the packing phase;
+    // serves as the completion barrier the graph has to pass before it is marked ready
+    void runDeferredWeightsPacking() const;
+
+
+    // per compiled model allocation counters, null for the helper contexts which do not run inference
+    MemoryStatistics::Ptr getMemoryStats() const {
+        return memoryStatsPtr;
+    }
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
     }
 
+    // content-hash keyed cache of the outputs of the nodes designated for memoization,
+    // null unless the feature is enabled via ov::intel_cpu::memoization_cache_size
+    ResultMemoCache::Ptr getResultMemoCache() const {
+        return resultMemoCache;
+    }
+
     DnnlScratchPadPtr getScratchPad(int subStreamID = 0) const {
         if (subStreamID < 0)
             subStreamID = 0;
@@ -84,8 +135,12 @@ private:
     Config config;  // network-level config
 
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    std::string weightsCacheScope;            // prefix of the name-keyed weights cache entries
+
+    MemoryStatistics::Ptr memoryStatsPtr;     // allocation counters of the owning compiled model
 
     MultiCachePtr rtParamsCache;     // primitive cache
+    ResultMemoCache::Ptr resultMemoCache;  // memoized node outputs, null when memoization is off
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
 
     bool isGraphQuantizedFlag = false;
@@ -96,6 +151,10 @@ private:
 
     ov::threading::CPUStreamsExecutor::Ptr cpuStreamExecutor;   // cpu stream executor for current graph
 
+    mutable std::mutex weightsPackingMutex;
+    mutable std::vector<std::function<void()>> weightsPackingTasks;  // deferred weight packing tasks
+    mutable bool weightsPackingDeferrable = true;
+
     int numNumaNodes = 1;
 };
 
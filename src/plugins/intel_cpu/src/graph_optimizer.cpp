@@ -6,6 +6,7 @@
 
 #include "dnnl_extension_utils.h"
 #include "nodes/bin_conv.h"
+#include "nodes/color_convert.h"
 #include "nodes/common/cpu_convert.h"
 #include "nodes/conv.h"
 #include "nodes/deconv.h"
@@ -147,6 +148,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseMVNAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndSimpleOperation");
+    FuseColorConvertAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseInterpolateAndSimpleOperation");
     FuseInterpolateAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -377,8 +382,13 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
             continue;
         if (supportedWeightsPrecisions.find(weightsNode->getOriginalOutputPrecisionAtPort(0)) == supportedWeightsPrecisions.end())
             continue;
-        if (withSubtract &&
-            !one_of(subtractConstNode->getOriginalOutputPrecisionAtPort(0), weightsNode->getOriginalOutputPrecisionAtPort(0), ov::element::f32))
+        // the zero points are repacked into f32 (or u8 for the dynamic quantization path) by the
+        // post-ops composer, so any precision a reorder can read is acceptable; asymmetric models
+        // frequently store them in u8/i8 even for 4-bit weights
+        if (withSubtract && !one_of(subtractConstNode->getOriginalOutputPrecisionAtPort(0),
+                                    weightsNode->getOriginalOutputPrecisionAtPort(0),
+                                    ov::element::f32, ov::element::f16, ov::element::bf16,
+                                    ov::element::u8, ov::element::i8))
             continue;
 
         // Shape limitations
@@ -1843,6 +1853,65 @@ void GraphOptimizer::FuseMVNAndSimpleOperation(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseColorConvertAndSimpleOperation(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](NodePtr node) {
+        return node->getType() == Type::ColorConvert && node->getChildEdges().size() == 1;
+    };
+
+    auto isSuitableChildNode = [&](NodePtr parentNode, NodePtr childNode) {
+        // Avoid cycle dependencies
+        for (auto &childParentEdge : childNode->getParentEdges()) {
+            for (auto &parentParentEdge : parentNode->getParentEdges()) {
+                if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
+                    return false;
+            }
+        }
+        if (!childNode->getFusedWith().empty())
+            return false;
+        auto colorConvertNode = dynamic_cast<ColorConvert*>(parentNode.get());
+        if (!colorConvertNode) {
+            OPENVINO_THROW("Cannot cast ", parentNode->getName(), " to ColorConvert");
+        }
+        return colorConvertNode->canFuse(childNode);
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseColorConvertAndSimpleOperation_ParentNode);
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildNode(parentNode, childNode)) {
+            parent++;
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseColorConvertAndSimpleOperation_ChildNode);
+
+        childNode->fuseInto(parentNode);
+
+        if (childNode->getType() == Type::Eltwise) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent()->getType() == Type::ColorConvert)
+                    continue;
+
+                graph.RemoveEdge(p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void GraphOptimizer::FuseInterpolateAndSimpleOperation(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -2113,6 +2182,108 @@ void GraphOptimizer::FuseEltwiseAndSimple(Graph &graph) {
     }
 }
 
+void GraphOptimizer::OptimizeLayoutAssignment(Graph& graph) {
+    // The nodes pick their layouts greedily in topological order, each matching only the already
+    // selected parents (see Node::selectPreferPrimitiveDescriptor), so a node may commit to a
+    // layout its consumers cannot take, and ResolveEdgeConflicts later pays for it with a reorder
+    // on every mismatched edge. This pass refines the greedy assignment model-wide: it sweeps the
+    // nodes re-selecting a descriptor whenever an alternative lowers the total size of the tensors
+    // that would have to be reordered, counting both the parent and the child edges. Every
+    // re-selection strictly lowers a non-negative total cost, so the sweeps converge; the sweep
+    // bound keeps the worst case linear in the graph size.
+    //
+    // Only layout variants of the already chosen implementation with identical precisions and
+    // in-place intentions are considered, so the pass never trades a faster kernel, a precision or
+    // a memory sharing decision for fewer reorders.
+    const auto& graphNodes = graph.GetNodes();
+
+    auto edgeWeight = [](const Node& producer, int port) -> size_t {
+        const auto& shape = producer.getOutputShapeAtPort(static_cast<size_t>(port));
+        // a dynamically shaped tensor still pays for a reorder, account it as a unit
+        return shape.isStatic() ? shape.getElementsCount() : 1lu;
+    };
+
+    auto reorderCost = [&](const NodePtr& node, const NodeConfig& config) -> size_t {
+        size_t cost = 0;
+        for (size_t port = 0; port < config.inConfs.size() && port < node->getParentEdges().size(); port++) {
+            auto parentEdge = node->getParentEdgeAt(port);
+            auto parent = parentEdge->getParent();
+            // reorders on the constant path run once on compilation, not at inference time
+            if (parent->isConstant())
+                continue;
+            auto parentSpd = parent->getSelectedPrimitiveDescriptor();
+            if (!parentSpd || parentSpd->getConfig().outConfs.empty())
+                continue;
+            int inNum = parentEdge->getInputNum();
+            if (inNum < 0 || inNum >= static_cast<int>(parentSpd->getConfig().outConfs.size()))
+                inNum = 0;
+            const auto parentDesc = parentSpd->getConfig().outConfs[inNum].getMemDesc();
+            if (!config.inConfs[port].getMemDesc()->isCompatible(*parentDesc))
+                cost += edgeWeight(*parent, inNum);
+        }
+        for (auto& childWeakEdge : node->getChildEdges()) {
+            auto childEdge = childWeakEdge.lock();
+            if (!childEdge)
+                continue;
+            auto childSpd = childEdge->getChild()->getSelectedPrimitiveDescriptor();
+            if (!childSpd)
+                continue;
+            const int outNum = childEdge->getInputNum();
+            const int childPort = childEdge->getOutputNum();
+            if (outNum < 0 || outNum >= static_cast<int>(config.outConfs.size()) || childPort < 0 ||
+                childPort >= static_cast<int>(childSpd->getConfig().inConfs.size()))
+                continue;
+            const auto childDesc = childSpd->getConfig().inConfs[childPort].getMemDesc();
+            if (!childDesc->isCompatible(*config.outConfs[outNum].getMemDesc()))
+                cost += edgeWeight(*node, outNum);
+        }
+        return cost;
+    };
+
+    auto sameContract = [](const NodeConfig& lhs, const NodeConfig& rhs) {
+        auto samePort = [](const PortConfig& l, const PortConfig& r) {
+            return l.inPlace() == r.inPlace() && l.constant() == r.constant() &&
+                   l.getMemDesc()->getPrecision() == r.getMemDesc()->getPrecision();
+        };
+        return lhs.inConfs.size() == rhs.inConfs.size() && lhs.outConfs.size() == rhs.outConfs.size() &&
+               std::equal(lhs.inConfs.begin(), lhs.inConfs.end(), rhs.inConfs.begin(), samePort) &&
+               std::equal(lhs.outConfs.begin(), lhs.outConfs.end(), rhs.outConfs.begin(), samePort);
+    };
+
+    bool changed = true;
+    for (int sweep = 0; sweep < 3 && changed; sweep++) {
+        changed = false;
+        for (const auto& node : graphNodes) {
+            const auto& spds = node->getSupportedPrimitiveDescriptors();
+            if (spds.size() < 2 || node->isConstant())
+                continue;
+            const auto* selected = node->getSelectedPrimitiveDescriptor();
+            if (!selected)
+                continue;
+            size_t bestCost = reorderCost(node, selected->getConfig());
+            if (bestCost == 0)
+                continue;
+            int bestIndex = -1;
+            for (size_t i = 0; i < spds.size(); i++) {
+                if (&spds[i] == selected || spds[i].getImplementationType() != selected->getImplementationType())
+                    continue;
+                if (!sameContract(spds[i].getConfig(), selected->getConfig()))
+                    continue;
+                const auto cost = reorderCost(node, spds[i].getConfig());
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIndex = static_cast<int>(i);
+                }
+            }
+            if (bestIndex >= 0) {
+                DEBUG_LOG(node->getName(), " re-selects primitive desc ", bestIndex, " to save reorders");
+                node->selectPrimitiveDescriptorByIndex(bestIndex);
+                changed = true;
+            }
+        }
+    }
+}
+
 void GraphOptimizer::ShareReorders(Graph& graph) {
     auto getSuitableReorder = [](NodePtr node) -> Reorder* {
         if (node->getType() != Type::Reorder)
@@ -17,6 +17,7 @@ public:
     void ApplyCommonGraphOptimizations(Graph& graph);
     void ApplyImplSpecificGraphOptimizations(Graph& graph);
     void ShareReorders(Graph &graph);
+    void OptimizeLayoutAssignment(Graph &graph);
 
 private:
     void FuseConvMatmulFCDeconvAndDQScales(Graph &graph);
@@ -35,6 +36,7 @@ private:
     void FusePoolingAndFakeQuantize(Graph &graph);
     void FuseConvolutionSumAndConvolutionSumActivation(Graph &graph);
     void FuseMVNAndSimpleOperation(Graph &graph);
+    void FuseColorConvertAndSimpleOperation(Graph &graph);
     void FuseInterpolateAndSimpleOperation(Graph &graph);
     void FuseNormalizeL2AndSimpleOperation(Graph &graph);
     void FuseReduceAndSimpleOperation(Graph &graph);
@@ -40,6 +40,7 @@ SyncInferRequest::SyncInferRequest(std::shared_ptr<const CompiledModel> compiled
 
 void SyncInferRequest::create_infer_request() {
     auto id = (m_compiled_model->m_numRequests)++;
+    m_request_id = id;
     m_profiling_task = openvino::itt::handle("INTEL_CPU_INFER_" + m_compiled_model->m_name + "_" + std::to_string(id));
 
     if (m_compiled_model->m_graphs.size() == 0) {
@@ -103,11 +104,32 @@ void SyncInferRequest::update_external_tensor_ptrs() {
     }
 }
 
+openvino::itt::handle_t SyncInferRequest::itt_infer_task() {
+    // tags the infer scope with the request id, the stream the request landed on and the input
+    // shape signature, so multi-stream VTune traces can be triaged without hand instrumented
+    // builds; the handle is interned and only rebuilt when the stream or the shapes change
+    const auto streamExecutor = m_graph->getGraphContext()->getCPUStreamExecutor();
+    std::string signature = "request#" + std::to_string(m_request_id) + "_stream#" +
+                            std::to_string(streamExecutor ? streamExecutor->get_stream_id() : -1);
+    for (size_t i = 0; i < m_input_ports_map.size(); i++) {
+        const auto& shape = get_tensor(m_input_ports_map.at(i))->get_shape();
+        signature += i == 0 ? "_shapes_" : ";";
+        for (size_t dim = 0; dim < shape.size(); dim++)
+            signature += (dim == 0 ? "" : "x") + std::to_string(shape[dim]);
+    }
+    if (signature != m_itt_infer_signature) {
+        m_itt_infer_signature = std::move(signature);
+        m_itt_infer_handle = openvino::itt::handle(m_itt_infer_signature);
+    }
+    return m_itt_infer_handle;
+}
+
 void SyncInferRequest::infer() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, m_profiling_task);
     auto graphLock = m_compiled_model->get_graph();
     m_graph = &(graphLock._graph);
+    OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, itt_infer_task());
 
     throw_if_canceled();
     convert_batched_tensors();
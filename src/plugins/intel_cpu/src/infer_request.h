@@ -103,6 +103,8 @@ private:
     void update_external_tensor_ptrs();
     void change_default_ptr();
 
+    openvino::itt::handle_t itt_infer_task();
+
     const ov::Output<const ov::Node>& get_internal_port(const ov::Output<const ov::Node>& port) const;
 
 private:
@@ -114,6 +116,11 @@ private:
 
     std::shared_ptr<const CompiledModel> m_compiled_model;
     openvino::itt::handle_t m_profiling_task;
+    // itt annotation of the last infer with the stream index and the input shape signature,
+    // rebuilt only when either of them changes, see itt_infer_task()
+    openvino::itt::handle_t m_itt_infer_handle = nullptr;
+    std::string m_itt_infer_signature;
+    int m_request_id = 0;
     std::vector<MemStatePtr> m_memory_states;
     AsyncInferRequest* m_asyncRequest = nullptr;
 
@@ -21,6 +21,87 @@ static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_cap
  */
 static constexpr Property<bool, PropertyMutability::RW> lp_transforms_mode{"LP_TRANSFORMS_MODE"};
 
+/**
+ * @brief Replicate read-only weights to every NUMA node, so streams running on a remote socket read a
+ * local copy instead of fetching the original allocation over the inter-socket link on every inference.
+ * Trades memory footprint (one weights copy per NUMA node) for throughput on multi-socket platforms.
+ */
+static constexpr Property<bool, PropertyMutability::RW> weights_replication{"CPU_WEIGHTS_REPLICATION"};
+
+/**
+ * @brief Pick the throughput-mode stream count empirically instead of by heuristic: compile a few
+ * candidate stream configurations, measure their throughput on the actual model with zero-filled
+ * inputs and keep the winner. Opt-in since it adds a bounded amount of compile time; the winner is
+ * persisted in the model cache next to the other CPU hints, so cached reloads skip the search.
+ */
+static constexpr Property<bool, PropertyMutability::RW> streams_auto_tune{"CPU_STREAMS_AUTO_TUNE"};
+
+/**
+ * @brief Upper bound, in bytes, on the live intermediate tensor memory of dynamically shaped graphs.
+ * While the activations counter is above the budget, the buffers of intermediate tensors are released
+ * as soon as their last consumer within the current inference has executed, instead of being retained
+ * for reuse by the following inferences. This trades buffer reallocation time for footprint, which
+ * makes huge-activation workloads (e.g. very long context prefill) fit in less host memory.
+ * 0 (the default) disables the budget and keeps all buffers allocated at their high-water marks.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> activations_memory_budget{"CPU_ACTIVATIONS_MEMORY_BUDGET"};
+
+/**
+ * @brief Byte budget of the cross-request result memoization cache. Nodes designated with the
+ * "memoize" runtime attribute cache their output blobs keyed by a fingerprint of their input
+ * content, so requests which repeat identical sub-inputs (a shared prompt prefix, a constant
+ * watermark image) skip recomputing the designated subgraphs. Records are evicted in LRU order
+ * once the budget is exceeded. 0 (the default) disables memoization.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> memoization_cache_size{"CPU_MEMOIZATION_CACHE_SIZE"};
+
+/**
+ * @brief Enum to define the explicit hugepage modes.
+ */
+enum class HugePages {
+    DISABLE = 0,  //!< Regular 4KB pages
+    PAGE_2M = 1,  //!< Back large long-lived allocations with explicit 2MB pages
+    PAGE_1G = 2,  //!< Back large long-lived allocations with explicit 1GB pages
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const HugePages& mode) {
+    switch (mode) {
+    case HugePages::DISABLE:
+        return os << "DISABLE";
+    case HugePages::PAGE_2M:
+        return os << "2M";
+    case HugePages::PAGE_1G:
+        return os << "1G";
+    default:
+        OPENVINO_THROW("Unsupported hugepage mode value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, HugePages& mode) {
+    std::string str;
+    is >> str;
+    if (str == "DISABLE") {
+        mode = HugePages::DISABLE;
+    } else if (str == "2M") {
+        mode = HugePages::PAGE_2M;
+    } else if (str == "1G") {
+        mode = HugePages::PAGE_1G;
+    } else {
+        OPENVINO_THROW("Unsupported hugepage mode: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Back the large long-lived CPU allocations (packed weights, KV cache state) with explicit
+ * hugepages of the selected size, which removes the dTLB pressure of walking multi-gigabyte
+ * weights with 4KB pages during decode. Requires pages reserved in the OS hugepage pool; when the
+ * pool is exhausted or absent the allocations silently fall back to regular pages.
+ */
+static constexpr Property<HugePages, PropertyMutability::RW> use_hugepages{"CPU_USE_HUGEPAGES"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
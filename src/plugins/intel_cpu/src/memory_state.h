@@ -94,6 +94,12 @@ private:
     size_t buffer_num = 0;
 };
 
+// Dense per-request KV-cache state. The cache is kept as one contiguous tensor per variable since
+// get_state()/set_state() expose it to the application as such; growth is amortized by the SDPA node,
+// which reserves extra rows along the sequence axis and only reallocates (with a copy) when the
+// reserve is exhausted. Block granular (paged) cache management with cross-sequence sharing is
+// provided by the PagedAttention flavour of the SDPA node instead, where the runtime owns the block
+// pool and per-sequence block tables and no state variables are involved.
 class VariableStateKVcache : public VariableStateBase {
 public:
     VariableStateKVcache(const std::string& name,
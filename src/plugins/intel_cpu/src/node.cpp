@@ -33,6 +33,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "common/primitive_hashing_utils.hpp"
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
 
@@ -114,6 +115,10 @@ Node::Node(const std::shared_ptr<ov::Node>& op,
         parallelDomain = getRTInfoValue(rtInfo, "parallelDomain");
     }
 
+    if (rtInfo.count("memoize")) {
+        memoizeOutputs = true;
+    }
+
     if (originalLayers.empty()) {
         addOriginalLayer(name);
     }
@@ -228,6 +233,14 @@ void Node::createPrimitive() {
     }
 }
 
+void Node::repackWeights() {
+    // the per-node replicas are keyed by format only; the shared caches key on the content, so
+    // their stale entries simply stop being referenced
+    if (privateWeightCache)
+        privateWeightCache->clear();
+    createPrimitive();
+}
+
 void Node::selectOptimalPrimitiveDescriptor() {
     selectPreferPrimitiveDescriptor(getImplPriority(), false);
 }
@@ -489,6 +502,22 @@ std::string Node::getPrimitiveDescriptorType() const {
     return str_type;
 }
 
+std::string Node::shapeSignature() const {
+    if (!isDynamicNode())
+        return {};
+
+    std::string signature;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        const auto& edge = getParentEdgeAt(i);
+        if (!edge->getMemoryPtr())
+            continue;
+        if (!signature.empty())
+            signature += ", ";
+        signature += edge->getMemory().getDesc().getShape().toString();
+    }
+    return signature;
+}
+
 EdgePtr Node::getParentEdgeAt(size_t idx) const {
     if (idx >= parentEdges.size())
         OPENVINO_THROW("Node ", getName(), " contains less parent edges than ", idx);
@@ -828,7 +857,19 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
                                         + "_" + std::to_string(internalBlob->getSize())
                                         + "_" + std::to_string(data_hash);
 
-        ptr = *weightCache->findOrCreate(string_hash, create);
+        // the key is a full content hash, so the packed blob may also be shared between processes
+        ptr = *weightCache->findOrCreate(string_hash, create, true, true);
+    } else if (!isConstant()) {
+        // allocate now, reorder in background: the graph runs all deferred packing tasks in
+        // parallel and waits for them before it is marked ready, see Graph::InitGraph
+        MemoryPtr _ptr = std::make_shared<Memory>(engine, intDesc);
+        const auto eng = engine;
+        const auto blob = internalBlob;
+        bool deferred = context->deferWeightsPacking([eng, blob, _ptr]() {
+            Memory memory{eng, blob->getDescPtr(), blob->getData()};
+            node::Reorder::reorderData(memory, *_ptr);
+        });
+        ptr = deferred ? _ptr : create();
     } else {
         ptr = create();
     }
@@ -892,11 +933,28 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
 
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr) {
+        const bool processShareable = WeightsSharing::processSharingEnabled();
+        // the leading bytes are a cheap per-process stand-in for a hash, but a key published to
+        // the other workers of the host must identify the full content
+        const uint64_t data_hash = processShareable
+            ? weightCache->GetHashFunc().hash(static_cast<const unsigned char*>(edgeMem->getData()),
+                                              edgeMem->getSize())
+            : *edgeMem->getDataAs<uint64_t>();
         const std::string string_hash = getName() + "_" + format
             + "_" + std::to_string(edgeMem->getSize())
-            + "_" + std::to_string(*edgeMem->getDataAs<uint64_t>());
-
-        ptr = *weightCache->findOrCreate(string_hash, create);
+            + "_" + std::to_string(data_hash);
+
+        ptr = *weightCache->findOrCreate(string_hash, create, true, processShareable);
+    } else if (!isConstant()) {
+        // allocate now, reorder in background: the graph runs all deferred packing tasks in
+        // parallel and waits for them before it is marked ready, see Graph::InitGraph
+        MemoryPtr dstMem = std::make_shared<Memory>(getEngine(), dstWeightDesc);
+        const auto eng = getEngine();
+        bool deferred = context->deferWeightsPacking([eng, srcWeightDesc, edgeMem, dstMem]() {
+            Memory srcMemory{eng, srcWeightDesc, edgeMem->getData()};
+            node::Reorder::reorderData(srcMemory, *dstMem);
+        });
+        ptr = deferred ? dstMem : create();
     } else {
         ptr = create();
     }
@@ -1596,6 +1654,17 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<Shape>& shapes
     }
 }
 
+size_t Node::ShapeInferResultKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+    size_t seed = 0;
+    seed = hash_combine(seed, inputDims.size());
+    for (const auto& dims : inputDims) {
+        seed = get_vector_hash(seed, dims);
+    }
+    return seed;
+}
+
 IShapeInfer::Result Node::shapeInfer() const {
     try {
         std::vector<std::reference_wrapper<const VectorDims>> input_shapes;
@@ -1605,12 +1674,34 @@ IShapeInfer::Result Node::shapeInfer() const {
         for (size_t port = 0; port < inputShapes.size(); ++port)
             input_shapes.emplace_back(std::ref(getParentEdgeAt(port)->getMemory().getStaticDims()));
 
+        if (EMPTY_PORT_MASK == input_value_port_mask) {
+            // the output shapes depend on the input shapes only, so the result may be memoized;
+            // the consecutive repetitions of the same shapes are already filtered out by
+            // needShapeInfer(), the cache covers the inputs alternating over a small set of
+            // shapes, e.g. the bucketed sequence lengths of a decoding loop
+            ShapeInferResultKey key;
+            key.inputDims.reserve(input_shapes.size());
+            for (const auto& shape : input_shapes)
+                key.inputDims.push_back(shape.get());
+
+            auto cachedDims = shapeInferCache.get(key);
+            if (!cachedDims.empty())
+                return {std::move(cachedDims), ShapeInferStatus::success};
+
+            auto result = shapeInference->infer(input_shapes, {});
+            // the implementations which generate padding as by-product (e.g. convolutions with
+            // auto_pad) must recompute it every call, so their results are not cached
+            if (ShapeInferStatus::success == result.status && shapeInference->get_pads_begin().empty() &&
+                shapeInference->get_pads_end().empty()) {
+                shapeInferCache.put(key, result.dims);
+            }
+            return result;
+        }
+
         std::unordered_map<size_t, MemoryPtr> input_values;
-        if (input_value_port_mask) {
-            for (size_t port = 0; port < inputShapes.size(); ++port) {
-                if (input_value_port_mask & (1 << port)) {
-                    input_values[port] = getSrcMemoryAtPort(port);
-                }
+        for (size_t port = 0; port < inputShapes.size(); ++port) {
+            if (input_value_port_mask & (1 << port)) {
+                input_values[port] = getSrcMemoryAtPort(port);
             }
         }
 
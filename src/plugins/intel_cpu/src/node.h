@@ -18,6 +18,7 @@
 #include "openvino/cc/factory.h"
 #include "openvino/core/node.hpp"
 #include <nodes/common/blocked_desc_creator.h>
+#include "cache/lru_cache.h"
 #include "cpu_types.h"
 #include "cpu_shape.h"
 #include "nodes/node_config.h"
@@ -358,6 +359,10 @@ public:
         return parallelDomain;
     }
 
+    bool isMemoized() const {
+        return memoizeOutputs;
+    }
+
     Type getType() const {
         return type;
     }
@@ -433,6 +438,10 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    // input shape signature of the current iteration used to bucket the perf counters of a dynamic
+    // node, e.g. "{1, 128}, {1, 1}"; empty for a static node, which only ever has one signature
+    std::string shapeSignature() const;
+
     virtual void resolveInPlaceEdges(Edge::LOOK look = Edge::LOOK_BOTH);
 
     virtual void execute(dnnl::stream strm) = 0;
@@ -453,6 +462,12 @@ public:
 
     virtual void createPrimitive();
 
+    /**
+     * @brief Drops the packed replicas of the constant inputs and rebuilds the primitive, so an
+     * in-place update of a source constant (see Graph::UpdateWeights) takes effect.
+     */
+    void repackWeights();
+
     virtual void selectOptimalPrimitiveDescriptor();
     virtual void initOptimalPrimitiveDescriptor();
     void resolveInPlaceDirection();
@@ -672,6 +687,9 @@ protected:
 
     std::string originalLayers;  // contains names of the original layers separated by comma
     std::string parallelDomain;
+    // set via the "memoize" runtime attribute; the graph caches the outputs of such nodes keyed by
+    // the content of their inputs, see Graph::ExecuteNodeMemoized()
+    bool memoizeOutputs = false;
 
     Node(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr ctx, const ShapeInferFactory& shapeInferFactory);
     Node(const std::string& type,
@@ -783,6 +801,18 @@ protected:
 
     std::shared_ptr<IShapeInfer> shapeInference;
 
+    // memoized shape inference results for the input shapes seen recently; only filled for the
+    // nodes whose output shapes are a pure function of the input shapes, see Node::shapeInfer
+    struct ShapeInferResultKey {
+        std::vector<VectorDims> inputDims;
+
+        size_t hash() const;
+        bool operator==(const ShapeInferResultKey& rhs) const {
+            return inputDims == rhs.inputDims;
+        }
+    };
+    mutable LruCache<ShapeInferResultKey, std::vector<VectorDims>> shapeInferCache{16};
+
     // we cannot rely on per-NUMA weightCache for caching weights because:
     //   1.it may not exist(in single stream configuration)
     //   2.it only holds weak references, the life-cycle of cached item
@@ -72,24 +72,97 @@ struct CausalMaskPreprocess::ExecutorCausalMaskPreprocess : public CausalMaskPre
         auto* prow = t_cache_positions.ptr<int32_t>(0);
         T min_dtype = std::numeric_limits<T>::lowest();
 
-        parallel_for2d(batch_size, qLen, [&](size_t n, size_t i) {
-            auto* pamask = t_attention_mask.ptr<int32_t>(n, 0);
-            auto* pdst = t_dst.ptr<T>(n, 0, i);
-            auto row = static_cast<size_t>(prow[i]);
-            size_t j = 0;
-            for (; j < mask_length; j++) {
-                bool cmask_eq0 = (j <= row);
+        auto mask_at = [&](int32_t* pamask, size_t row, size_t j) {
+            bool cmask_eq0 = (j <= row);
+            if (j < mask_length) {
                 bool amask_eq0 = (pamask[j] == 0);
                 bool padding_mask = (cmask_eq0 && amask_eq0);
-                pdst[j] = (padding_mask | (!cmask_eq0))? min_dtype : T(0);
+                return (padding_mask | (!cmask_eq0)) ? min_dtype : T(0);
             }
-            for (; j < kvLen; j++) {
-                bool cmask_eq0 = (j <= row);
-                pdst[j] = cmask_eq0 ? T(0) : min_dtype;
-            }
-        });
+            return cmask_eq0 ? T(0) : min_dtype;
+        };
+
+        if (can_extend(t_attention_mask, batch_size, qLen, kvLen, mask_length, prow)) {
+            // decode extends the mask by one token: the new row equals the cached one except
+            // at the freshly attended positions, so patch instead of re-deriving every element
+            auto row = static_cast<size_t>(prow[0]);
+            parallel_for(batch_size, [&](size_t n) {
+                auto* pamask = t_attention_mask.ptr<int32_t>(n, 0);
+                auto* pdst = t_dst.ptr<T>(n, 0, 0);
+                cpu_memcpy(pdst, m_last_row.ptr<T>(n), (kvLen - 1) * sizeof(T));
+                if (row < kvLen - 1)
+                    pdst[row] = mask_at(pamask, row, row);
+                pdst[kvLen - 1] = mask_at(pamask, row, kvLen - 1);
+            });
+        } else {
+            parallel_for2d(batch_size, qLen, [&](size_t n, size_t i) {
+                auto* pamask = t_attention_mask.ptr<int32_t>(n, 0);
+                auto* pdst = t_dst.ptr<T>(n, 0, i);
+                auto row = static_cast<size_t>(prow[i]);
+                size_t j = 0;
+                for (; j < mask_length; j++) {
+                    bool cmask_eq0 = (j <= row);
+                    bool amask_eq0 = (pamask[j] == 0);
+                    bool padding_mask = (cmask_eq0 && amask_eq0);
+                    pdst[j] = (padding_mask | (!cmask_eq0))? min_dtype : T(0);
+                }
+                for (; j < kvLen; j++) {
+                    bool cmask_eq0 = (j <= row);
+                    pdst[j] = cmask_eq0 ? T(0) : min_dtype;
+                }
+            });
+        }
+        save_state(t_attention_mask, t_dst, batch_size, qLen, kvLen, mask_length, prow);
         DEBUG_LOG("CausalMaskPreprocess::execute  dst=", t_dst);
     }
+
+private:
+    // the incremental path is only valid when this step appends exactly one token to the
+    // state cached from the previous step and the historical attention_mask is unchanged
+    bool can_extend(PlainTensor& t_attention_mask,
+                    size_t batch_size, size_t qLen, size_t kvLen, size_t mask_length,
+                    const int32_t* prow) {
+        if (!m_state_valid || qLen != 1 || batch_size != m_batch || kvLen != m_kvLen + 1 ||
+            mask_length != kvLen || static_cast<size_t>(prow[0]) != m_row_pos + 1)
+            return false;
+        for (size_t n = 0; n < batch_size; n++) {
+            if (std::memcmp(t_attention_mask.ptr<int32_t>(n, 0), m_last_amask.ptr<int32_t>(n),
+                            m_kvLen * sizeof(int32_t)) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    void save_state(PlainTensor& t_attention_mask, PlainTensor& t_dst,
+                    size_t batch_size, size_t qLen, size_t kvLen, size_t mask_length,
+                    const int32_t* prow) {
+        // only the common decode layout (attention_mask covering the whole kv history)
+        // can be extended on the next step
+        if (mask_length != kvLen) {
+            m_state_valid = false;
+            return;
+        }
+        m_last_row.resize<T>({batch_size, kvLen});
+        m_last_amask.resize<int32_t>({batch_size, kvLen});
+        parallel_for(batch_size, [&](size_t n) {
+            cpu_memcpy(m_last_row.ptr<T>(n), t_dst.ptr<T>(n, 0, qLen - 1), kvLen * sizeof(T));
+            cpu_memcpy(m_last_amask.ptr<int32_t>(n), t_attention_mask.ptr<int32_t>(n, 0),
+                       kvLen * sizeof(int32_t));
+        });
+        m_batch = batch_size;
+        m_kvLen = kvLen;
+        m_row_pos = static_cast<size_t>(prow[qLen - 1]);
+        m_state_valid = true;
+    }
+
+    // mask row produced for the newest cache position and the attention_mask it was
+    // derived from, kept across infer requests to extend the mask incrementally on decode
+    PlainTensor m_last_row;
+    PlainTensor m_last_amask;
+    size_t m_batch = 0;
+    size_t m_kvLen = 0;
+    size_t m_row_pos = 0;
+    bool m_state_valid = false;
 };
 
 CausalMaskPreprocess::CausalMaskPreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context)
@@ -3,6 +3,7 @@
 //
 
 #include "color_convert.h"
+#include "eltwise.h"
 #include <memory_desc/dnnl_blocked_memory_desc.h>
 #include <openvino/op/nv12_to_rgb.hpp>
 #include <openvino/op/nv12_to_bgr.hpp>
@@ -42,6 +43,7 @@ public:
     Converter(Node *node);
 
     bool singlePlane() const;
+    const float * fusedScaleShift() const;
 
     template <typename T>
     std::tuple<T, T, T> yuv_to_rgb(float y, float u, float v);
@@ -58,6 +60,10 @@ bool Converter::singlePlane() const {
     return _node->getOriginalInputsNumber() == 1;
 }
 
+const float * Converter::fusedScaleShift() const {
+    return static_cast<const ColorConvert*>(_node)->fusedScaleShift();
+}
+
 template <typename T>
 std::tuple<T, T, T> Converter::yuv_to_rgb(float y, float u, float v) {
     auto c = y - 16.f;
@@ -86,6 +92,7 @@ struct jit_uni_converter : public jit_kernel {
         const void * v;
         void * dst;
         size_t width;
+        const float * scaleShift;   // per-channel normalization: 3 scales followed by 3 shifts in R,G,B order
         uint8_t colorFormat;    // RGB: 0, BGR: !=0
     };
 
@@ -105,6 +112,7 @@ protected:
                     const variable<float[N]> & u,
                     const variable<float[N]> & v,
                     const variable<uint8_t> & color_format,
+                    const variable<const float*> & scale_shift,
                     bool round);
     template<typename T, size_t N>
     void store_tail(const variable<T*> & dst,
@@ -133,6 +141,7 @@ void jit_uni_converter::yuv_to_rgb(const variable<float[N]> & y,
                                    const variable<float[N]> & u,
                                    const variable<float[N]> & v,
                                    const variable<uint8_t> & color_format,
+                                   const variable<const float*> & scale_shift,
                                    bool round) {
     auto clip = [&](const variable<float[N]> & op,
                     const variable<float[N]> & a,
@@ -240,6 +249,16 @@ void jit_uni_converter::yuv_to_rgb(const variable<float[N]> & y,
     clip(g, y, u);
     clip(b, y, u);
 
+    // apply the fused per-channel normalization;
+    // scale_shift points to identity values when nothing has been fused
+    for (size_t i = 0; i < 3; i++) {
+        const auto & channel = i == 0 ? r : i == 1 ? g : b;
+        uni_vbroadcastss(tmp, ptr[scale_shift + i * sizeof(float)]);
+        uni_vmulps(channel, channel, tmp);
+        uni_vbroadcastss(tmp, ptr[scale_shift + (i + 3) * sizeof(float)]);
+        uni_vaddps(channel, channel, tmp);
+    }
+
     _if(color_format == 0)
     ._then([&]{ blend(r, g, b, y, u, v); })
     ._else([&]{ blend(b, g, r, y, u, v); });
@@ -265,6 +284,9 @@ void jit_uni_converter::store_tail(const variable<T*> & dst,
 
     copy<T>(ptr[dst], s.pointer(), copy_size);
 }
+
+// Identity normalization for the kernel when no scale/shift has been fused.
+const float identity_scale_shift[6] = { 1.f, 1.f, 1.f, 0.f, 0.f, 0.f };
 #endif
 
 namespace nv12 {
@@ -326,6 +348,7 @@ void RefConverter::convert(const T* y,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
+    const float* ss = fusedScaleShift();
     ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
         T* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
@@ -339,6 +362,11 @@ void RefConverter::convert(const T* y,
             auto v_val = static_cast<float>(uv_ptr[uv_index + 1]);
             T r, g, b;
             std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
+            if (ss) {
+                r = static_cast<T>(r * ss[0] + ss[3]);
+                g = static_cast<T>(g * ss[1] + ss[4]);
+                b = static_cast<T>(b * ss[2] + ss[5]);
+            }
             out[y_index * 3 + _colorFormat[0]] = r;
             out[y_index * 3 + _colorFormat[1]] = g;
             out[y_index * 3 + _colorFormat[2]] = b;
@@ -423,6 +451,7 @@ void JitConverter<T[N]>::generate() {
     auto src_uv = arg<const T*>(&Params::u);
     auto dst = arg<T*>(&Params::dst);
     auto width = arg(&Params::width);
+    auto scaleShift = arg<const float*>(&Params::scaleShift);
     auto colorFormat = arg(&Params::colorFormat);
 
     static const float data[8] = { 16.f, 128.f, 1.164f, 1.596f, 0.391f, 2.018f, 0.813f, 255.f };
@@ -441,7 +470,7 @@ void JitConverter<T[N]>::generate() {
         const auto & u = std::get<1>(yuv);
         const auto & v = std::get<2>(yuv);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, scaleShift, std::is_integral<T>::value);
 
         store(dst, y);  dst += step;
         store(dst, u);  dst += step;
@@ -465,7 +494,7 @@ void JitConverter<T[N]>::generate() {
         const auto & u = std::get<0>(uv_pair);
         const auto & v = std::get<1>(uv_pair);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, scaleShift, std::is_integral<T>::value);
 
         store_tail(dst, y, u, v, width);
     });
@@ -568,12 +597,17 @@ public:
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
 
+        const float* scaleShift = fusedScaleShift();
+        if (!scaleShift)
+            scaleShift = identity_scale_shift;
+
         ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.u = args.v = uv + batch * stride_uv + (h / 2) * width;
             args.dst = dst + (batch * width * height + h * width) * 3;
             args.width = width;
+            args.scaleShift = scaleShift;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
         });
@@ -603,12 +637,17 @@ public:
         const size_t stride_y = height * width;
         const size_t stride_uv = height * width / 2;
 
+        const float* scaleShift = fusedScaleShift();
+        if (!scaleShift)
+            scaleShift = identity_scale_shift;
+
         ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.u = args.v = uv + batch * stride_uv + (h / 2) * width;
             args.dst = dst + (batch * width * height + h * width) * 3;
             args.width = width;
+            args.scaleShift = scaleShift;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
         });
@@ -678,6 +717,7 @@ void RefConverter::convert(const T* y,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
+    const float* ss = fusedScaleShift();
     ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
         T* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
@@ -692,6 +732,11 @@ void RefConverter::convert(const T* y,
             auto v_val = static_cast<float>(v_ptr[uv_index]);
             T r, g, b;
             std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
+            if (ss) {
+                r = static_cast<T>(r * ss[0] + ss[3]);
+                g = static_cast<T>(g * ss[1] + ss[4]);
+                b = static_cast<T>(b * ss[2] + ss[5]);
+            }
             out[y_index * 3 + _colorFormat[0]] = r;
             out[y_index * 3 + _colorFormat[1]] = g;
             out[y_index * 3 + _colorFormat[2]] = b;
@@ -779,6 +824,7 @@ void JitConverter<T[N]>::generate() {
     auto src_v = arg<const T*>(&Params::v);
     auto dst = arg<T*>(&Params::dst);
     auto width = arg(&Params::width);
+    auto scaleShift = arg<const float*>(&Params::scaleShift);
     auto colorFormat = arg(&Params::colorFormat);
 
     static const float data[8] = { 16.f, 128.f, 1.164f, 1.596f, 0.391f, 2.018f, 0.813f, 255.f };
@@ -797,7 +843,7 @@ void JitConverter<T[N]>::generate() {
         const auto & u = std::get<1>(yuv);
         const auto & v = std::get<2>(yuv);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, scaleShift, std::is_integral<T>::value);
 
         store(dst, y);  dst += step;
         store(dst, u);  dst += step;
@@ -821,7 +867,7 @@ void JitConverter<T[N]>::generate() {
 
         unpack_uv(u, v);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, scaleShift, std::is_integral<T>::value);
 
         store_tail(dst, y, u, v, width);
     });
@@ -919,6 +965,10 @@ public:
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
 
+        const float* scaleShift = fusedScaleShift();
+        if (!scaleShift)
+            scaleShift = identity_scale_shift;
+
         ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
@@ -926,6 +976,7 @@ public:
             args.v = v + batch * stride_uv + (h / 2) * (width / 2);
             args.dst = dst + (batch * width * height + h * width) * 3;
             args.width = width;
+            args.scaleShift = scaleShift;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
         });
@@ -956,6 +1007,10 @@ public:
         const size_t stride_y = height * width;
         const size_t stride_uv = height * width / 4;
 
+        const float* scaleShift = fusedScaleShift();
+        if (!scaleShift)
+            scaleShift = identity_scale_shift;
+
         ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
@@ -963,6 +1018,7 @@ public:
             args.v = v + batch * stride_uv + (h / 2) * (width / 2);
             args.dst = dst + (batch * width * height + h * width) * 3;
             args.width = width;
+            args.scaleShift = scaleShift;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
         });
@@ -1108,6 +1164,35 @@ void ColorConvert::createPrimitive() {
         OPENVINO_THROW(getTypeStr() + " node with name '" + getName() + "' ",
                        "no optimal primitive descriptor selected");
 
+    if (!fusedWith.empty() && !_withScaleShift) {
+        // Fold the fused scale/shift chain into a single per-channel normalization
+        // stored in R,G,B order as expected by the converters.
+        float scale[3] = { 1.f, 1.f, 1.f };
+        float shift[3] = { 0.f, 0.f, 0.f };
+        for (const auto & fusedNode : fusedWith) {
+            auto eltwise = dynamic_cast<const Eltwise *>(fusedNode.get());
+            if (!eltwise)
+                OPENVINO_THROW(getTypeStr() + " node with name '" + getName() + "' ",
+                               "supports only scale/shift nodes fusing");
+            const auto & scales = eltwise->getScales();
+            const auto & shifts = eltwise->getShifts();
+            for (size_t c = 0; c < 3; c++) {
+                const float sc = scales.empty() ? 1.f : scales[scales.size() == 1 ? 0 : c];
+                const float sh = shifts.empty() ? 0.f : shifts[shifts.size() == 1 ? 0 : c];
+                scale[c] *= sc;
+                shift[c] = shift[c] * sc + sh;
+            }
+        }
+        const bool isRGB = algorithm == Algorithm::ColorConvertNV12toRGB
+                                || algorithm == Algorithm::ColorConvertI420toRGB;
+        for (size_t c = 0; c < 3; c++) {
+            const size_t channel = isRGB ? c : 2 - c;
+            _scaleShift[c] = scale[channel];
+            _scaleShift[c + 3] = shift[channel];
+        }
+        _withScaleShift = true;
+    }
+
     if (!_impl) {
         const auto & cfg = desc->getConfig();
         const auto precision = cfg.inConfs[0].getMemDesc()->getPrecision();
@@ -1127,6 +1212,25 @@ void ColorConvert::execute(dnnl::stream strm) {
     _impl->execute(strm);
 }
 
+bool ColorConvert::canFuse(const NodePtr& node) const {
+    // Only per-channel scale/shift chains (e.g. the mean/scale normalization
+    // inserted by the pre-processing API) are folded into the converter, and
+    // only when the conversion is performed in f32.
+    if (getOriginalInputPrecisionAtPort(0) == ov::element::u8)
+        return false;
+    if (node->getType() != Type::Eltwise || node->getAlgorithm() == Algorithm::EltwisePrelu)
+        return false;
+    return node->canBePerformedAsScaleShift(this);
+}
+
+int ColorConvert::getFusingAxis() const {
+    return Converter::C_DIM;    // the converter output is NHWC
+}
+
+const float* ColorConvert::fusedScaleShift() const {
+    return _withScaleShift ? _scaleShift.data() : nullptr;
+}
+
 bool ColorConvert::created() const {
     return getType() == Type::ColorConvert;
 }
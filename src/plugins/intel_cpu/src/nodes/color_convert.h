@@ -27,6 +27,12 @@ public:
     bool created() const override;
     bool needPrepareParams() const override;
     void executeDynamicImpl(dnnl::stream strm) override;
+    bool canFuse(const NodePtr& node) const override;
+    int getFusingAxis() const override;
+
+    // Folded per-channel normalization collected from the fused scale/shift nodes:
+    // 3 scales followed by 3 shifts in R,G,B order; nullptr when nothing was fused.
+    const float* fusedScaleShift() const;
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
@@ -44,6 +50,8 @@ private:
 
     std::unique_ptr<Converter> _impl;
     SupportedImpls _supportedImpls;
+    std::array<float, 6> _scaleShift = { 1.f, 1.f, 1.f, 0.f, 0.f, 0.f };
+    bool _withScaleShift = false;
 };
 
 class ColorConvert::Converter {
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(_WIN32) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Prefetches the cache lines of [src, src + count) for reading.
+ * A hint only: nothing is prefetched on platforms without a suitable intrinsic and the
+ * address does not have to be dereferenceable. Intended to hide the DRAM latency of a data
+ * dependent random access (e.g. the next row of a large embedding table) behind the
+ * processing of the current one.
+ */
+inline void cpu_prefetch_read(const void* src, size_t count) {
+    const char* p = static_cast<const char*>(src);
+#if defined(__GNUC__) || defined(__clang__)
+    for (size_t i = 0; i < count; i += 64)
+        __builtin_prefetch(p + i, 0);
+#elif defined(_WIN32) && (defined(_M_IX86) || defined(_M_X64))
+    for (size_t i = 0; i < count; i += 64)
+        _mm_prefetch(p + i, _MM_HINT_T0);
+#else
+    (void)p;
+    (void)count;
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
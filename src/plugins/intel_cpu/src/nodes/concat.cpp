@@ -6,7 +6,9 @@
 
 #include "openvino/op/concat.hpp"
 
+#include <algorithm>
 #include <map>
+#include <numeric>
 #include <utility>
 #include <vector>
 #include "dnnl_extension_utils.h"
@@ -40,9 +42,6 @@ bool Concat::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std
             errorMessage = "Node is not an instance of the Concat operation.";
             return false;
         }
-        if (concatOp->get_output_element_type(0) == ov::element::string) {
-            return false;
-        }
     } catch (...) {
         return false;
     }
@@ -58,6 +57,7 @@ Concat::Concat(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr con
 
     const auto inRank = getInputShapeAtPort(0).getRank();
     auto concatOp = ov::as_type_ptr<ov::op::v0::Concat>(op);
+    isStringTensor = concatOp->get_output_element_type(0) == ov::element::string;
     auto axis = concatOp->get_axis();
     if (axis < 0) {
         axis += inRank;
@@ -89,7 +89,7 @@ void Concat::getSupportedDescriptors() {
     // we need the first dims before axis to be 1 to avoid the reorder in the edge between the first parent and this concat
 
     const auto& childDims = outputShapes[0].getDims();
-    if (childDims[axis] != Shape::UNDEFINED_DIM &&
+    if (!isStringTensor && childDims[axis] != Shape::UNDEFINED_DIM &&
         std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
         canBeInPlace = true;
 }
@@ -117,10 +117,13 @@ void Concat::initSupportedPrimitiveDescriptors() {
 
     const auto& dstShape = getOutputShapeAtPort(0);
     std::vector<LayoutType> tdCreatorTypes = {LayoutType::ncsp, LayoutType::nspc};
+    // for string tensors only the plain layout and the generic per-element copy make sense
+    if (isStringTensor)
+        tdCreatorTypes = {LayoutType::ncsp};
 
     // check if blocked layouts are available the channels size should be evenly divided by the block size to avoid slow oneDNN ref implementation and allow
     // inPlace memory usage if possible
-    if (dstShape.getRank() > channelAxis) {
+    if (!isStringTensor && dstShape.getRank() > channelAxis) {
         for (auto& item : { std::make_pair(8lu, LayoutType::nCsp8c), std::make_pair(16lu, LayoutType::nCsp16c)}) {
             const VectorDims &blkDims = dstShape.getDims();
             if (blkDims[channelAxis] == Shape::UNDEFINED_DIM || blkDims[channelAxis] % item.first != 0)
@@ -324,7 +327,8 @@ bool Concat::needPrepareParams() const {
 }
 
 void Concat::prepareParams() {
-    if (canOptimizeNspc || isInPlace())
+    // the string case reads the shapes directly at execution time and must not be mapped on a oneDNN data type
+    if (isStringTensor || canOptimizeNspc || isInPlace())
         return;
 
     const auto& dstMemPtr = getDstMemoryAtPort(0);
@@ -466,7 +470,7 @@ void Concat::initOptimalPrimitiveDescriptor() {
     auto memDesc = primDesc->getConfig().outConfs[0].getMemDesc()->as<BlockedMemoryDesc>();
     auto rank = memDesc->getShape().getRank();
     bool isBlocked = rank != memDesc->getBlockDims().size();
-    if (!isBlocked && rank <= MAX_RANK_REF) {
+    if (!isStringTensor && !isBlocked && rank <= MAX_RANK_REF) {
         canExecRef = true;
         nelemToCopy.resize(getParentEdges().size(), 0);
         dstOffset.resize(getParentEdges().size());
@@ -492,6 +496,11 @@ void Concat::execute(dnnl::stream strm) {
         return;
     }
 
+    if (isStringTensor) {
+        execStringCase();
+        return;
+    }
+
     if (canExecRef) {
         execRef();
     } else {
@@ -528,6 +537,32 @@ void Concat::exec1DCase() {
     }
 }
 
+void Concat::execStringCase() {
+    DEBUG_LOG(getName(), " execStringCase");
+    const auto& dstMemPtr = getDstMemoryAtPort(0);
+    auto* dst = dstMemPtr->getDataAs<StringMemory::OvString>();
+    const auto& dstDims = dstMemPtr->getStaticDims();
+    const size_t outerSize = std::accumulate(dstDims.begin(), dstDims.begin() + axis, 1lu, std::multiplies<size_t>());
+    const size_t dstInnerSize = std::accumulate(dstDims.begin() + axis, dstDims.end(), 1lu, std::multiplies<size_t>());
+    size_t dstInnerOffset = 0lu;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        const auto& srcMem = getParentEdgeAt(i)->getMemory();
+        const auto& srcDims = srcMem.getStaticDims();
+        const size_t srcInnerSize =
+            std::accumulate(srcDims.begin() + axis, srcDims.end(), 1lu, std::multiplies<size_t>());
+        if (srcInnerSize == 0lu) {
+            continue;
+        }
+        const auto* src = srcMem.getDataAs<const StringMemory::OvString>();
+        // std::string elements must be copied via assignment, a raw byte copy would corrupt them
+        parallel_for(outerSize, [&](size_t o) {
+            const auto* srcPtr = src + o * srcInnerSize;
+            std::copy(srcPtr, srcPtr + srcInnerSize, dst + o * dstInnerSize + dstInnerOffset);
+        });
+        dstInnerOffset += srcInnerSize;
+    }
+}
+
 void Concat::execNspcSpecCase() {
     const auto& dst_memory = getChildEdgeAt(0)->getMemory();
     const size_t num_src = getParentEdges().size();
@@ -37,7 +37,9 @@ private:
     bool canBeInPlace = false;
     bool canOptimizeNspc = false;
     bool canOptimize1DCase = false;
+    bool isStringTensor = false;
     void execRef();
+    void execStringCase();
     size_t inverseOrder(const VectorDims& order, size_t axis);
     void execNspcSpecCase();
     void exec1DCase();
@@ -8,6 +8,7 @@
 #include "openvino/op/ctc_greedy_decoder.hpp"
 #include "openvino/core/parallel.hpp"
 #include "ctc_greedy_decoder.h"
+#include "kernels/ctc_argmax.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -76,7 +77,6 @@ void CTCGreedyDecoder::execute(dnnl::stream strm) {
     const size_t B = getParentEdgeAt(DATA_INDEX)->getMemory().getStaticDims()[1];
     const int C = getParentEdgeAt(DATA_INDEX)->getMemory().getStaticDims()[2];
     const size_t BC = B * C;
-    const size_t CB1 = C * (B - 1);
 
     const int blankIndex = C - 1;
 
@@ -121,18 +121,8 @@ void CTCGreedyDecoder::execute(dnnl::stream strm) {
             size_t sequenceLength = sequenceLengths[b];
 
             for (size_t t = tStart; t < sequenceLength; ++t) {
-                int maxClassIdx = 0;
-
-                float maxProb = probs[0];
-                ++probs;
-
-                for (int c = 1; c < C; ++c, ++probs) {
-                    if (*probs > maxProb) {
-                        maxClassIdx = c;
-                        maxProb = *probs;
-                    }
-                }
-                probs += CB1;
+                const auto maxClassIdx = Extensions::Cpu::XARCH::ctc_arg_max_f32(probs, C);
+                probs += BC;
                 outputSequences[outputIndex++] = static_cast<float>(maxClassIdx);
 
                 if (++workCounter >= end) {
@@ -8,6 +8,7 @@
 #include <openvino/op/ctc_greedy_decoder_seq_len.hpp>
 #include "openvino/core/parallel.hpp"
 #include "ctc_greedy_decoder_seq_len.h"
+#include "kernels/ctc_argmax.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -124,16 +125,8 @@ void CTCGreedyDecoderSeqLen::execute(dnnl::stream strm) {
             const size_t actualSeqLen = sequenceLengths[b];
 
             for (size_t t = tStart; t < actualSeqLen; ++t) {
-                int maxClassIdx = 0;
-                float maxProb = probs[0];
-                probs++;
-
-                for (int c = 1; c < C; c++, probs++) {
-                    if (*probs > maxProb) {
-                        maxClassIdx = c;
-                        maxProb = *probs;
-                    }
-                }
+                const auto maxClassIdx = static_cast<int>(Extensions::Cpu::XARCH::ctc_arg_max_f32(probs, C));
+                probs += C;
                 decodedClasses[outputIndex++] = maxClassIdx;
 
                 if (++workCounter >= end) {
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -10,6 +11,7 @@
 #include "embedding_bag_sum.h"
 #include "openvino/opsets/opset1.hpp"
 #include "common/cpu_memcpy.h"
+#include "common/cpu_prefetch.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -54,6 +56,13 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto *dstData = outMemory->getDataAs<T>();
 
+    // Software prefetch pipelining: the rows gathered from a large table are data dependent
+    // DRAM accesses, so the next row of the bag is fetched while the current one is
+    // accumulated. Not worth the extra instructions when the table is cache resident.
+    static constexpr size_t tableSizeThreshold = 1024lu * 1024lu;
+    const size_t prefetchSize = inDataDims[0] * _embDepth * sizeof(T) > tableSizeThreshold
+            ? std::min(_embDepth * sizeof(T), 1024lu) : 0lu;
+
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
         splitter(outputBagsNum, nthr, ithr, start, end);
@@ -77,6 +86,8 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                     OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
                 }
                 size_t srcIndex = indices[inIdx] * _embDepth;
+                if (prefetchSize && indicesSize > 1lu)
+                    cpu_prefetch_read(srcData + indices[1] * _embDepth, prefetchSize);
 
                 if (withWeights) {
                     for (size_t i = 0lu; i < _embDepth; i++) {
@@ -94,6 +105,8 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                         OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
                     }
                     size_t srcIndex = indices[inIdx] * _embDepth;
+                    if (prefetchSize && inIdx + 1lu < indicesSize)
+                        cpu_prefetch_read(srcData + indices[inIdx + 1lu] * _embDepth, prefetchSize);
 
                     if (withWeights) {
                         for (size_t i = 0lu; i < _embDepth; i++) {
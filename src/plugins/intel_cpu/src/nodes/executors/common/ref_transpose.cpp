@@ -37,6 +37,14 @@ void RefTransposeExecutor::referenceExecute(const uint8_t* src_data, uint8_t* ds
     if (static_cast<int>(dst_dims[0]) != mb)
         dst_dims[0] = mb;
 
+    // when the innermost dimension is dense in both tensors (a permutation which keeps the last
+    // axis in place), whole rows are copied with one memcpy instead of element-wise copies
+    size_t copy_size = data_size;
+    if (ndims > 1 && src_strides[ndims - 1] == 1 && dst_strides[ndims - 1] == 1) {
+        copy_size *= dst_dims[ndims - 1];
+        dst_dims[ndims - 1] = 1;
+    }
+
     size_t work_amount = std::accumulate(dst_dims.begin(), dst_dims.end(), 1, std::multiplies<size_t>());
 
     auto get_idx = [ndims, data_size](const VectorDims& indexes, const VectorDims& strides) {
@@ -56,7 +64,7 @@ void RefTransposeExecutor::referenceExecute(const uint8_t* src_data, uint8_t* ds
         for (size_t iwork = start; iwork < end; ++iwork) {
             const size_t dst_idx = get_idx(indexes, dst_strides);
             const size_t src_idx = get_idx(indexes, src_strides);
-            cpu_memcpy(&dst_data[dst_idx], &src_data[src_idx], data_size);
+            cpu_memcpy(&dst_data[dst_idx], &src_data[src_idx], copy_size);
 
             parallel_step(ndims, dst_dims, indexes);
         }
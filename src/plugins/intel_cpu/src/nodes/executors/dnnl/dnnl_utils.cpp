@@ -51,9 +51,16 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr srcWeightDesc,
     MemoryPtr ptr;
     if (globalWeightCache &&
         dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
-        const std::string string_hash = format + "_" + std::to_string(weightsMem->getSize()) + "_" +
-                                        std::to_string(*weightsMem->getDataAs<uint64_t>());
-        ptr = *globalWeightCache->findOrCreate(string_hash, create);
+        const bool processShareable = WeightsSharing::processSharingEnabled();
+        // the leading bytes are a cheap per-process stand-in for a hash, but a key published to
+        // the other workers of the host must identify the full content
+        const uint64_t data_hash = processShareable
+            ? WeightsSharing::GetHashFunc().hash(static_cast<const unsigned char*>(weightsMem->getData()),
+                                                 weightsMem->getSize())
+            : *weightsMem->getDataAs<uint64_t>();
+        const std::string string_hash =
+            format + "_" + std::to_string(weightsMem->getSize()) + "_" + std::to_string(data_hash);
+        ptr = *globalWeightCache->findOrCreate(string_hash, create, true, processShareable);
     } else {
         ptr = create();
     }
@@ -143,6 +143,11 @@ public:
      * - Otherwise creates the executor using the selected implementation.
      * - Updates the executor with the given memory information.
      *
+     * @note Since selection is repeated for every shape change, a node effectively keeps one
+     *       specialized executor per accepted shape class (see acceptsShapes()), i.e. a GEMM-oriented
+     *       and a GEMV-oriented executor can co-exist and be picked per-inference (LLM prefill
+     *       vs decode being the typical case). Executors are cached per implementation, so
+     *       switching back and forth does not repack weights or recreate primitives.
      */
     ExecutorPtr make(MemoryArgs& memory) {
         auto createExec = [this](MemoryArgs& memory, size_t implId) -> ExecutorPtr {
@@ -19,6 +19,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/fullyconnected_config.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "post_ops.hpp"
 #include "shape_inference/custom/fullyconnected.hpp"
@@ -182,12 +183,20 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
 
     const auto weightsData = weiMemory->getDataAs<const int8_t>();
     auto elementsCount = weiMemory->getDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
-    size_t zerosCount = 0;
-    for (size_t i = 0; i < elementsCount; i++) {
-        if (weightsData[i] == 0) {
-            zerosCount++;
+    // the scan touches every weight element of the model at compile time, so count by blocks in parallel
+    constexpr size_t blockSize = 64 * 1024;
+    const size_t blocksCount = div_up(elementsCount, blockSize);
+    size_t zerosCount = parallel_sum(blocksCount, static_cast<size_t>(0), [&](size_t blockIdx) -> size_t {
+        const size_t begin = blockIdx * blockSize;
+        const size_t end = std::min(begin + blockSize, elementsCount);
+        size_t count = 0;
+        for (size_t i = begin; i < end; i++) {
+            if (weightsData[i] == 0) {
+                count++;
+            }
         }
-    }
+        return count;
+    });
 
     DEBUG_LOG("elementsCount = ",
               elementsCount,
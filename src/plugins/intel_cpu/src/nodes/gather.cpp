@@ -6,6 +6,7 @@
 
 #include <partitioned_mem_mgr.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <openvino/op/constant.hpp>
 #include <openvino/op/gather.hpp>
@@ -14,6 +15,7 @@
 #include <vector>
 
 #include "common/cpu_memcpy.h"
+#include "common/cpu_prefetch.h"
 #include "kernels/x64/gather_uni_kernel.hpp"
 #include "openvino/core/parallel.hpp"
 #include "ov_ops/gather_compressed.hpp"
@@ -37,9 +39,6 @@ bool Gather::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std
             return true;
         }
 
-        if (op->get_output_element_type(0) == element::string) {
-            return false;
-        }
         if (!one_of(op->get_type_info(),
                     ov::op::v7::Gather::get_type_info_static(),
                     ov::op::v8::Gather::get_type_info_static())) {
@@ -72,6 +71,8 @@ Gather::Gather(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr con
         THROW_ERROR("has incorrect number of input/output edges!");
     }
 
+    isStringTensor = op->get_output_element_type(0) == element::string;
+
     const auto& dataShape = getInputShapeAtPort(GATHER_DATA);
     isDataShapeStat = dataShape.isStatic();
     dataSrcRank = dataShape.getRank();
@@ -209,6 +210,10 @@ void Gather::initSupportedPrimitiveDescriptors() {
     // Let's check for the special inPlace memory use case
     // in place only makes sense when we split by dense blocks since strided tensors are not supported by most nodes
 
+    if (isStringTensor) {
+        return;
+    }
+
     if (!isAxisInputConst) {
         return;
     }
@@ -259,7 +264,7 @@ void Gather::createPrimitive() {
                                                      : 1;
     }
     // Gather instruction is not supported by SSE.
-    if ((x64::mayiuse(x64::avx512_core) || x64::mayiuse(x64::avx2)) &&
+    if (!isStringTensor && (x64::mayiuse(x64::avx512_core) || x64::mayiuse(x64::avx2)) &&
         (isDynamicNode() || afterAxisSize == 1 ||
          (afterAxisSize <= idxElPerVec &&
           (x64::mayiuse(x64::avx512_core) || (x64::mayiuse(x64::avx2) && dataTypeSize == 4))))) {
@@ -420,6 +425,10 @@ void Gather::execute(dnnl::stream strm) {
     if (compressed) {
         return execCompressed();
     }
+
+    if (isStringTensor) {
+        return execReferenceString();
+    }
 #if defined(OPENVINO_ARCH_X86_64)
     if (jitKernel && jitKernel->isSupportedConfiguration(afterAxisSize)) {
         const void* srcIndices = getSrcDataAtPort(GATHER_INDICES);
@@ -488,6 +497,10 @@ void Gather::executeDynamicImpl(dnnl::stream strm) {
         return execCompressed();
     }
 
+    if (isStringTensor) {
+        return execReferenceString();
+    }
+
 #if defined(OPENVINO_ARCH_X86_64)
     if (jitKernel && jitKernel->isSupportedConfiguration(afterAxisSize)) {
         const void* srcIndices = getSrcDataAtPort(GATHER_INDICES);
@@ -814,6 +827,16 @@ void Gather::execReference() {
         }
         const size_t idx = ii;
         const size_t c2 = dstAfterBatchSize * b + afterAxisSizeInBytes * j;
+        // prefetch the row of the next index so the data dependent DRAM access of a large
+        // dictionary overlaps with the copy of the current row
+        if (j + 1 < specIndicesSize) {
+            int nextIdx = srcIndices[b * specIndicesSize + j + 1];
+            if (nextIdx < 0 && reverseIndexing)
+                nextIdx += axisDim;
+            if (nextIdx >= 0 && nextIdx < axisDim)
+                cpu_prefetch_read(&srcData[srcAfterBatchSizeInBytes * b + afterAxisSizeInBytes * nextIdx],
+                                  std::min(afterAxisSizeInBytes, static_cast<uint64_t>(1024lu)));
+        }
         if (idx < static_cast<size_t>(axisDim)) {
             size_t c1 = srcAfterBatchSizeInBytes * b + afterAxisSizeInBytes * idx;
             for (size_t i = 0; i < betweenBatchAndAxisSize; i++) {
@@ -830,6 +853,43 @@ void Gather::execReference() {
     });
 }
 
+void Gather::execReferenceString() {
+    const int32_t* srcIndices = getSrcDataAtPortAs<const int32_t>(GATHER_INDICES);
+    const auto* srcData = getSrcDataAtPortAs<const StringMemory::OvString>(GATHER_DATA);
+    auto* dstData = getDstDataAtPortAs<StringMemory::OvString>(0);
+
+    const size_t dstAfterBatchSize = betweenBatchAndAxisSize * specIdxAndAfterAxSize;
+    parallel_for2d(beforeBatchSize, specIndicesSize, [&](const size_t b, const size_t j) {
+        int ii = srcIndices[b * specIndicesSize + j];
+        if (ii < 0) {
+            if (reverseIndexing)
+                ii += axisDim;
+            else
+                ii = axisDim;
+        }
+        const size_t idx = ii;
+        const size_t c2 = dstAfterBatchSize * b + afterAxisSize * j;
+        if (idx < static_cast<size_t>(axisDim)) {
+            const size_t c1 = srcAfterBatchSize * b + afterAxisSize * idx;
+            for (size_t i = 0; i < betweenBatchAndAxisSize; i++) {
+                const size_t srcIdx = c1 + axisAndAfterAxisSize * i;
+                const size_t dstIdx = c2 + specIdxAndAfterAxSize * i;
+                // std::string elements must be copied via assignment, a raw byte copy would corrupt them
+                for (size_t k = 0; k < afterAxisSize; k++) {
+                    dstData[dstIdx + k] = srcData[srcIdx + k];
+                }
+            }
+        } else {
+            for (size_t i = 0; i < betweenBatchAndAxisSize; i++) {
+                const size_t dstIdx = c2 + specIdxAndAfterAxSize * i;
+                for (size_t k = 0; k < afterAxisSize; k++) {
+                    dstData[dstIdx + k].clear();
+                }
+            }
+        }
+    });
+}
+
 void Gather::exec1DCase() {
     DEBUG_LOG(getName(), " exec1DCase");
     auto* pdst = getDstDataAtPortAs<uint32_t>(0);
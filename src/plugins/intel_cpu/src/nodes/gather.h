@@ -62,6 +62,7 @@ protected:
 private:
     void initShortParams(threadExecParams& p, uint64_t start);
     void execReference();
+    void execReferenceString();
 
     bool canOptimize1DCase = false;
     void exec1DCase();
@@ -74,6 +75,7 @@ private:
     bool isAxisInputConst = false;
 
     bool reverseIndexing = false;
+    bool isStringTensor = false;
 
     uint64_t dataTypeSize = 1lu;
     static constexpr uint64_t idxTypeSize = sizeof(int);
@@ -82,8 +82,12 @@ void If::getSupportedDescriptors() {
 
     const std::shared_ptr<const ov::Model>& thenBody = ifOp->get_then_body();
     const std::shared_ptr<const ov::Model>& elseBody = ifOp->get_else_body();
-    subGraphThen.CreateGraph(thenBody, context);
-    subGraphElse.CreateGraph(elseBody, context);
+    // the branch executors are compiled lazily on the first execution which actually takes the
+    // branch (see Graph::MaterializePrimitives), so a branch which is never taken, e.g. the
+    // recovery path of a cascade model, never pays the compilation time and the packed weights
+    // memory; the body memory is still planned here as the port maps below reference it
+    subGraphThen.CreateGraph(thenBody, context, /* deferPrimitives = */ true);
+    subGraphElse.CreateGraph(elseBody, context, /* deferPrimitives = */ true);
 
     const auto& inMapThen = subGraphThen.GetInputNodesMap();
     for (const auto& param : ifOp->get_then_body()->get_parameters()) {
@@ -29,6 +29,12 @@ public:
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
 
+    // true when the memory aliases the buffer of the original model constant (zero-copy path),
+    // which may be file-backed and must not be overwritten in place
+    bool holdsOriginalBlob() const {
+        return constOp && memoryPtr && memoryPtr->getData() == constOp->get_data_ptr();
+    }
+
     void execute(dnnl::stream strm) override {}
     void executeDynamicImpl(dnnl::stream strm) override {}
     bool isExecutable() const override {
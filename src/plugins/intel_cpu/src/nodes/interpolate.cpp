@@ -2542,6 +2542,17 @@ void Interpolate::execute(dnnl::stream strm) {
     }
 }
 
+// Number of tiles an output plane is split into, so that spatial parallelism is engaged when
+// batch * channels alone cannot occupy all cores (e.g. single-image high resolution upscale).
+// A minimum tile size keeps the per-call overhead amortized and the tiles cache-sized.
+static int spatialTilesNum(int planesNum, int spatialWork) {
+    constexpr int minTileSize = 1024;
+    const int threadsNum = parallel_get_max_threads();
+    if (planesNum >= threadsNum || spatialWork < 2 * minTileSize)
+        return 1;
+    return std::min(div_up(threadsNum, planesNum), div_up(spatialWork, minTileSize));
+}
+
 // for ndhwc and nCdhw8c[16c]
 // input may be f32/bf16/int8, fused->output varies
 void Interpolate::InterpolateJitExecutor::NNCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_,
@@ -2640,15 +2651,23 @@ void Interpolate::InterpolateJitExecutor::linearOnnxPlanar(const uint8_t *in_ptr
     int scratchLen = rnd_up(eltInGrid * OW * OH * OD, 16);
     float *weight = reinterpret_cast<float*>(&auxTable[scratchLen]);
 
-    parallel_for2d(B, C, [&](size_t b, size_t c) {
+    // the index/weight tables are laid out as planes of OW * OH * OD elements, so the kernel can
+    // process any contiguous sub-range of the output plane starting from the respective entries
+    int spatialWork = OW * OH * OD;
+    int tilesNum = spatialTilesNum(B * C, spatialWork);
+    int tileSize = rnd_up(div_up(spatialWork, tilesNum), 16);
+    parallel_for3d(B, C, tilesNum, [&](size_t b, size_t c, size_t tile) {
+        int tileStart = tile * tileSize;
+        if (tileStart >= spatialWork)
+            return;
         uint8_t *out_ptr_nc = out_ptr_ + (OH * OW * OD * C * b + OH * OW * OD * c) * dstDataSize;
         const uint8_t *in_ptr_nc = in_ptr_ + (IH * IW * ID * C * b + IH * IW * ID * c) * srcDataSize;
         auto arg = jit_interpolate_call_args();
         arg.src_ptr[0] = in_ptr_nc;
-        arg.index = static_cast<int*>(&index[0]);
-        arg.weight_ptr[0] = static_cast<float*>(&weight[0]);
-        arg.dst = out_ptr_nc;
-        arg.work_amount = OW * OH * OD;
+        arg.index = static_cast<int*>(&index[tileStart]);
+        arg.weight_ptr[0] = static_cast<float*>(&weight[tileStart]);
+        arg.dst = out_ptr_nc + tileStart * dstDataSize;
+        arg.work_amount = std::min(spatialWork - tileStart, tileSize);
         arg.oc_off = static_cast<size_t>(c * sizeof(float));
         arg.post_op_data = post_ops_data_;
         (*interpolateKernel)(&arg);
@@ -2790,20 +2809,28 @@ void Interpolate::InterpolateJitExecutor::cubicPlanar(const uint8_t *in_ptr_, ui
     tblAdvance += OW * OH;
     int *sequenceOW = static_cast<int*>(&auxTable[tblAdvance]);
 
-    parallel_for2d(B, C, [&](size_t n, size_t c) {
+    // the oh/ow sequence tables address the output plane per element, so the kernel can process
+    // any contiguous sub-range of the plane starting from the respective sequence entries
+    int spatialWork = OW * OH;
+    int tilesNum = spatialTilesNum(B * C, spatialWork);
+    int tileSize = rnd_up(div_up(spatialWork, tilesNum), 16);
+    parallel_for3d(B, C, tilesNum, [&](size_t n, size_t c, size_t tile) {
+        int tileStart = tile * tileSize;
+        if (tileStart >= spatialWork)
+            return;
         const uint8_t *in_ptr_nc = in_ptr_ + (IW * IH * C * n + IW * IH * c) * srcDataSize;
         uint8_t *out_ptr_nc = out_ptr_ + (OW * OH * C * n + OW * OH * c) * dstDataSize;
 
         auto arg = jit_interpolate_call_args();
-        arg.dst = out_ptr_nc;
+        arg.dst = out_ptr_nc + tileStart * dstDataSize;
         arg.src_ptr[0] = in_ptr_nc;
         arg.index = xOrigin;
         arg.src_ptr[1] = yOrigin;
-        arg.src_ptr[2] = static_cast<int*>(&sequenceOH[0]);
-        arg.src_ptr[3] = static_cast<int*>(&sequenceOW[0]);
+        arg.src_ptr[2] = static_cast<int*>(&sequenceOH[tileStart]);
+        arg.src_ptr[3] = static_cast<int*>(&sequenceOW[tileStart]);
         arg.weight_ptr[0] = xFactor;
         arg.weight_ptr[1] = yFactor;
-        arg.work_amount = static_cast<size_t>(OW * OH);
+        arg.work_amount = static_cast<size_t>(std::min(spatialWork - tileStart, tileSize));
         arg.oc_off = static_cast<size_t>(c * sizeof(float));
         arg.post_op_data = post_ops_data_;
         (*interpolateKernel)(&arg);
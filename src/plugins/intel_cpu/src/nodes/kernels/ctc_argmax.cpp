@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <cstdint>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "ctc_argmax.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+size_t ctc_arg_max_f32(const float* row, size_t size) {
+    size_t i = 0;
+    float maxValue = row[0];
+    size_t maxIdx = 0;
+
+#if defined(HAVE_AVX512F)
+    if (size >= 16) {
+        __m512 vmax = _mm512_loadu_ps(row);
+        __m512i vmaxIdx = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        __m512i vcurIdx = vmaxIdx;
+        const __m512i vstep = _mm512_set1_epi32(16);
+        for (i = 16; i + 16 <= size; i += 16) {
+            vcurIdx = _mm512_add_epi32(vcurIdx, vstep);
+            __m512 v = _mm512_loadu_ps(row + i);
+            // strict 'greater than' keeps the first occurrence within each lane
+            __mmask16 gt = _mm512_cmp_ps_mask(v, vmax, _CMP_GT_OS);
+            vmax = _mm512_mask_blend_ps(gt, vmax, v);
+            vmaxIdx = _mm512_mask_blend_epi32(gt, vmaxIdx, vcurIdx);
+        }
+        float values[16];
+        int32_t indices[16];
+        _mm512_storeu_ps(values, vmax);
+        _mm512_storeu_si512(indices, vmaxIdx);
+        maxValue = values[0];
+        maxIdx = static_cast<size_t>(indices[0]);
+        for (size_t lane = 1; lane < 16; lane++) {
+            const auto laneIdx = static_cast<size_t>(indices[lane]);
+            if (values[lane] > maxValue || (values[lane] == maxValue && laneIdx < maxIdx)) {
+                maxValue = values[lane];
+                maxIdx = laneIdx;
+            }
+        }
+    }
+#elif defined(HAVE_AVX2)
+    if (size >= 8) {
+        __m256 vmax = _mm256_loadu_ps(row);
+        __m256i vmaxIdx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        __m256i vcurIdx = vmaxIdx;
+        const __m256i vstep = _mm256_set1_epi32(8);
+        for (i = 8; i + 8 <= size; i += 8) {
+            vcurIdx = _mm256_add_epi32(vcurIdx, vstep);
+            __m256 v = _mm256_loadu_ps(row + i);
+            // strict 'greater than' keeps the first occurrence within each lane
+            __m256 gt = _mm256_cmp_ps(v, vmax, _CMP_GT_OS);
+            vmax = _mm256_blendv_ps(vmax, v, gt);
+            vmaxIdx = _mm256_blendv_epi8(vmaxIdx, vcurIdx, _mm256_castps_si256(gt));
+        }
+        float values[8];
+        int32_t indices[8];
+        _mm256_storeu_ps(values, vmax);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(indices), vmaxIdx);
+        maxValue = values[0];
+        maxIdx = static_cast<size_t>(indices[0]);
+        for (size_t lane = 1; lane < 8; lane++) {
+            const auto laneIdx = static_cast<size_t>(indices[lane]);
+            if (values[lane] > maxValue || (values[lane] == maxValue && laneIdx < maxIdx)) {
+                maxValue = values[lane];
+                maxIdx = laneIdx;
+            }
+        }
+    }
+#endif
+
+    for (; i < size; i++) {
+        if (row[i] > maxValue) {
+            maxValue = row[i];
+            maxIdx = i;
+        }
+    }
+    return maxIdx;
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/**
+ * Returns the index of the maximum element of a dense f32 row.
+ * The first occurrence wins on ties, matching the scalar scan the CTC decoders used before.
+ */
+size_t ctc_arg_max_f32(const float* row, size_t size);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -191,6 +191,37 @@ static void attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
     });
 }
 
+template <typename T>
+static void paged_attn_quant_mt(const ov::intel_cpu::PlainTensor& k_src,
+                                const ov::intel_cpu::PlainTensor& v_src,
+                                const ov::intel_cpu::PlainTensor& k_dst,
+                                const ov::intel_cpu::PlainTensor& v_dst,
+                                const ov::intel_cpu::PlainTensor& slot_mapping) {
+    size_t B = k_src.m_dims[0], H = k_src.m_dims[1], L1 = k_src.m_dims[2];
+    size_t block_size = k_dst.m_dims[2];
+    // each row of the u8 cache is prefixed with its scale and zero point
+    size_t params_offset = sizeof(float) * 2;
+    size_t S = k_dst.m_dims[3] - params_offset;
+    parallel_for3d(B, L1, H, [&](size_t b, size_t m, size_t h) {
+        auto slot = slot_mapping.ptr<int32_t>(b)[m];
+        if (slot < 0) return;
+        auto block_number = slot / block_size;
+        auto block_offset = slot % block_size;
+        auto p_k = k_dst.ptr<uint8_t>(block_number, h, block_offset);
+        auto p_v = v_dst.ptr<uint8_t>(block_number, h, block_offset);
+        quant_u8(k_src.ptr<T>(b, h, m),
+                 p_k + params_offset,
+                 S,
+                 reinterpret_cast<float*>(p_k)[0],
+                 reinterpret_cast<float*>(p_k)[1]);
+        quant_u8(v_src.ptr<T>(b, h, m),
+                 p_v + params_offset,
+                 S,
+                 reinterpret_cast<float*>(p_v)[0],
+                 reinterpret_cast<float*>(p_v)[1]);
+    });
+}
+
 void attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
                   const ov::intel_cpu::PlainTensor& v_src,
                   const ov::intel_cpu::PlainTensor& k_dst,
@@ -206,6 +237,21 @@ void attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
     }
 }
 
+void paged_attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
+                        const ov::intel_cpu::PlainTensor& v_src,
+                        const ov::intel_cpu::PlainTensor& k_dst,
+                        const ov::intel_cpu::PlainTensor& v_dst,
+                        const ov::intel_cpu::PlainTensor& slot_mapping) {
+    if (k_src.get_precision() == ov::element::f32 && k_dst.get_precision() == ov::element::u8) {
+        paged_attn_quant_mt<float>(k_src, v_src, k_dst, v_dst, slot_mapping);
+    } else if (k_src.get_precision() == ov::element::bf16 && k_dst.get_precision() == ov::element::u8) {
+        paged_attn_quant_mt<ov::bfloat16>(k_src, v_src, k_dst, v_dst, slot_mapping);
+    } else {
+        OPENVINO_THROW("unsupport src type: ", k_src.get_precision(),
+                       ", dst type: ", k_dst.get_precision(), " in paged_attn_quantkv");
+    }
+}
+
 void attn_quant_u8(const float* src, uint8_t* dst, size_t n, float& scale, float& zp) {
     quant_u8(src, dst, n, scale, zp);
 }
@@ -22,6 +22,12 @@ void attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
                   const ov::intel_cpu::PlainTensor& k_scale_zp,
                   const ov::intel_cpu::PlainTensor& v_scale_zp);
 
+void paged_attn_quantkv(const ov::intel_cpu::PlainTensor& k_src,
+                        const ov::intel_cpu::PlainTensor& v_src,
+                        const ov::intel_cpu::PlainTensor& k_dst,
+                        const ov::intel_cpu::PlainTensor& v_dst,
+                        const ov::intel_cpu::PlainTensor& slot_mapping);
+
 void attn_quant_u8(const float* src, uint8_t* dst, size_t n, float& scale, float& zp);
 
 void attn_dequant_u8(const uint8_t* src, float* dst, size_t n, float scale, float zp);
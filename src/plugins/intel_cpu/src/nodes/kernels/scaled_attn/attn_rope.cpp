@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <float.h>
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/parallel.hpp"
+#include "common.hpp"
+#include "attn_rope.hpp"
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+using namespace ov;
+
+// rotate-half flavour of the rotary embedding over one row:
+//   dst[i] = cos[i] * src[i] - sin[i] * src[i + half]   for the first half of rotary_dims
+//   dst[i] = cos[i] * src[i] + sin[i] * src[i - half]   for the second half
+// the elements beyond rotary_dims are passed through unchanged
+template <typename T>
+static void rope_rotate_half(T* dst, T* src, float* cos, float* sin, size_t rotary_dims, size_t feature_size) {
+    auto half = rotary_dims / 2;
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    for (; i + vec_len_f32_avx512 <= half; i += vec_len_f32_avx512) {
+        auto v_cos = _mm512_loadu_ps(cos + i);
+        auto v_sin = _mm512_loadu_ps(sin + i);
+        auto v_a = mm512_uni_loadu_ps(src + i);
+        auto v_b = mm512_uni_loadu_ps(src + i + half);
+        mm512_uni_storeu_ps(dst + i, _mm512_fnmadd_ps(v_sin, v_b, _mm512_mul_ps(v_cos, v_a)));
+    }
+#elif defined(HAVE_AVX2)
+    for (; i + vec_len_f32_avx2 <= half; i += vec_len_f32_avx2) {
+        auto v_cos = _mm256_loadu_ps(cos + i);
+        auto v_sin = _mm256_loadu_ps(sin + i);
+        auto v_a = mm256_uni_loadu_ps(src + i);
+        auto v_b = mm256_uni_loadu_ps(src + i + half);
+        mm256_uni_storeu_ps(dst + i, _mm256_fnmadd_ps(v_sin, v_b, _mm256_mul_ps(v_cos, v_a)));
+    }
+#endif
+    for (; i < half; i++) {
+        dst[i] = cos[i] * src[i] - sin[i] * src[i + half];
+    }
+#if defined(HAVE_AVX512F)
+    for (; i + vec_len_f32_avx512 <= rotary_dims; i += vec_len_f32_avx512) {
+        auto v_cos = _mm512_loadu_ps(cos + i);
+        auto v_sin = _mm512_loadu_ps(sin + i);
+        auto v_a = mm512_uni_loadu_ps(src + i);
+        auto v_b = mm512_uni_loadu_ps(src + i - half);
+        mm512_uni_storeu_ps(dst + i, _mm512_fmadd_ps(v_sin, v_b, _mm512_mul_ps(v_cos, v_a)));
+    }
+#elif defined(HAVE_AVX2)
+    for (; i + vec_len_f32_avx2 <= rotary_dims; i += vec_len_f32_avx2) {
+        auto v_cos = _mm256_loadu_ps(cos + i);
+        auto v_sin = _mm256_loadu_ps(sin + i);
+        auto v_a = mm256_uni_loadu_ps(src + i);
+        auto v_b = mm256_uni_loadu_ps(src + i - half);
+        mm256_uni_storeu_ps(dst + i, _mm256_fmadd_ps(v_sin, v_b, _mm256_mul_ps(v_cos, v_a)));
+    }
+#endif
+    for (; i < rotary_dims; i++) {
+        dst[i] = cos[i] * src[i] + sin[i] * src[i - half];
+    }
+#if defined(HAVE_AVX512F)
+    for (; i + vec_len_f32_avx512 <= feature_size; i += vec_len_f32_avx512) {
+        mm512_uni_storeu_ps(dst + i, mm512_uni_loadu_ps(src + i));
+    }
+#elif defined(HAVE_AVX2)
+    for (; i + vec_len_f32_avx2 <= feature_size; i += vec_len_f32_avx2) {
+        mm256_uni_storeu_ps(dst + i, mm256_uni_loadu_ps(src + i));
+    }
+#endif
+    for (; i < feature_size; i++) {
+        dst[i] = src[i];
+    }
+}
+
+void attn_rope_rotate_half(void* dst,
+                           void* src,
+                           float* cos,
+                           float* sin,
+                           size_t rotary_dims,
+                           size_t feature_size,
+                           ov::element::Type precision) {
+    if (precision == ov::element::bf16) {
+        rope_rotate_half(static_cast<ov::bfloat16*>(dst), static_cast<ov::bfloat16*>(src),
+                         cos, sin, rotary_dims, feature_size);
+    } else {
+        rope_rotate_half(static_cast<float*>(dst), static_cast<float*>(src),
+                         cos, sin, rotary_dims, feature_size);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
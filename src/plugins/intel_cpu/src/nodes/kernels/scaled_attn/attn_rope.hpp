@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <openvino/core/type/element_type.hpp>
+
+namespace ov {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+void attn_rope_rotate_half(void* dst,
+                           void* src,
+                           float* cos,
+                           float* sin,
+                           size_t rotary_dims,
+                           size_t feature_size,
+                           ov::element::Type precision);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace ov
@@ -188,8 +188,16 @@ static void attn_acc_value_block(float* out, float* weight, T* v, size_t S, size
     }
 }
 
+static void attn_acc_value(float* out, float weight, uint8_t* v, size_t S, float* scale, float* zp);
+
 static void attn_acc_value_block(float* out, float* weight, uint8_t* v, size_t S, size_t block_size) {
-    // TODO: int8 kvcache support
+    // each quantized row of the block is prefixed with its scale and zero point
+    size_t params_offset = sizeof(float) * 2;
+    for (size_t j = 0; j < block_size; j++) {
+        auto p = reinterpret_cast<float*>(v);
+        attn_acc_value(out, weight[j], v + params_offset, S, p, p + 1);
+        v += S + params_offset;
+    }
 }
 
 template<typename T>
@@ -784,7 +792,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     // avx2 will pre-compute the zero point and try to save the sub instruction in the dot_product,
     //  but it seems not necessary for avx512. Possible reason may be that for avx2 the cost of dot_product
     //  is larger than the memory access time, but for avx512 is not and the cost of pre-compute is a pure increase.
-    bool pastkv_is_int8 = past_k_scale_zp;
+    bool pastkv_is_int8 = past_k_scale_zp || (is_pagedattn && present_value.get_precision() == ov::element::u8);
     if (pastkv_is_int8) {
         // be sure no false sharing
         head_sum.resize<float>({B, H, q_len, 16});
@@ -796,20 +804,26 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
 
     // TODO: refactor to seperate files
     if (is_pagedattn) {
-        // if present_key is true, it means q*k is already computed in the caller
+        // if present_key is false, it means q*k is already computed in the caller
         if (present_key) {
+            // each row of the u8 cache is prefixed with its scale and zero point
+            constexpr bool key_is_int8 = std::is_same<T2, uint8_t>::value;
             parallel_for3d_dynamic(B, h_group_num, kv_len, [&](size_t b, size_t h_group, size_t pk) {
                 auto context_len = static_cast<size_t>(context_lens.ptr<int32_t>()[b]);
                 // kv_len must be valid
                 if (pk < context_len) {
                     auto block_number = beams.ptr<int32_t>(b)[pk / block_size];
                     auto block_offset = pk % block_size;
+                    auto p_k = present_key.ptr<T2>(block_number, h_group, block_offset);
+                    auto p = key_is_int8 ? reinterpret_cast<float*>(p_k) : nullptr;
+                    if (key_is_int8)
+                        p_k += sizeof(float) * 2;
 
                     for (size_t pq = 0; pq < q_len; pq++) {
                         for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                             buf_attn_w.ptr<float>(b, h, pq)[pk] =
-                                    dot_product(query.ptr<T>(b, h, pq), present_key.ptr<T2>(block_number, h_group, block_offset),
-                                        S, nullptr, nullptr, nullptr);
+                                    dot_product(query.ptr<T>(b, h, pq), p_k,
+                                        S, p, p ? p + 1 : nullptr, head_sum ? head_sum.ptr<float>(b, h, pq) : nullptr);
                         }
                     }
                 }
@@ -919,6 +933,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                             auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
                             auto p = past_k_scale_zp.ptr<float>(b_kv, h_group, pk);
                             auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
+                            prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
                             buf_attn_w.ptr<float>(b, h_group, 0)[pk] =
                                     dot_product(query.ptr<T>(b, h_group), p_k,
                                         S, p, p + 1, head_sum.ptr<float>(b, h_group));
@@ -928,11 +943,13 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                 } else {
                     for (size_t iwork = start; iwork < end; ++iwork) {
                         auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
+                        auto p_k = present_key.ptr<T2>(b_kv, h_group, pk);
+                        prefetch_bytes(S, _MM_HINT_T0, 4096, p_k);
                         for (size_t pq = 0; pq < q_len; pq++) {
                             auto p = past_k_scale_zp.ptr<float>(b_kv, h_group, pk);
                             for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                                 buf_attn_w.ptr<float>(b, h, pq)[pk] =
-                                        dot_product(query.ptr<T>(b, h, pq), present_key.ptr<T2>(b_kv, h_group, pk),
+                                        dot_product(query.ptr<T>(b, h, pq), p_k,
                                             S, p, p + 1, head_sum.ptr<float>(b, h, pq));
                             }
                         }
@@ -980,6 +997,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                         auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
                         auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
                         auto p = past_v_scale_zp.ptr<float>(b_kv, h_group, pv);
+                        prefetch_bytes(S, _MM_HINT_T0, 4096, v);
                         attn_acc_value(buf_attn_score.ptr<float>(ithr, b, 0, h_group),
                                     buf_attn_w.ptr<float>(b, h_group, 0, pv)[0],
                                     v,
@@ -993,6 +1011,7 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                         auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
                         auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
                         auto p = past_v_scale_zp.ptr<float>(b_kv, h_group, pv);
+                        prefetch_bytes(S, _MM_HINT_T0, 4096, v);
                         for (size_t pq = 0; pq < q_len; pq++) {
                             for (size_t h = h_group * h_each_group_len; h < (h_group + 1) * h_each_group_len; h++) {
                                 attn_acc_value(buf_attn_score.ptr<float>(ithr, b, pq, h),
@@ -16,6 +16,7 @@
 #include "openvino/op/non_max_suppression.hpp"
 #include "ov_ops/nms_ie_internal.hpp"
 
+#include <atomic>
 #include <queue>
 
 
@@ -329,6 +330,22 @@ void NonMaxSuppression::execute(dnnl::stream strm) {
     }
 }
 
+// The (batch, class) jobs are extremely uneven: a class which dominates the detections costs
+// orders of magnitude more sorting and suppression than an almost empty one, and the static
+// splitter of parallel_for2d then leaves most of the threads idle. Feed the workers from a
+// shared counter instead, so a thread which finished its job steals the next pending pair.
+template <typename Body>
+static void parallel_for2d_dynamic(size_t d0, size_t d1, const Body& body) {
+    const size_t jobs_num = d0 * d1;
+    std::atomic<size_t> job_counter{0lu};
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        for (size_t job = job_counter.fetch_add(1lu, std::memory_order_relaxed); job < jobs_num;
+             job = job_counter.fetch_add(1lu, std::memory_order_relaxed)) {
+            body(job / d1, job % d1);
+        }
+    });
+}
+
 void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
                                                              const VectorDims &scoresStrides, std::vector<FilteredBox> &filtBoxes) {
     auto less = [](const boxInfo& l, const boxInfo& r) {
@@ -344,7 +361,7 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
         return std::exp(m_scale * iou * iou);
     };
 
-    parallel_for2d(m_batches_num, m_classes_num, [&](int batch_idx, int class_idx) {
+    parallel_for2d_dynamic(m_batches_num, m_classes_num, [&](int batch_idx, int class_idx) {
         std::vector<FilteredBox> selectedBoxes;
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
@@ -457,7 +474,7 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
 void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
                                                                 const VectorDims &scoresStrides, std::vector<FilteredBox> &filtBoxes) {
     int max_out_box = static_cast<int>(m_output_boxes_per_class);
-    parallel_for2d(m_batches_num, m_classes_num, [&](int batch_idx, int class_idx) {
+    parallel_for2d_dynamic(m_batches_num, m_classes_num, [&](int batch_idx, int class_idx) {
         const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
@@ -785,7 +802,7 @@ void NonMaxSuppression::nmsRotated(const float* boxes, const float* scores, cons
     if (m_jit_kernel) {
         THROW_CPU_NODE_ERR("does not have implementation of the JIT kernel for Rotated boxes.");
     } else {
-        parallel_for2d(m_batches_num, m_classes_num, [&](int64_t batch_idx, int64_t class_idx) {
+        parallel_for2d_dynamic(m_batches_num, m_classes_num, [&](int64_t batch_idx, int64_t class_idx) {
             const float *boxes_ptr = boxes + batch_idx * boxes_strides[0];
             const float *scores_ptr = scores + batch_idx * scores_strides[0] + class_idx * scores_strides[1];
 
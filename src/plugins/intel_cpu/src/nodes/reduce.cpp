@@ -2278,7 +2278,7 @@ void Reduce::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
             size_t ob = ReduceN ? 0 : ib; GET_PTR_N_PLN;
             if (!ReduceC && !ReduceD && ReduceW) {
                 size_t work_amount = ReduceH ? IH * IW : IW;
-                if (work_amount < blk_size && mayiuse(cpu::x64::avx2)) {
+                if (ReduceWGather_opt) {
                     size_t outer_size = ReduceH ? IC * ID : IC * ID * IH;
                     size_t inner_size = ReduceH ? IH * IW : IW;
                     size_t output_inner_size = ReduceH ? OH * OW : OW;
@@ -3097,6 +3097,20 @@ inline void Reduce::set_reduce_dim_flags() {
 
     ReduceAll_opt = layout == ReduceLayoutType::reduce_blocked && support_split &&
                     ReduceC && ReduceD && ReduceH && ReduceW;
+
+    // Transposed accumulation via gather loads lets the kernel reduce blk_size rows per invocation,
+    // keeping vector lanes full when a single row is too short for the linear vector loop or leaves
+    // a long scalar tail after it. It pays off on big outer counts, where the row-per-call scheme
+    // spends most of the time in call overhead and horizontal reductions.
+    if (layout != ReduceLayoutType::reduce_blocked && !ReduceC && !ReduceD && ReduceW &&
+        mayiuse(cpu::x64::avx2)) {
+        size_t gather_inner = ReduceH ? IH * IW : IW;
+        size_t gather_outer = ReduceH ? IC * ID : IC * ID * IH;
+        ReduceWGather_opt = gather_inner < 2 * blk_size && gather_outer >= blk_size;
+    } else {
+        ReduceWGather_opt = false;
+    }
+
     if (!set_use_aux_kernel) {
         use_aux_kernel = (ReduceDH_opt || ReduceCDW_opt || ReduceAll_opt) && precision_change;
         set_use_aux_kernel = true;
@@ -147,6 +147,7 @@ private:
     bool ReduceAll_opt = false;
     bool ReduceDH_opt = false;
     bool ReduceCDW_opt = false;
+    bool ReduceWGather_opt = false;
     bool use_aux_kernel = false;
     bool set_use_aux_kernel = false;
     bool ReduceN, ReduceC, ReduceD, ReduceH, ReduceW;
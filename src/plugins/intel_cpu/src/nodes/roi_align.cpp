@@ -3,6 +3,8 @@
 //
 
 #include "roi_align.h"
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <math.h>
@@ -1070,13 +1072,30 @@ void ROIAlign::executeSpecified() {
         OPENVINO_THROW("realRois must be greater than 0");
     }
 
+    // Schedule spatially close ROIs temporally close to each other, so that threads pooling
+    // neighboring ROIs reuse the overlapping feature map region from cache instead of re-reading
+    // it from DRAM (detection models commonly produce hundreds of clustered proposals).
+    // The permutation only changes the processing order, each ROI still fills its own output slot.
+    std::vector<int> roiOrder(realRois);
+    std::iota(roiOrder.begin(), roiOrder.end(), 0);
+    if (realRois > 2) {
+        std::sort(roiOrder.begin(), roiOrder.end(), [&](int a, int b) {
+            if (srcRoiIdx[a] != srcRoiIdx[b])
+                return srcRoiIdx[a] < srcRoiIdx[b];
+            if (srcRoi[a * 4 + 1] != srcRoi[b * 4 + 1])
+                return srcRoi[a * 4 + 1] < srcRoi[b * 4 + 1];
+            return srcRoi[a * 4] < srcRoi[b * 4];
+        });
+    }
+
     if (roi_align_kernel) {
         if (!isPlainFmt) {
             std::vector<float> workingBuf;
             int bufSize = rnd_up(C, 16);
             size_t threadsNum = parallel_get_num_threads();
             workingBuf.resize(bufSize * threadsNum, 0.f);
-            parallel_for3d(realRois, pooledH, pooledW, [&](int n, int yBinInd, int xBinInd) {
+            parallel_for3d(realRois, pooledH, pooledW, [&](int nIdx, int yBinInd, int xBinInd) {
+                const int n = roiOrder[nIdx];
                 int numSamplesROI = numSamples[n];
                 // each sample have 4 values for srcAddressList and weight
                 size_t binOffset = numSamplesROI * BLIParamsNum * pooledW * yBinInd + numSamplesROI * BLIParamsNum * xBinInd;
@@ -1098,7 +1117,8 @@ void ROIAlign::executeSpecified() {
             });
         } else {
             // one lane for one sample generation, then pooling all samples.
-            parallel_for4d(realRois, C, pooledH, pooledW, [&](int n, int cIdx, int yBinInd, int xBinInd) {
+            parallel_for4d(realRois, C, pooledH, pooledW, [&](int nIdx, int cIdx, int yBinInd, int xBinInd) {
+                const int n = roiOrder[nIdx];
                 size_t batchSrcOffset = srcRoiIdx[n] * batchInputStride;
                 size_t channelSrcOffset = batchSrcOffset + cIdx * H * W;
                 size_t binOffset = yBinInd * pooledW + xBinInd;
@@ -1120,7 +1140,8 @@ void ROIAlign::executeSpecified() {
         }
     } else {
         // ref with planar
-        parallel_for4d(realRois, C, pooledH, pooledW, [&](int n, int cIdx, int yBinInd, int xBinInd) {
+        parallel_for4d(realRois, C, pooledH, pooledW, [&](int nIdx, int cIdx, int yBinInd, int xBinInd) {
+            const int n = roiOrder[nIdx];
             int numSamplesROI = numSamples[n];
             size_t batchSrcOffset = srcRoiIdx[n] * batchInputStride;
             size_t channelSrcOffset = batchSrcOffset + cIdx * H * W;
@@ -22,6 +22,7 @@
 #include <memory>
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
 using namespace dnnl;
 using namespace dnnl::impl;
@@ -530,6 +531,28 @@ void ROIPooling::prepareParams() {
     execPtr = result.first;
 }
 
+// Schedule spatially close ROIs temporally close to each other, so that threads pooling
+// neighboring ROIs reuse the overlapping feature map region from cache instead of re-reading
+// it from DRAM. The permutation only changes the processing order, each ROI still fills its
+// own output slot; the padding ROIs past real_rois keep their original positions.
+template <typename T>
+static std::vector<int> buildSpatialRoiOrder(const T* src_roi, const size_t src_roi_step, int mb, int real_rois) {
+    std::vector<int> order(mb);
+    std::iota(order.begin(), order.end(), 0);
+    if (real_rois > 2) {
+        std::sort(order.begin(), order.begin() + real_rois, [&](int a, int b) {
+            const T* roi_a = &src_roi[a * src_roi_step];
+            const T* roi_b = &src_roi[b * src_roi_step];
+            if (roi_a[0] != roi_b[0])
+                return roi_a[0] < roi_b[0];
+            if (roi_a[2] != roi_b[2])
+                return roi_a[2] < roi_b[2];
+            return roi_a[1] < roi_b[1];
+        });
+    }
+    return order;
+}
+
 template <typename T>
 class ROIPooling::ROIPoolingJitExecutor : public ROIPooling::ROIPoolingExecutor {
 public:
@@ -589,7 +612,9 @@ private:
             }
         }
 
-        parallel_for4d(MB, cb_work, jpp.oh, jpp.ow, [&](int n, int cbb, int oh, int ow) {
+        const auto roi_order = buildSpatialRoiOrder(src_roi, src_roi_step, MB, real_rois);
+        parallel_for4d(MB, cb_work, jpp.oh, jpp.ow, [&](int n_idx, int cbb, int oh, int ow) {
+            const int n = roi_order[n_idx];
             auto arg = jit_roi_pooling_call_args();
             int cb = cbb * jpp.nb_c_blocking;
             int cb_num = jpp.nb_c_blocking;
@@ -707,7 +732,9 @@ public:
             }
         }
 
-        parallel_for4d(MB, cb_work, jpp.oh, jpp.ow, [&](int n, int cbb, int oh, int ow) {
+        const auto roi_order = buildSpatialRoiOrder(src_roi, src_roi_step, MB, real_rois);
+        parallel_for4d(MB, cb_work, jpp.oh, jpp.ow, [&](int n_idx, int cbb, int oh, int ow) {
+            const int n = roi_order[n_idx];
             int cb_num = jpp.nb_c_blocking;
             int c_block = jpp.c_block;
 
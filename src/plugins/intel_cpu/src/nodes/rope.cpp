@@ -7,6 +7,7 @@
 #include "common/bfloat16.hpp"
 #include "common/cpu_memcpy.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "kernels/scaled_attn/attn_rope.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 #include "utils/plain_tensor.hpp"
 
@@ -14,6 +15,8 @@
 #include <string>
 #include <vector>
 
+using namespace ov::Extensions::Cpu::XARCH;
+
 namespace ov {
 namespace intel_cpu {
 namespace node {
@@ -64,7 +67,6 @@ struct RoPE::RoPEExecutorRotateHalf : public RoPE::Executor {
         auto feature_size = t_src.size(3);
 
         auto rotary_dims = config.rotary_ndims;
-        auto half_rotary_dims = rotary_dims / 2;
 
         parallel_for3d(batch_size, head_cnt, seq_len, [&](size_t b, size_t h, size_t p) {
             auto cos_pos = p;
@@ -79,16 +81,7 @@ struct RoPE::RoPEExecutorRotateHalf : public RoPE::Executor {
             auto* sin = &t_sin.at<float>({b, h, cos_pos, 0}, true);
             auto* dst = &t_dst.at<T>({b, h, p, 0});
 
-            size_t i = 0;
-            for (; i < half_rotary_dims; i++) {
-                dst[i] = cos[i] * src[i] + sin[i] * (-src[i + half_rotary_dims]);
-            }
-            for (; i < rotary_dims; i++) {
-                dst[i] = cos[i] * src[i] + sin[i] * (src[i - half_rotary_dims]);
-            }
-            for (; i < feature_size; i++) {
-                dst[i] = src[i];
-            }
+            attn_rope_rotate_half(dst, src, cos, sin, rotary_dims, feature_size, ov::element::from<T>());
         });
     }
 };
@@ -192,7 +185,6 @@ struct RoPE::RoPEExecutorQwen : public RoPE::Executor {
         auto present_kv_len = t_cos.size(1);
 
         auto rotary_dims = t_cos.size(3);
-        auto half_rotary_dims = rotary_dims / 2;
 
         parallel_for3d(batch_size, seq_len, head_cnt, [&](size_t b, size_t p, size_t h) {
             auto* src = &t_src.at<T>({b, p, h * head_size});
@@ -200,16 +192,7 @@ struct RoPE::RoPEExecutorQwen : public RoPE::Executor {
             auto* sin = &t_sin.at<float>({b, present_kv_len - seq_len + p, h, 0}, true);
             auto* dst = &t_dst.at<T>({b, p, h, 0});
 
-            size_t i = 0;
-            for (; i < half_rotary_dims; i++) {
-                dst[i] = cos[i] * src[i] + sin[i] * (-src[i + half_rotary_dims]);
-            }
-            for (; i < rotary_dims; i++) {
-                dst[i] = cos[i] * src[i] + sin[i] * (src[i - half_rotary_dims]);
-            }
-            for (; i < head_size; i++) {
-                dst[i] = src[i];
-            }
+            attn_rope_rotate_half(dst, src, cos, sin, rotary_dims, head_size, ov::element::from<T>());
         });
     }
 };
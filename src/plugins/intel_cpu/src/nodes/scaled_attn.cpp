@@ -274,11 +274,17 @@ struct MHAKernel {
 
         auto k_stride_s = present_key.stride(3);
 
-        parallel_for2d(B, H, [&](size_t b, size_t h) {
+        // chunk the query dimension as well, so the prefill of a single long prompt
+        // (B and H provide too few work items) can spread over all cores
+        constexpr size_t m_block_size = 4;
+        auto m_blocks = (q_len + m_block_size - 1) / m_block_size;
+        parallel_for3d(B, H, m_blocks, [&](size_t b, size_t h, size_t m_blk) {
             std::vector<float> attn_score(kv_len);
             std::vector<float> word_vec(head_size, 0.0f);
+            auto m_start = m_blk * m_block_size;
+            auto m_end = std::min(m_start + m_block_size, q_len);
 
-            for (size_t m = 0; m < q_len; m++) {
+            for (size_t m = m_start; m < m_end; m++) {
                 // dot-product to get attention scores
                 auto* q = query.ptr<T>(b, h, m, 0);
                 // how many key/values can be accessed causally
@@ -859,7 +865,9 @@ struct MHAKernel<ScaledDotProductAttention::KT_MLAS, float> {
 };
 #endif
 
-// 2nd token case : only 1 token in query
+// 2nd token case : q_len is 1 for plain decoding, or a small number of tokens verified in one pass
+// against the concatenated KV-cache (speculative decoding); in the latter case the token tree is
+// described by an explicit per-row attention mask instead of the auto-generated causal one.
 struct MHASingleToken {
     PlainTensor m_attn_w;
     PlainTensor m_temp;
@@ -1027,14 +1035,15 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             has_out_transpose = true;
 
             // q: [B, L1, H*S], kv: [B, L1, Hk*S]
-            // k_cache: [NUM_BLOCKS, Hk, 16, S]
+            // k_cache: [NUM_BLOCKS, Hk, 16, S], for u8 cache each row is prefixed with its scale and zp
             // v_cache: [NUM_BLOCKS, Hk, 16, S]
             // context_lens: [B]
             // block_tables: [B, max_block_per_request]
             B = k_input.size(0);
             L1 = k_input.size(1);
             auto Hk = present_key.size(1);
-            S = present_value.size(3);
+            S = present_value.size(3) -
+                (present_value.get_precision() == ov::element::u8 ? sizeof(float) * 2 : 0);
             auto H = q_input.size(2) / S;
             // L0 in each batch may be different
             L0 = 0;
@@ -1125,7 +1134,8 @@ struct ScaledDotProductAttention::AttentionExecutor : public ScaledDotProductAtt
             }
         }
 
-        // second token, or first token with pastkv fusing
+        // second token (L1 may still be a small group of speculative tokens verified in one pass
+        // with a per-row tree mask), or first token with pastkv fusing
         bool use_one_token;
         if (is_pagedattn)
             use_one_token = !is_prompt;
@@ -1437,7 +1447,90 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
             " should less than batch of previous pastkv: ", B_state);
     }
 
-    // 2. resize pastkv
+    // 2. try to shrink in place: dropping trailing sequences (the eviction pattern of continuous
+    //    batching) keeps every surviving slot at its position, so the state can be reinterpreted
+    //    with a smaller batch instead of gathering the whole KV history into a new buffer
+    if (B < B_state && L0 > 0 && !m_k_state->is_reset_state() && !m_v_state->is_reset_state()) {
+        bool identity_prefix = true;
+        for (size_t b = 0; b < B && identity_prefix; b++) {
+            identity_prefix = static_cast<size_t>(table[b]) == b;
+        }
+        // surviving rows must not reference dropped slots, otherwise their history would be
+        // lost on the next buffer growth
+        for (size_t b = 0; b < B && identity_prefix; b++) {
+            for (size_t l = 0; l < L0; l++) {
+                if (static_cast<size_t>(old_beam_table_k.at<int32_t>({b, l})) >= B) {
+                    identity_prefix = false;
+                    break;
+                }
+            }
+        }
+        auto max_l = m_k_state->internal_state_max_size() / (B_state * H * S);
+        auto max_l_bt = m_k_state->hidden_state_max_size() / B_state;
+        if (identity_prefix && L0 + L1 <= max_l && L0 + L1 <= max_l_bt) {
+            ov::element::Type precision = m_k_state->internal_desc()->getPrecision();
+            auto internal_mem_k = m_k_state->internal_state_mem();
+            auto internal_mem_v = m_v_state->internal_state_mem();
+            auto new_shape = {B, H, (L0 + L1), S};
+            auto mem_desc = std::make_shared<CpuBlockedMemoryDesc>(precision,
+                Shape(reverse(new_shape)),
+                new_shape,
+                order,
+                0,
+                VectorDims{},
+                internal_mem_k->getDescWithType<BlockedMemoryDesc>()->getStrides());
+            internal_mem_k->redefineDesc(mem_desc);
+            internal_mem_v->redefineDesc(mem_desc);
+            // keep the capacity bookkeeping consistent with the smaller batch so the growth
+            // check still triggers when a row runs out of its strided slot
+            m_k_state->assign_internal_state_max_size(B * H * max_l * S);
+            m_v_state->assign_internal_state_max_size(B * H * max_l * S);
+            if (precision == ov::element::u8) {
+                m_k_state->get_scale_zp().m_dims[0] = B;
+                m_v_state->get_scale_zp().m_dims[0] = B;
+            }
+
+            PlainTensor past_k, past_v;
+            past_k.reset(internal_mem_k);
+            past_v.reset(internal_mem_v);
+            past_k = past_k.permute(order);
+            past_v = past_v.permute(order);
+            if (precision == ov::element::u8) {
+                attn_quantkv(cur_k, cur_v,
+                    past_k.slice(2, L0, L0 + L1), past_v.slice(2, L0, L0 + L1),
+                    m_k_state->get_scale_zp().slice(2, L0, L0 + L1),
+                    m_v_state->get_scale_zp().slice(2, L0, L0 + L1));
+            } else {
+                attn_memcpy(cur_k, cur_v, past_k.slice(2, L0, L0 + L1), past_v.slice(2, L0, L0 + L1));
+            }
+
+            auto old_hidden_state_v = m_v_state->hidden_state_mem();
+            std::vector<size_t> new_bt_shape{B, (L0 + L1)};
+            auto bt_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                Shape(new_bt_shape),
+                new_bt_shape,
+                VectorDims{0, 1},
+                0,
+                VectorDims{},
+                old_hidden_state_k->getDescWithType<BlockedMemoryDesc>()->getStrides());
+            old_hidden_state_k->redefineDesc(bt_desc);
+            old_hidden_state_v->redefineDesc(bt_desc);
+            m_k_state->assign_hidden_state_max_size(B * max_l_bt);
+            m_v_state->assign_hidden_state_max_size(B * max_l_bt);
+            PlainTensor beam_table_k, beam_table_v;
+            beam_table_k.reset(old_hidden_state_k);
+            beam_table_v.reset(old_hidden_state_v);
+            for (size_t b = 0; b < B; b++) {
+                for (size_t l = L0; l < L0 + L1; l++) {
+                    beam_table_k.at<int32_t>({b, l}) = b;
+                    beam_table_v.at<int32_t>({b, l}) = b;
+                }
+            }
+            return;
+        }
+    }
+
+    // 3. resize pastkv
     ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
     {
         auto shape = {B, H, (L0 + L1) * 2, S};
@@ -1516,7 +1609,7 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
         m_k_state->assign_internal_state_max_size(B * H * (L0 + L1) * 2 * S);
         m_v_state->assign_internal_state_max_size(B * H * (L0 + L1) * 2 * S);
     }
-    // 3. create beam table
+    // 4. create beam table
     {
         auto mem_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32, Shape{B, (L0 + L1) * 2});
 
@@ -1551,6 +1644,10 @@ void ScaledDotProductAttention::resetBeamTablePastkv(const MemoryPtr& mem_cur_k,
     }
 }
 
+// Scatter the new tokens into the block based KV-cache pool. The pool ([NUM_BLOCKS, H, block_size, S])
+// and the per-sequence slot mapping are owned by the runtime, so the cache never gets reallocated or
+// copied on growth and blocks can be shared across sequences; the stateful path below keeps a dense
+// per-request tensor instead (see VariableStateKVcache).
 void ScaledDotProductAttention::gatherConcatPastkvForPagedAttn(const std::vector<MemoryPtr>& inputs) {
     PlainTensor k, v, k_cache, v_cache, slot_mapping;
 
@@ -1563,17 +1660,22 @@ void ScaledDotProductAttention::gatherConcatPastkvForPagedAttn(const std::vector
     auto B = k.size(0);
     auto L1 = k.size(1);
     auto H = k_cache.size(1);
-    auto S = v_cache.size(3);
+    // for u8 cache each row is prefixed with its scale and zp
+    auto S_cache = v_cache.size(3);
+    auto S = S_cache - (v_cache.get_precision() == ov::element::u8 ? sizeof(float) * 2 : 0);
 
     k.assert_dims({B, L1, H * S});
     v.assert_dims({B, L1, H * S});
-    k_cache.assert_dims({0, H, 0, S}, true);
-    v_cache.assert_dims({k_cache.m_dims[0], H, k_cache.m_dims[2], S});
+    k_cache.assert_dims({0, H, 0, S_cache}, true);
+    v_cache.assert_dims({k_cache.m_dims[0], H, k_cache.m_dims[2], S_cache});
     slot_mapping.assert_dims({B, 0}, true);
     k = k.reshape({B, L1, H, S}).permute({0, 2, 1, 3});
     v = v.reshape({B, L1, H, S}).permute({0, 2, 1, 3});
-    paged_attn_memcpy(k, v, k_cache, v_cache, slot_mapping);
-    // TODO: add u8 kvcache support
+    if (k_cache.get_precision() == ov::element::u8) {
+        paged_attn_quantkv(k, v, k_cache, v_cache, slot_mapping);
+    } else {
+        paged_attn_memcpy(k, v, k_cache, v_cache, slot_mapping);
+    }
 }
 
 void ScaledDotProductAttention::gatherConcatPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx) {
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 using namespace dnnl;
@@ -388,6 +389,96 @@ private:
 };
 };   // namespace scatter_elements_update
 
+// Privatized-accumulator parallel reduction: each thread reduces its chunk of updates into a
+// private copy of the output initialized with the reduction neutral value, then the partials are
+// merged and applied to the output. Races on duplicated indices are confined to the private
+// buffers, so no serialization along the axis is needed. Used for the shapes which give the
+// axis-serial implementation too little outer parallelism while the output is small enough for
+// per-thread copies (the typical GNN scatter-add: a huge updates tensor reduced into a small table).
+template <typename DataType, typename KernelType>
+void ScatterUpdate::scatterElementsUpdatePrivateReduce(const MemoryPtr& mem_data, const MemoryPtr& mem_indices,
+                                                       const MemoryPtr& mem_updates, int axis,
+                                                       const KernelType& kernel) {
+    using namespace scatter_elements_update;
+    DataType *dataPtr = mem_data->getDataAs<DataType>();
+    DataType *updatePtr = mem_updates->getDataAs<DataType>();
+    uint8_t *indicesPtr = mem_indices->getDataAs<uint8_t>();
+
+    const auto& data_shape = mem_data->getStaticDims();
+    const auto& indices_shape = mem_indices->getStaticDims();
+    const size_t updates_rank = indices_shape.size();
+    const int64_t data_dim_size = static_cast<int64_t>(data_shape[axis]);
+    const size_t data_size = shape_size(data_shape);
+    const size_t indices_size = shape_size(indices_shape);
+
+    const std::vector<size_t> dataBlockND = getBlockND(data_shape);
+
+    const auto neutral = reduction_neutral_value<DataType>(reduction_type);
+    const int nthr = parallel_get_max_threads();
+    std::vector<DataType> partial(static_cast<size_t>(nthr) * data_size, neutral);
+    std::vector<uint8_t> touched(static_cast<size_t>(nthr) * data_size, 0);
+
+    parallel_nt(nthr, [&](const int ithr, const int nthr_actual) {
+        size_t start = 0, end = 0;
+        splitter(indices_size, nthr_actual, ithr, start, end);
+        if (start >= end)
+            return;
+        DataType* priv = &partial[ithr * data_size];
+        uint8_t* mask = &touched[ithr * data_size];
+
+        // walk the flat updates range while keeping the data offset of the non-axis coordinates
+        // up to date incrementally
+        VectorDims coord(updates_rank, 0);
+        getCoordinate(coord, start, indices_shape);
+        size_t dst_base = 0;
+        for (size_t d = 0; d < updates_rank; d++) {
+            if (static_cast<int>(d) != axis)
+                dst_base += coord[d] * dataBlockND[d + 1];
+        }
+        for (size_t i = start; i < end; i++) {
+            int64_t idxValue = getIndicesValue(indicesPtr, i);
+            if (idxValue < 0) idxValue += data_dim_size;
+            assert(idxValue < data_dim_size && idxValue >= 0);
+            const size_t dst_off = dst_base + static_cast<size_t>(idxValue) * dataBlockND[axis + 1];
+            kernel(&priv[dst_off], &updatePtr[i]);
+            mask[dst_off] = 1;
+
+            for (size_t d = updates_rank; d-- > 0;) {
+                coord[d]++;
+                if (static_cast<int>(d) != axis)
+                    dst_base += dataBlockND[d + 1];
+                if (coord[d] < indices_shape[d])
+                    break;
+                coord[d] = 0;
+                if (static_cast<int>(d) != axis)
+                    dst_base -= indices_shape[d] * dataBlockND[d + 1];
+            }
+        }
+    });
+
+    parallel_nt(0, [&](const int ithr, const int nthr_actual) {
+        size_t start = 0, end = 0;
+        splitter(data_size, nthr_actual, ithr, start, end);
+        for (size_t i = start; i < end; i++) {
+            DataType acc = neutral;
+            bool any = false;
+            for (int t = 0; t < nthr; t++) {
+                if (touched[static_cast<size_t>(t) * data_size + i]) {
+                    kernel(&acc, &partial[static_cast<size_t>(t) * data_size + i]);
+                    any = true;
+                }
+            }
+            if (!any)
+                continue;
+            if (use_init_val) {
+                kernel(&dataPtr[i], &acc);
+            } else {
+                dataPtr[i] = acc;
+            }
+        }
+    });
+}
+
 // output[indices[i][j][k]][j][k] = updates[i][j][k] if axis = 0,
 // output[i][indices[i][j][k]][k] = updates[i][j][k] if axis = 1,
 // output[i][j][indices[i][j][k]] = updates[i][j][k] if axis = 2.
@@ -412,6 +503,21 @@ void ScatterUpdate::scatterElementsUpdate(const MemoryPtr& mem_data, const Memor
     VectorDims squashed_indices_shape(indices_shape);
     squashed_indices_shape[axis] = 1;
 
+    // The processing below is serial along 'axis' only to order the writes of duplicated indices.
+    // The commutative reductions do not need that order, so when the remaining dimensions give too
+    // little parallelism they are dispatched to the privatized-accumulator implementation instead,
+    // as long as the per-thread output copies stay cache sized.
+    if (!std::is_same<KernelType, scatter_elements_update::ReduceNone>::value) {
+        constexpr size_t maxPrivateCopyBytes = 256 * 1024;
+        const int nthr = parallel_get_max_threads();
+        if (nthr > 1 && shape_size(squashed_indices_shape) < static_cast<size_t>(nthr) &&
+            shape_size(data_shape) * sizeof(DataType) <= maxPrivateCopyBytes &&
+            shape_size(indices_shape) >= 1024u) {
+            scatterElementsUpdatePrivateReduce<DataType>(mem_data, mem_indices, mem_updates, axis, kernel);
+            return;
+        }
+    }
+
     const std::vector<size_t> dataBlockND = getBlockND(data_shape);
     const std::vector<size_t> indicesBlockND = getBlockND(indices_shape);
     const size_t dataBlock_axisplus1 = dataBlockND[axis + 1];
@@ -163,10 +163,10 @@ void Split::initSupportedPrimitiveDescriptors() {
     }
 
     // in place only makes sense when we split by dense blocks since strided tensors are not supported by most nodes.
+    // The axis dimensions may be dynamic: the partition geometry is then refreshed per shape signature
+    // in redefineOutputMemory.
     const auto& parentdDims = inputShapes[0].getDims();
-    if (parentdDims[axis] != Shape::UNDEFINED_DIM &&
-        std::all_of(parentdDims.begin(), parentdDims.begin() + axis, [](size_t dim) { return  dim == 1; }) &&
-        std::all_of(outputShapes.begin(), outputShapes.end(), [=](const Shape& shape){ return shape.getDims()[axis] != Shape::UNDEFINED_DIM; })) {
+    if (std::all_of(parentdDims.begin(), parentdDims.begin() + axis, [](size_t dim) { return  dim == 1; })) {
         for (auto refPdIndex : pdIndexesToReuse) {
             auto config = supportedPrimitiveDescriptors[refPdIndex].getConfig();
 
@@ -534,18 +534,18 @@ void Split::resolveInPlaceEdges(Edge::LOOK look) {
     size_t numberOfOutputs = config.outConfs.size();
     size_t inplaceInpIndx = selected_pd->getConfig().outConfs[0].inPlace();
     auto baseDim = inputShapes.front().getDims()[axis];
-    OPENVINO_ASSERT(baseDim != Shape::UNDEFINED_DIM,
-                    " Split node: ",
-                    getName(),
-                    " can not use inPlace memory with splitting on dynamic dimension");
     auto baseMemMngr = getParentEdgeAt(inplaceInpIndx)->getMemory().getMemoryMngr();
+    const bool dynamicAxis = baseDim == Shape::UNDEFINED_DIM ||
+        std::any_of(outputShapes.begin(), outputShapes.end(), [this](const Shape& shape) {
+            return shape.getDims()[axis] == Shape::UNDEFINED_DIM;
+        });
+    inplacePartitions.clear();
+    if (dynamicAxis) {
+        inplacePartitions.resize(numberOfOutputs);
+    }
     ptrdiff_t offset = 0;
     for (size_t i = 0; i < numberOfOutputs; ++i) {
         auto partDim = outputShapes[i].getDims()[axis];
-        OPENVINO_ASSERT(partDim != Shape::UNDEFINED_DIM,
-                        " Split node: ",
-                        getName(),
-                        " can not use inPlace memory with splitting on dynamic dimension");
         const auto& childEdges = getChildEdgesAtPort(i);
         for (auto& childEdge : childEdges) {
             OPENVINO_ASSERT(childEdge->getStatus() == Edge::Status::NotAllocated,
@@ -557,7 +557,14 @@ void Split::resolveInPlaceEdges(Edge::LOOK look) {
             auto memDesc = selected_pd->getConfig().outConfs[i].getMemDesc();
             MemoryPtr newMem;
             if (partDim != 0) {
-                auto memMngr = std::make_shared<PartitionedMemoryMngr>(baseMemMngr, baseDim, offset, partDim);
+                std::shared_ptr<PartitionedMemoryMngr> memMngr;
+                if (dynamicAxis) {
+                    // placeholder geometry which redefineOutputMemory refreshes on every shape change
+                    memMngr = std::make_shared<PartitionedMemoryMngr>(baseMemMngr);
+                    inplacePartitions[i].push_back(memMngr);
+                } else {
+                    memMngr = std::make_shared<PartitionedMemoryMngr>(baseMemMngr, baseDim, offset, partDim);
+                }
                 newMem = std::make_shared<Memory>(getEngine(), memDesc, memMngr);
             } else {
                 // empty tensor, no need to reference a part, default memory is enough
@@ -566,8 +573,48 @@ void Split::resolveInPlaceEdges(Edge::LOOK look) {
 
             childEdge->reuse(newMem);
         }
+        if (!dynamicAxis) {
+            offset += partDim;
+        }
+    }
+}
+
+void Split::redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes) {
+    if (!isInPlace() || inplacePartitions.empty()) {
+        Node::redefineOutputMemory(newOutputShapes);
+        return;
+    }
+
+    OPENVINO_ASSERT(newOutputShapes.size() == outputShapes.size(),
+                    "Number shapes mismatch with real outputs number for node with name: ",
+                    getName());
+
+    size_t total = 0;
+    for (const auto& dims : newOutputShapes) {
+        total += dims[axis];
+    }
+    ptrdiff_t offset = 0;
+    for (size_t i = 0; i < newOutputShapes.size(); ++i) {
+        const auto partDim = newOutputShapes[i][axis];
+        for (const auto& memMngr : inplacePartitions[i]) {
+            memMngr->setPartition(total, offset, partDim);
+        }
         offset += partDim;
     }
+
+    // redefine the memory on every port unconditionally: even when the port dims are intact,
+    // the partition offset may have moved after a sibling dim change
+    for (size_t i = 0; i < newOutputShapes.size(); ++i) {
+        auto newShape = newOutputShapes[i];
+        if (newShape.empty()) {
+            newShape.push_back(1);
+        }
+        const bool hasZeroDims = std::count(std::begin(newShape), std::end(newShape), 0lu) > 0;
+        const auto memDesc = getBaseMemDescAtOutputPort(i)->cloneWithNewDims(newShape, hasZeroDims);
+        for (auto& childEdge : getChildEdgesAtPort(i)) {
+            childEdge->getMemoryPtr()->redefineDesc(memDesc);
+        }
+    }
 }
 
 }   // namespace node
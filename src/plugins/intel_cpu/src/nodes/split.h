@@ -8,6 +8,9 @@
 
 namespace ov {
 namespace intel_cpu {
+
+class PartitionedMemoryMngr;
+
 namespace node {
 
 class Split : public Node {
@@ -30,6 +33,7 @@ public:
     void prepareParams() override;
     void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
     void resolveInPlaceEdges(Edge::LOOK look) override;
+    void redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes) override;
 
 private:
     struct SplitExecutor {
@@ -53,6 +57,10 @@ private:
     void optimizedNspc2Ncsp(size_t MB);
     std::vector<uint8_t*> getRawDstMemPtrs() const;
 
+    // per output port: the partition views created by resolveInPlaceEdges whose geometry has to
+    // follow the actual shapes when the split axis is dynamic; empty for a static axis
+    std::vector<std::vector<std::shared_ptr<PartitionedMemoryMngr>>> inplacePartitions;
+
     bool canUseOptimizedNspc2Ncsp = false;
 
     size_t axis = 1;
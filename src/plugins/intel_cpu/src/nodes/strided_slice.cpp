@@ -4,6 +4,8 @@
 
 #include "strided_slice.h"
 
+#include <partitioned_mem_mgr.h>
+
 #include "openvino/core/parallel.hpp"
 #include "common/cpu_memcpy.h"
 #include "input.h"
@@ -264,6 +266,97 @@ void StridedSlice::initSupportedPrimitiveDescriptors() {
         config.outConfs[0].setMemDesc(itr->second->createSharedDesc(dataPrecision, getOutputShapeAtPort(DATA_ID)));
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
     }
+
+    // a unit-stride slice which cuts a single dense block of the input (one sliced axis with all
+    // outer dimensions equal to 1) does not have to copy: additionally expose an in-place
+    // configuration which resolves the output into an offset partition of the input memory,
+    // the same way Split does for its outputs
+    if (detectInplaceGeometry()) {
+        const auto& planarCreator = creators.at(LayoutType::ncsp);
+        config.inConfs[DATA_ID].setMemDesc(
+            planarCreator->createSharedDesc(dataPrecision, getInputShapeAtPort(DATA_ID)));
+        config.outConfs[0].setMemDesc(planarCreator->createSharedDesc(dataPrecision, getOutputShapeAtPort(0)));
+        config.outConfs[0].inPlace(0);
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+    }
+}
+
+bool StridedSlice::detectInplaceGeometry() {
+    if (!hasConstAttrInputs || attrs.ellipsisMaskCounter != 0 || !attrs.equalDims ||
+        !getInputShapeAtPort(DATA_ID).isStatic() || !getOutputShapeAtPort(0).isStatic())
+        return false;
+
+    auto tmpAttrs = attrs;
+    addHiddenDims(tmpAttrs, getInputShapeAtPort(DATA_ID).getRank(), getOutputShapeAtPort(0).getRank(), isAxesSpecified);
+    const auto& srcDims = getInputShapeAtPort(DATA_ID).getStaticDims();
+    const auto& dstDims = getOutputShapeAtPort(0).getStaticDims();
+    if (srcDims.size() != dstDims.size())
+        return false;
+
+    const auto strideOf = [&](size_t axis) {
+        return axis < tmpAttrs.stride.size() ? tmpAttrs.stride[axis] : 1;
+    };
+
+    int slicedAxis = -1;
+    for (size_t i = 0; i < srcDims.size(); i++) {
+        if (strideOf(i) != 1)
+            return false;
+        if (dstDims[i] != srcDims[i]) {
+            // more than one sliced axis produces a non-contiguous region
+            if (slicedAxis >= 0)
+                return false;
+            slicedAxis = static_cast<int>(i);
+        }
+    }
+    if (slicedAxis < 0) {
+        // the slice is an identity, view the whole parent memory
+        inplaceAxis = 0;
+        inplaceOffset = 0;
+        return true;
+    }
+    // outer non-unit dimensions make the sliced region non-contiguous
+    for (int i = 0; i < slicedAxis; i++) {
+        if (srcDims[i] != 1)
+            return false;
+    }
+    if (static_cast<size_t>(slicedAxis) >= tmpAttrs.beginMask.size())
+        return false;
+
+    int begin = 0;
+    if (tmpAttrs.beginMask[slicedAxis] && static_cast<size_t>(slicedAxis) < tmpAttrs.begin.size())
+        begin = tmpAttrs.begin[slicedAxis];
+    if (begin < 0)
+        begin += static_cast<int>(srcDims[slicedAxis]);
+    if (begin < 0 || static_cast<size_t>(begin) + dstDims[slicedAxis] > srcDims[slicedAxis])
+        return false;
+
+    inplaceAxis = static_cast<size_t>(slicedAxis);
+    inplaceOffset = begin;
+    return true;
+}
+
+void StridedSlice::resolveInPlaceEdges(Edge::LOOK look) {
+    if (!(look & Edge::LOOK_UP) || !isInPlace()) {
+        Node::resolveInPlaceEdges(look);
+        return;
+    }
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr)
+        OPENVINO_THROW("Preferable primitive descriptor is not set.");
+
+    const auto baseDim = inputShapes.front().getDims()[inplaceAxis];
+    const auto partDim = outputShapes.front().getDims()[inplaceAxis];
+    auto baseMemMngr = getParentEdgeAt(DATA_ID)->getMemory().getMemoryMngr();
+    auto memMngr = std::make_shared<PartitionedMemoryMngr>(baseMemMngr, baseDim, inplaceOffset, partDim);
+    auto memDesc = selected_pd->getConfig().outConfs[0].getMemDesc();
+    for (auto& childEdge : getChildEdgesAtPort(0)) {
+        OPENVINO_ASSERT(childEdge->getStatus() == Edge::Status::NotAllocated,
+                        " Unexpected edge status in node: ",
+                        getName(),
+                        " with type ",
+                        getTypeStr());
+        childEdge->reuse(std::make_shared<Memory>(getEngine(), memDesc, memMngr));
+    }
 }
 
 bool StridedSlice::isExecutable() const {
@@ -286,6 +379,10 @@ bool StridedSlice::needPrepareParams() const {
 void StridedSlice::prepareParams() {
     updateLastInputDims();
 
+    // the output is a view into the input memory, nothing to compile
+    if (isInPlace())
+        return;
+
     if (srcMemory.empty()) {
         for (size_t i = 0; i < getOriginalInputsNumber(); i++) {
             srcMemory.push_back(getSrcMemoryAtPort(i));
@@ -304,6 +401,8 @@ bool StridedSlice::needShapeInfer() const {
 }
 
 void StridedSlice::execute(dnnl::stream strm) {
+    if (isInPlace())
+        return;
     if (!execPtr)
         OPENVINO_THROW(errorPrefix, "doesn't have compiled executor!");
 
@@ -20,6 +20,7 @@ public:
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
+    void resolveInPlaceEdges(Edge::LOOK look) override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
@@ -58,6 +59,7 @@ protected:
     bool needPrepareParams() const override;
     void prepareParams() override;
     void executeDynamicImpl(dnnl::stream strm) override;
+    bool detectInplaceGeometry();
 
 private:
     class StridedSliceExecutor {
@@ -127,6 +129,10 @@ private:
     bool isConstantInput[AXES_ID + 1] = {false};
     bool shapeHasDataDependency = false;
     bool hasConstAttrInputs = true;
+    // geometry of the zero-copy case: a unit-stride slice which takes a single dense block of
+    // the input, so the output is resolved to an offset partition of the parent memory
+    size_t inplaceAxis = 0;
+    ptrdiff_t inplaceOffset = 0;
 
     std::vector<MemoryCPtr> srcMemory;
     std::vector<MemoryCPtr> dstMemory;
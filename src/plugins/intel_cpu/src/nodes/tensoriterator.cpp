@@ -547,6 +547,7 @@ void TensorIterator::prepareParams() {
     first_mappers.clear();
     before_mappers.clear();
     back_mappers.clear();
+    back_mappers_state.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
         reshapeSubgraphInput();
@@ -675,7 +676,26 @@ void TensorIterator::prepareBackEdges() {
 }
 
 void TensorIterator::prepareDynamicBackEdges() {
+    // A stateful loop usually keeps the state shape constant between the iterations (e.g. an RNN
+    // hidden state), in which case the memories redefined and the mappers built for the previous
+    // iteration stay valid; skip the per-iteration redefinition then, so the loop body dispatch
+    // doesn't dominate over the body math.
+    if (back_mappers_state.size() == backEdges.size()) {
+        bool reusable = true;
+        for (size_t i = 0lu; i < backEdges.size(); i++) {
+            const auto& from_mem = output_mem[backEdges[i].from];
+            if (back_mappers_state[i].src_data != from_mem->getData() ||
+                !back_mappers_state[i].desc->isCompatible(*from_mem->getDescPtr())) {
+                reusable = false;
+                break;
+            }
+        }
+        if (reusable)
+            return;
+    }
+
     back_mappers.clear();
+    back_mappers_state.clear();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mems = input_mems[map_rule.to];
@@ -684,6 +704,7 @@ void TensorIterator::prepareDynamicBackEdges() {
 
         // first memory is enough to get common memory ptr
         back_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mems.front()));
+        back_mappers_state.push_back({from_mem->getDescPtr(), from_mem->getData()});
     }
 }
 
@@ -163,6 +163,13 @@ private:
         after_mappers,   /// < Applied after each iteration
         back_mappers;    /// < Applied before each iteration for dynamic shapes
 
+    struct BackEdgeState {
+        MemoryDescPtr desc;
+        const void* src_data = nullptr;
+    };
+    std::vector<BackEdgeState> back_mappers_state;  /// < What the back_mappers were built for, to reuse them
+                                                    /// < across the iterations which keep the state shape
+
     std::shared_ptr<PortChecker>
         trip_count_check,      /// < Perform check of trip count value. value >= -1
         initial_cond_check,    /// < Perform check of initial continue condition value. value [0, 1]
@@ -15,6 +15,7 @@
 #include "utils/ngraph_utils.hpp"
 
 #include <algorithm>
+#include <numeric>
 #include <set>
 #include <string>
 #include <vector>
@@ -2156,6 +2157,26 @@ void TopK::execute(dnnl::stream strm) {
     }
 }
 
+template <typename T>
+static void topk_select_candidates(const T *cand_vals, const int32_t *cand_idx, size_t cand_num,
+                                   T *out_vals, int32_t *out_idx, size_t k, bool mode_max, bool sort_index) {
+    std::vector<int32_t> order(cand_num);
+    std::iota(order.begin(), order.end(), 0);
+    std::partial_sort(order.begin(), order.begin() + k, order.end(), [&](int32_t a, int32_t b) {
+        if (cand_vals[a] != cand_vals[b])
+            return mode_max ? cand_vals[a] > cand_vals[b] : cand_vals[a] < cand_vals[b];
+        return cand_idx[a] < cand_idx[b];
+    });
+    if (sort_index) {
+        std::sort(order.begin(), order.begin() + k,
+                  [&](int32_t a, int32_t b) { return cand_idx[a] < cand_idx[b]; });
+    }
+    for (size_t i = 0; i < k; i++) {
+        out_vals[i] = cand_vals[order[i]];
+        out_idx[i] = cand_idx[order[i]];
+    }
+}
+
 void TopK::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
     uint8_t *process_ptr = vec_process_ptr.data();
     uint8_t *process_idx_ptr = vec_process_idx_ptr.data();
@@ -2184,6 +2205,13 @@ void TopK::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_id
             });
         }
     } else { // [planar layout] [blocked layout with topk on non-C]
+        // [planar layout with topk on a huge innermost dimension and only a few sorting rows]
+        // the heap sort kernel walks its row sequentially, so a single large row (e.g. a ranking
+        // model scoring ~1M candidates per request) would keep one thread busy while the rest of
+        // the stream idles; split the row into chunks, select top_k candidates per chunk with the
+        // same kernel in parallel and merge the chunk winners
+        if (topk_split_innermost(in_ptr, out_ptr, out_idx_ptr))
+            return;
         parallel_for2d(O, I / blk_size, [&](size_t o, size_t k) {
             const uint8_t *in_ptr_a = in_ptr + (o * A * I + k * blk_size) * data_size;
             uint8_t *process_ptr_a = process_ptr + (o * A * I + k * blk_size) * data_size;
@@ -2209,6 +2237,67 @@ void TopK::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_id
     }
 }
 
+bool TopK::topk_split_innermost(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    if (algorithm != TopKAlgorithm::topk_heap_sort || I != 1 || stable)
+        return false;
+
+    // the candidate merge below compares the values on the host
+    const auto precision = getSrcMemoryAtPort(TOPK_DATA)->getDesc().getPrecision();
+    if (precision != ov::element::f32 && precision != ov::element::i32)
+        return false;
+
+    // splitting only pays off when the rows don't occupy the threads on their own and every
+    // chunk is still large enough to amortize the scheduling and the merge
+    const size_t min_chunk = 32 * 1024;
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    if (O >= nthr || axis_dim < 2 * std::max(min_chunk, static_cast<size_t>(top_k)))
+        return false;
+
+    const size_t max_chunks = axis_dim / std::max(min_chunk, static_cast<size_t>(top_k));
+    const size_t chunks = std::min(max_chunks, div_up(nthr, O));
+    if (chunks < 2)
+        return false;
+
+    const size_t chunk_len = axis_dim / chunks;
+    const size_t cand_num = chunks * top_k;
+    std::vector<uint8_t> cand_vals(O * cand_num * data_size);
+    std::vector<int32_t> cand_idx(O * cand_num);
+
+    parallel_for2d(O, chunks, [&](size_t o, size_t c) {
+        const size_t start = c * chunk_len;
+        const size_t len = (c == chunks - 1) ? axis_dim - start : chunk_len;
+        auto arg = jit_topk_call_args();
+        arg.src = static_cast<const void *>(in_ptr + (o * A + start) * data_size);
+        arg.dst = static_cast<void *>(cand_vals.data() + (o * chunks + c) * top_k * data_size);
+        arg.index = static_cast<void *>(cand_idx.data() + (o * chunks + c) * top_k);
+        // the offset sequence makes the kernel emit indices relative to the whole axis
+        arg.idx_seq_buf = vec_idx_seq.data() + start;
+        arg.axis_dim = len;
+        arg.top_k = static_cast<size_t>(top_k);
+        arg.work_amount = 1;
+        arg.sort_stride = I;
+        (*topk_kernel)(&arg);
+    });
+
+    parallel_for(O, [&](size_t o) {
+        if (precision == ov::element::f32) {
+            topk_select_candidates(reinterpret_cast<const float *>(cand_vals.data()) + o * cand_num,
+                                   cand_idx.data() + o * cand_num, cand_num,
+                                   reinterpret_cast<float *>(out_ptr) + o * top_k,
+                                   reinterpret_cast<int32_t *>(out_idx_ptr) + o * top_k,
+                                   static_cast<size_t>(top_k), mode_max, sort_index);
+        } else {
+            topk_select_candidates(reinterpret_cast<const int32_t *>(cand_vals.data()) + o * cand_num,
+                                   cand_idx.data() + o * cand_num, cand_num,
+                                   reinterpret_cast<int32_t *>(out_ptr) + o * top_k,
+                                   reinterpret_cast<int32_t *>(out_idx_ptr) + o * top_k,
+                                   static_cast<size_t>(top_k), mode_max, sort_index);
+        }
+    });
+
+    return true;
+}
+
 inline void TopK::topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *out_idx_p,
                                                 uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount) {
     auto arg = jit_topk_call_args();
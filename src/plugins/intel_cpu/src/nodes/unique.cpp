@@ -11,6 +11,8 @@
 #include "common/cpu_memcpy.h"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 
+#include <algorithm>
+
 using namespace ov::intel_cpu;
 using namespace ov::intel_cpu::node;
 
@@ -184,45 +186,36 @@ void Unique::flattenTensorExec() {
 
     if (sorted) {
         cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
+        parallel_sort(uniDataTmpPtr, uniDataTmpPtr + inputLen, std::less<T>());
+        if (definedOutputs[OCCURRENCES_NUM] && inputLen > 0) {
+            // the sorted copy still holds the duplicates at this point, so the occurrence count
+            // of every unique value is just the length of its run
+            int* occurIt = occurTmpPtr;
+            *occurIt = 1;
+            for (size_t i = 1; i < inputLen; i++) {
+                if (uniDataTmpPtr[i] == uniDataTmpPtr[i - 1]) {
+                    (*occurIt)++;
+                } else {
+                    *++occurIt = 1;
+                }
+            }
+        }
         auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
         uniqueLen = last - uniDataTmpPtr;
 
         if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
+            std::fill(firstTmpPtr, firstTmpPtr + uniqueLen, static_cast<int>(inputLen));
             for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
+                const size_t j = std::lower_bound(uniDataTmpPtr, last, srcDataPtr[i]) - uniDataTmpPtr;
+                if (firstTmpPtr[j] == static_cast<int>(inputLen)) {
+                    firstTmpPtr[j] = i;
                 }
             }
         }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
+        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
+            parallel_for(inputLen, [&](size_t i) {
+                inToOutTmpPtr[i] = std::lower_bound(uniDataTmpPtr, last, srcDataPtr[i]) - uniDataTmpPtr;
+            });
         }
     } else {
         uniDataTmpPtr[0] = srcDataPtr[0];
@@ -7,6 +7,8 @@
 using namespace ov::intel_cpu;
 
 void* PartitionedMemoryMngr::getRawPtr() const noexcept {
+    if (m_size_blocks == 0)
+        return m_pMngr->getRawPtr();
     return static_cast<uint8_t*>(m_pMngr->getRawPtr()) + m_offset_blocks * m_size / m_size_blocks;
 }
 
@@ -16,6 +18,10 @@ void PartitionedMemoryMngr::setExtBuff(void* ptr, size_t size) {
 
 bool PartitionedMemoryMngr::resize(size_t size) {
     m_size = size;
+    if (m_size_blocks == 0) {
+        // an empty partition doesn't occupy any blocks of the base memory
+        return m_pMngr->resize(0);
+    }
     return m_pMngr->resize(m_size * m_total_blocks / m_size_blocks);
 }
 
@@ -31,3 +37,9 @@ void PartitionedMemoryMngr::unregisterMemory(Memory* memPtr) {
     m_pMngr->unregisterMemory(memPtr);
 }
 
+void PartitionedMemoryMngr::setPartition(size_t total_blocks, ptrdiff_t offset_blocks, size_t size_blocks) {
+    m_total_blocks = total_blocks;
+    m_offset_blocks = offset_blocks;
+    m_size_blocks = size_blocks;
+}
+
@@ -28,6 +28,10 @@ public:
     void registerMemory(Memory* memPtr) override;
     void unregisterMemory(Memory* memPtr) override;
 
+    // redefines the view geometry, e.g. when the partitioned dimension changes between inferences;
+    // the caller is responsible for redefining the memory objects built on top of this view afterwards
+    void setPartition(size_t total_blocks, ptrdiff_t offset_blocks, size_t size_blocks);
+
 private:
     MemoryMngrPtr m_pMngr;
     size_t m_total_blocks = 1; // size of the parent memory in abstract blocks
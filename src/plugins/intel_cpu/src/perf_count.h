@@ -4,8 +4,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <map>
 #include <ratio>
+#include <string>
 
 namespace ov {
 namespace intel_cpu {
@@ -13,11 +17,42 @@ namespace intel_cpu {
 class PerfCount {
     uint64_t total_duration;
     uint32_t num;
+    uint64_t last_itr_duration = 0;
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
 public:
+    /**
+     * @brief Aggregated statistics of the iterations which shared one shape signature.
+     *
+     * Durations are additionally binned into a log2 microsecond histogram, so percentiles can be
+     * estimated without retaining the individual samples (the estimate is the bin upper edge).
+     */
+    struct ShapeBucket {
+        static constexpr size_t binCount = 64;
+
+        uint64_t total_duration = 0;
+        uint64_t max_duration = 0;
+        uint32_t num = 0;
+        uint32_t hist[binCount] = {};
+
+        uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
+
+        uint64_t percentile(uint32_t pct) const {
+            if (num == 0)
+                return 0;
+            const uint32_t threshold = static_cast<uint32_t>((static_cast<uint64_t>(num) * pct + 99) / 100);
+            uint32_t cumulative = 0;
+            for (size_t bin = 0; bin < binCount; ++bin) {
+                cumulative += hist[bin];
+                if (cumulative >= threshold)
+                    return std::min(max_duration, (uint64_t(2) << bin) - 1);
+            }
+            return max_duration;
+        }
+    };
+
     PerfCount(): total_duration(0), num(0) {}
 
     std::chrono::duration<double, std::milli> duration() const {
@@ -27,31 +62,53 @@ public:
     uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
     uint32_t count() const { return num; }
 
+    const std::map<std::string, ShapeBucket>& shapeBuckets() const { return shape_buckets; }
+
 private:
+    std::map<std::string, ShapeBucket> shape_buckets;
+
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
     }
 
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
-        total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        last_itr_duration = std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        total_duration += last_itr_duration;
         num++;
     }
 
+    void add_shape_sample(const std::string& signature) {
+        auto& bucket = shape_buckets[signature];
+        bucket.total_duration += last_itr_duration;
+        bucket.max_duration = std::max(bucket.max_duration, last_itr_duration);
+        bucket.num++;
+        size_t bin = 0;
+        for (uint64_t value = last_itr_duration; value >>= 1;)
+            ++bin;
+        bucket.hist[std::min(bin, ShapeBucket::binCount - 1)]++;
+    }
+
     friend class PerfHelper;
 };
 
 class PerfHelper {
     PerfCount &counter;
+    std::string signature;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    explicit PerfHelper(PerfCount &count, std::string shapeSignature = {})
+        : counter(count), signature(std::move(shapeSignature)) { counter.start_itr(); }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        counter.finish_itr();
+        if (!signature.empty())
+            counter.add_shape_sample(signature);
+    }
 };
 
 }   // namespace intel_cpu
 }   // namespace ov
 
-#define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter()))
+#define GET_PERF(_node) std::unique_ptr<PerfHelper>(new PerfHelper(_node->PerfCounter(), _node->shapeSignature()))
 #define PERF(_node, _need) auto pc = _need ? GET_PERF(_node) : nullptr;
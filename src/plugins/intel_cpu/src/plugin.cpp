@@ -12,6 +12,7 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "serialize.h"
+#include "streams_auto_tune.h"
 #include "transformations/transformation_pipeline.h"
 #include "transformations/utils/utils.hpp"
 #include "utils/denormals.hpp"
@@ -162,6 +163,7 @@ void Plugin::get_performance_streams(Config& config, const std::shared_ptr<ov::M
 
 void Plugin::calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& model, bool imported) const {
     const auto model_prefer_name = std::string("MODEL_PREFER_THREADS");
+    const auto tuned_streams_name = std::string("AUTO_TUNED_STREAMS");
     if (imported && model->has_rt_info("intel_cpu_hints_config")) {
         // load model_prefer_threads from cache
         int cache_model_prefer;
@@ -176,6 +178,16 @@ void Plugin::calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& m
 
             conf.modelPreferThreads = cache_model_prefer;
         }
+        // reuse the empirically tuned stream count unless the user pinned ov::num_streams
+        const auto it_tuned_streams = hints_config.find(tuned_streams_name);
+        if (it_tuned_streams != hints_config.end() && !conf.streamsChanged) {
+            try {
+                conf.streams = it_tuned_streams->second.as<int>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Cache file doesn't have valid value for " + tuned_streams_name);
+            }
+            conf.streamsChanged = true;
+        }
     }
     get_performance_streams(conf, model);
     // save model_prefer_threads to model rt_info when loading network
@@ -322,7 +334,40 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+
+    // opt-in empirical search for the stream count; limited to statically shaped models in
+    // throughput mode and skipped when the user pinned ov::num_streams
+    if (conf.streamsAutoTune && !conf.streamsChanged && conf.hintPerfMode == ov::hint::PerformanceMode::THROUGHPUT &&
+        !cloned_model->is_dynamic()) {
+        const int heuristic_streams = conf.streamExecutorConfig.get_streams();
+        auto compile_candidate = [&](int num_streams) -> std::shared_ptr<ov::ICompiledModel> {
+            Config candidate_conf = conf;
+            candidate_conf.streams = num_streams;
+            candidate_conf.streamsChanged = true;
+            get_performance_streams(candidate_conf, cloned_model);
+            return std::make_shared<CompiledModel>(cloned_model,
+                                                   shared_from_this(),
+                                                   candidate_conf,
+                                                   m_socketWeights,
+                                                   false);
+        };
+        const int tuned_streams =
+            auto_tune_streams(compile_candidate, heuristic_streams, conf.streamExecutorConfig.get_threads());
+        if (tuned_streams != heuristic_streams) {
+            conf.streams = tuned_streams;
+            conf.streamsChanged = true;
+            get_performance_streams(conf, cloned_model);
+        }
+        // persist the winner next to MODEL_PREFER_THREADS; the cloned model is what the blob
+        // serializes, so a cached reload applies the result without repeating the search
+        auto hints_config = cloned_model->has_rt_info("intel_cpu_hints_config")
+                                ? cloned_model->get_rt_info<ov::AnyMap>("intel_cpu_hints_config")
+                                : ov::AnyMap{};
+        hints_config["AUTO_TUNED_STREAMS"] = std::to_string(tuned_streams);
+        cloned_model->set_rt_info(hints_config, "intel_cpu_hints_config");
+    }
+
+    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, m_socketWeights, false);
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -414,6 +459,8 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
             engConfig.fcDynamicQuantizationGroupSize);
     } else if (name == ov::hint::kv_cache_precision) {
         return decltype(ov::hint::kv_cache_precision)::value_type(engConfig.kvCachePrecision);
+    } else if (name == ov::cache_mode) {
+        return decltype(ov::cache_mode)::value_type(engConfig.cacheMode);
     }
     return get_ro_property(name, options);
 }
@@ -458,6 +505,7 @@ ov::Any Plugin::get_ro_property(const std::string& name, const ov::AnyMap& optio
             RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
             RW_property(ov::hint::dynamic_quantization_group_size.name()),
             RW_property(ov::hint::kv_cache_precision.name()),
+            RW_property(ov::cache_mode.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -472,7 +520,8 @@ ov::Any Plugin::get_ro_property(const std::string& name, const ov::AnyMap& optio
             ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties_supported.name(),
-                             ov::PropertyMutability::RO}};
+                             ov::PropertyMutability::RO},
+            ov::PropertyName{ov::internal::cached_model_path.name(), ov::PropertyMutability::RW}};
     } else if (name == ov::device::full_name) {
         return decltype(ov::device::full_name)::value_type(deviceFullName);
     } else if (name == ov::available_devices) {
@@ -577,9 +626,24 @@ ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>&
 std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& networkModel, const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "import_model");
 
-    ModelDeserializer deserializer(networkModel, [this](const std::string& model, const ov::Tensor& weights) {
-        return get_core()->read_model(model, weights, true);
-    });
+    // check internal properties and erase them to avoid exception in readProperties.
+    auto _config = config;
+    std::string origin_model_path;
+    const auto& path_it = _config.find(ov::internal::cached_model_path.name());
+    if (path_it != _config.end()) {
+        origin_model_path = path_it->second.as<std::string>();
+        _config.erase(path_it);
+    }
+
+    ModelDeserializer deserializer(
+        networkModel,
+        [this](const std::string& model, const ov::Tensor& weights) {
+            return get_core()->read_model(model, weights, true);
+        },
+        [this](const std::string& model_path) {
+            return get_core()->read_model(model_path, {});
+        },
+        origin_model_path);
 
     std::shared_ptr<ov::Model> model;
     deserializer >> model;
@@ -588,7 +652,6 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& networkMo
     Config::ModelType modelType = getModelType(model);
 
     // check ov::loaded_from_cache property and erase it to avoid exception in readProperties.
-    auto _config = config;
     const auto& it = _config.find(ov::loaded_from_cache.name());
     bool loaded_from_cache = false;
     if (it != _config.end()) {
@@ -599,7 +662,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& networkMo
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model =
+        std::make_shared<CompiledModel>(model, shared_from_this(), conf, m_socketWeights, loaded_from_cache);
     return compiled_model;
 }
 }  // namespace intel_cpu
@@ -55,6 +55,10 @@ private:
     bool streamsExplicitlySetForEngine = false;
     const std::string deviceFullName;
     ov::AnyMap m_compiled_model_runtime_properties;
+    // weights caches shared by all compiled models of this plugin instance: identically packed
+    // weights (the same content, precision and layout) are stored once per NUMA node even when
+    // the same model is compiled several times, e.g. with different inference precision hints
+    mutable SocketsWeights m_socketWeights;
 
     std::shared_ptr<void> specialSetup;
 };
@@ -3,6 +3,8 @@
 //
 #include "serialize.h"
 
+#include <cstring>
+#include <iterator>
 #include <pugixml.hpp>
 
 #include "openvino/pass/serialize.hpp"
@@ -11,6 +13,10 @@
 namespace ov {
 namespace intel_cpu {
 
+// Magic prefix of weightless cache blobs; such a blob contains only the input/output
+// information, the model itself is reloaded from the original file at import
+static const char weightless_blob_magic[8] = {'O', 'V', 'C', 'P', 'U', 'W', 'L', 'M'};
+
 static void setInfo(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {
     pugi::xml_node outputs = root.child("outputs");
     auto nodes_it = outputs.children("out").begin();
@@ -24,7 +30,9 @@ static void setInfo(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {
     }
 }
 
-ModelSerializer::ModelSerializer(std::ostream& ostream) : _ostream(ostream) {}
+ModelSerializer::ModelSerializer(std::ostream& ostream, bool weightless)
+    : _ostream(ostream)
+    , _weightless(weightless) {}
 
 void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
     auto serializeInfo = [&](std::ostream& stream) {
@@ -40,13 +48,25 @@ void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
         xml_doc.save(stream);
     };
 
+    if (_weightless) {
+        _ostream.write(weightless_blob_magic, sizeof(weightless_blob_magic));
+        serializeInfo(_ostream);
+        _ostream.flush();
+        return;
+    }
+
     ov::pass::StreamSerialize serializer(_ostream, serializeInfo);
     serializer.run_on_model(std::const_pointer_cast<ov::Model>(model->clone()));
 }
 
-ModelDeserializer::ModelDeserializer(std::istream & istream, model_builder fn)
+ModelDeserializer::ModelDeserializer(std::istream& istream,
+                                     model_builder fn,
+                                     file_model_builder file_fn,
+                                     std::string origin_model_path)
     : _istream(istream)
-    , _model_builder(fn) {
+    , _model_builder(fn)
+    , _file_model_builder(file_fn)
+    , _origin_model_path(std::move(origin_model_path)) {
 }
 
 void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
@@ -58,6 +78,29 @@ void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     // get file size before seek content
     // blob from cache may have other header, skip it
     const size_t _pos = _istream.tellg();
+
+    char magic[sizeof(weightless_blob_magic)] = {};
+    _istream.read(magic, sizeof(magic));
+    if (_istream.gcount() == sizeof(magic) && std::memcmp(magic, weightless_blob_magic, sizeof(magic)) == 0) {
+        // Weightless blob: reload the model (and so its weights, memory mapped when enabled) from
+        // the original file; the core has already verified it did not change since compilation
+        OPENVINO_ASSERT(_file_model_builder && !_origin_model_path.empty(),
+                        "Cannot import a weightless cached model: the original model path is not available. "
+                        "Recompile the model by path or use ov::CacheMode::OPTIMIZE_SPEED.");
+        model = _file_model_builder(_origin_model_path);
+
+        pugi::xml_document xmlInOutDoc;
+        std::string xmlInOutString((std::istreambuf_iterator<char>(_istream)), std::istreambuf_iterator<char>());
+        auto res = xmlInOutDoc.load_string(xmlInOutString.c_str());
+        if (res.status != pugi::status_ok) {
+            OPENVINO_THROW("NetworkNotRead: The inputs and outputs information is invalid.");
+        }
+        pugi::xml_node root = xmlInOutDoc.child("cnndata");
+        setInfo(root, model);
+        return;
+    }
+    _istream.clear();
+    _istream.seekg(_pos, _istream.beg);
     _istream.seekg(0, _istream.end);
     const size_t file_size = _istream.tellg();
     _istream.seekg(_pos, _istream.beg);
@@ -16,22 +16,31 @@ namespace intel_cpu {
 
 class ModelSerializer {
 public:
-    ModelSerializer(std::ostream& ostream);
+    ModelSerializer(std::ostream& ostream, bool weightless = false);
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
 private:
     std::ostream& _ostream;
+    // Weightless blobs keep only the input/output information; the model (topology and weights)
+    // is reloaded from the original file at import
+    bool _weightless;
 };
 
 class ModelDeserializer {
 public:
     typedef std::function<std::shared_ptr<ov::Model>(const std::string&, const ov::Tensor&)> model_builder;
-    ModelDeserializer(std::istream& istream, model_builder fn);
+    typedef std::function<std::shared_ptr<ov::Model>(const std::string&)> file_model_builder;
+    ModelDeserializer(std::istream& istream,
+                      model_builder fn,
+                      file_model_builder file_fn = {},
+                      std::string origin_model_path = {});
     void operator>>(std::shared_ptr<ov::Model>& model);
 
 private:
     std::istream& _istream;
     model_builder _model_builder;
+    file_model_builder _file_model_builder;
+    std::string _origin_model_path;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "streams_auto_tune.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// per-candidate measurement budget; with at most 4 candidates the search stays within ~1.5s
+// of inference time on top of the extra candidate compilations
+constexpr auto measure_budget = std::chrono::milliseconds(300);
+// rounds executed regardless of the budget, so tiny models still average over several batches
+constexpr int min_rounds = 3;
+// a candidate replaces the heuristic choice only when it is at least this much faster
+constexpr double improvement_threshold = 1.05;
+
+double measure_throughput(const ov::ICompiledModel& compiled, int num_requests) {
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+    for (int i = 0; i < num_requests; i++)
+        requests.push_back(compiled.create_infer_request());
+
+    // zero-filled inputs: the values are irrelevant for the timing, but the pages have to be
+    // touched and the lazy primitive preparation has to happen before the measurement starts
+    for (auto& request : requests) {
+        for (const auto& port : request->get_inputs()) {
+            auto tensor = request->get_tensor(port);
+            if (tensor && port.get_element_type() != ov::element::string)
+                std::memset(tensor->data(), 0, tensor->get_byte_size());
+        }
+        request->infer();
+    }
+
+    size_t count = 0;
+    int rounds = 0;
+    const auto begin = std::chrono::steady_clock::now();
+    auto elapsed = begin - begin;
+    do {
+        for (auto& request : requests)
+            request->start_async();
+        for (auto& request : requests)
+            request->wait();
+        count += requests.size();
+        rounds++;
+        elapsed = std::chrono::steady_clock::now() - begin;
+    } while (rounds < min_rounds || elapsed < measure_budget);
+    return static_cast<double>(count) / std::chrono::duration<double>(elapsed).count();
+}
+
+}  // namespace
+
+int auto_tune_streams(const std::function<std::shared_ptr<ov::ICompiledModel>(int num_streams)>& compile_candidate,
+                      int heuristic_streams,
+                      int max_streams) {
+    std::vector<int> candidates{heuristic_streams};
+    auto add_candidate = [&](int num_streams) {
+        num_streams = std::max(1, std::min(num_streams, std::max(1, max_streams)));
+        if (std::find(candidates.begin(), candidates.end(), num_streams) == candidates.end())
+            candidates.push_back(num_streams);
+    };
+    add_candidate(heuristic_streams / 2);
+    add_candidate(heuristic_streams * 2);
+    add_candidate(1);
+
+    int best_streams = heuristic_streams;
+    double heuristic_fps = 0.0;
+    double best_fps = 0.0;
+    for (const auto num_streams : candidates) {
+        double fps = 0.0;
+        try {
+            const auto candidate = compile_candidate(num_streams);
+            fps = measure_throughput(*candidate, num_streams);
+        } catch (const std::exception& e) {
+            DEBUG_LOG("streams auto-tune: candidate ", num_streams, " streams failed: ", e.what());
+            continue;
+        }
+        DEBUG_LOG("streams auto-tune: ", num_streams, " streams -> ", fps, " fps");
+        if (num_streams == heuristic_streams)
+            heuristic_fps = fps;
+        if (fps > best_fps) {
+            best_fps = fps;
+            best_streams = num_streams;
+        }
+    }
+    // stay with the heuristic unless the winner is clearly better
+    if (best_streams != heuristic_streams && best_fps < heuristic_fps * improvement_threshold)
+        best_streams = heuristic_streams;
+    DEBUG_LOG("streams auto-tune: selected ", best_streams, " streams (heuristic ", heuristic_streams, ")");
+    return best_streams;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "openvino/runtime/icompiled_model.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Picks the throughput-mode stream count empirically instead of trusting the static heuristic.
+ *
+ * Compiles a small set of candidate stream counts derived from @p heuristic_streams (the heuristic
+ * choice itself, half of it, double of it and a single stream, clamped to [1, max_streams]), measures
+ * the throughput of each candidate on the actual model with zero-filled inputs for a bounded time and
+ * returns the winner. The heuristic choice is kept unless a candidate beats it by a noticeable margin,
+ * so measurement noise does not flip the configuration. Candidates which fail to compile or run are
+ * skipped.
+ *
+ * @param compile_candidate Builds a compiled model for the given stream count
+ * @param heuristic_streams The stream count selected by the static heuristic
+ * @param max_streams Upper bound for the candidate stream counts (e.g. the number of threads)
+ * @return The stream count with the best measured throughput
+ */
+int auto_tune_streams(const std::function<std::shared_ptr<ov::ICompiledModel>(int num_streams)>& compile_candidate,
+                      int heuristic_streams,
+                      int max_streams);
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mlp_fusion.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/opsets/opset4.hpp"
+#include "openvino/opsets/opset7.hpp"
+#include "openvino/pass/constant_folding.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+#include "itt.hpp"
+
+using namespace ov;
+
+namespace {
+
+bool single_consumer(const Output<Node>& out) {
+    return out.get_target_inputs().size() == 1;
+}
+
+// weights are either a plain constant or a constant under a decompression convert
+bool get_weights(const Output<Node>& out,
+                 std::shared_ptr<opset1::Constant>& constant,
+                 std::shared_ptr<opset1::Convert>& convert) {
+    auto node = out.get_node_shared_ptr();
+    convert = std::dynamic_pointer_cast<opset1::Convert>(node);
+    if (convert) {
+        node = convert->get_input_node_shared_ptr(0);
+    }
+    constant = std::dynamic_pointer_cast<opset1::Constant>(node);
+    return constant != nullptr;
+}
+
+}  // namespace
+
+intel_cpu::MLPGateUpFusion::MLPGateUpFusion() {
+    MATCHER_SCOPE(MLPGateUpFusion);
+    auto mul_m = pass::pattern::wrap_type<opset1::Multiply>({pass::pattern::any_input(), pass::pattern::any_input()});
+
+    matcher_pass_callback callback = [](pass::pattern::Matcher& m) {
+        auto mul = m.get_match_root();
+
+        // the multiply combines the activated gate projection with the up projection,
+        // in either input order
+        std::shared_ptr<Node> act;
+        std::shared_ptr<opset1::MatMul> mm_gate, mm_up;
+        size_t act_idx = 0;
+        for (; act_idx < 2; act_idx++) {
+            auto candidate = mul->get_input_node_shared_ptr(act_idx);
+            if (ov::is_type<opset4::Swish>(candidate) || ov::is_type<opset7::Gelu>(candidate)) {
+                act = candidate;
+                mm_gate = std::dynamic_pointer_cast<opset1::MatMul>(act->get_input_node_shared_ptr(0));
+                mm_up = std::dynamic_pointer_cast<opset1::MatMul>(mul->get_input_node_shared_ptr(1 - act_idx));
+                break;
+            }
+        }
+        if (!act || !mm_gate || !mm_up)
+            return false;
+        if (!single_consumer(act->output(0)) || !single_consumer(mm_gate->output(0)) ||
+            !single_consumer(mm_up->output(0)))
+            return false;
+        // both projections must consume the very same activation tensor
+        if (mm_gate->input_value(0) != mm_up->input_value(0))
+            return false;
+        if (mm_gate->get_transpose_a() != mm_up->get_transpose_a() ||
+            mm_gate->get_transpose_b() != mm_up->get_transpose_b())
+            return false;
+
+        std::shared_ptr<opset1::Constant> w_gate, w_up;
+        std::shared_ptr<opset1::Convert> cvt_gate, cvt_up;
+        if (!get_weights(mm_gate->input_value(1), w_gate, cvt_gate) ||
+            !get_weights(mm_up->input_value(1), w_up, cvt_up))
+            return false;
+        if ((cvt_gate == nullptr) != (cvt_up == nullptr))
+            return false;
+        if (cvt_gate && cvt_gate->get_destination_type() != cvt_up->get_destination_type())
+            return false;
+        if (w_gate->get_element_type() != w_up->get_element_type())
+            return false;
+        const auto& w_gate_shape = w_gate->get_shape();
+        const auto& w_up_shape = w_up->get_shape();
+        if (w_gate_shape.size() != 2 || w_gate_shape != w_up_shape)
+            return false;
+
+        const size_t n_axis = mm_gate->get_transpose_b() ? 0 : 1;
+        const auto N = static_cast<int64_t>(w_gate_shape[n_axis]);
+
+        // concatenate the raw constants so the concat folds even when the decompression
+        // convert on top is excluded from constant folding
+        auto w_fused = std::make_shared<opset1::Concat>(OutputVector{w_gate, w_up}, static_cast<int64_t>(n_axis));
+        Output<Node> w_out = w_fused;
+        NodeVector new_nodes{w_fused};
+        if (cvt_gate) {
+            auto new_cvt = std::make_shared<opset1::Convert>(w_out, cvt_gate->get_destination_type());
+            if (pass::constant_folding_is_disabled(cvt_gate))
+                pass::disable_constant_folding(new_cvt);
+            w_out = new_cvt;
+            new_nodes.push_back(new_cvt);
+        }
+
+        auto new_mm = mm_gate->clone_with_new_inputs({mm_gate->input_value(0), w_out});
+        new_mm->set_friendly_name(mm_gate->get_friendly_name() + "/gate_up");
+        auto axis = opset1::Constant::create(element::i64, Shape{}, {-1});
+        auto lengths = opset1::Constant::create(element::i64, Shape{2}, {N, N});
+        auto vsplit = std::make_shared<opset1::VariadicSplit>(new_mm, axis, lengths);
+        auto act_inputs = act->input_values();
+        act_inputs[0] = vsplit->output(0);
+        auto new_act = act->clone_with_new_inputs(act_inputs);
+        new_act->set_friendly_name(act->get_friendly_name());
+        new_nodes.push_back(new_mm);
+        new_nodes.push_back(vsplit);
+        new_nodes.push_back(new_act);
+        copy_runtime_info({mm_gate, mm_up, act}, new_nodes);
+
+        mul->input(act_idx).replace_source_output(new_act->output(0));
+        mul->input(1 - act_idx).replace_source_output(vsplit->output(1));
+        return true;
+    };
+
+    auto m = std::make_shared<pass::pattern::Matcher>(mul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Merges the parallel gate and up projections of a transformer MLP into one MatMul
+ *        over horizontally concatenated weights:
+ *
+ *            Multiply(Act(MatMul(x, Wg)), MatMul(x, Wu))
+ *                -> VariadicSplit(MatMul(x, concat(Wg, Wu)), -1, {N, N})
+ *                   with the same Act/Multiply applied to the two halves
+ *
+ *        A single GEMM over the doubled output channels reads the activations once and
+ *        keeps all cores busy, which matters most for the M=1 decode phase of LLMs where
+ *        each of the two half-sized GEMMs alone cannot saturate the machine.
+ */
+class MLPGateUpFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MLPGateUpFusion", "0");
+    MLPGateUpFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
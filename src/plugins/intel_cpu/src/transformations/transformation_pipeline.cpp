@@ -122,6 +122,7 @@
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
 #include "transformations/cpu_opset/common/pass/rope_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/causal_mask_preprocess_fusion.hpp"
+#include "transformations/cpu_opset/common/pass/mlp_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
 
 // Snippets
@@ -168,6 +169,14 @@ bool Transformations::is_decompression_multiply(const_node_ptr& node) const {
             return true;
         }
     }
+    // the decompressed weights may also reach the MatMul through a Transpose (optionally
+    // following the Reshape), which the plugin folds into the FC weights path
+    if (consumer != nullptr && ov::is_type<ov::opset1::Transpose>(consumer)) {
+        consumer = get_single_consumer(consumer);
+        if (consumer != nullptr && ov::is_type<ov::opset1::MatMul>(consumer)) {
+            return true;
+        }
+    }
     if (consumer != nullptr && ov::is_type<ov::opset1::Convert>(consumer)) {
         consumer = get_single_consumer(consumer);
         if (consumer != nullptr && ov::is_type<ov::opset1::MatMul>(consumer)) {
@@ -754,6 +763,8 @@ void Transformations::PostLpt() {
         MoveEltwiseUpThroughDataMov);
     CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::Validate);
 
+    // before ConstantFolding, so the horizontally concatenated weights get folded
+    CPU_REGISTER_PASS_X64(postLPTPassManager, MLPGateUpFusion);
     CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::ConstantFolding);
 
     CPU_REGISTER_PASS_X64(postLPTPassManager, FuseFQtoInteraction);
@@ -5,13 +5,122 @@
 #include "weights_cache.hpp"
 #include "openvino/runtime/system_conf.hpp"
 
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <new>
+
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
 
 namespace ov {
 namespace intel_cpu {
 
 const SimpleDataHash WeightsSharing::simpleCRC;
 
+#if defined(__linux__)
+namespace {
+
+// Layout of a named segment holding one packed weights blob. The creator packs privately, copies
+// the result into the segment and publishes it with a release store of the ready flag; an attacher
+// which observes the flag maps the payload read-only. The segments are left in /dev/shm on purpose
+// so a restarted worker can still attach; removing stale ones (e.g. after a model update) is an
+// operator action: rm /dev/shm/ov_cpu_weights_*.
+struct ShmBlobHeader {
+    uint64_t magic;
+    uint64_t size;  // payload bytes
+    std::atomic<uint64_t> ready;
+};
+
+constexpr uint64_t shmBlobMagic = 0x70575643'55504f56;  // "OVPUCVWp"
+
+// Returns a pointer to the blob payload inside the named segment derived from the key, creating
+// and filling the segment from src on first use; nullptr when the blob can not be shared (the
+// creator is still publishing, the sizes diverge, or shm is not usable).
+const void* attachOrPublishShmBlob(const std::string& key, const void* src, size_t size) {
+    const auto keyHash =
+        WeightsSharing::GetHashFunc().hash(reinterpret_cast<const unsigned char*>(key.data()), key.size());
+    char name[64];
+    snprintf(name, sizeof(name), "/ov_cpu_weights_%016llx", static_cast<unsigned long long>(keyHash));
+    const size_t total = sizeof(ShmBlobHeader) + size;
+
+    int fd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) {
+        if (::ftruncate(fd, total) != 0) {
+            ::close(fd);
+            ::shm_unlink(name);
+            return nullptr;
+        }
+        void* map = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (map == MAP_FAILED) {
+            ::shm_unlink(name);
+            return nullptr;
+        }
+        auto header = new (map) ShmBlobHeader();
+        header->magic = shmBlobMagic;
+        header->size = size;
+        auto payload = static_cast<char*>(map) + sizeof(ShmBlobHeader);
+        std::memcpy(payload, src, size);
+        header->ready.store(1, std::memory_order_release);
+        return payload;
+    }
+    if (errno != EEXIST)
+        return nullptr;
+
+    fd = ::shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+        return nullptr;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != total) {
+        ::close(fd);
+        return nullptr;
+    }
+    void* map = ::mmap(nullptr, total, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED)
+        return nullptr;
+    auto header = reinterpret_cast<const ShmBlobHeader*>(map);
+    if (header->magic != shmBlobMagic || header->size != size ||
+        header->ready.load(std::memory_order_acquire) != 1) {
+        ::munmap(map, total);
+        return nullptr;
+    }
+    return static_cast<const char*>(map) + sizeof(ShmBlobHeader);
+}
+
+// Rebinds the packed blob to the named segment: the creator path publishes the private copy, the
+// attacher path drops it in favor of the mapping another worker published.
+MemoryPtr tryShmBacked(const std::string& key, MemoryPtr packed) {
+    auto concrete = std::dynamic_pointer_cast<Memory>(packed);
+    if (!concrete || !concrete->getData() || !concrete->getSize())
+        return packed;
+    const void* shared = attachOrPublishShmBlob(key, concrete->getData(), concrete->getSize());
+    if (!shared)
+        return packed;
+    return std::make_shared<Memory>(concrete->getEngine(), concrete->getDescPtr(), shared);
+}
+
+}  // namespace
+#endif
+
+bool WeightsSharing::processSharingEnabled() {
+#if defined(__linux__)
+    static const bool enabled = []() {
+        const char* env = std::getenv("OV_CPU_SHARED_WEIGHTS");
+        return env != nullptr && env[0] != '\0' && env[0] != '0';
+    }();
+    return enabled;
+#else
+    return false;
+#endif
+}
+
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MemoryInfo::Ptr & memory,
@@ -36,7 +145,8 @@ void WeightsSharing::SharedMemory::valid(bool b) {
 WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                             const std::string& key,
                             std::function<MemoryPtr(void)> create,
-                            bool valid) {
+                            bool valid,
+                            bool processShareable) {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
     {
@@ -46,6 +156,12 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+#if defined(__linux__)
+            if (processShareable && valid && processSharingEnabled())
+                newPtr = tryShmBacked(key, newPtr);
+#else
+            (void)processShareable;
+#endif
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -88,14 +88,28 @@ public:
         MemoryPtr newPtr;
     };
 
+    /**
+     * @param processShareable marks entries whose key fully identifies the content (a stable
+     *        content hash, no process-local parts like pointers), so the packed blob may be placed
+     *        into a named shared memory segment and reused by the other worker processes of the
+     *        host, see processSharingEnabled()
+     */
     SharedMemory::Ptr findOrCreate(const std::string& key,
                                    std::function<MemoryPtr(void)> create,
-                                   bool valid = true);
+                                   bool valid = true,
+                                   bool processShareable = false);
 
     SharedMemory::Ptr get(const std::string& key) const;
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    // Cross-process sharing of the packed weights, opted in with the OV_CPU_SHARED_WEIGHTS
+    // environment variable (Linux only). The first worker of a host publishes every
+    // process-shareable blob into a named shm segment, the subsequent workers attach and drop
+    // their private replicas, so a fleet of N isolated workers keeps one copy of the packed
+    // weights instead of N.
+    static bool processSharingEnabled();
+
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "nodes/kernels/scaled_attn/attn_memcpy.hpp"
+#include "nodes/kernels/scaled_attn/softmax.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace microbench {
+
+namespace {
+
+// attn_softmax over the sequence length grid of the scaled_attn node. The kernel streams
+// the score row, the attention mask and the destination row, so it is reported as GB/s.
+void bench_attn_softmax(const std::string& filter) {
+    if (!name_matches(filter, "attn_softmax"))
+        return;
+
+    for (size_t len : {128, 512, 1024, 2048, 4096, 8192}) {
+        std::vector<float> scores(len);
+        std::vector<float> mask(len, 0.0f);
+        std::vector<float> dst(len);
+        for (size_t i = 0; i < len; i++) {
+            scores[i] = std::sin(static_cast<float>(i)) * 0.1f;
+        }
+        const float scale = 1.0f / std::sqrt(static_cast<float>(len));
+
+        const double seconds = measure_seconds([&]() {
+            ov::Extensions::Cpu::XARCH::attn_softmax(scores.data(),
+                                                     dst.data(),
+                                                     scale,
+                                                     nullptr,
+                                                     mask.data(),
+                                                     nullptr,
+                                                     false,
+                                                     len,
+                                                     len,
+                                                     ov::element::f32,
+                                                     ov::element::f32);
+        });
+
+        std::ostringstream shape;
+        shape << "len=" << len;
+        print_row("attn_softmax", shape.str(), seconds, 3 * len * sizeof(float), 0);
+    }
+}
+
+// attn_memcpy2d_kernel over strided 2D blocks, the cache copy path of the scaled_attn node.
+// Purely memory bound: one read plus one write of the block.
+void bench_attn_memcpy2d(const std::string& filter) {
+    if (!name_matches(filter, "attn_memcpy2d"))
+        return;
+
+    for (size_t height : {32, 128, 1024}) {
+        for (size_t width : {64, 128, 256}) {
+            const size_t stride = width + 16;
+            std::vector<float> src(height * stride, 1.0f);
+            std::vector<float> dst(height * stride, 0.0f);
+
+            const double seconds = measure_seconds([&]() {
+                ov::Extensions::Cpu::XARCH::attn_memcpy2d_kernel(src.data(),
+                                                                 dst.data(),
+                                                                 ov::element::f32,
+                                                                 ov::element::f32,
+                                                                 stride,
+                                                                 stride,
+                                                                 width,
+                                                                 height);
+            });
+
+            std::ostringstream shape;
+            shape << height << "x" << width;
+            print_row("attn_memcpy2d", shape.str(), seconds, 2 * height * width * sizeof(float), 0);
+        }
+    }
+}
+
+}  // namespace
+
+void run_attn_benchmarks(const std::string& filter) {
+    bench_attn_softmax(filter);
+    bench_attn_memcpy2d(filter);
+}
+
+}  // namespace microbench
+}  // namespace intel_cpu
+}  // namespace ov
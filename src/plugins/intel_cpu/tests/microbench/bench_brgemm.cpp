@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "nodes/kernels/x64/brgemm_kernel.hpp"
+#include "openvino/runtime/system_conf.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace microbench {
+
+namespace {
+
+// Single-threaded (M, K) x (K, N) sweep over the BrgemmKernel used by the MHA and matmul
+// paths. FLOPs are the usual 2*M*N*K, so the GFLOPS column is directly comparable with the
+// peak of one core.
+template <typename T>
+void bench_brgemm_prec(const std::string& name, ov::element::Type rtPrec, const std::string& filter) {
+    if (!name_matches(filter, name))
+        return;
+
+    for (size_t size : {64, 128, 256, 512, 1024}) {
+        const size_t M = size, N = size, K = size;
+        BrgemmKernel gemm(M, N, K, K, N, N, false, rtPrec);
+        const bool is_bf16 = (rtPrec == ov::element::bf16);
+
+        std::vector<T> a_data(M * K, static_cast<T>(1.0f / 33));
+        std::vector<T> b_data(K * N, static_cast<T>(4.0f));
+        std::vector<float> c_data(M * N, 0.0f);
+        std::vector<size_t> wsp(gemm.get_wsp_size(), 0);
+        std::vector<T> b_scratch(std::max<size_t>(gemm.get_scratch_b_size(), 1), static_cast<T>(0.0f));
+        std::vector<T> a_scratch(std::max<size_t>(gemm.get_scratch_a_size(), 1), static_cast<T>(0.0f));
+        if (is_bf16)
+            gemm.copy_buffer_b(b_data.data(), b_scratch.data());
+        T* b_ptr = is_bf16 ? b_scratch.data() : b_data.data();
+
+        const size_t m_block_size = gemm.get_mblk_size();
+        const size_t m_blocks = (M + m_block_size - 1) / m_block_size;
+
+        const double seconds = measure_seconds([&]() {
+            for (size_t m_blk = 0; m_blk < m_blocks; m_blk++) {
+                const size_t m_start = m_blk * m_block_size;
+                const size_t m_cnt = std::min(m_start + m_block_size, M) - m_start;
+                gemm.executeGemm(m_cnt < m_block_size,
+                                 a_data.data() + m_start * K,
+                                 b_ptr,
+                                 c_data.data() + m_start * N,
+                                 wsp.data(),
+                                 a_scratch.data());
+            }
+        });
+
+        std::ostringstream shape;
+        shape << "M=N=K=" << size;
+        const size_t bytes = (M * K + K * N) * sizeof(T) + M * N * sizeof(float);
+        print_row(name, shape.str(), seconds, bytes, 2 * M * N * K);
+    }
+}
+
+}  // namespace
+
+void run_brgemm_benchmarks(const std::string& filter) {
+    if (ov::with_cpu_x86_avx512_core()) {
+        bench_brgemm_prec<float>("brgemm_f32", ov::element::f32, filter);
+    }
+    if (ov::with_cpu_x86_bfloat16()) {
+        bench_brgemm_prec<ov::bfloat16>("brgemm_bf16", ov::element::bf16, filter);
+    }
+}
+
+}  // namespace microbench
+}  // namespace intel_cpu
+}  // namespace ov
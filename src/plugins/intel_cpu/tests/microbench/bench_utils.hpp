@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "openvino/core/visibility.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace microbench {
+
+// Runs the kernel repeatedly and returns the best wall-clock time of one call in seconds.
+// The warm-up iterations pull code and data into caches and let the JIT emitters settle,
+// the best-of-repetitions policy filters out scheduler noise.
+inline double measure_seconds(const std::function<void()>& kernel,
+                              size_t warmup_iterations = 3,
+                              size_t repetitions = 10,
+                              size_t calls_per_repetition = 10) {
+    for (size_t i = 0; i < warmup_iterations; i++) {
+        kernel();
+    }
+    double best = std::numeric_limits<double>::max();
+    for (size_t r = 0; r < repetitions; r++) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t c = 0; c < calls_per_repetition; c++) {
+            kernel();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(stop - start).count() / calls_per_repetition);
+    }
+    return best;
+}
+
+inline void print_header() {
+    std::cout << std::left << std::setw(28) << "kernel" << std::setw(28) << "shape" << std::right << std::setw(12)
+              << "time (us)" << std::setw(12) << "GB/s" << std::setw(12) << "GFLOPS" << std::endl;
+}
+
+// Prints one line of the report; pass 0 bytes or 0 flops to skip the corresponding column
+// for kernels where the metric is not meaningful.
+inline void print_row(const std::string& name, const std::string& shape, double seconds, size_t bytes, size_t flops) {
+    std::cout << std::left << std::setw(28) << name << std::setw(28) << shape << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12) << seconds * 1e6;
+    if (bytes > 0) {
+        std::cout << std::setw(12) << bytes / seconds / 1e9;
+    } else {
+        std::cout << std::setw(12) << "-";
+    }
+    if (flops > 0) {
+        std::cout << std::setw(12) << flops / seconds / 1e9;
+    } else {
+        std::cout << std::setw(12) << "-";
+    }
+    std::cout << std::endl;
+}
+
+// Substring filter passed on the command line; an empty filter matches everything.
+inline bool name_matches(const std::string& filter, const std::string& name) {
+    return filter.empty() || name.find(filter) != std::string::npos;
+}
+
+// Benchmark suites, one per translation unit
+void run_attn_benchmarks(const std::string& filter);
+#if defined(OPENVINO_ARCH_X86_64)
+void run_brgemm_benchmarks(const std::string& filter);
+#endif
+
+}  // namespace microbench
+}  // namespace intel_cpu
+}  // namespace ov
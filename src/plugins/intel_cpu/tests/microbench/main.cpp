@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <iostream>
+#include <string>
+
+#include "bench_utils.hpp"
+
+// Microbenchmark harness for the intel_cpu node kernels. Runs the registered kernel sweeps
+// over synthetic shape grids and reports per-call time together with the achieved memory
+// bandwidth and compute throughput, so that kernel regressions can be caught without
+// building a full model. An optional command line argument is a substring filter applied
+// to the benchmark names, e.g. `ov_cpu_kernel_microbench brgemm`.
+int main(int argc, char* argv[]) {
+    using namespace ov::intel_cpu::microbench;
+
+    const std::string filter = argc > 1 ? argv[1] : "";
+
+    print_header();
+    run_attn_benchmarks(filter);
+#if defined(OPENVINO_ARCH_X86_64)
+    run_brgemm_benchmarks(filter);
+#endif
+    return 0;
+}
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -9,6 +11,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/result_memo.h"
 
 using namespace ov::intel_cpu;
 
@@ -379,3 +382,103 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+namespace {
+struct SharedIntKey {
+    size_t hash() const {
+        return std::hash<int>().operator()(data);
+    }
+    bool operator==(const SharedIntKey& rhs) const noexcept {
+        return this->data == rhs.data;
+    }
+
+    int data;
+};
+} // namespace
+
+TEST(MultiCacheTests, SmokeSharedInstanceSingleFlight) {
+    using ValueType = std::shared_ptr<int>;
+    constexpr size_t numThreads = 8;
+
+    std::atomic<int> builderCalls{0};
+    auto builder = [&](const SharedIntKey& key) {
+        builderCalls++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return std::make_shared<int>(key.data);
+    };
+
+    std::vector<MultiCache> vecCache(numThreads, MultiCache(10, true));
+    std::vector<ValueType> results(numThreads);
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread([&, i]() {
+                results[i] = vecCache[i].getOrCreate(SharedIntKey{42}, builder).first;
+            }));
+        }
+    }
+
+    // the build is single-flight: the first requester runs the builder, the concurrent requesters
+    // of the same key wait for its result instead of building redundant copies
+    ASSERT_EQ(builderCalls.load(), 1);
+    for (auto& result : results) {
+        ASSERT_NE(result, ValueType());
+        ASSERT_EQ(result, results.front());
+        ASSERT_EQ(*result, 42);
+    }
+}
+
+namespace {
+ResultMemoCache::RecordCPtr makeMemoRecord(uint8_t fill, size_t bytes) {
+    auto record = std::make_shared<ResultMemoCache::Record>();
+    record->shapes = {{bytes}};
+    record->blobs = {std::vector<uint8_t>(bytes, fill)};
+    record->bytes = bytes;
+    return record;
+}
+} // namespace
+
+TEST(ResultMemoCacheTests, PutGet) {
+    ResultMemoCache cache(1024);
+    auto record = makeMemoRecord(7, 4);
+    ResultMemoCache::Key key{ResultMemoCache::hashBytes(record->blobs[0].data(), 4, 0)};
+    ASSERT_EQ(cache.get(key), nullptr);
+    cache.put(key, record);
+    auto hit = cache.get(key);
+    ASSERT_NE(hit, nullptr);
+    ASSERT_EQ(hit->blobs, record->blobs);
+    ASSERT_EQ(hit->shapes, record->shapes);
+}
+
+TEST(ResultMemoCacheTests, ByteBudgetEviction) {
+    constexpr size_t budget = 64;
+    ResultMemoCache cache(budget);
+    // 4 records of 16 bytes fill the budget exactly
+    for (uint8_t i = 0; i < 4; ++i) {
+        cache.put({i}, makeMemoRecord(i, 16));
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+        ASSERT_NE(cache.get({i}), nullptr);
+    }
+    // the next record evicts the least recently used one, which is {0} after the get() sweep above
+    cache.put({4}, makeMemoRecord(4, 16));
+    ASSERT_EQ(cache.get({0}), nullptr);
+    ASSERT_NE(cache.get({1}), nullptr);
+    ASSERT_NE(cache.get({4}), nullptr);
+    // a record larger than the whole budget is dropped silently
+    cache.put({5}, makeMemoRecord(5, budget + 1));
+    ASSERT_EQ(cache.get({5}), nullptr);
+}
+
+TEST(ResultMemoCacheTests, HashBytesStability) {
+    const std::vector<uint8_t> data{0, 1, 2, 3, 4, 5, 6, 7};
+    const auto fingerprint = ResultMemoCache::hashBytes(data.data(), data.size(), 0);
+    ASSERT_EQ(fingerprint, ResultMemoCache::hashBytes(data.data(), data.size(), 0));
+    auto modified = data;
+    modified.back() ^= 1;
+    ASSERT_NE(fingerprint, ResultMemoCache::hashBytes(modified.data(), modified.size(), 0));
+    // the seed chains, so the same content hashed under a different prefix does not collide
+    ASSERT_NE(fingerprint, ResultMemoCache::hashBytes(data.data(), data.size(), fingerprint));
+}
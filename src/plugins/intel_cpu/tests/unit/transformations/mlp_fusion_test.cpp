@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+#include <numeric>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset4.hpp>
+#include <transformations/cpu_opset/common/pass/mlp_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <openvino/pass/constant_folding.hpp>
+#include <openvino/pass/manager.hpp>
+#include "common_test_utils/ov_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+static std::vector<float> makeWeights(size_t size, float start) {
+    std::vector<float> data(size);
+    std::iota(data.begin(), data.end(), start);
+    return data;
+}
+
+TEST(TransformationTests, MLPGateUpFusionTest1) {
+    const size_t K = 4, N = 8;
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32,
+                                                             ov::PartialShape{-1, -1, static_cast<int64_t>(K)});
+        auto w_gate = ov::opset1::Constant::create(ov::element::f32, ov::Shape{N, K}, makeWeights(N * K, 0.0f));
+        auto w_up = ov::opset1::Constant::create(ov::element::f32, ov::Shape{N, K}, makeWeights(N * K, 100.0f));
+        auto mm_gate = std::make_shared<ov::opset1::MatMul>(input, w_gate, false, true);
+        auto mm_up = std::make_shared<ov::opset1::MatMul>(input, w_up, false, true);
+        auto act = std::make_shared<ov::opset4::Swish>(mm_gate);
+        auto mul = std::make_shared<ov::opset1::Multiply>(act, mm_up);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ mul }, ov::ParameterVector{ input });
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<MLPGateUpFusion>();
+        m.register_pass<ov::pass::ConstantFolding>();
+        m.run_passes(f);
+    }
+
+    {
+        auto input = std::make_shared<ov::opset1::Parameter>(ov::element::f32,
+                                                             ov::PartialShape{-1, -1, static_cast<int64_t>(K)});
+        auto w_gate = makeWeights(N * K, 0.0f);
+        auto w_up = makeWeights(N * K, 100.0f);
+        w_gate.insert(w_gate.end(), w_up.begin(), w_up.end());
+        auto w_fused = ov::opset1::Constant::create(ov::element::f32, ov::Shape{2 * N, K}, w_gate);
+        auto mm = std::make_shared<ov::opset1::MatMul>(input, w_fused, false, true);
+        auto axis = ov::opset1::Constant::create(ov::element::i64, ov::Shape{}, {-1});
+        auto lengths = ov::opset1::Constant::create(ov::element::i64, ov::Shape{2},
+                                                    {static_cast<int64_t>(N), static_cast<int64_t>(N)});
+        auto vsplit = std::make_shared<ov::opset1::VariadicSplit>(mm, axis, lengths);
+        auto act = std::make_shared<ov::opset4::Swish>(vsplit->output(0));
+        auto mul = std::make_shared<ov::opset1::Multiply>(act, vsplit->output(1));
+
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{ mul }, ov::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MLPGateUpFusionTestDifferentInputs) {
+    const size_t K = 4, N = 8;
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        // the projections consume different tensors, the pattern must not fuse
+        auto input0 = std::make_shared<ov::opset1::Parameter>(ov::element::f32,
+                                                             ov::PartialShape{-1, -1, static_cast<int64_t>(K)});
+        auto input1 = std::make_shared<ov::opset1::Parameter>(ov::element::f32,
+                                                             ov::PartialShape{-1, -1, static_cast<int64_t>(K)});
+        auto w_gate = ov::opset1::Constant::create(ov::element::f32, ov::Shape{N, K}, makeWeights(N * K, 0.0f));
+        auto w_up = ov::opset1::Constant::create(ov::element::f32, ov::Shape{N, K}, makeWeights(N * K, 100.0f));
+        auto mm_gate = std::make_shared<ov::opset1::MatMul>(input0, w_gate, false, true);
+        auto mm_up = std::make_shared<ov::opset1::MatMul>(input1, w_up, false, true);
+        auto act = std::make_shared<ov::opset4::Swish>(mm_gate);
+        auto mul = std::make_shared<ov::opset1::Multiply>(act, mm_up);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ mul }, ov::ParameterVector{ input0, input1 });
+        f_ref = f->clone();
+
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<MLPGateUpFusion>();
+        m.run_passes(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
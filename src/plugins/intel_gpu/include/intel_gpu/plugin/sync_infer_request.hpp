@@ -75,6 +75,9 @@ private:
     std::unordered_map<size_t, TensorWrapper> m_plugin_inputs;
     std::unordered_map<size_t, TensorWrapper> m_plugin_outputs;
 
+    // pinned (USM host) staging buffers for uploads from pageable user memory on dGPU
+    std::unordered_map<size_t, std::shared_ptr<ov::ITensor>> m_staging_inputs;
+
     std::unordered_map<size_t, ov::Output<const ov::Node>> m_input_ports_map;
     std::unordered_map<size_t, ov::Output<const ov::Node>> m_output_ports_map;
 
@@ -87,6 +90,9 @@ private:
     RemoteContextImpl::Ptr m_context = nullptr;
     std::shared_ptr<ov::threading::IStreamsExecutor> m_stream_executor = nullptr;
     std::shared_ptr<cldnn::ShapePredictor> m_shape_predictor = nullptr;
+    // lazily created side queue for the device-to-host output copies, so the readback can overlap
+    // with the still running tail of the compute stream (see wait())
+    cldnn::stream::ptr m_copy_stream = nullptr;
     bool m_enable_profiling = false;
     bool m_use_external_queue = false;
 
@@ -114,7 +120,7 @@ private:
     void allocate_states();
     void allocate_input(const ov::Output<const ov::Node>& port, size_t input_idx);
     void allocate_output(const ov::Output<const ov::Node>& port, size_t output_idx);
-    cldnn::event::ptr copy_output_data(cldnn::memory::ptr src, const ov::ITensor& dst) const;
+    cldnn::event::ptr copy_output_data(cldnn::memory::ptr src, const ov::ITensor& dst, cldnn::stream& stream) const;
 
     void init_mappings();
     bool is_batched_input(const ov::Output<const ov::Node>& port) const;
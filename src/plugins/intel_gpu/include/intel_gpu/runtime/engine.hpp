@@ -74,6 +74,9 @@ public:
     memory_ptr share_dx_buffer(const layout& layout, shared_handle res);
 #else
     memory_ptr share_surface(const layout& layout, shared_surface surf, uint32_t plane);
+
+    /// Create shared memory object importing dma_buf file descriptor @p fd using specified @p layout
+    memory_ptr share_dma_buf(const layout& layout, shared_handle fd);
 #endif
 
     /// Checks whether two memory objects represents the same physical memory
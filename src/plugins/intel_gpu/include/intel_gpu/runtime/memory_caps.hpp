@@ -77,7 +77,10 @@ enum class shared_mem_type {
     shared_mem_dxbuffer,
 
     /// @brief Structure describes shared USM memory.
-    shared_mem_usm
+    shared_mem_usm,
+
+    /// @brief Structure describes memory imported from a dma_buf file descriptor (Linux)
+    shared_mem_dmabuf
 };
 
 using shared_handle = void*;
@@ -36,6 +36,11 @@ public:
                                       bool is_output_event = false) = 0;
     virtual event::ptr enqueue_marker(std::vector<event::ptr> const& deps, bool is_output_event = false) = 0;
     virtual void enqueue_barrier() = 0;
+    // Blocks the commands enqueued to this stream afterwards until all deps are completed. Unlike
+    // enqueue_marker, the dependency is expressed with an explicit wait list, so deps may belong to
+    // another stream of the same engine. Returns nullptr when some dep can not be waited on at the
+    // queue level; in that case nothing is enqueued and the caller has to synchronize on the host.
+    virtual event::ptr enqueue_dependency_barrier(const std::vector<event::ptr>& deps) = 0;
     virtual event::ptr group_events(std::vector<event::ptr> const& deps) = 0;
     virtual void wait_for_events(const std::vector<event::ptr>& events) = 0;
     virtual event::ptr create_user_event(bool set) = 0;
@@ -994,9 +994,17 @@ void prepare_primitive_fusing::fuse_simple_primitives(program &p) {
                 return;
 
             bool merge_allowed = true;
-            // If fused node is not convolution and fused node has multiple users,
+            auto peer_is_fused_node_parent = [&]() {
+                for (auto& parent : fused_node->get_dependencies())
+                    if (parent.first->id() == peer_node->id())
+                        return true;
+                return false;
+            };
+            // If fused node is not convolution or an eltwise chain head and fused node has multiple users,
             //  follow the legacy checking rule
-            if (!supports_immad && fused_node->is_type<convolution>() && fused_node->get_users().size() > 1) {
+            if (!supports_immad && fused_node->get_users().size() > 1 &&
+                (fused_node->is_type<convolution>() ||
+                 (fused_node->is_type<eltwise>() && !peer_is_fused_node_parent()))) {
                 // Allowed new pattern: Elt1, Act, Elt2, Elt3, Elt4 are fused to Conv1
                 // * Conv1 -> Eltw1(Add) -> Act(Clamp) -> Eltw2(Mul) -> Eltw3(Mul) -> Eltw4(Add) -> Conv2
                 // *   \–----------------------------------->/                          \---------> Eltw5(Div)
@@ -1010,6 +1018,10 @@ void prepare_primitive_fusing::fuse_simple_primitives(program &p) {
                 // 4. When node_queue has only one node, the while loop is ended and this node is fused to fused node(Conv1)
                 //      node_queue having one node means all user nodes from fused node(Conv1) converge at that node.
                 // 5. if node_queue has multiple nodes even if the level of current_node is max_levels, it cannot be fused.
+                //
+                // The same convergence rules are applied when the chain head is itself an eltwise, so
+                // diamond shaped elementwise DAGs collapse into the single generated kernel of the head
+                // instead of leaving one kernel per branch with intermediate global memory traffic.
                 std::deque<std::pair<cldnn::program_node*, size_t>> node_queue; //std::pair<cldnn::program_node*, layer level>
                 std::vector<cldnn::program_node*> node_history;
                 node_queue.push_back(std::make_pair(fused_node, 0));
@@ -138,6 +138,11 @@ struct kv_cache_impl : multi_stage_primitive<kv_cache> {
         }
     }
 
+    // On the steady decode path (_can_be_optimized == true) this boils down to a single dispatch:
+    // the output aliases the padded variable memory, the past-copy sub-kernel is skipped in
+    // update_dispatch_data() and only the new-token copy runs, writing into the padded tail of the
+    // cache in place. The full concat plus copy-back below is only taken on reallocation
+    // iterations, i.e. once per get_prealloc_iter_num() generated tokens.
     event::ptr execute_impl(const std::vector<event::ptr>& events, kv_cache_inst& instance) override {
         const bool can_be_optimized = instance.get_impl_params()->_can_be_optimized;
         auto& stream = instance.get_network().get_stream();
@@ -339,6 +339,8 @@ private:
                                                                 network::ptr body_network, int64_t iter);
     void set_memory_in_body_network(cldnn::network::ptr body_network, const std::shared_ptr<cldnn::primitive_inst>& inst,
                                         memory::ptr mem);
+    memory::ptr get_backedge_updated_mem(memory::ptr target_mem, const layout& updated_layout,
+                                        const primitive_id& target_id);
 
     std::vector<loop::io_primitive_map> _input_primitive_maps;
     std::vector<loop::io_primitive_map> _output_primitive_maps;
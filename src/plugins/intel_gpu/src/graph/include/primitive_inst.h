@@ -371,7 +371,16 @@ protected:
     bool _is_constant = false;
     bool _needs_completion_event = false;
 
+    // Evaluated once after the first complete iteration: fully static primitives whose arguments are
+    // pinned take a fast path on the following iterations which enqueues the kernel directly without
+    // the per-iteration validation and bookkeeping (see primitive_inst::execute)
+    bool _fast_execute_checked = false;
+    bool _can_fast_execute = false;
+
     size_t _max_output_layout_count = 0;
+    // number of consecutive inferences which used only a small part of the output buffer,
+    // used to release buffers that stay cold after a peak shape
+    size_t _cold_output_iters = 0;
     std::vector<size_t> max_intermediates_memory_sizes;
 
     std::vector<memory::ptr> allocate_outputs(kernel_impl_params* updated_params = nullptr,
@@ -392,6 +401,7 @@ protected:
 
     void fill_shape_info_data(const layout& runtime_layout, const layout& node_layout, int32_t* shape_info_ptr, size_t& offset);
     bool use_async_compilation();
+    bool can_skip_per_iteration_checks() const;
     // if primitive_inst doesn't replace impl to new impl(static impl with opt kerenl or dynamic impl), return false
     bool update_impl();
     event::ptr realloc_if_needed();
@@ -993,6 +993,33 @@ void loop_inst::set_memory_in_body_network(cldnn::network::ptr body_network,
     }
 }
 
+memory::ptr loop_inst::get_backedge_updated_mem(memory::ptr target_mem, const layout& updated_layout,
+                                                const primitive_id& target_id) {
+    auto& engine = body_network->get_engine();
+    // Growing shapes in the body network (e.g. kv-cache backedges of a decoder loop) change the layout
+    // on almost every iteration. Reuse the buffer already bound to the backedge input when its capacity
+    // covers the new layout, and when reallocation is unavoidable consult the shape predictor to
+    // over-allocate for the next iterations, so the following layout updates hit the reuse path
+    // (same policy as primitive_inst output allocation)
+    if (target_mem && target_mem->size() >= updated_layout.bytes_count()) {
+        GPU_DEBUG_LOG << "[SINGLE] Backedge_to node(" << target_id << ") reuses its buffer(" << target_mem
+                        << ") for updated layout " << updated_layout.to_short_string() << std::endl;
+        return engine.reinterpret_buffer(*target_mem, updated_layout);
+    }
+
+    auto alloc_layout = updated_layout;
+    auto& sp = *get_network().get_shape_predictor();
+    auto dt_bitwidth = ov::element::Type(updated_layout.data_type).bitwidth();
+    auto prealloc_info = sp.predict_preallocation_shape(id() + "/" + target_id, updated_layout, false);
+    if (prealloc_info.first && sp.can_preallocate(ov::shape_size(prealloc_info.second) * dt_bitwidth))
+        alloc_layout.set_partial_shape(prealloc_info.second);
+
+    auto new_mem = engine.allocate_memory(alloc_layout, false);
+    if (!alloc_layout.identical(updated_layout))
+        new_mem = engine.reinterpret_buffer(*new_mem, updated_layout);
+    return new_mem;
+}
+
 std::vector<event::ptr> loop_inst::handle_buffers_for_next_iteration(const loop_inst::backedge_memory_mapping& mapping,
                                                     network::ptr body_network, int64_t iter) {
     std::vector<event::ptr> event_vec;
@@ -1054,7 +1081,7 @@ std::vector<event::ptr> loop_inst::handle_buffers_for_next_iteration(const loop_
                 auto to_id = mapping.to_primitive->id();
                 // Check backedge_to shape needs to be updated by initial_mem
                 if (!mapping.initial_mem->get_layout().identical(to_mem->get_layout())) {
-                    to_mem = body_network->get_engine().allocate_memory(mapping.initial_mem->get_layout(), false);
+                    to_mem = get_backedge_updated_mem(to_mem, mapping.initial_mem->get_layout(), to_id);
                     body_network->set_input_data(to_id, to_mem);
                     ev = to_mem->copy_from(body_network->get_stream(), *(mapping.initial_mem));
                     GPU_DEBUG_LOG << iter << ") [SINGLE] Backedge_to node(" << to_id << ") is set to new memory("
@@ -1076,7 +1103,7 @@ std::vector<event::ptr> loop_inst::handle_buffers_for_next_iteration(const loop_
 
                 // Check backedge_to shape needs to be updated by backedge_from
                 if (!from_mem->get_layout().identical(to_mem->get_layout())) {
-                    to_mem = body_network->get_engine().allocate_memory(from_mem->get_layout(), false);
+                    to_mem = get_backedge_updated_mem(to_mem, from_mem->get_layout(), to_id);
                     GPU_DEBUG_LOG << iter << ") [SINGLE] Backedge_to node(" << to_id << ") is set to new memory("
                                     << to_mem << ", " << to_mem->get_layout().to_short_string()
                                     << ") because of shape update from backedge_from()" << from_id
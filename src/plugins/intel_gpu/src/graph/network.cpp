@@ -999,11 +999,14 @@ void network::execute_impl(const std::vector<event::ptr>& events) {
         return std::to_string(iter) + "_";
     };
 
-    // This extra flush command is needed for dynamic models in case of out_of_order operating mode since
+    // This extra flush command is needed in case of out_of_order operating mode since
     // it reduces `bubbles` number in pipeline and GPU's idle time by timely flushing new kernels to device.
+    // For OOO queue each primitive carries its dependency events, so the hardware scheduler can already
+    // overlap independent branches of the graph - but only once the commands are submitted, thus flush
+    // periodically instead of once at the end while the host is still enqueuing the remaining primitives.
     // The freqency of flushing (16) is selected empirically, see details in tickets 116365, 116287.
     const bool is_out_of_order_queue = get_stream().get_queue_type() == QueueTypes::out_of_order;
-    const bool needs_flushing = _is_dynamic && is_out_of_order_queue;
+    const bool needs_flushing = is_out_of_order_queue;
     const size_t flush_frequency = needs_flushing ? 16 : 0;
     size_t executed_prims = 0;
 
@@ -1443,8 +1446,28 @@ void network::transfer_memory_to_device(std::shared_ptr<primitive_inst> instance
         return;
 
     if (alloc_type == allocation_type::usm_host || alloc_type == allocation_type::usm_shared) {
+        // Leave the constant in host memory when device memory is exhausted: USM host allocations
+        // are still directly accessible by the GPU over PCIe, so a model slightly larger than VRAM
+        // runs with its coldest weights at reduced bandwidth instead of failing to load. Constants
+        // are transferred in processing order, so the layers left behind are the last ones.
+        const auto used_device_mem = get_engine().get_used_device_memory(allocation_type::usm_device);
+        const auto total_device_mem = get_engine().get_device_info().max_global_mem_size;
+        if (used_device_mem + inst_mem.size() > total_device_mem) {
+            GPU_DEBUG_LOG << "[" << node.id() << ": constant stays in " << alloc_type
+                          << " as device memory is exhausted]" << std::endl;
+            return;
+        }
+
         // Allocate and transfer memory
-        auto device_mem = inst_mem.get_engine()->allocate_memory(inst_mem.get_layout(), allocation_type::usm_device, false);
+        memory::ptr device_mem = nullptr;
+        try {
+            device_mem = inst_mem.get_engine()->allocate_memory(inst_mem.get_layout(), allocation_type::usm_device, false);
+        } catch (const std::exception&) {
+            // Allocation may still fail due to fragmentation or concurrent users - fall back to host memory
+            GPU_DEBUG_LOG << "[" << node.id() << ": constant stays in " << alloc_type
+                          << " as device allocation failed]" << std::endl;
+            return;
+        }
         device_mem->copy_from(get_stream(), inst_mem);
         GPU_DEBUG_LOG << "[" << node.id() << ": constant]" << std::endl;
         _memory_pool->release_memory(&inst_mem, node.get_unique_id(), node.id(), get_id());
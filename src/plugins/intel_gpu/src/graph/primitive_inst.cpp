@@ -566,6 +566,21 @@ event::ptr primitive_inst::realloc_if_needed() {
                                << " is much smaller than current memory size! " << _max_output_layout_count
                                << "Reset memory" << std::endl;
         _max_output_layout_count = 0;
+        _cold_output_iters = 0;
+    } else if (updated_layout.get_buffer_size().count() * 3 < _max_output_layout_count) {
+        // moderately oversized buffers are released only after staying cold for several
+        // consecutive inferences, so a single small shape does not drop a buffer which the
+        // next iteration would reallocate at its peak size again
+        constexpr size_t max_cold_iters = 10;
+        if (++_cold_output_iters >= max_cold_iters) {
+            GPU_DEBUG_TRACE_DETAIL << id() << ": Output buffer stayed cold for " << _cold_output_iters
+                                   << " inferences (used " << updated_layout.count() << "/"
+                                   << _max_output_layout_count << "). Reset memory" << std::endl;
+            _max_output_layout_count = 0;
+            _cold_output_iters = 0;
+        }
+    } else {
+        _cold_output_iters = 0;
     }
 
     bool can_reuse_buffer = _outputs[0] && updated_layout.count() <= _max_output_layout_count;
@@ -843,6 +858,11 @@ bool primitive_inst::update_impl() {
         }
         if (!cached_impl) {
             if (_dynamic_impl || is_current_impl_dynamic) {
+                // Serve this occurrence of the shape with the generic shape-agnostic impl and compile
+                // a shape-specialized variant in the background: once it lands in the implementations
+                // cache, the cache lookup above hot-swaps it in on a later iteration with the same key.
+                // The key is the fake-aligned params, so e.g. fully_connected batches are bucketed to
+                // the alignment granularity instead of compiling one variant per exact batch size.
                 if (use_async_compilation()) {
                     auto& compilation_context = prog->get_compilation_context();
                     compilation_context.push_task(updated_params_no_dyn_pad, [this, &compilation_context, updated_params_no_dyn_pad]() {
@@ -1249,7 +1269,42 @@ bool primitive_inst::has_inner_networks() const {
     return (_impl_params->inner_nets.size() > 0);
 }
 
+bool primitive_inst::can_skip_per_iteration_checks() const {
+    if (is_dynamic() || has_mutable_input() || is_output() || has_inner_networks())
+        return false;
+    // CPU impls wait on their dependency events and optimized out primitives propagate memory, both
+    // of which the fast path skips
+    if (!_impl || _impl->is_cpu() || can_be_optimized() || needs_completion_event())
+        return false;
+    // stateful primitives rebind the variable memory in on_execute on every iteration
+    if (_node->is_in_shape_of_subgraph() || _node->is_type<assign>() || _node->is_type<read_value>())
+        return false;
+    // only the in-order queue makes the event dependencies implicit
+    if (get_network().get_stream().get_queue_type() != QueueTypes::in_order)
+        return false;
+    // a dynamic dependency may reallocate its output buffer, which requires the args update check
+    for (const auto& dep : _deps) {
+        if (dep.first->is_dynamic())
+            return false;
+    }
+    // the debug dump features rely on the per-iteration hooks of the full path
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    GPU_DEBUG_IF(debug_config->verbose > 0 || !debug_config->dump_profiling_data.empty() ||
+                 debug_config->dump_layers_path.length() > 0) {
+        return false;
+    }
+    return true;
+}
+
 event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
+    // Fully static primitive beyond its first iteration: shapes, buffers and kernel arguments cannot
+    // change anymore, so skip the validation and bookkeeping below and enqueue the kernel directly.
+    // On the in-order queue the event dependencies are implicit, hence none are collected either.
+    if (_can_fast_execute) {
+        _mem_changed = false;
+        GPU_DEBUG_PROFILED_STAGE(instrumentation::pipeline_stage::inference);
+        return _impl->execute({}, *this);
+    }
     OV_ITT_SCOPED_TASK(ov::intel_gpu::itt::domains::intel_gpu_plugin, openvino::itt::handle("primitive_inst::execute: " + id()));
     const auto primitive_id = id();
     OPENVINO_ASSERT(_has_valid_input, primitive_id, " has invalid/unset input");
@@ -1262,7 +1317,13 @@ event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
     GPU_DEBUG_TRACE_DETAIL << "-----------------------------------------------------------------" << std::endl;
     bool need_args_update = false;
     _mem_changed = false;
-    const auto orig_outputs = _outputs;
+    // Only dynamic primitives can reallocate their outputs, so for static ones skip the snapshot
+    // and the buffer comparison after execution - refcounting a copy of every output on each
+    // enqueue is pure host overhead for small host-bound models
+    const bool track_mem_change = is_dynamic() && !_node->is_type<condition>() && !_node->is_type<loop>();
+    std::vector<memory::ptr> orig_outputs;
+    if (track_mem_change)
+        orig_outputs = _outputs;
     std::vector<event::ptr> dependencies;
     if (is_dynamic() && !has_inner_networks()) {
         do_runtime_in_place_concat();
@@ -1368,7 +1429,7 @@ event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
     }
     on_execute();
 
-    if (!_node->is_type<condition>() && !_node->is_type<loop>()) {
+    if (track_mem_change) {
         for (size_t i = 0; i < _outputs.size(); ++i) {
             if ((!orig_outputs[i] && _outputs[i]) || (orig_outputs[i] && !_outputs[i])) {
                 _mem_changed = true;
@@ -1413,6 +1474,13 @@ event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
         dependencies = {grouped_ev};
     }
 
+    // Decide once, after everything has been set up by the first complete iteration, whether the
+    // following iterations can take the fast path at the top of this function
+    if (!_fast_execute_checked) {
+        _fast_execute_checked = true;
+        _can_fast_execute = can_skip_per_iteration_checks();
+    }
+
     {
         GPU_DEBUG_PROFILED_STAGE(instrumentation::pipeline_stage::inference);
         auto ev = _impl->execute(dependencies, *this);
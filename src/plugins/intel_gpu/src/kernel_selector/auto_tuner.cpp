@@ -4,6 +4,7 @@
 
 #include "auto_tuner.h"
 
+#include <cctype>
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -204,6 +205,15 @@ TuningCache::Entry TuningCache::LoadKernel_v2(const Params& params, uint32_t com
 std::tuple<std::string, int> AutoTuner::LoadKernelOffline(const Params& params) {
     std::lock_guard<std::mutex> lock(mutex);
     static const uint32_t defaultComputeUnits = 24;
+
+    // A cache tuned for this exact device and driver, when present in the cache directory, takes
+    // precedence over the common one shipped next to the plugin binary.
+    if (TuningCache* perDeviceCache = GetDeviceCache(params)) {
+        auto result = perDeviceCache->LoadKernel(params);
+        if (!std::get<0>(result).empty())
+            return result;
+    }
+
     TuningCache* deviceCache = TuningCache::get();
     if (!deviceCache)
         return {};
@@ -214,6 +224,36 @@ std::tuple<std::string, int> AutoTuner::LoadKernelOffline(const Params& params)
     return result;
 }
 
+TuningCache* AutoTuner::GetDeviceCache(const Params& params) {
+    const auto& info = params.engineInfo;
+    if (info.tuningCacheDir.empty() || info.deviceId.empty())
+        return nullptr;
+
+    auto path = info.tuningCacheDir;
+    if (path.back() != '/' && path.back() != '\\')
+        path += "/";
+    // The driver version is part of the key, so the entries expire neither silently on a driver
+    // update nor when the cache directory is shared between machines with different GPUs.
+    auto driverVersion = info.driverVersion;
+    for (auto& c : driverVersion) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '-')
+            c = '_';
+    }
+    path += "tuning_cache_" + info.deviceId + "_" + driverVersion + ".json";
+
+    auto it = deviceCaches.find(path);
+    if (it == deviceCaches.end()) {
+        std::shared_ptr<TuningCache> cache;
+        try {
+            cache = std::make_shared<TuningCache>(path);
+        } catch (...) {
+            cache = nullptr;
+        }
+        it = deviceCaches.emplace(path, std::move(cache)).first;
+    }
+    return it->second.get();
+}
+
 TuningCache* TuningCache::get() {
     static std::mutex m;
     static std::shared_ptr<TuningCache> cache_instance = nullptr;
@@ -55,6 +55,12 @@ public:
     std::tuple<std::string, int> LoadKernelOffline(const Params& params);
 
 private:
+    // Returns the cache tuned for the exact device of params, loaded from the cache directory
+    // (engineInfo.tuningCacheDir), or nullptr when no such cache exists. A missing file is
+    // remembered as well so it is probed at most once per device.
+    TuningCache* GetDeviceCache(const Params& params);
+
+    std::map<std::string, std::shared_ptr<TuningCache>> deviceCaches;  // keyed by cache file path
     std::mutex mutex;  // Mutex to synchronize cache updates
 
     /*
@@ -387,6 +387,7 @@ struct EngineInfo {
     uint64_t maxImage2dHeight = 0;
     std::string deviceId = "";
     std::string driverVersion = "";
+    std::string tuningCacheDir = "";
     std::vector<size_t> supportedSimdSizes = {};
 
     DeviceFeaturesKey get_supported_device_features_key() const;
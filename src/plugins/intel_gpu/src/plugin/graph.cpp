@@ -486,6 +486,13 @@ void Graph::update_profiling_info() {
 
             if (interval.stage == cldnn::instrumentation::profiling_stage::submission) {
                 pc.cpu_uSec += count;
+            } else if (interval.stage == cldnn::instrumentation::profiling_stage::starting) {
+                // submit -> start is the time the kernel waited in the device queue; without vendor
+                // counter APIs this is the closest available signal of device contention and driver
+                // scheduling latency, so account it instead of dropping it. For GPU primitives
+                // cpu_time thus covers the full queued -> start latency while real_time remains
+                // pure kernel execution
+                pc.cpu_uSec += count;
             } else if (interval.stage == cldnn::instrumentation::profiling_stage::executing) {
                 pc.realTime_uSec += count;
             } else if (interval.stage == cldnn::instrumentation::profiling_stage::duration) {  // "duration" is used for CPU layers
@@ -157,6 +157,10 @@ ov::SoPtr<ov::IRemoteTensor> RemoteContextImpl::create_tensor(const ov::element:
                 tensor_type = TensorType::BT_DX_BUF_SHARED;
                 mem = extract_object(params, ov::intel_gpu::dev_object_handle);
                 check_if_shared();
+#else
+            } else if (ov::intel_gpu::SharedMemType::DMA_BUF == mem_type) {
+                tensor_type = TensorType::BT_DMA_BUF_SHARED;
+                mem = extract_object(params, ov::intel_gpu::mem_handle);
 #endif
             } else {
                 OPENVINO_THROW("[GPU] Unsupported shared object type ", mem_type);
@@ -172,6 +172,10 @@ void RemoteTensorImpl::allocate() {
         m_memory_object = engine.share_surface(m_layout, m_surf, m_plane);
         break;
     }
+    case TensorType::BT_DMA_BUF_SHARED: {
+        m_memory_object = engine.share_dma_buf(m_layout, m_mem);
+        break;
+    }
 #endif
     case TensorType::BT_IMG_SHARED: {
         m_memory_object = engine.share_image(m_layout, m_mem);
@@ -197,7 +201,8 @@ bool RemoteTensorImpl::is_shared() const noexcept {
            m_mem_type == TensorType::BT_USM_SHARED ||
            m_mem_type == TensorType::BT_IMG_SHARED ||
            m_mem_type == TensorType::BT_SURF_SHARED ||
-           m_mem_type == TensorType::BT_DX_BUF_SHARED;
+           m_mem_type == TensorType::BT_DX_BUF_SHARED ||
+           m_mem_type == TensorType::BT_DMA_BUF_SHARED;
 }
 
 bool RemoteTensorImpl::supports_caching() const {
@@ -293,6 +298,14 @@ void RemoteTensorImpl::update_properties() {
             ov::intel_gpu::dev_object_handle(params.surface),
         };
         break;
+#else
+    case TensorType::BT_DMA_BUF_SHARED:
+        m_properties = {
+            ov::intel_gpu::shared_mem_type(ov::intel_gpu::SharedMemType::DMA_BUF),
+            ov::intel_gpu::ocl_context(params.context),
+            ov::intel_gpu::mem_handle(params.mem),
+        };
+        break;
 #endif
     case TensorType::BT_IMG_SHARED:
         m_properties = {
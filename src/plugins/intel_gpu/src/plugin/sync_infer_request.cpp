@@ -298,17 +298,36 @@ void SyncInferRequest::wait() {
     // wait for completion & collect outputs as requested by the model
     // for in_order_queue, it is enough to call finish only once
     bool do_sync_per_output = (network.get_stream().get_queue_type() == QueueTypes::in_order) ? false : true;
-    if (!do_sync_per_output)
+
+    // When every output comes with a completion event, the device-to-host copies below are chained
+    // on those events and enqueued to a dedicated side queue, so the transfers of the outputs which
+    // are ready early overlap with the still running tail of the compute stream instead of starting
+    // only after a full stream sync. Profiling needs the whole network finished before the stats
+    // are collected, so it keeps the synchronous path.
+    bool overlap_copy = !m_use_external_queue && !m_enable_profiling;
+    for (const auto& it : m_output_names_map) {
+        if (!m_internal_outputs.at(it.second).get_event()) {
+            overlap_copy = false;
+            break;
+        }
+    }
+    if (overlap_copy && !m_copy_stream)
+        m_copy_stream = m_graph->get_engine().create_stream(m_graph->get_config());
+
+    if (!do_sync_per_output && !overlap_copy)
         network.get_stream().finish();
 
     std::vector<cldnn::event::ptr> copy_events;
+    bool needs_main_sync = false;
 
     for (const auto& it : m_output_ports_map) {
         size_t port_idx = it.first;
         const auto& port = it.second;
         cldnn::primitive_id internal_name = m_output_names_map.at(port_idx);
-        auto output_memory = m_internal_outputs.at(internal_name).get_memory(do_sync_per_output);
+        auto output_memory = m_internal_outputs.at(internal_name).get_memory(do_sync_per_output && !overlap_copy);
         auto output_layout = m_internal_outputs.at(internal_name).get_layout();
+        auto producer_event = overlap_copy ? m_internal_outputs.at(internal_name).get_event() : nullptr;
+        bool readback_chained = false;
 
         if (output_memory) {
             OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "SyncInferRequest::wait::reinterpret_memory");
@@ -376,7 +395,17 @@ void SyncInferRequest::wait() {
             if (!same_mem && output_memory->size()) {
                 GPU_DEBUG_TRACE_DETAIL << internal_name << " with index " << port_idx << " copy from: " << output_memory->buffer_ptr() << " to "
                                        << (!is_remote ? output_tensor->data() : remote_ptr->get_original_memory()->buffer_ptr()) << std::endl;
-                if (auto ev = copy_output_data(output_memory, *output_tensor)) {
+                auto& copy_stream = overlap_copy ? *m_copy_stream : network.get_stream();
+                if (overlap_copy) {
+                    if (m_copy_stream->enqueue_dependency_barrier({producer_event})) {
+                        readback_chained = true;
+                    } else {
+                        // the producer completion is not expressible at the queue level (e.g. the
+                        // output is optimized out), fall back to the full sync of the old path
+                        network.get_stream().finish();
+                    }
+                }
+                if (auto ev = copy_output_data(output_memory, *output_tensor, copy_stream)) {
                     copy_events.push_back(ev);
                 }
             }
@@ -386,18 +415,47 @@ void SyncInferRequest::wait() {
             if (user_mem->get_allocation_type() == cldnn::allocation_type::cl_mem && output_memory->get_allocation_type() != cldnn::allocation_type::cl_mem) {
                 // WA: Copy between cl_mem and usm memory may fail for some reason (driver bug?)
                 // so this explicit memcpy is used to provide correct output for cl_mem output in dynamic cases
+                if (overlap_copy)
+                    stream.finish();
                 cldnn::mem_lock<uint8_t, cldnn::mem_lock_type::write> lock_dst(user_mem, stream);
                 cldnn::mem_lock<uint8_t, cldnn::mem_lock_type::read> lock_src(output_memory, stream);
                 std::memcpy(lock_dst.data(), lock_src.data(), output_memory->size());
+            } else if (overlap_copy) {
+                if (m_copy_stream->enqueue_dependency_barrier({producer_event})) {
+                    readback_chained = true;
+                } else {
+                    stream.finish();
+                }
+                copy_events.push_back(output_memory->copy_to(*m_copy_stream, *user_mem, false));
             } else {
                 copy_events.push_back(output_memory->copy_to(stream, *user_mem, false));
             }
         }
+
+        // an output which got no chained copy (direct write to the user memory, remote tensor or
+        // a host-synchronized fallback above) still has to be completed before returning
+        if (overlap_copy && !readback_chained) {
+            if (do_sync_per_output) {
+                copy_events.push_back(producer_event);  // event wait, same as the old per-output sync
+            } else {
+                // the event of an in-order queue output may be improper in some cases
+                // (see network_output::get_memory), fall back to the full queue sync
+                needs_main_sync = true;
+            }
+        }
     }
 
+    if (needs_main_sync)
+        network.get_stream().finish();
+
     if (!copy_events.empty()) {
         auto& stream = network.get_stream();
-        if (stream.get_queue_type() == QueueTypes::in_order) {
+        if (overlap_copy) {
+            // the copies were enqueued non-blocking to the side queue, push them to the device
+            // before the host wait
+            m_copy_stream->flush();
+            m_copy_stream->wait_for_events(copy_events);
+        } else if (stream.get_queue_type() == QueueTypes::in_order) {
             // wait only the last one
             stream.wait_for_events({copy_events.back()});
         } else {
@@ -490,7 +548,9 @@ TensorWrapper SyncInferRequest::create_or_share_device_tensor(const TensorWrappe
     return { create_device_tensor(actual_memory_shape, element_type, need_lockable_mem), TensorOwner::PLUGIN };
 }
 
-cldnn::event::ptr SyncInferRequest::copy_output_data(cldnn::memory::ptr src, const ov::ITensor& dst) const {
+cldnn::event::ptr SyncInferRequest::copy_output_data(cldnn::memory::ptr src,
+                                                     const ov::ITensor& dst,
+                                                     cldnn::stream& stream) const {
     OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "SyncInferRequest::copy_output_data");
     OPENVINO_ASSERT(src->count() <= dst.get_size(),
                     "[GPU] Unexpected elements count of dst tensor: ",
@@ -498,7 +558,6 @@ cldnn::event::ptr SyncInferRequest::copy_output_data(cldnn::memory::ptr src, con
                     "only ", dst.get_size(), " got");
 
     const auto& layout = src->get_layout();
-    auto& stream = m_graph->get_network()->get_stream();
 
     if (is_convert_required(layout.data_type, dst.get_element_type())) {
         convert_and_copy(src, &dst, stream);
@@ -762,6 +821,22 @@ std::vector<cldnn::event::ptr> SyncInferRequest::prepare_input(const std::string
     if (!is_remote && !convert_needed) {
         auto src_ptr = static_cast<uint8_t*>(user_tensor->data());
         if (!same_host_mem(memory, src_ptr)) {
+            // On dGPU an upload from pageable user memory makes the driver stage and synchronize
+            // internally, so route it through a persistent pinned (USM host) buffer: the host copy
+            // lands in pinned memory and the enqueued write becomes a pure asynchronous DMA
+            bool use_staging = engine.get_device_info().dev_type == cldnn::device_type::discrete_gpu &&
+                               engine.use_unified_shared_memory() &&
+                               can_use_usm_host(engine) &&
+                               user_tensor_mem_type == cldnn::allocation_type::unknown;
+            if (use_staging) {
+                auto staging = m_staging_inputs.count(input_idx) ? m_staging_inputs.at(input_idx) : nullptr;
+                if (!staging || staging->get_byte_size() < user_tensor->get_byte_size()) {
+                    staging = m_context->create_host_tensor(element_type, user_tensor->get_shape())._ptr;
+                    m_staging_inputs[input_idx] = staging;
+                }
+                std::memcpy(staging->data(), src_ptr, user_tensor->get_byte_size());
+                src_ptr = static_cast<uint8_t*>(staging->data());
+            }
             ret_event = memory->copy_from(stream, src_ptr, false);
         }
     }
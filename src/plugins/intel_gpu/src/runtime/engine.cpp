@@ -194,6 +194,11 @@ memory_ptr engine::share_surface(const layout& layout, shared_surface surf, uint
     shared_mem_params params = { shared_mem_type::shared_mem_vasurface, nullptr, nullptr, nullptr, surf, plane };
     return reinterpret_handle(layout, params);
 }
+
+memory_ptr engine::share_dma_buf(const layout& layout, shared_handle fd) {
+    shared_mem_params params = { shared_mem_type::shared_mem_dmabuf, nullptr, nullptr, fd, 0, 0 };
+    return reinterpret_handle(layout, params);
+}
 #endif  // _WIN32
 
 uint64_t engine::get_max_used_device_memory() const {
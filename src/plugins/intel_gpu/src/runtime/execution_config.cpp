@@ -23,6 +23,17 @@ public:
     }
 };
 
+class ModelDistributionPolicyValidator : public BaseValidator {
+public:
+    bool is_valid(const ov::Any& v) const override {
+        // The GPU plugin has no multi-device distribution mode implemented yet (tensor parallel
+        // execution across iGPU+dGPU requires weights splitting and cross-device reduction which
+        // the runtime does not provide), so only the empty policy set is accepted. Registering the
+        // property still lets applications query the supported policies instead of probing by error.
+        return v.as<std::set<ov::hint::ModelDistributionPolicy>>().empty();
+    }
+};
+
 class PerformanceModeValidator : public BaseValidator {
 public:
     bool is_valid(const ov::Any& v) const override {
@@ -46,6 +57,9 @@ void ExecutionConfig::set_default() {
         std::make_tuple(ov::hint::execution_mode, ov::hint::ExecutionMode::PERFORMANCE),
         std::make_tuple(ov::hint::num_requests, 0),
         std::make_tuple(ov::hint::enable_cpu_pinning, false),
+        std::make_tuple(ov::hint::model_distribution_policy,
+                        std::set<ov::hint::ModelDistributionPolicy>{},
+                        ModelDistributionPolicyValidator()),
 
         std::make_tuple(ov::intel_gpu::hint::host_task_priority, ov::hint::Priority::MEDIUM),
         std::make_tuple(ov::intel_gpu::hint::queue_throttle, ov::intel_gpu::hint::ThrottleLevel::MEDIUM),
@@ -14,6 +14,7 @@
 #include "intel_gpu/runtime/debug_configuration.hpp"
 #include "intel_gpu/runtime/itt.hpp"
 #include "intel_gpu/runtime/file_util.hpp"
+#include "intel_gpu/runtime/lru_cache.hpp"
 
 #ifdef WIN32
 #include <sdkddkver.h>
@@ -23,6 +24,7 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <sstream>
 #include <fstream>
@@ -37,7 +39,41 @@
 #endif
 
 namespace {
-std::mutex cacheAccessMutex;
+// the persistent cache is sharded into per-batch files named by the batch hash; stripe the
+// locks by the same hash so parallel builds only serialize on I/O to the same shard
+constexpr size_t cacheAccessStripes = 16;
+std::array<std::mutex, cacheAccessStripes> cacheAccessMutex;
+
+std::mutex& getCacheAccessMutex(size_t hash_value) {
+    return cacheAccessMutex[hash_value % cacheAccessStripes];
+}
+
+// Process-wide store of compiled batch binaries keyed by the same content hash as the persistent
+// cache files (compilation options + driver version + device name + full source code), so programs
+// built for different models in one process reuse each other's compilation results even when the
+// on-disk model cache is disabled. Capacity is counted in batches; at several hundred KB per batch
+// binary the worst case stays within a ~100 MB budget.
+constexpr size_t processBinariesCacheCapacity = 512;
+
+std::mutex& getProcessBinariesMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+cldnn::LruCache<size_t, std::vector<uint8_t>>& getProcessBinariesCache() {
+    static cldnn::LruCache<size_t, std::vector<uint8_t>> cache(processBinariesCacheCapacity);
+    return cache;
+}
+
+std::vector<uint8_t> findProcessBinaries(size_t hash_value) {
+    std::lock_guard<std::mutex> lock(getProcessBinariesMutex());
+    return getProcessBinariesCache().get(hash_value);
+}
+
+void addProcessBinaries(size_t hash_value, const std::vector<uint8_t>& bin) {
+    std::lock_guard<std::mutex> lock(getProcessBinariesMutex());
+    getProcessBinariesCache().add(hash_value, bin);
+}
 
 std::string reorder_options(const std::string& org_options) {
     std::stringstream ss(org_options);
@@ -233,17 +269,19 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
     std::string cached_bin_name = get_cache_path() + std::to_string(batch.hash_value) + ".cl_cache";
     cl::Program::Binaries precompiled_kernels = {};
 
-    if (is_cache_enabled()) {
+    // Check the process-wide binaries store first: a program built for another model in this
+    // process may have already compiled exactly the same batch
+    std::vector<uint8_t> bin = findProcessBinaries(batch.hash_value);
+
+    if (bin.empty() && is_cache_enabled()) {
         // Try to load file with name ${hash_value}.cl_cache which contains precompiled kernels for current bucket
         // If read is successful, then remove kernels from compilation bucket
-        std::vector<uint8_t> bin;
-        {
-            std::lock_guard<std::mutex> lock(cacheAccessMutex);
-            bin = ov::util::load_binary(cached_bin_name);
-        }
-        if (!bin.empty()) {
-            precompiled_kernels.push_back(bin);
-        }
+        std::lock_guard<std::mutex> lock(getCacheAccessMutex(batch.hash_value));
+        bin = ov::util::load_binary(cached_bin_name);
+    }
+    if (!bin.empty()) {
+        addProcessBinaries(batch.hash_value, bin);
+        precompiled_kernels.push_back(std::move(bin));
     }
     try {
         cl::vector<cl::Kernel> kernels;
@@ -267,13 +305,15 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
 
             program.createKernels(&kernels);
 
+            auto program_bin = getProgramBinaries(program);
+            addProcessBinaries(batch.hash_value, program_bin);
             if (is_cache_enabled()) {
                 // If kernels caching is enabled, then we save compiled bucket to binary file with name ${code_hash_value}.cl_cache
                 // Note: Bin file contains full bucket, not separate kernels, so kernels reuse across different models is quite limited
                 // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
                 // compile time.
-                std::lock_guard<std::mutex> lock(cacheAccessMutex);
-                ov::intel_gpu::save_binary(cached_bin_name, getProgramBinaries(program));
+                std::lock_guard<std::mutex> lock(getCacheAccessMutex(batch.hash_value));
+                ov::intel_gpu::save_binary(cached_bin_name, program_bin);
             }
         } else {
             cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
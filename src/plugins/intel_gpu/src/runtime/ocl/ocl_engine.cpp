@@ -244,6 +244,9 @@ memory::ptr ocl_engine::reinterpret_handle(const layout& new_layout, shared_mem_
 #ifdef _WIN32
         } else if (params.mem_type == shared_mem_type::shared_mem_dxbuffer) {
             return std::make_shared<ocl::gpu_dx_buffer>(this, new_layout, params);
+#else
+        } else if (params.mem_type == shared_mem_type::shared_mem_dmabuf) {
+            return std::make_shared<ocl::gpu_dmabuf_buffer>(this, new_layout, params);
 #endif
         } else if (params.mem_type == shared_mem_type::shared_mem_buffer) {
             cl::Buffer buf(static_cast<cl_mem>(params.mem), true);
@@ -33,6 +33,34 @@ typedef cl_va_api_device_set_intel    cl_device_set_intel;
 
 #include <sstream>
 
+/***************************************************************
+* cl_khr_external_memory
+***************************************************************/
+
+#if !defined(cl_khr_external_memory)
+#define cl_khr_external_memory 1
+
+typedef cl_uint cl_external_memory_handle_type_khr;
+
+/* cl_mem_properties entry to import a dma_buf file descriptor */
+#define CL_EXTERNAL_MEMORY_HANDLE_DMA_BUF_KHR                   0x2067
+
+/* cl_device_info */
+#define CL_DEVICE_EXTERNAL_MEMORY_IMPORT_HANDLE_TYPES_KHR       0x204F
+
+#endif  // cl_khr_external_memory
+
+typedef cl_ulong cl_mem_properties_khr;
+
+typedef cl_mem (CL_API_CALL *
+clCreateBufferWithProperties_fn)(
+            cl_context context,
+            const cl_mem_properties_khr* properties,
+            cl_mem_flags flags,
+            size_t size,
+            void* host_ptr,
+            cl_int* errcode_ret);
+
 /********************************************
 * cl_intel_required_subgroup_size extension *
 *********************************************/
@@ -454,6 +454,35 @@ shared_mem_params gpu_dx_buffer::get_internal_params() const {
     return {shared_mem_type::shared_mem_dxbuffer, static_cast<shared_handle>(cl_engine->get_cl_context().get()), device,
             static_cast<shared_handle>(_buffer.get()), resource, 0 };
 }
+#else
+static cl::Buffer import_dma_buf(ocl_engine* engine, const layout& new_layout, const shared_mem_params& params) {
+    // cl_khr_external_memory is an OpenCL 3.0 extension, so the entrypoint is loaded dynamically
+    // to keep compatibility with the older ICDs which do not export the symbol
+    auto context = engine->get_cl_context().get();
+    const std::string fname = "clCreateBufferWithProperties";
+    auto create_buffer_fn = try_load_entrypoint<clCreateBufferWithProperties_fn>(context, fname);
+    if (!create_buffer_fn)
+        throw std::runtime_error("[GPU] dma_buf import failed: clCreateBufferWithProperties entrypoint is not found");
+    cl_mem_properties_khr props[] = {CL_EXTERNAL_MEMORY_HANDLE_DMA_BUF_KHR,
+                                     static_cast<cl_mem_properties_khr>(reinterpret_cast<uintptr_t>(params.mem)),
+                                     0};
+    cl_int err = CL_SUCCESS;
+    cl_mem mem = create_buffer_fn(context, props, CL_MEM_READ_WRITE, new_layout.bytes_count(), nullptr, &err);
+    if (err != CL_SUCCESS)
+        throw cl::Error(err, "clCreateBufferWithProperties");
+    return cl::Buffer(mem, false);
+}
+
+gpu_dmabuf_buffer::gpu_dmabuf_buffer(ocl_engine* engine,
+                                     const layout& new_layout,
+                                     shared_mem_params params)
+    : gpu_buffer(engine, new_layout, import_dma_buf(engine, new_layout, params), nullptr) { }
+
+shared_mem_params gpu_dmabuf_buffer::get_internal_params() const {
+    auto cl_engine = downcast<const ocl_engine>(_engine);
+    return {shared_mem_type::shared_mem_dmabuf, static_cast<shared_handle>(cl_engine->get_cl_context().get()), nullptr,
+            static_cast<shared_handle>(_buffer.get()), 0, 0 };
+}
 #endif
 
 gpu_usm::gpu_usm(ocl_engine* engine, const layout& new_layout, const cl::UsmMemory& buffer, allocation_type type, std::shared_ptr<MemoryTracker> mem_tracker)
@@ -102,6 +102,11 @@ private:
     void* device;
     void* resource;
 };
+#else
+struct gpu_dmabuf_buffer : public gpu_buffer {
+    gpu_dmabuf_buffer(ocl_engine* engine, const layout& new_layout, shared_mem_params params);
+    shared_mem_params get_internal_params() const override;
+};
 #endif
 
 struct gpu_usm : public lockable_gpu_mem, public memory {
@@ -361,6 +361,28 @@ event::ptr ocl_stream::enqueue_marker(std::vector<event::ptr> const& deps, bool
     }
 }
 
+event::ptr ocl_stream::enqueue_dependency_barrier(const std::vector<event::ptr>& deps) {
+    std::vector<cl::Event> dep_events;
+    for (auto& dep : deps) {
+        // Only a plain queue event carries a dependency which is valid across queues. Grouped and
+        // user events would silently narrow the wait list, so refuse them and let the caller
+        // synchronize on the host instead.
+        auto ocl_ev = dynamic_cast<ocl_event*>(dep.get());
+        if (ocl_ev == nullptr || ocl_ev->get().get() == nullptr)
+            return nullptr;
+        dep_events.push_back(ocl_ev->get());
+    }
+
+    cl::Event ret_ev;
+    try {
+        _command_queue.enqueueBarrierWithWaitList(dep_events.empty() ? nullptr : &dep_events, &ret_ev);
+    } catch (cl::Error const& err) {
+        OPENVINO_THROW(OCL_ERR_MSG_FMT(err));
+    }
+
+    return std::make_shared<ocl_event>(ret_ev, ++_queue_counter);
+}
+
 event::ptr ocl_stream::group_events(std::vector<event::ptr> const& deps) {
     return std::make_shared<ocl_events>(deps);
 }
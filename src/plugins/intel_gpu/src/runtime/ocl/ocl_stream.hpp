@@ -73,6 +73,7 @@ public:
                               std::vector<event::ptr> const& deps,
                               bool is_output = false) override;
     event::ptr enqueue_marker(std::vector<event::ptr> const& deps, bool is_output) override;
+    event::ptr enqueue_dependency_barrier(const std::vector<event::ptr>& deps) override;
     event::ptr group_events(std::vector<event::ptr> const& deps) override;
     void wait_for_events(const std::vector<event::ptr>& events) override;
     void enqueue_barrier() override;
@@ -450,6 +450,29 @@ INSTANTIATE_TEST_SUITE_P(fusings_gpu, eltwise_fp32_fused_prims, ::testing::Value
     eltwise_test_params{ CASE_ELTWISE_U8_4, 3, 5 },
 }));
 
+class eltwise_diamond_fused_prims : public EltwiseFusingTest {};
+TEST_P(eltwise_diamond_fused_prims, eltwise_chain_with_reconvergence) {
+    auto p = GetParam();
+    create_topologies(
+        input_layout("input", get_input_layout(p)),
+        input_layout("input2", get_input_layout2(p)),
+        data("eltwise_data", get_mem(get_input_layout2(p), -10, 10)),
+        eltwise("eltwise1", { input_info("input"), input_info("input2") }, p.mode, data_types::f32),
+        eltwise("eltwise2", { input_info("eltwise1"), input_info("eltwise_data") }, eltwise_mode::prod, p.default_type),
+        eltwise("eltwise3", { input_info("eltwise1"), input_info("eltwise2") }, eltwise_mode::sum, p.default_type),
+        reorder("out", input_info("eltwise3"), p.default_format, data_types::f32)
+    );
+
+    tolerance = default_tolerance(p.input_type);
+    execute(p);
+}
+
+INSTANTIATE_TEST_SUITE_P(fusings_gpu, eltwise_diamond_fused_prims, ::testing::ValuesIn(std::vector<eltwise_test_params>{
+    eltwise_test_params{ CASE_ELTWISE_FP32_1, 3, 5 },
+    eltwise_test_params{ CASE_ELTWISE_FP32_2, 3, 5 },
+    eltwise_test_params{ CASE_ELTWISE_FP16_1, 3, 5 },
+}));
+
 class eltwise_reorder_eltwise_fp32_fused_prims : public EltwiseFusingTest {};
 TEST_P(eltwise_reorder_eltwise_fp32_fused_prims, eltwise_activation) {
     auto p = GetParam();
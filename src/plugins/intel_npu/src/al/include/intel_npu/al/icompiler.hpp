@@ -18,6 +18,7 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/tensor.hpp"
 
 namespace intel_npu {
 
@@ -75,6 +76,16 @@ struct NetworkDescription final {
     NetworkDescription(std::vector<uint8_t>&& compiledNetwork, NetworkMetadata&& metadata)
         : compiledNetwork(std::move(compiledNetwork)),
           metadata(std::move(metadata)) {}
+    // Zero-copy variant: the compiled network is a borrowed view into an externally owned buffer
+    // (e.g. a memory mapped blob adopted on import), "networkOwner" keeps the buffer alive
+    NetworkDescription(const uint8_t* networkData,
+                       size_t networkSize,
+                       ov::Tensor&& networkOwner,
+                       NetworkMetadata&& metadata)
+        : metadata(std::move(metadata)),
+          compiledNetworkView(networkData),
+          compiledNetworkViewSize(networkSize),
+          compiledNetworkOwner(std::move(networkOwner)) {}
     // Force move semantics to prevent blob copies
     NetworkDescription(const NetworkDescription&) = delete;
     NetworkDescription(NetworkDescription&&) = default;
@@ -82,9 +93,23 @@ struct NetworkDescription final {
     NetworkDescription& operator=(NetworkDescription&&) = default;
     ~NetworkDescription() = default;
 
+    const uint8_t* data() const {
+        return compiledNetworkView != nullptr ? compiledNetworkView : compiledNetwork.data();
+    }
+
+    size_t size() const {
+        return compiledNetworkView != nullptr ? compiledNetworkViewSize : compiledNetwork.size();
+    }
+
     std::vector<uint8_t> compiledNetwork;
 
     NetworkMetadata metadata;
+
+    // Set only for the zero-copy variant, "compiledNetwork" stays empty then and the blob has to be
+    // accessed through "data()"/"size()"
+    const uint8_t* compiledNetworkView = nullptr;
+    size_t compiledNetworkViewSize = 0;
+    ov::Tensor compiledNetworkOwner;
 };
 
 /**
@@ -136,6 +161,16 @@ public:
                                                                     const std::vector<uint8_t>& network,
                                                                     const Config& config) const = 0;
 
+    /**
+     * @brief Same as parse(network, config) but over a borrowed buffer, so that a memory mapped
+     *        blob can be parsed without materializing a copy of it first
+     * @details The default implementation copies the buffer and falls back to the vector overload,
+     *          so compilers which do not care about the zero-copy path need no changes
+     */
+    virtual NetworkMetadata parse(const uint8_t* network, size_t size, const Config& config) const {
+        return parse(std::vector<uint8_t>(network, network + size), config);
+    }
+
 protected:
     virtual ~ICompiler() = default;
 };
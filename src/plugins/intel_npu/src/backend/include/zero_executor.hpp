@@ -7,6 +7,8 @@
 #include <ze_api.h>
 #include <ze_graph_ext.h>
 
+#include <mutex>
+
 #include "intel_npu/utils/logger/logger.hpp"
 #include "npu.hpp"
 #include "zero_init.hpp"
@@ -53,6 +55,11 @@ public:
     inline const std::unordered_map<std::string, ArgumentDescriptor>& outputs_desc_map() const {
         return _outputs_desc_map;
     }
+    // Guards argument binding and command list recording on the shared graph handle, so that
+    // pipelines for concurrently created infer requests do not interleave
+    inline std::mutex& mutex() const {
+        return _mutex;
+    }
 
 private:
     const Config _config;
@@ -71,6 +78,8 @@ private:
     std::unordered_map<std::string, ArgumentDescriptor> _outputs_desc_map;
 
     std::array<std::shared_ptr<CommandQueue>, stage::COUNT> _command_queues;
+
+    mutable std::mutex _mutex;
 };
 
 }  // namespace intel_npu
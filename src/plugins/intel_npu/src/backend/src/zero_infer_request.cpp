@@ -294,8 +294,12 @@ std::vector<ov::ProfilingInfo> ZeroInferRequest::get_profiling_info() const {
         // processing to the compiler
         const auto& networkDesc = compiledModel.get_network_description();
         const auto& compiler = compiledModel.get_compiler();
-        const auto& blob = networkDesc->compiledNetwork;
         auto profData = get_raw_profiling_data();
+        if (!networkDesc->compiledNetwork.empty()) {
+            return compiler->process_profiling_output(profData, networkDesc->compiledNetwork, compilerConfig);
+        }
+        // the blob was adopted zero-copy from a memory mapped buffer, materialize it for the call
+        const std::vector<uint8_t> blob(networkDesc->data(), networkDesc->data() + networkDesc->size());
         return compiler->process_profiling_output(profData, blob, compilerConfig);
     } else {
         auto proftype = _config.get<PROFILING_TYPE>();
@@ -7,6 +7,7 @@
 #include <ze_api.h>
 #include <ze_graph_ext.h>
 
+#include "intel_npu/al/config/runtime.hpp"
 #include "intel_npu/al/itt.hpp"
 #include "intel_npu/al/prefix.hpp"
 #include "intel_npu/utils/logger/logger.hpp"
@@ -147,13 +148,13 @@ public:
                        const std::shared_ptr<const IExecutor>& executorPtr,
                        ze_graph_profiling_query_handle_t profiling_handle,
                        std::shared_ptr<zeroProfiling::NpuInferProfiling> npu_profiling,
-                       CommandQueue& command_queue,
+                       std::unique_ptr<CommandQueue> command_queue,
                        const uint32_t& group_ordinal,
                        std::unordered_map<std::string, std::shared_ptr<ov::ITensor>>& tensors)
         : _config(config),
-          _command_queue{command_queue},
+          _command_queue{std::move(command_queue)},
           _command_list{device_handle, context, graph_ddi_table_ext, _config, group_ordinal},
-          _fence{_command_queue, _config},
+          _fence{*_command_queue, _config},
           _event_pool{device_handle, context, 1, _config},
           _event{_event_pool.handle(), 0, _config},
           _npu_profiling(npu_profiling) {
@@ -201,9 +202,9 @@ public:
     void push() override {
         OV_ITT_TASK_CHAIN(ZERO_EXECUTOR_IP_PUSH, itt::domains::LevelZeroBackend, "IntegratedPipeline", "push");
         if (sync_output_with_fences_) {
-            _command_queue.executeCommandList(_command_list, _fence);
+            _command_queue->executeCommandList(_command_list, _fence);
         } else {
-            _command_queue.executeCommandList(_command_list);
+            _command_queue->executeCommandList(_command_list);
         }
     };
 
@@ -230,7 +231,7 @@ public:
 
 private:
     const Config _config;
-    CommandQueue& _command_queue;
+    std::unique_ptr<CommandQueue> _command_queue;
     CommandList _command_list;
     Fence _fence;
     EventPool _event_pool;
@@ -262,6 +263,16 @@ std::unique_ptr<Pipeline> makePipeline(const std::shared_ptr<const IExecutor>& e
     zeroUtils::throwOnFail("zeDeviceGetProperties", zeDeviceGetProperties(device_handle, &properties));
 
     if (properties.flags & ZE_DEVICE_PROPERTY_FLAG_INTEGRATED) {
+        // A dedicated execute queue per request lets the driver schedule independent inferences
+        // concurrently across the available tiles instead of serializing them on the single
+        // executor-wide queue; the graph handle (and with it the weights) stays shared
+        auto command_queue = std::make_unique<CommandQueue>(device_handle,
+                                                            context,
+                                                            zeroUtils::toZeQueuePriority(config.get<MODEL_PRIORITY>()),
+                                                            config,
+                                                            group_ordinal);
+        // argument binding and command list recording act on the shared graph handle
+        std::lock_guard<std::mutex> lock(executor->mutex());
         return std::make_unique<IntegratedPipeline>(config,
                                                     device_handle,
                                                     context,
@@ -269,11 +280,12 @@ std::unique_ptr<Pipeline> makePipeline(const std::shared_ptr<const IExecutor>& e
                                                     executorPtr,
                                                     profiling_query.getHandle(),
                                                     npu_profiling,
-                                                    *command_queues[stage::EXECUTE],
+                                                    std::move(command_queue),
                                                     group_ordinal,
                                                     tensors);
     }
 
+    std::lock_guard<std::mutex> lock(executor->mutex());
     return std::make_unique<DiscretePipeline>(config,
                                               device_handle,
                                               context,
@@ -30,6 +30,8 @@ public:
 
     NetworkMetadata parse(const std::vector<uint8_t>& network, const Config& config) const override final;
 
+    NetworkMetadata parse(const uint8_t* network, size_t size, const Config& config) const override final;
+
     std::vector<ov::ProfilingInfo> process_profiling_output(const std::vector<uint8_t>& profData,
                                                             const std::vector<uint8_t>& network,
                                                             const Config& config) const override final;
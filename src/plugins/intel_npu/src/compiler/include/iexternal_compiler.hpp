@@ -38,7 +38,7 @@ public:
     virtual NetworkDescription compileIR(const std::shared_ptr<const ov::Model>& model,
                                          IR& irModel,
                                          const Config& config) const = 0;
-    virtual NetworkMetadata parseBlob(const std::vector<uint8_t>& blob, const Config& config) const = 0;
+    virtual NetworkMetadata parseBlob(const uint8_t* blobData, size_t blobSize, const Config& config) const = 0;
 };
 }  // namespace driverCompilerAdapter
 }  // namespace intel_npu
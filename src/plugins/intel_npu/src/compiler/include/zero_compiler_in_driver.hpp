@@ -54,7 +54,7 @@ public:
                                  IR& irModel,
                                  const Config& config) const override final;
 
-    NetworkMetadata parseBlob(const std::vector<uint8_t>& blob, const Config& config) const override final;
+    NetworkMetadata parseBlob(const uint8_t* blobData, size_t blobSize, const Config& config) const override final;
 
     template <typename T = TableExtension, std::enable_if_t<!NotSupportQuery(T), bool> = true>
     std::unordered_set<std::string> getQueryResultFromSupportedLayers(
@@ -218,9 +218,13 @@ ov::SupportedOpsMap LevelZeroCompilerAdapter::query(const std::shared_ptr<const
 }
 
 NetworkMetadata LevelZeroCompilerAdapter::parse(const std::vector<uint8_t>& blob, const Config& config) const {
+    return parse(blob.data(), blob.size(), config);
+}
+
+NetworkMetadata LevelZeroCompilerAdapter::parse(const uint8_t* blob, size_t size, const Config& config) const {
     _logger.setLevel(config.get<LOG_LEVEL>());
     _logger.debug("parseBlob");
-    return apiAdapter->parseBlob(blob, config);
+    return apiAdapter->parseBlob(blob, size, config);
 }
 
 std::vector<ov::ProfilingInfo> LevelZeroCompilerAdapter::process_profiling_output(const std::vector<uint8_t>&,
@@ -798,21 +798,22 @@ NetworkDescription LevelZeroCompilerInDriver<TableExtension>::compileIR(const st
 }
 
 template <typename TableExtension>
-NetworkMetadata LevelZeroCompilerInDriver<TableExtension>::parseBlob(const std::vector<uint8_t>& blob,
+NetworkMetadata LevelZeroCompilerInDriver<TableExtension>::parseBlob(const uint8_t* blobData,
+                                                                     size_t blobSize,
                                                                      const Config& config) const {
     OV_ITT_TASK_CHAIN(PARSE_BLOB, itt::domains::NPUPlugin, "LevelZeroCompilerInDriver::parseBlob", "desc");
     _logger.setLevel(config.get<LOG_LEVEL>());
     _logger.debug("getNetworkMeta");
     ze_graph_handle_t graphHandle;
 
-    if (!blob.empty()) {
+    if (blobData != nullptr && blobSize != 0) {
         _logger.debug("Import network case");
         ze_graph_format_t format = ZE_GRAPH_FORMAT_NATIVE;
         ze_graph_desc_t desc{ZE_STRUCTURE_TYPE_GRAPH_DESC_PROPERTIES,
                              nullptr,
                              format,
-                             blob.size(),
-                             blob.data(),
+                             blobSize,
+                             blobData,
                              nullptr};
 
         auto result = _graphDdiTableExt->pfnCreate(_context, _deviceHandle, &desc, &graphHandle);
@@ -27,10 +27,10 @@ constexpr std::string_view NO_EXECUTOR_FOR_INFERENCE =
     "Can't create infer request!\n"
     "Please make sure that the device is available. Only exports can be made.";
 
-std::uint32_t hash(const std::vector<uint8_t>& data) {
+std::uint32_t hash(const uint8_t* data, const size_t size) {
     std::uint32_t result = 1171117u;
-    for (const auto& c : data)
-        result = ((result << 7) + result) + static_cast<uint32_t>(c);
+    for (size_t i = 0; i < size; ++i)
+        result = ((result << 7) + result) + static_cast<uint32_t>(data[i]);
     return result;
 }
 
@@ -111,11 +111,12 @@ std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request(
 }
 
 void CompiledModel::export_model(std::ostream& stream) const {
-    const auto& blob = _networkPtr->compiledNetwork;
-    stream.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+    const auto* blobData = _networkPtr->data();
+    const auto blobSize = _networkPtr->size();
+    stream.write(reinterpret_cast<const char*>(blobData), blobSize);
 
     std::stringstream str;
-    str << "Blob size: " << blob.size() << ", hash: " << std::hex << hash(blob);
+    str << "Blob size: " << blobSize << ", hash: " << std::hex << hash(blobData, blobSize);
     _logger.info(str.str().c_str());
 }
 
@@ -555,7 +555,16 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& stream, c
     OV_ITT_SCOPED_TASK(itt::domains::NPUPlugin, "Plugin::import_model");
 
     OV_ITT_TASK_CHAIN(PLUGIN_IMPORT_MODEL, itt::domains::NPUPlugin, "Plugin::import_model", "merge_configs");
-    auto localConfig = merge_configs(_globalConfig, any_copy(properties), OptionMode::RunTime);
+    // When the core read the blob through a memory mapping, it exposes the mapped buffer here so
+    // the plugin can parse the blob in place instead of copying it out of the stream
+    ov::Tensor mappedBlob;
+    auto npuProperties = properties;
+    auto mappedBlobMatch = npuProperties.find(ov::internal::cached_model_buffer.name());
+    if (mappedBlobMatch != npuProperties.end()) {
+        mappedBlob = mappedBlobMatch->second.as<ov::Tensor>();
+        npuProperties.erase(mappedBlobMatch);
+    }
+    auto localConfig = merge_configs(_globalConfig, any_copy(npuProperties), OptionMode::RunTime);
     const auto platform = _backends->getCompilationPlatform(localConfig.get<PLATFORM>(), localConfig.get<DEVICE_ID>());
     localConfig.update({{ov::intel_npu::platform.name(), platform}});
     auto device = _backends->getDevice(localConfig.get<DEVICE_ID>());
@@ -578,19 +587,38 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& stream, c
         if (graphSize == 0) {
             OPENVINO_THROW("Blob is empty");
         }
-        std::vector<uint8_t> blob(graphSize);
-        stream.read(reinterpret_cast<char*>(blob.data()), graphSize);
 
-        auto meta = compiler->parse(blob, localConfig);
-        meta.name = "net" + std::to_string(_compiledModelLoadCounter++);
+        std::shared_ptr<const NetworkDescription> networkDescription;
+        if (mappedBlob) {
+            // zero-copy path: the stream position marks where the core stopped after consuming the
+            // header, the rest of the mapped buffer is the blob itself
+            const auto blobOffset = static_cast<size_t>(stream.tellg());
+            OPENVINO_ASSERT(blobOffset + graphSize <= mappedBlob.get_byte_size(),
+                            "Mapped blob is smaller than the stream reports");
+            const auto* blobData = static_cast<const uint8_t*>(mappedBlob.data()) + blobOffset;
+            stream.seekg(graphSize, std::ios_base::cur);
+
+            auto meta = compiler->parse(blobData, graphSize, localConfig);
+            meta.name = "net" + std::to_string(_compiledModelLoadCounter++);
+            networkDescription = std::make_shared<const NetworkDescription>(blobData,
+                                                                            graphSize,
+                                                                            std::move(mappedBlob),
+                                                                            std::move(meta));
+        } else {
+            std::vector<uint8_t> blob(graphSize);
+            stream.read(reinterpret_cast<char*>(blob.data()), graphSize);
 
+            auto meta = compiler->parse(blob, localConfig);
+            meta.name = "net" + std::to_string(_compiledModelLoadCounter++);
+            networkDescription = std::make_shared<const NetworkDescription>(std::move(blob), std::move(meta));
+        }
+
+        const auto& meta = networkDescription->metadata;
         const std::shared_ptr<ov::Model> modelDummy =
             create_dummy_model(meta.parameters, meta.results, meta.inputNames, meta.outputNames);
 
         bool profiling = localConfig.get<PERF_COUNT>();
 
-        auto networkDescription = std::make_shared<const NetworkDescription>(std::move(blob), std::move(meta));
-
         compiledModel = std::make_shared<CompiledModel>(modelDummy,
                                                         shared_from_this(),
                                                         networkDescription,
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
@@ -12,10 +13,17 @@
 namespace ov {
 namespace proxy {
 
+class RemoteContext;
+
 class InferRequest : public ov::IAsyncInferRequest {
 private:
     ov::SoPtr<ov::IAsyncInferRequest> m_infer_request;
     std::shared_ptr<const ov::ICompiledModel> m_compiled_model;
+    // proxy context resolved once and reused on per-call tensor wrapping
+    mutable std::shared_ptr<RemoteContext> m_wrap_context;
+    mutable std::once_flag m_wrap_context_once;
+
+    const std::shared_ptr<RemoteContext>& get_wrap_context() const;
 
 public:
     InferRequest(ov::SoPtr<ov::IAsyncInferRequest>&& request,
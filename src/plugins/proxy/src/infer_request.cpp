@@ -47,14 +47,23 @@ std::vector<ov::ProfilingInfo> ov::proxy::InferRequest::get_profiling_info() con
     return m_infer_request->get_profiling_info();
 }
 
+const std::shared_ptr<ov::proxy::RemoteContext>& ov::proxy::InferRequest::get_wrap_context() const {
+    // the binding to the hardware context never changes after the model is compiled,
+    // resolve it once instead of translating through get_context() on every call
+    std::call_once(m_wrap_context_once, [this]() {
+        auto remote_context = std::dynamic_pointer_cast<ov::proxy::RemoteContext>(m_compiled_model->get_context()._ptr);
+        OPENVINO_ASSERT(remote_context);
+        m_wrap_context = remote_context;
+    });
+    return m_wrap_context;
+}
+
 ov::SoPtr<ov::ITensor> ov::proxy::InferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
     auto tensor = m_infer_request->get_tensor(port);
     if (!tensor._so)
         tensor._so = m_infer_request._so;
     if (std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr)) {
-        auto remote_context = std::dynamic_pointer_cast<ov::proxy::RemoteContext>(m_compiled_model->get_context()._ptr);
-        OPENVINO_ASSERT(remote_context);
-        tensor = remote_context->wrap_tensor(tensor);
+        tensor = get_wrap_context()->wrap_tensor(tensor);
     }
     return tensor;
 }
@@ -69,10 +78,7 @@ std::vector<ov::SoPtr<ov::ITensor>> ov::proxy::InferRequest::get_tensors(const o
         if (!tensor._so)
             tensor._so = m_infer_request._so;
         if (std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr)) {
-            auto remote_context =
-                std::dynamic_pointer_cast<ov::proxy::RemoteContext>(m_compiled_model->get_context()._ptr);
-            OPENVINO_ASSERT(remote_context);
-            tensor = remote_context->wrap_tensor(tensor);
+            tensor = get_wrap_context()->wrap_tensor(tensor);
         }
     }
     return tensors;
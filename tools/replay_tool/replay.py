@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# Copyright (C) 2018-2024 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""Replays an inference sequence captured with OV_REPLAY_CAPTURE against a model.
+
+The capture log records the input shape signature and the timing of every inference of a
+process (no tensor data), so a production p99 stall can be reproduced on a test machine:
+
+    OV_REPLAY_CAPTURE=/tmp/seq.ovrp ./production_app ...
+    python3 replay.py /tmp/seq.ovrp -m model.xml -d CPU --timing
+"""
+
+import argparse
+import statistics
+import struct
+import sys
+import time
+
+import numpy as np
+from openvino.runtime import Core
+
+MAGIC = b"OVRP"
+SUPPORTED_VERSION = 1
+
+# element type names as written by ov::element::Type::get_type_name()
+DTYPES = {
+    "boolean": np.bool_,
+    "bf16": np.uint16,  # raw bit pattern, random data only
+    "f16": np.float16,
+    "f32": np.float32,
+    "f64": np.float64,
+    "i8": np.int8,
+    "i16": np.int16,
+    "i32": np.int32,
+    "i64": np.int64,
+    "u8": np.uint8,
+    "u16": np.uint16,
+    "u32": np.uint32,
+    "u64": np.uint64,
+}
+
+
+def read_log(path):
+    """Returns a list of records: (start_ns, end_ns, [(type_name, shape), ...])."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != MAGIC:
+        sys.exit(f"{path}: not a replay capture log")
+    (version,) = struct.unpack_from("<I", data, 4)
+    if version != SUPPORTED_VERSION:
+        sys.exit(f"{path}: unsupported capture version {version}")
+    records = []
+    offset = 8
+    while offset < len(data):
+        start_ns, end_ns, n_inputs = struct.unpack_from("<QQI", data, offset)
+        offset += 20
+        inputs = []
+        for _ in range(n_inputs):
+            (name_len,) = struct.unpack_from("<B", data, offset)
+            offset += 1
+            type_name = data[offset:offset + name_len].decode()
+            offset += name_len
+            (rank,) = struct.unpack_from("<I", data, offset)
+            offset += 4
+            shape = struct.unpack_from(f"<{rank}Q", data, offset) if rank else ()
+            offset += 8 * rank
+            inputs.append((type_name, tuple(shape)))
+        records.append((start_ns, end_ns, inputs))
+    return records
+
+
+def make_tensors(inputs, rng):
+    tensors = []
+    for type_name, shape in inputs:
+        dtype = DTYPES.get(type_name)
+        if dtype is None:
+            sys.exit(f"cannot generate data for element type '{type_name}'")
+        if np.issubdtype(dtype, np.floating):
+            tensors.append(rng.random(shape, dtype=np.float32).astype(dtype))
+        else:
+            tensors.append(rng.integers(0, 2, size=shape).astype(dtype))
+    return tensors
+
+
+def percentile(values, boundary):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(len(ordered) / 100.0 * boundary))]
+
+
+def report(name, latencies_ms):
+    print(f"{name}: count {len(latencies_ms)}, "
+          f"avg {statistics.mean(latencies_ms):.3f} ms, "
+          f"median {percentile(latencies_ms, 50):.3f} ms, "
+          f"p99 {percentile(latencies_ms, 99):.3f} ms, "
+          f"max {max(latencies_ms):.3f} ms")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", help="capture log written via OV_REPLAY_CAPTURE")
+    parser.add_argument("-m", "--model", required=True, help="model file (.xml or .onnx)")
+    parser.add_argument("-d", "--device", default="CPU", help="target device (default: CPU)")
+    parser.add_argument("--timing", action="store_true",
+                        help="pace the requests with the recorded inter-arrival gaps "
+                             "instead of issuing them back to back")
+    parser.add_argument("--loops", type=int, default=1, help="number of passes over the sequence")
+    parser.add_argument("--seed", type=int, default=0, help="random data seed")
+    args = parser.parse_args()
+
+    records = read_log(args.log)
+    if not records:
+        sys.exit(f"{args.log}: no records")
+    report("recorded", [(end - start) / 1e6 for start, end, _ in records])
+
+    core = Core()
+    compiled = core.compile_model(args.model, args.device)
+    request = compiled.create_infer_request()
+    rng = np.random.default_rng(args.seed)
+
+    latencies_ms = []
+    for _ in range(args.loops):
+        first_start_ns = records[0][0]
+        replay_begin = time.perf_counter()
+        for start_ns, _, inputs in records:
+            if args.timing:
+                offset_s = (start_ns - first_start_ns) / 1e9
+                sleep_s = offset_s - (time.perf_counter() - replay_begin)
+                if sleep_s > 0:
+                    time.sleep(sleep_s)
+            tensors = make_tensors(inputs, rng)
+            begin = time.perf_counter()
+            request.infer(tensors)
+            latencies_ms.append((time.perf_counter() - begin) * 1e3)
+    report("replayed", latencies_ms)
+
+
+if __name__ == "__main__":
+    main()